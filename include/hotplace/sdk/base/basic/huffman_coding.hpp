@@ -0,0 +1,231 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_BASE_BASIC_HUFFMAN__
+#define __HOTPLACE_SDK_BASE_BASIC_HUFFMAN__
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <sdk/base/basic/types.hpp>
+#include <sdk/base/nostd/range.hpp>
+#include <sdk/base/nostd/tree.hpp>
+#include <sdk/base/pattern/trie.hpp>
+#include <vector>
+
+#define SWITCH_HUFFMANCODING_TRIE 1
+
+namespace hotplace {
+
+/*
+ * @brief   huffman codes
+ * @refer   Data Structures and Algorithm Analysis in C++ - 10.1.2 Huffman Codes
+ *          Data Structures & Algorithms in C++ - 12.4.1 The Huffman-Coding Algorithm
+ *          https://asecuritysite.com/calculators/huff
+ * @sample
+ *          huffman_coding huff;
+ *          // method.1 - learn huffman codes from stream
+ *          huff.load(sample).learn().infer();
+ *          // method.2 - load from pre-trained codes
+ *          huff.imports(_h2hcodes);
+ */
+
+class huffman_coding {
+   private:
+    struct hc_t {
+        uint8 symbol;
+        size_t weight;
+        uint32 flags;
+
+        hc_t() : symbol(0), weight(0), flags(0) {}
+        hc_t(uint8 b) : symbol(b), weight(0), flags(0) {}
+        hc_t(uint8 b, size_t f) : symbol(b), weight(f), flags(0) {}
+        hc_t(const hc_t &rhs) : symbol(rhs.symbol), weight(rhs.weight), flags(rhs.flags) {}
+        bool operator<(const hc_t &rhs) const { return symbol < rhs.symbol; }
+    };
+    struct hc_comparator : t_comparator_base<hc_t> {
+        bool operator()(const hc_t &lhs, const hc_t &rhs) const {
+            bool ret = false;
+
+            if (lhs.weight < rhs.weight) {
+                ret = true;
+            } else if (lhs.weight == rhs.weight) {
+                if (lhs.flags < rhs.flags) {
+                    ret = true;
+                } else {
+                    ret = lhs.symbol < rhs.symbol;
+                }
+            }
+
+            return ret;
+        }
+    };
+    struct hc_temp {
+        size_t depth;
+        std::string code;
+
+        hc_temp() : depth(0) {}
+    };
+    struct hc_code {
+        uint8 sym;
+        const char *code;
+    };
+
+    typedef t_btree<hc_t> measure_tree_t;          // counting
+    typedef t_btree<hc_t, hc_comparator> btree_t;  // by weight(frequency)
+    typedef std::map<hc_t, typename btree_t::node_t *, hc_comparator> map_t;
+    typedef std::pair<typename map_t::iterator, bool> map_pib_t;
+    typedef std::map<uint8, std::string> codetable_t;
+    typedef std::map<std::string, uint8> reverse_codetable_t;
+
+    typedef typename btree_t::node_t node_t;
+    typedef typename std::function<void(hc_t const &t)> const_visitor;
+    typedef typename std::function<void(hc_t &t)> visitor;
+    typedef typename std::function<void(hc_t &t, const hc_t &lhs, const hc_t &rhs)> learn_visitor;
+
+   public:
+    typedef hc_code hc_code_t;
+
+    huffman_coding();
+    ~huffman_coding();
+
+    void reset();
+
+    huffman_coding &operator<<(const char *s);
+    huffman_coding &load(const char *s);
+    huffman_coding &learn();
+    huffman_coding &infer();
+
+    /**
+     * @brief   import pre-trained codes
+     * @sample
+     *          const huffman_coding::hc_code_t _h2hcodes[] = {
+     *              { 1, "11111111111111111011000" },
+     *              { 2, "1111111111111111111111100010" },
+     *              // ...
+     *              { 0, nullptr },
+     *          };
+     *
+     *          huffman_coding huff;
+     *          huff.imports(_h2hcodes);
+     */
+    huffman_coding &imports(const hc_code_t *table);
+    /**
+     * @brief   export hufman codes
+     * @sample
+     *          auto lambda_exports = [](uint8 sym, const char* code) -> void {
+     *              printf("sym %c (0x%02x) %s (%zi)\n", isprint(sym) ? sym : '?', sym, code, strlen(code));
+     *          };
+     *          huffman_coding huff;
+     *          huff.imports(_h2hcodes).exports(lambda_exports);
+     */
+    huffman_coding &exports(std::function<void(uint8, const char *)> v);
+
+    return_t expect(const char *source, size_t &size_expected) const;
+    return_t expect(const char *source, size_t size, size_t &size_expected) const;
+    return_t expect(const byte_t *source, size_t size, size_t &size_expected) const;
+
+    /*
+     * @brief   encode
+     * @sample
+     *          const char* sample = "www.example.com";
+     *          binary_t bin;
+     *          huff.encode(bin, (byte_t*)sample, strlen(sample));
+     *          // f1 e3 c2 e5 f2 3a 6b a0 ab 90 f4 ff
+     */
+    return_t encode(binary_t &bin, const char *source, size_t size, bool usepad = true) const;
+    return_t encode(binary_t &bin, const byte_t *source, size_t size, bool usepad = true) const;
+    /*
+     * @brief   encode
+     * @sample
+     *          const char* sample = "www.example.com";
+     *          basic_stream bs;
+     *          huff.encode(&bs, (byte_t*)sample, strlen(sample));
+     *          printf("%s\n", bs.c_str());
+     *
+     */
+    return_t encode(stream_t *stream, const char *source, size_t size) const;
+    return_t encode(stream_t *stream, const byte_t *source, size_t size) const;
+    /**
+     * @brief   decode
+     * @remarks constraints : min(code len in bits) >= 5
+     *
+     *          huff.imports(_h2hcodes);  // RFC 7541 Appendix B. Huffman Code
+     *          huff.encode(...);
+     *          huff.decode(...);
+     */
+    return_t decode(stream_t *stream, const byte_t *source, size_t size) const;
+
+    /**
+     * @brief   check min(code len in bits) >= 5
+     */
+    bool decodable();
+    /**
+     * @brief   bit-packed encoder and 4-bit state table decoder (default true)
+     * @remarks
+     *          false - bitstring encoder and trie decoder (see SWITCH_HUFFMANCODING_TRIE), for comparison
+     *          codes longer than 32 bits are always handled by the bitstring/trie implementation
+     */
+    huffman_coding &set_packed(bool enable);
+
+    size_t sizeof_codetable();
+
+   protected:
+    node_t *build(node_t **root = nullptr);
+    void build(typename btree_t::node_t *&p);
+    void infer(hc_temp &hc, typename btree_t::node_t *t);
+
+    /**
+     * @brief   build _packed and _decode_table from _codetable
+     * @remarks
+     *          _decode_table[state << 4 | nibble], a state is an internal node of the code tree (root 0)
+     *          min(code len in bits) >= 5, so a nibble emits a symbol at most once
+     */
+    void build_table();
+    bool packed() const;
+    return_t encode_packed(binary_t &bin, const byte_t *source, size_t size, bool usepad) const;
+    return_t decode_packed(stream_t *stream, const byte_t *source, size_t size) const;
+
+   private:
+    struct packed_code_t {
+        uint32 code;  // LSB aligned
+        uint8 bits;   // 0 if not in the code table
+    };
+    enum decode_flag_t {
+        decode_emit = 1,    // symbol
+        decode_fail = 2,    // no such code
+        decode_accept = 4,  // all 1s so far, a valid padding (EOS prefix)
+    };
+    struct decode_entry_t {
+        uint16 state;
+        uint8 flags;
+        uint8 symbol;
+    };
+
+    measure_tree_t _measure;
+    btree_t _btree;
+    map_t _m;
+    codetable_t _codetable;
+#if SWITCH_HUFFMANCODING_TRIE == 0
+    reverse_codetable_t _reverse_codetable;
+#else
+    t_trie<char> _trie;
+    t_range<size_t> _range;
+#endif
+    bool _packed_enable;
+    bool _packed_ready;
+    packed_code_t _packed[256];
+    std::vector<decode_entry_t> _decode_table;
+};
+
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,25 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_BASE_BASIC_TYPES__
+#define __HOTPLACE_SDK_BASE_BASIC_TYPES__
+
+#include <sdk/base/callback.hpp>
+#include <sdk/base/charset.hpp>
+#include <sdk/base/error.hpp>
+#include <sdk/base/inline.hpp>
+#include <sdk/base/stream.hpp>
+#include <sdk/base/syntax.hpp>
+#include <sdk/base/template.hpp>
+#include <sdk/base/trace.hpp>
+#include <sdk/base/types.hpp>
+
+#endif
@@ -0,0 +1,14 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_BASE_CPP14__
+#define __HOTPLACE_SDK_BASE_CPP14__
+#include <sdk/base/basic/constexpr_obfuscate.hpp>
+#endif
@@ -0,0 +1,24 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_BASE_SYSTEM_LINUX_DEBUGTRACE__
+#define __HOTPLACE_SDK_BASE_SYSTEM_LINUX_DEBUGTRACE__
+
+#include <pthread.h>
+
+#include <sdk/base/system/thread.hpp>
+
+namespace hotplace {
+
+return_t debug_trace(stream_t* stream);
+
+}  // namespace hotplace
+
+#endif
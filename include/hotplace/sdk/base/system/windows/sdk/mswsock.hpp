@@ -0,0 +1,18 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_BASE_SYSTEM_WINDOWS_SDK_MSWSOCK__
+#define __HOTPLACE_SDK_BASE_SYSTEM_WINDOWS_SDK_MSWSOCK__
+
+#if defined _WINSOCK2API_
+
+#endif
+
+#endif
@@ -0,0 +1,430 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_IO_BASIC_SHARDEDMLFQ__
+#define __HOTPLACE_SDK_IO_BASIC_SHARDEDMLFQ__
+
+#include <atomic>
+#include <sdk/base/error.hpp>
+#include <sdk/base/syntax.hpp>
+#include <sdk/base/system/semaphore.hpp>
+#include <sdk/base/types.hpp>
+#include <sdk/io/basic/mlfq.hpp>
+#include <thread>
+#include <vector>
+
+namespace hotplace {
+namespace io {
+
+/**
+ * @brief   bounded MPMC ring (sequence numbered slots, no lock)
+ * @param   typename TYPENAME_T [IN] element type (stored as a pointer)
+ * @remarks
+ *          capacity is rounded up to a power of two
+ *          a slot is emptied by exchanging nullptr, so a cancelled slot reads nullptr
+ */
+template <typename TYPENAME_T>
+class t_mpmc_ring {
+   public:
+    t_mpmc_ring(size_t capacity = 1024);
+    ~t_mpmc_ring();
+
+    /**
+     * @brief   enqueue
+     * @return  false if full
+     */
+    bool enqueue(TYPENAME_T* source);
+    /**
+     * @brief   dequeue
+     * @param   TYPENAME_T** source [OUT] nullptr if the slot was cancelled
+     * @return  false if empty
+     */
+    bool dequeue(TYPENAME_T** source);
+    /**
+     * @brief   replace all pending source with nullptr
+     * @return  number of slots cancelled
+     */
+    size_t cancel(TYPENAME_T* source);
+
+   protected:
+    struct slot_t {
+        std::atomic<size_t> sequence;
+        std::atomic<TYPENAME_T*> data;
+    };
+
+   private:
+    // producers and consumers update different cache lines
+    char _pad0[64];
+    std::atomic<size_t> _enqueue_pos;
+    char _pad1[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> _dequeue_pos;
+    char _pad2[64 - sizeof(std::atomic<size_t>)];
+    slot_t* _slots;
+    size_t _mask;
+};
+
+template <typename TYPENAME_T>
+t_mpmc_ring<TYPENAME_T>::t_mpmc_ring(size_t capacity) : _enqueue_pos(0), _dequeue_pos(0), _slots(nullptr), _mask(0) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    _slots = new slot_t[size];
+    for (size_t i = 0; i < size; i++) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+        _slots[i].data.store(nullptr, std::memory_order_relaxed);
+    }
+    _mask = size - 1;
+}
+
+template <typename TYPENAME_T>
+t_mpmc_ring<TYPENAME_T>::~t_mpmc_ring() {
+    delete[] _slots;
+}
+
+template <typename TYPENAME_T>
+bool t_mpmc_ring<TYPENAME_T>::enqueue(TYPENAME_T* source) {
+    slot_t* slot = nullptr;
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        slot = &_slots[pos & _mask];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (0 == dif) {
+            if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            return false;  // full
+        } else {
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->data.store(source, std::memory_order_relaxed);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename TYPENAME_T>
+bool t_mpmc_ring<TYPENAME_T>::dequeue(TYPENAME_T** source) {
+    slot_t* slot = nullptr;
+    size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        slot = &_slots[pos & _mask];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (0 == dif) {
+            if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            return false;  // empty
+        } else {
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    *source = slot->data.exchange(nullptr, std::memory_order_acq_rel);
+    slot->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename TYPENAME_T>
+size_t t_mpmc_ring<TYPENAME_T>::cancel(TYPENAME_T* source) {
+    size_t count = 0;
+    for (size_t i = 0; i <= _mask; i++) {
+        TYPENAME_T* expected = source;
+        if (_slots[i].data.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief   sharded MFQ
+ * @param   typename TYPENAME_T [IN] Queue
+ * @param   typename BINDER_T [INOPT] binder member manipulates the semaphore operation (p and v).
+ *                                    default mlfq_shared_binder<TYPENAME_T>
+ * @remarks
+ *          same interface as t_mlfq, without a lock
+ *
+ *          each shard has a bounded t_mpmc_ring per priority level
+ *          a thread posts into its own shard and gets from its own shard first, then steals from the others
+ *          greater number mean more priority, priority is clamped into [0, levels)
+ *          cancel replaces the pending slots with nullptr instead of maintaining a workingset
+ *
+ *          post returns errorcode_t::full if every shard is full at the given priority
+ */
+template <typename TYPENAME_T, typename BINDER_T = mlfq_shared_binder<TYPENAME_T> >
+class t_sharded_mlfq {
+   public:
+    /**
+     * @brief   constructor
+     * @param   size_t shards   [INOPT] 0 hardware concurrency
+     * @param   size_t levels   [INOPT] priority levels
+     * @param   size_t capacity [INOPT] ring capacity per shard per level
+     */
+    t_sharded_mlfq(size_t shards = 0, size_t levels = 8, size_t capacity = 1024);
+    ~t_sharded_mlfq();
+
+    /**
+     * @brief post
+     * @param   int pri [IN] priority
+     * @param   TYPENAME_T* source  [IN] internally increase reference counter, cannot be null
+     * @param   void* param [IN] see binder(..., void* param)
+     * @return error code (see error.hpp)
+     */
+    return_t post(int pri, TYPENAME_T* source, void* param = nullptr);
+    return_t push(int pri, TYPENAME_T* source, void* param = nullptr);
+    t_sharded_mlfq& operator<<(TYPENAME_T* source);
+    /**
+     * @brief   get
+     * @param   int*          pri     [IN]
+     * @param   TYPENAME_T**  source  [OUT]
+     * @param   uint32         msecs   [IN]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::success
+     *          errorcode_t::not_ready no data
+     *          errorcode_t::canceled/errorcode_t::not_found canceled or woken up
+     */
+    return_t get(int* pri, TYPENAME_T** source, uint32 msecs);
+    return_t pop(int* pri, TYPENAME_T** source, uint32 msecs);
+
+    return_t cancel(TYPENAME_T* source, void* param);
+    return_t wakeup();
+    return_t clear(void* param);
+    return_t set(int mode, int value);
+
+    size_t size();
+
+   protected:
+    typedef t_mpmc_ring<TYPENAME_T> ring_t;
+
+    size_t home();
+    ring_t* ring(size_t shard, size_t level);
+
+   private:
+    BINDER_T _binder;
+    semaphore _semaphore;
+    size_t _shards;
+    size_t _levels;
+    std::vector<ring_t*> _rings;
+    std::atomic<size_t> _size;
+    std::atomic<size_t> _next_home;
+    std::atomic<int> _block;
+};
+
+template <typename TYPENAME_T, typename BINDER_T>
+t_sharded_mlfq<TYPENAME_T, BINDER_T>::t_sharded_mlfq(size_t shards, size_t levels, size_t capacity)
+    : _shards(shards), _levels(levels), _size(0), _next_home(0), _block(-1) {
+    if (0 == _shards) {
+        _shards = std::thread::hardware_concurrency();
+    }
+    if (0 == _shards) {
+        _shards = 1;
+    }
+    if (0 == _levels) {
+        _levels = 1;
+    }
+    for (size_t i = 0; i < _shards * _levels; i++) {
+        _rings.push_back(new ring_t(capacity));
+    }
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+t_sharded_mlfq<TYPENAME_T, BINDER_T>::~t_sharded_mlfq() {
+    clear(nullptr);
+    for (auto item : _rings) {
+        delete item;
+    }
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+size_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::home() {
+    // per thread, assigned at first use
+    static thread_local size_t _home = (size_t)-1;
+    if ((size_t)-1 == _home) {
+        _home = _next_home.fetch_add(1, std::memory_order_relaxed);
+    }
+    return _home % _shards;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+typename t_sharded_mlfq<TYPENAME_T, BINDER_T>::ring_t* t_sharded_mlfq<TYPENAME_T, BINDER_T>::ring(size_t shard, size_t level) {
+    return _rings[(shard * _levels) + level];
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::post(int pri, TYPENAME_T* source, void* param) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == source) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (0 == _block.load(std::memory_order_relaxed)) {
+            ret = errorcode_t::blocked;
+            __leave2;
+        }
+
+        size_t level = (pri < 0) ? 0 : ((size_t)pri >= _levels ? _levels - 1 : (size_t)pri);
+
+        _binder.binder(mlfq_binder_operation_t::binder_v, source, param);  // reference counter ++
+        _size.fetch_add(1, std::memory_order_relaxed);
+
+        ret = errorcode_t::full;
+        size_t shard = home();
+        for (size_t i = 0; i < _shards; i++) {
+            if (ring((shard + i) % _shards, level)->enqueue(source)) {
+                ret = errorcode_t::success;
+                break;
+            }
+        }
+
+        if (errorcode_t::success == ret) {
+            _semaphore.signal();
+        } else {
+            _size.fetch_sub(1, std::memory_order_relaxed);
+            _binder.binder(mlfq_binder_operation_t::binder_p, source, param);  // reference counter --
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::push(int pri, TYPENAME_T* source, void* param) {
+    return post(pri, source, param);
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+t_sharded_mlfq<TYPENAME_T, BINDER_T>& t_sharded_mlfq<TYPENAME_T, BINDER_T>::operator<<(TYPENAME_T* source) {
+    post(0, source, nullptr);
+    return *this;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::get(int* pri, TYPENAME_T** source, uint32 timeout) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == pri || nullptr == source) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        *source = nullptr;
+
+        uint32 wait = _semaphore.wait(timeout);
+        if (0 != wait) {
+            ret = errorcode_t::not_ready;
+            __leave2;
+        }
+
+        ret = errorcode_t::not_found;
+        size_t shard = home();
+        bool found = false;
+        while (false == found) {
+            // greater number mean more priority
+            for (size_t level = _levels; (false == found) && (level > 0); level--) {
+                for (size_t i = 0; i < _shards; i++) {
+                    TYPENAME_T* object = nullptr;
+                    if (ring((shard + i) % _shards, level - 1)->dequeue(&object)) {
+                        _size.fetch_sub(1, std::memory_order_relaxed);
+                        if (nullptr == object) {
+                            ret = errorcode_t::canceled;
+                        } else {
+                            ret = errorcode_t::success;
+                            *pri = (int)(level - 1);
+                            *source = object;
+                        }
+                        found = true;
+                        break;
+                    }
+                }
+            }
+            if ((false == found) && (0 == _size.load(std::memory_order_relaxed))) {
+                break;  // woken up without post
+            }
+            if (false == found) {
+                std::this_thread::yield();  // a post is being published
+            }
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::pop(int* pri, TYPENAME_T** source, uint32 timeout) {
+    return get(pri, source, timeout);
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::cancel(TYPENAME_T* source, void* param) {
+    return_t ret = errorcode_t::success;
+    for (auto item : _rings) {
+        size_t count = item->cancel(source);
+        while (count--) {
+            _binder.binder(mlfq_binder_operation_t::binder_p, source, param);  // reference counter --
+        }
+    }
+    return ret;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::wakeup() {
+    return _semaphore.signal();
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::clear(void* param) {
+    return_t ret = errorcode_t::success;
+    for (auto item : _rings) {
+        TYPENAME_T* source = nullptr;
+        while (item->dequeue(&source)) {
+            _size.fetch_sub(1, std::memory_order_relaxed);
+            if (source) {
+                _binder.binder(mlfq_binder_operation_t::binder_p, source, param);  // reference counter --
+            }
+            // no signals to handler
+        }
+    }
+    return ret;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::set(int mode, int value) {
+    return_t ret = errorcode_t::success;
+    switch (mode) {
+        case mlfq_mode_t::mlfq_block:
+            _block.store(value, std::memory_order_relaxed);
+            break;
+        default:
+            break;
+    }
+    return ret;
+}
+
+template <typename TYPENAME_T, typename BINDER_T>
+size_t t_sharded_mlfq<TYPENAME_T, BINDER_T>::size() {
+    return _size.load(std::memory_order_relaxed);
+}
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
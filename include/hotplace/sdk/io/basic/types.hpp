@@ -0,0 +1,27 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_IO_BASIC_TYPES__
+#define __HOTPLACE_SDK_IO_BASIC_TYPES__
+
+#include <sdk/io/types.hpp>
+
+namespace hotplace {
+namespace io {
+
+class parser;
+class payload_encoded;
+class payload_member;
+class payload;
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
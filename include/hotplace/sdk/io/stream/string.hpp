@@ -0,0 +1,29 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_IO_STREAM_STRING__
+#define __HOTPLACE_SDK_IO_STREAM_STRING__
+
+#include <ostream>
+#include <sdk/base/charset.hpp>
+#include <sdk/base/error.hpp>
+#include <sdk/base/syntax.hpp>
+#include <sdk/base/types.hpp>
+#include <sdk/io/stream/stream.hpp>
+
+namespace hotplace {
+namespace io {
+
+//
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
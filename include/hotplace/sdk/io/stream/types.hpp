@@ -0,0 +1,25 @@
+
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_IO_STREAM_TYPES__
+#define __HOTPLACE_SDK_IO_STREAM_TYPES__
+
+#include <sdk/io/types.hpp>
+
+namespace hotplace {
+namespace io {
+
+class file_stream;
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
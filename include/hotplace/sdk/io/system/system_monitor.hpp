@@ -0,0 +1,28 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file    {file}
+ * @author  Soo Han, Kim (princeb612.kr@gmail.com)
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_IO_SYSTEM_SYSMON__
+#define __HOTPLACE_SDK_IO_SYSTEM_SYSMON__
+
+#include <sdk/base/charset.hpp>
+#include <sdk/base/error.hpp>
+#include <sdk/base/syntax.hpp>
+#include <sdk/base/types.hpp>
+#include <sdk/io/system/types.hpp>
+
+namespace hotplace {
+namespace io {
+
+//
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,196 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_BASIC_SERVERSOCKET__
+#define __HOTPLACE_SDK_NET_BASIC_SERVERSOCKET__
+
+#include <sdk/net/basic/socket/basic_socket.hpp>
+
+namespace hotplace {
+namespace net {
+
+class server_socket : public basic_socket {
+   public:
+    server_socket() : basic_socket() {}
+    virtual ~server_socket() {}
+
+    /**
+     * @brief   listen
+     * @param   socket_t*       sock            [OUT] listen socket
+     * @param   unsigned int    family          [IN] AF_INET, AF_INET6
+     * @param   uint16          port            [IN]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t open(socket_t* sock, unsigned int family, uint16 port) { return errorcode_t::success; }
+    /**
+     * @brief   accept
+     * @param   socket_t        sock            [IN] listen socket
+     * @param   socket_t*       clisock         [OUT] client socket
+     * @param   struct sockaddr* addr           [OUT]
+     * @param   socklen_t*      addrlen         [IN]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t accept(socket_t sock, socket_t* clisock, struct sockaddr* addr, socklen_t* addrlen) { return errorcode_t::success; }
+    /**
+     * @brief   DTLS
+     */
+    virtual return_t dtls_open(tls_context_t** tls_handle, socket_t sock) { return errorcode_t::success; }
+    /**
+     * @brief   handshake
+     * @param   tls_context_t* handle [in]
+     * @param   sockaddr* addr [inopt]
+     * @param   socklen_t addrlen [in]
+     */
+    virtual return_t dtls_handshake(tls_context_t* handle, sockaddr* addr, socklen_t addrlen) { return errorcode_t::success; }
+    /**
+     * @brief   tls accept
+     * @param   socket_t        clisock         [IN] client socket
+     * @param   tls_context_t** tls_handle      [OUT] Tls context
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          do nothing, return errorcode_t::success
+     */
+    virtual return_t tls_accept(socket_t clisock, tls_context_t** tls_handle) { return errorcode_t::not_supported; }
+    /**
+     * @brief   non-blocking tls accept
+     * @param   socket_t        clisock         [IN] client socket
+     * @param   tls_context_t** tls_handle      [OUT] Tls context
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          see tls_accept_continue
+     */
+    virtual return_t tls_accept_begin(socket_t clisock, tls_context_t** tls_handle) { return errorcode_t::not_supported; }
+    /**
+     * @brief   progress a tls accept without blocking
+     * @param   tls_context_t*  tls_handle      [IN] Tls context
+     * @param   uint32*         wait            [OUT] see SOCK_WAIT_FLAGS
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    call again when the socket is ready
+     */
+    virtual return_t tls_accept_continue(tls_context_t* tls_handle, uint32* wait) { return errorcode_t::not_supported; }
+    /**
+     * @brief   tls_stop_accept
+     */
+    virtual return_t tls_stop_accept() { return errorcode_t::success; }
+    /**
+     * @brief   read
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   int             mode            [IN] ignore, it defines operation mode. see also transport_layer_security_server.
+     * @param   char*           ptr_data        [OUT]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbread          [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          ERROR_CONNECTION_CLOSED
+     */
+    virtual return_t read(socket_t sock, tls_context_t* tls_handle, int mode, char* ptr_data, size_t size_data, size_t* cbread) { return errorcode_t::success; }
+    /**
+     * @brief   recvfrom
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   int             mode            [IN] ignore, it defines operation mode. see also transport_layer_security_server.
+     * @param   char*           ptr_data        [OUT]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbread          [OUT]
+     * @param   struct sockaddr* addr           [out]
+     * @param   socklen_t*      addrlen         [in]
+     * @return  error code (see error.hpp)
+     * @remarks
+     */
+    virtual return_t recvfrom(socket_t sock, tls_context_t* tls_handle, int mode, char* ptr_data, size_t size_data, size_t* cbread, struct sockaddr* addr,
+                              socklen_t* addrlen) {
+        return errorcode_t::success;
+    }
+    /**
+     * @brief   receive datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [INOUT] ptr, bufsize [IN] size, segment, addr, addrlen [OUT]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT] number of datagrams received
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          does not block
+     */
+    virtual return_t recvmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) { return errorcode_t::not_supported; }
+    /**
+     * @brief   send
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const char*     ptr_data        [IN]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent) { return errorcode_t::success; }
+    /**
+     * @brief   send
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const char*     ptr_data        [IN]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @param   const struct sockaddr* addr     [in]
+     * @param   socklen_t       addrlen         [in]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t sendto(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent, const struct sockaddr* addr,
+                            socklen_t addrlen) {
+        return errorcode_t::success;
+    }
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const sendbuf_t* bufs           [IN] ptr, size
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          the pieces are not copied into a contiguous buffer
+     */
+    virtual return_t sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent) {
+        return errorcode_t::not_supported;
+    }
+    /**
+     * @brief   send a file
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   handle_t        fd              [IN] file
+     * @param   uint64          offset          [IN]
+     * @param   size_t          size            [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  TLS, the caller sends the content
+     * @remarks
+     *          [linux] sendfile, the content is not copied into the user space
+     */
+    virtual return_t sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent) {
+        return errorcode_t::not_supported;
+    }
+    /**
+     * @brief   send datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [IN] ptr, size, segment, addr, addrlen
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT] number of datagrams sent
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t sendmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) { return errorcode_t::not_supported; }
+
+   protected:
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
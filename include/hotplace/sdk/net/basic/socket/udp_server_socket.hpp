@@ -0,0 +1,112 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_BASIC_UDPSERVERSOCKET__
+#define __HOTPLACE_SDK_NET_BASIC_UDPSERVERSOCKET__
+
+#include <sdk/net/basic/socket/server_socket.hpp>
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   udp_server_socket
+ * @sa      class dtls_server_socket : public udp_server_socket
+ */
+class udp_server_socket : public server_socket {
+   public:
+    udp_server_socket();
+
+    /**
+     * @brief   open
+     * @param   socket_t*       sock            [OUT] listen socket
+     * @param   unsigned int    family          [IN] AF_INET, AF_INET6
+     * @param   uint16          port            [IN]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t open(socket_t* sock, unsigned int family, uint16 port);
+    /**
+     * @brief   close
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          tls_svr_sock.accept(listen_socket, &cli_socket, &tls_context, &sockaddr, &sockaddrlen);
+     *          // client connection established...
+     *          // ...
+     *          // socket closed
+     *          tls_svr_sock.close(cli_socket, tls_context);
+     */
+    virtual return_t close(socket_t sock, tls_context_t* tls_handle);
+    /**
+     * @brief   read
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   int             mode            [IN] ignore, it defines operation mode. see also transport_layer_security_server.
+     * @param   char*           ptr_data        [OUT]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbread          [OUT]
+     * @param   struct sockaddr* addr           [out]
+     * @param   socklen_t*      addrlen         [in]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          ERROR_CONNECTION_CLOSED
+     */
+    virtual return_t recvfrom(socket_t sock, tls_context_t* tls_handle, int mode, char* ptr_data, size_t size_data, size_t* cbread, struct sockaddr* addr,
+                              socklen_t* addrlen);
+    /**
+     * @brief   receive datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [INOUT]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] recvmmsg(MSG_DONTWAIT), a single syscall
+     *                  if UDP_GRO is enabled, dgram_t::segment is the size of coalesced segments
+     *          [windows] recvfrom
+     */
+    virtual return_t recvmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount);
+    /**
+     * @brief   send
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const char*     ptr_data        [IN]
+     * @param   size_t          size_data       [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @param   const struct sockaddr* addr     [in]
+     * @param   socklen_t       addrlen         [in]
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t sendto(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent, const struct sockaddr* addr,
+                            socklen_t addrlen);
+    /**
+     * @brief   send datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [IN]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] sendmmsg
+     *                  if dgram_t::segment is set, UDP_SEGMENT (GSO) splits a datagram into segments
+     *          [windows] sendto
+     */
+    virtual return_t sendmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount);
+
+    virtual int socket_type();
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
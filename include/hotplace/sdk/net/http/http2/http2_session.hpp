@@ -0,0 +1,216 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_HTTP2_SESSION__
+#define __HOTPLACE_SDK_NET_HTTP_HTTP2_SESSION__
+
+#include <list>
+#include <sdk/base/charset.hpp>
+#include <sdk/base/error.hpp>
+#include <sdk/base/syntax.hpp>
+#include <sdk/base/types.hpp>
+#include <sdk/net/http/http2/hpack.hpp>   // hpack_dynamic_table
+#include <sdk/net/http/http_request.hpp>  // http_request
+#include <sdk/net/http/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+class http2_session {
+   public:
+    http2_session();
+
+    /**
+     * @brief   consume
+     * @param   uint32 type [in]
+     * @param   uint32 data_count [in]
+     * @param   void* data_array[] [in]
+     * @param   http_server* server [in]
+     * @param   http_request** request [outopt] can be nullptr if END_HEADERS, END_STREAM is not set
+     */
+    http2_session& consume(uint32 type, uint32 data_count, void* data_array[], http_server* server, http_request** request);
+
+    hpack_dynamic_table& get_hpack_session();
+
+    /**
+     * @brief   enable push
+     * @remarks
+     *          RFC 7540 6.5.2.  Defined SETTINGS Parameters
+     *            SETTINGS_ENABLE_PUSH (0x2):
+     *              This setting can be used to disable server push (Section 8.2).
+     *              An endpoint MUST NOT send a PUSH_PROMISE frame if it receives this parameter set to a value of 0.
+     */
+    http2_session& enable_push(bool enable);
+    bool is_push_enabled();
+
+    /**
+     * @brief   send a response under flow control
+     * @param   network_session* session [in]
+     * @param   uint32 stream_id [in]
+     * @param   const binary_t& headers [in] HEADERS (ALTSVC) frames, sent at once
+     * @param   binary_t& content [in] DATA payload (moved into the stream queue)
+     * @param   bool end_stream [in] END_STREAM is set in HEADERS (no DATA follows)
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          RFC 9113 5.2.  Flow Control
+     *          RFC 9113 6.9.  WINDOW_UPDATE
+     *
+     *          DATA frames are fragmented by SETTINGS_MAX_FRAME_SIZE and sent within the send window (connection and stream)
+     *          the rest is queued and sent when WINDOW_UPDATE arrives (see consume)
+     */
+    return_t send(network_session* session, uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream);
+    /**
+     * @brief   queue a response and write the frames to be sent
+     * @param   uint32 stream_id [in]
+     * @param   const binary_t& headers [in]
+     * @param   binary_t& content [in]
+     * @param   bool end_stream [in]
+     * @param   binary_t& frames [out] appended
+     * @return  error code (see error.hpp)
+     * @sa      send
+     */
+    return_t write(uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream, binary_t& frames);
+    /**
+     * @brief   send a chunk of a response under flow control (generated content)
+     * @param   network_session* session [in]
+     * @param   uint32 stream_id [in]
+     * @param   const binary_t& headers [in] HEADERS (ALTSVC) frames with the first chunk, empty after
+     * @param   binary_t& content [in] appended to the DATA payload queued
+     * @param   bool end_stream [in] the last chunk, END_STREAM is set in the last DATA frame
+     * @return  error code (see error.hpp)
+     *          already_exist   a response (send) is in progress
+     * @remarks
+     *          the stream is kept open until the last chunk, the window left is used by the next chunk
+     */
+    return_t send_chunk(network_session* session, uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream);
+    /**
+     * @brief   queue a chunk and write the frames to be sent
+     * @sa      send_chunk
+     */
+    return_t write_chunk(uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream, binary_t& frames);
+    /**
+     * @brief   WINDOW_UPDATE
+     * @param   uint32 stream_id [in] 0 connection
+     * @param   uint32 increment [in]
+     * @param   binary_t& frames [out] DATA frames unblocked, appended
+     * @return  error code (see error.hpp)
+     */
+    return_t update_window(uint32 stream_id, uint32 increment, binary_t& frames);
+    /**
+     * @brief   SETTINGS_INITIAL_WINDOW_SIZE, SETTINGS_MAX_FRAME_SIZE
+     * @param   uint16 id [in] see h2_settings_param_t
+     * @param   uint32 value [in]
+     * @param   binary_t& frames [out] DATA frames unblocked, appended
+     * @return  error code (see error.hpp)
+     */
+    return_t update_settings(uint16 id, uint32 value, binary_t& frames);
+    /**
+     * @brief   PRIORITY
+     * @param   uint32 stream_id [in]
+     * @param   uint8 weight [in] 0..255 (weight - 1)
+     */
+    http2_session& set_weight(uint32 stream_id, uint8 weight);
+    /**
+     * @brief   send window
+     * @param   uint32 stream_id [in] 0 connection
+     */
+    int64 get_window(uint32 stream_id);
+    /**
+     * @brief   streams queued
+     */
+    size_t get_pending_streams();
+
+    /**
+     * @brief   acknowledge DATA received
+     * @param   network_session* session [in]
+     * @param   uint32 stream_id [in]
+     * @param   uint32 size [in] flow-controlled length (payload including padding)
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          RFC 9113 6.9.  WINDOW_UPDATE
+     *
+     *          DATA consumed (buffered or delivered to a body sink) is acknowledged automatically
+     *          a body sink returns errorcode_t::pending to hold the window (backpressure) and acknowledges it later
+     *          WINDOW_UPDATE is sent when a half of the receive window is consumed
+     * @sa      http_router::add_sink
+     */
+    return_t acknowledge(network_session* session, uint32 stream_id, uint32 size);
+    /**
+     * @brief   acknowledge DATA received and write WINDOW_UPDATE frames
+     * @param   uint32 stream_id [in]
+     * @param   uint32 size [in]
+     * @param   binary_t& frames [out] appended
+     * @sa      acknowledge
+     */
+    return_t acknowledge(uint32 stream_id, uint32 size, binary_t& frames);
+
+   protected:
+    /**
+     * @brief   stream
+     * @remarks
+     *          weighted round robin (deficit round robin), see schedule
+     *          quantum = SETTINGS_MAX_FRAME_SIZE * weight / 16 (the default weight 16 sends a frame per round)
+     */
+    struct h2_stream_t {
+        int64 window;      // send window
+        uint16 weight;     // 1..256
+        size_t deficit;    // bytes allowed in this round
+        binary_t content;  // DATA payload
+        size_t pos;        // sent
+        bool end;          // false if more chunks follow (write_chunk)
+
+        h2_stream_t() : window(0), weight(16), deficit(0), pos(0), end(true) {}
+    };
+    typedef std::map<uint32, h2_stream_t> streams_t;
+
+    /**
+     * @brief   receiving stream
+     */
+    struct h2_recv_t {
+        bool lookup;            // body sink looked up
+        http_body_sink_t sink;  // see http_router::add_sink
+        uint32 consumed;        // not announced yet
+
+        h2_recv_t() : lookup(false), consumed(0) {}
+    };
+    typedef std::map<uint32, h2_recv_t> recv_t;
+
+    h2_stream_t& get_stream(uint32 stream_id);
+    /**
+     * @brief   write DATA frames within the windows (lock required)
+     */
+    void schedule(binary_t& frames);
+    void close_stream(uint32 stream_id);
+
+   private:
+    critical_section _lock;
+    typedef std::map<uint32, uint8> flags_t;
+    typedef std::map<uint32, http_request> headers_t;
+    typedef std::pair<flags_t::iterator, bool> flags_pib_t;
+    typedef std::pair<headers_t::iterator, bool> headers_pib_t;
+    flags_t _flags;
+    headers_t _headers;  // map<stream_identifier, http_request>
+    hpack_dynamic_table _hpack_session;
+    bool _enable_push;
+
+    // flow control (_lock)
+    int64 _window;           // connection send window
+    uint32 _initial_window;  // SETTINGS_INITIAL_WINDOW_SIZE
+    uint32 _max_frame_size;  // SETTINGS_MAX_FRAME_SIZE
+    streams_t _streams;
+    std::list<uint32> _active;  // streams queued, round robin
+    uint32 _recv_consumed;      // connection, not announced yet
+    recv_t _recv;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,258 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_CLIENT__
+#define __HOTPLACE_SDK_NET_HTTP_CLIENT__
+
+#include <sdk/base/system/critical_section.hpp>
+#include <sdk/base/system/semaphore.hpp>
+#include <sdk/base/system/thread.hpp>
+#include <sdk/io/string/string.hpp>  // url_info_t
+#include <sdk/io/system/multiplexer.hpp>
+#include <sdk/net/http/http_request.hpp>  // http_request
+#include <sdk/net/http/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+struct http_client_stat_t {
+    uint64 connect;  // new connections
+    uint64 reuse;    // requests sent on a kept-alive connection
+    uint64 resume;   // TLS sessions resumed (abbreviated handshake)
+    uint64 expire;   // idle connections closed
+    size_t idle;     // idle connections
+
+    http_client_stat_t() : connect(0), reuse(0), resume(0), expire(0), idle(0) {}
+};
+
+/**
+ * @brief   simple client
+ * @remarks
+ *          connections are pooled per origin (scheme://host:port)
+ *              set_keepalive           a connection is reused unless the response says "Connection: close", closed after idle
+ *              set_max_connections     connections per origin (in use and idle)
+ *          TLS sessions are resumed per origin (session ticket, see transport_layer_security::get_session)
+ *          pipeline                    RFC 9112 9.3.2 send the requests at once, the responses are read in order
+ *          post                        non-blocking, the responses are read by the multiplexer (epoll) thread
+ * @sample
+ *      // sketch
+ *
+ *      http_client client;
+ *      http_response* response = nullptr;
+ *      client.request("https://localhost:9000/", &response); // connect, send, read
+ *      // ...
+ *      resposne->release();
+ *
+ *      http_request request;
+ *      request.compose(http_method_t::HTTP_GET, "/");
+ *      request.get_http_header().add("Accept-Encoding", "gzip, deflate");
+ *      client.request(request, &response);  // the connection is reused
+ *      // ...
+ *      response->release();
+ *
+ *      // non-blocking
+ *      auto callback = [&](return_t result, http_response* response) -> void {
+ *          // ...
+ *      };
+ *      client.post("https://localhost:9000/api/json", callback);
+ *      client.post("https://localhost:9000/api/html", callback);
+ *      client.wait(1000);
+ */
+class http_client {
+   public:
+    http_client();
+    ~http_client();
+
+    http_client& set_url(const std::string& url);
+    http_client& set_url(const url_info_t& url_info);
+    http_client& set_wto(uint32 milliseconds);
+    /**
+     * @brief   keep-alive
+     * @param   uint32 milliseconds [in] an idle connection is closed after (default 30 sec), 0 closes the connection after a response
+     */
+    http_client& set_keepalive(uint32 milliseconds);
+    /**
+     * @brief   connections per origin
+     * @param   uint32 count [in] in use and idle (default 6)
+     * @remarks
+     *          request returns errorcode_t::max_reached, post is queued until a connection is released
+     */
+    http_client& set_max_connections(uint32 count);
+    /**
+     * @brief   pipelining (post)
+     * @param   uint32 depth [in] requests in flight per connection (default 1, no pipelining)
+     * @remarks
+     *          the queued requests (see set_max_connections) are sent at once when a connection is available
+     *          only idempotent methods (GET, HEAD) are pipelined (RFC 9112 9.3.2)
+     */
+    http_client& set_pipelining(uint32 depth);
+
+    http_client& request(const std::string& url, http_response** response);
+    http_client& request(http_request& request, http_response** response);
+    /**
+     * @brief   pipeline
+     * @param   std::vector<http_request*>& requests [in] see set_url
+     * @param   std::vector<http_response*>& responses [out] in order, nullptr if not responded
+     * @return  *this
+     */
+    http_client& pipeline(std::vector<http_request*>& requests, std::vector<http_response*>& responses);
+    /**
+     * @brief   non-blocking request
+     * @param   const std::string& url [in]
+     * @param   http_response_callback_t callback [in] called by the multiplexer thread
+     * @return  error code (see error.hpp)
+     *          not_supported   no multiplexer (linux only)
+     * @remarks
+     *          connect (if no idle connection) and send are blocking
+     */
+    return_t post(const std::string& url, http_response_callback_t callback);
+    return_t post(http_request& request, http_response_callback_t callback);
+    /**
+     * @brief   wait for the posted requests
+     * @param   uint32 milliseconds [in]
+     * @return  error code (see error.hpp)
+     *          success, timeout
+     */
+    return_t wait(uint32 milliseconds);
+    /**
+     * @brief   close idle connections
+     */
+    http_client& close();
+
+    void get_stat(http_client_stat_t* stat);
+
+   protected:
+    struct inflight_t {
+        bool head;  // HEAD request, no content
+        http_response_callback_t callback;
+
+        inflight_t() : head(false) {}
+    };
+    struct connection_t {
+        std::string origin;
+        tcp_client_socket* client;
+        socket_t sock;
+        tls_context_t* tls_handle;
+        struct timespec idle;         // since
+        std::string buffer;           // received, the responses are read from the front
+        std::list<inflight_t> queue;  // posted, waiting for the responses
+
+        connection_t() : client(nullptr), sock(INVALID_SOCKET), tls_handle(nullptr) {}
+    };
+    struct posted_t {
+        std::string request;
+        inflight_t inflight;
+        bool idempotent;
+
+        posted_t() : idempotent(false) {}
+    };
+    struct origin_t {
+        url_info_t url_info;
+        std::list<connection_t*> idle;  // the most recently used first
+        size_t count;                   // in use and idle
+        SSL_SESSION* session;           // to resume
+        std::list<posted_t> posted;     // waiting for a connection
+
+        origin_t() : count(0), session(nullptr) {}
+    };
+
+    /**
+     * @brief   an idle connection or a new connection
+     * @param   const url_info_t& url_info [in]
+     * @param   connection_t** conn [out]
+     * @param   bool* reused [outopt]
+     * @return  error code (see error.hpp)
+     *          max_reached     see set_max_connections
+     */
+    return_t acquire(const url_info_t& url_info, connection_t** conn, bool* reused = nullptr);
+    /**
+     * @brief   keep-alive or close, and then send the queued requests
+     * @param   connection_t* conn [in]
+     * @param   bool keepalive [in]
+     */
+    void release(connection_t* conn, bool keepalive);
+    void close(connection_t* conn);
+
+    return_t send(connection_t* conn, const char* data, size_t size);
+    /**
+     * @brief   append to connection_t::buffer
+     * @param   connection_t* conn [in]
+     * @param   uint32 wto [in] milliseconds, 0 no wait
+     * @return  error code (see error.hpp)
+     *          success, timeout, disconnect
+     */
+    return_t receive(connection_t* conn, uint32 wto);
+    /**
+     * @brief   read a response from connection_t::buffer
+     * @param   connection_t* conn [in]
+     * @param   bool head [in]
+     * @param   bool eof [in] the connection is closed
+     * @param   http_response** response [out]
+     * @param   bool* keepalive [out]
+     * @return  error code (see error.hpp)
+     *          more_data   receive and call again
+     */
+    return_t read_response(connection_t* conn, bool head, bool eof, http_response** response, bool* keepalive);
+
+    http_client& do_request_and_response(const url_info_t& url_info, http_request& request, http_response** response);
+    return_t do_request(const url_info_t& url_info, const basic_stream& stream, bool head, http_response** response, bool* stale);
+    return_t do_post(const url_info_t& url_info, http_request& request, http_response_callback_t callback);
+
+    /**
+     * @brief   send the posted requests and read the responses by the multiplexer
+     */
+    void dispatch(connection_t* conn, std::list<posted_t>& items);
+    /**
+     * @brief   send the queued requests if a connection is available
+     */
+    void drain(const std::string& origin);
+    /**
+     * @brief   read the posted responses
+     * @param   connection_t* conn [in]
+     * @param   bool eof [in]
+     */
+    void complete(connection_t* conn, bool eof);
+    void fail(connection_t* conn, return_t result);
+    void signal(size_t count);
+
+    static return_t event_loop_thread(void* param);
+    static return_t event_handler(uint32 type, uint32 count, void* data[], CALLBACK_CONTROL* control, void* param);
+
+   private:
+    tcp_client_socket* _client_socket;
+    tls_client_socket* _tls_client_socket;
+    transport_layer_security* _tls;
+    SSL_CTX* _tlsctx;
+    url_info_t _url_info;
+    uint32 _wto;
+    uint32 _keepalive;
+    uint32 _max_connections;
+    uint32 _pipelining;
+
+    critical_section _lock;
+    std::map<std::string, origin_t> _origins;
+    http_client_stat_t _stat;
+    bool _stopping;
+
+    std::map<socket_t, connection_t*> _posted;  // bound to the multiplexer
+    size_t _outstanding;                         // posted, not yet completed
+    semaphore _completed;
+#if defined __linux__
+    multiplexer_epoll _mplexer;
+    multiplexer_context_t* _mplexer_handle;
+    thread* _thread;
+#endif
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
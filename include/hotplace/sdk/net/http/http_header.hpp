@@ -0,0 +1,205 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_HEADER__
+#define __HOTPLACE_SDK_NET_HTTP_HEADER__
+
+#include <sdk/base/basic/keyvalue.hpp>
+#include <sdk/net/http/types.hpp>
+#include <vector>
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   well-known header fields (interned)
+ * @sa      http_header::find, http_header::get_field
+ */
+enum http_field_t : uint8 {
+    http_field_unknown = 0,
+    http_field_authority,          // :authority
+    http_field_method,             // :method
+    http_field_path,               // :path
+    http_field_scheme,             // :scheme
+    http_field_status,             // :status
+    http_field_accept,             // Accept
+    http_field_accept_encoding,    // Accept-Encoding
+    http_field_accept_ranges,      // Accept-Ranges
+    http_field_alt_svc,            // Alt-Svc
+    http_field_authorization,      // Authorization
+    http_field_cache_control,      // Cache-Control
+    http_field_connection,         // Connection
+    http_field_content_encoding,   // Content-Encoding
+    http_field_content_length,     // Content-Length
+    http_field_content_range,      // Content-Range
+    http_field_content_type,       // Content-Type
+    http_field_cookie,             // Cookie
+    http_field_etag,               // ETag
+    http_field_host,               // Host
+    http_field_if_none_match,      // If-None-Match
+    http_field_keep_alive,         // Keep-Alive
+    http_field_location,           // Location
+    http_field_range,              // Range
+    http_field_te,                 // TE
+    http_field_transfer_encoding,  // Transfer-Encoding
+    http_field_upgrade,            // Upgrade
+    http_field_user_agent,         // User-Agent
+    http_field_www_authenticate,   // WWW-Authenticate
+    http_field_count,
+};
+
+/**
+ * @brief   header fields
+ * @remarks
+ *          a flat vector in the order added, a name is hashed once (case-insensitive FNV-1a)
+ *          a well-known field is found by its index (see http_field_t), others by the hash
+ *          RFC 9110 5.1.  Field Names - field names are case-insensitive
+ */
+class http_header {
+   public:
+    http_header();
+    http_header(const http_header& object);
+    virtual ~http_header();
+
+    /**
+     * @brief   add a header
+     * @param   const std::string&  name    [IN]
+     * @param   const std::string&  value   [IN]
+     * @return  *this
+     * @remarks
+     *          header.add ("WWW-Authenticate", "Basic realm=\"protected\"");
+     */
+    http_header& add(const std::string& name, const std::string& value);
+    http_header& add(const char* name, size_t name_size, const char* value, size_t value_size);
+
+    /**
+     * @brief   clear
+     * @return  *this
+     */
+    http_header& clear();
+
+    /**
+     * @brief   conversion
+     * @param   const std::string& value [in]
+     * @param   skey_value& kv [out]
+     * @return  error code (see error.hpp)
+     * @sample
+     *          const char* auth =
+     *              "Digest username=\"user\", realm=\"happiness\", nonce=\"b10d9755f22e0cc887d3b195569dca7a\", uri=\"/auth/digest\", "
+     *              "response=\"756ae055c932efce3d1f1a38129aab3b\", opaque=\"553c454bedbdc9bb352df88630663669\", qop=auth, nc=00000002, "
+     *              "cnonce=\"f3806458ed81c203\"";
+     *
+     *          http_header::to_keyvalue(auth, kv);
+     *          std::string nonce = kv.get("nonce");
+     *          std::string uri = kv.get("uri");
+     *          std::string response = kv.get("response");
+     *          std::string opaque = kv.get("opaque");
+     *          std::string qop = kv.get("qop");
+     *          std::string nc = kv.get("nc");
+     *          std::string cnonce = kv.get("cnonce");
+     */
+    static return_t to_keyvalue(const std::string& value, skey_value& kv);
+
+    /**
+     * @brief   read a header
+     * @param   const std::string& name [in]
+     * @param   std::string& value [out]
+     * @return  value
+     * @sample
+     *          header.get ("Content-Length", conent_length);
+     */
+    std::string get(const std::string& name, std::string& value);
+    std::string get(const std::string& name);
+    /**
+     * @brief   find a header, the value is not copied
+     * @param   const std::string& name [in] case-insensitive
+     * @param   http_field_t id [in]
+     * @return  value, nullptr if not found
+     * @sample
+     *          const std::string* value = header.find(http_field_content_length);
+     *          if (value) {
+     *              size = atoi(value->c_str());
+     *          }
+     */
+    const std::string* find(const std::string& name);
+    const std::string* find(const char* name, size_t size);
+    const std::string* find(http_field_t id);
+    /**
+     * @brief   contains
+     * @param   const std::string& name [in]
+     * @param   const std::string& value [in]
+     * @sample
+     *          header.add("Content-Type", "text/html;charset=UTF-8");
+     *          test = header.contains("Content-Type", "text/html");
+     */
+    bool contains(const std::string& name, const std::string& value);
+    /**
+     * @brief   read a header token
+     * @param   const std::string& name [in]
+     * @param   unsigned index [in]
+     * @param   std::string& token [out]
+     * @return  token
+     * @sample
+     *          // Authorization: Bearer 0123-4567-89ab-cdef
+     *          header.get ("Authorization", 0, auth_type); // Bearer
+     *          header.get ("Authorization", 1, auth_data); // 0123-4567-89ab-cdef
+     *          if (auth_type == "Basic") ...
+     *          else if (auth_type == "Digest") ...
+     */
+    const char* get_token(const std::string& name, unsigned index, std::string& token);
+
+    /**
+     * @brief read all headers
+     * @param std::string& contents [out]
+     * @return error code (see error.hpp)
+     */
+    return_t get_headers(std::string& contents);
+    return_t get_headers(std::function<void(const std::string&, const std::string&)> f);
+
+    http_header& operator=(const http_header& object);
+    http_header& operator=(http_header&& object);
+
+    http_header& set_version(uint8 version);
+    uint8 get_version();
+
+    /**
+     * @brief   well-known field
+     * @param   const char* name [in] case-insensitive
+     * @param   size_t size [in]
+     * @return  http_field_unknown if not well-known
+     */
+    static http_field_t get_field(const char* name, size_t size);
+
+   protected:
+    static uint32 hash_name(const char* name, size_t size);
+    static http_field_t get_field(const char* name, size_t size, uint32 hash);
+    size_t lookup(const char* name, size_t size, uint32 hash, http_field_t id);
+
+   private:
+    struct field_t {
+        uint32 hash;  // case-insensitive
+        uint8 id;     // http_field_t
+        std::string name;
+        std::string value;
+
+        field_t(uint32 h, uint8 i, const char* n, size_t nsize, const char* v, size_t vsize) : hash(h), id(i), name(n, nsize), value(v, vsize) {}
+    };
+    typedef std::vector<field_t> fields_t;
+    fields_t _fields;
+    uint32 _index[http_field_count];  // position + 1, 0 if not present
+    uint8 _version;
+    critical_section _lock;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
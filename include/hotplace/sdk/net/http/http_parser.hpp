@@ -0,0 +1,106 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *  RFC 9112 HTTP/1.1
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_PARSER__
+#define __HOTPLACE_SDK_NET_HTTP_PARSER__
+
+#include <sdk/net/http/types.hpp>
+#include <sdk/net/server/network_protocol.hpp>  // protocol_cursor_t
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   protocol_cursor_t::phase
+ */
+enum http_parser_phase_t {
+    http_parser_start_line = 0,
+    http_parser_header = 1,
+    http_parser_content = 2,
+    http_parser_chunk_size = 3,
+    http_parser_chunk_data = 4,
+    http_parser_trailer = 5,
+    http_parser_complete = 6,
+};
+
+/**
+ * @brief   protocol_cursor_t::flags
+ */
+enum http_parser_flag_t {
+    http_parser_chunked = (1 << 0),         // Transfer-Encoding: chunked
+    http_parser_content_length = (1 << 1),  // Content-Length
+    http_parser_eof = (1 << 2),             // no more data, see http_request::open
+};
+
+/**
+ * @brief   HTTP/1.1 message parser
+ * @remarks
+ *          resumable, the state is kept in protocol_cursor_t
+ *              phase   see http_parser_phase_t
+ *              flags   see http_parser_flag_t
+ *              pos     parsed so far (offset from the start of the message)
+ *              value   end of content (Content-Length), size of chunk (chunked)
+ *
+ *          RFC 9112
+ *              2.1 Message Format
+ *              5.1 Field Line Parsing - no whitespace is allowed between the field name and colon
+ *              6.1 Transfer-Encoding - chunked overrides Content-Length
+ *              7.1 Chunked Transfer Coding
+ *
+ *          http_parser parser;
+ *          protocol_cursor_t cursor;
+ *          ret = parser.parse(&cursor, stream, size, &need);  // errorcode_t::more_data
+ *          // ... append
+ *          ret = parser.parse(&cursor, stream, size, &need);  // errorcode_t::success, cursor.pos is the size of the message
+ */
+class http_parser {
+   public:
+    http_parser();
+    virtual ~http_parser();
+
+    /**
+     * @brief   parse
+     * @param   protocol_cursor_t* cursor [inout]
+     * @param   const char* stream [in] from the start of the message
+     * @param   size_t size [in]
+     * @param   size_t* need [outopt] the size of the message required to resume, 0 if unknown
+     * @return  errorcode_t::success - complete, cursor->pos is the size of the message
+     *          errorcode_t::more_data
+     *          errorcode_t::bad_data
+     */
+    return_t parse(protocol_cursor_t* cursor, const char* stream, size_t size, size_t* need = nullptr);
+
+   protected:
+    /**
+     * @brief   request-line (method SP request-target SP HTTP-version) or status-line
+     */
+    virtual void on_start_line(const char* method, size_t method_size, const char* target, size_t target_size);
+    /**
+     * @brief   field line (also trailer)
+     */
+    virtual void on_header(const char* name, size_t name_size, const char* value, size_t value_size);
+    /**
+     * @brief   content (decoded, if chunked)
+     */
+    virtual void on_content(const char* data, size_t size);
+
+   private:
+    return_t getline(protocol_cursor_t* cursor, const char* stream, size_t size, size_t* line_end, size_t* next);
+    return_t parse_start_line(const char* line, size_t size);
+    return_t parse_header(protocol_cursor_t* cursor, const char* line, size_t size);
+    return_t parse_chunk_size(const char* line, size_t size, size_t* chunk_size);
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,176 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_RESPONSE__
+#define __HOTPLACE_SDK_NET_HTTP_RESPONSE__
+
+#include <sdk/base/stream/basic_stream.hpp>  // basic_stream
+#include <sdk/net/http/http_header.hpp>      // http_header
+#include <sdk/net/http/http_router.hpp>      // http_router
+#include <sdk/net/http/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+class http_response {
+    friend class http_router;
+    friend class http_response_parser;
+
+   public:
+    http_response();
+    http_response(http_request* request);
+    http_response(const http_response& object);
+    ~http_response();
+
+    /* *
+     * @brief   open HTTP 1.x
+     * @param   const char*     response        [IN]
+     * @param   size_t          size_response   [IN]
+     * @return  error code (see error.hpp)
+     */
+    return_t open(const char* response, size_t size_response);
+    return_t open(const char* response);
+    return_t open(const basic_stream& response);
+    return_t open(const std::string& response);
+    /* *
+     * @brief  close
+     * @return  error code (see error.hpp)
+     */
+    return_t close();
+
+    /**
+     * @brief   compose
+     */
+    http_response& compose(int status_code);
+    http_response& compose(int status_code, const char* content_type, const char* content, ...);
+    http_response& compose(int status_code, const std::string& content_type, const char* content, ...);
+    http_response& compose(int status_code, const std::string& content_type, const binary_t& bin);
+    /**
+     * @brief   compose (html_documents)
+     * @param   int status_code [in]
+     * @param   const std::string& content_type [in]
+     * @param   html_document* document [in] referenced until close
+     * @param   uint64 offset [in]
+     * @param   uint64 length [in]
+     * @remarks
+     *          the body is not copied into the response
+     *          HTTP/1.1 respond sends the file (sendfile), HTTP/2 reads the mapped file
+     */
+    http_response& compose(int status_code, const std::string& content_type, html_document* document, uint64 offset, uint64 length);
+    /**
+     * @brief   compose (generated content)
+     * @param   int status_code [in]
+     * @param   const std::string& content_type [in]
+     * @param   http_body_producer_t producer [in] called until no_more
+     * @remarks
+     *          HTTP/1.1 Transfer-Encoding: chunked, a chunk is sent as it is produced
+     *          HTTP/2 DATA frames under flow control (http2_session::send_chunk)
+     *          the producer is consumed by respond (or get_response)
+     */
+    http_response& compose(int status_code, const std::string& content_type, http_body_producer_t producer);
+    /**
+     * @brief   respond
+     * @remarks
+     *          HTTP/1.1 the status line and the headers are written into a reusable buffer, the body is sent by reference (writev)
+     * @example
+     *          response.get_http_header().clear();
+     *          response.compose(200, "text/html>", "<html><body></body></html>");
+     *          basic_stream bs;
+     *          response.get_response(bs)
+     *          session->send((const char*)bs.data(), bs.size());
+     */
+    return_t respond(network_session* session);
+
+    http_router* get_http_router();
+
+    /**
+     * @brief   Content-Type
+     */
+    const char* content_type();
+    /**
+     * @brief   content
+     */
+    const char* content();
+    size_t content_size();
+    /**
+     * @brief   status code
+     */
+    int status_code();
+    /**
+     * @brief   header
+     */
+    http_header& get_http_header();
+    /**
+     * @brief   request
+     */
+    http_request* get_http_request();
+    /**
+     * @brief   response
+     */
+    http_response& get_response(basic_stream& bs);  // HTTP/1.1
+    http_response& get_response_h2(binary_t& bin);  // HTTP/2, HEADERS and a DATA frame
+    /**
+     * @brief   response (HTTP/2)
+     * @param   binary_t& headers [out] ALTSVC, HEADERS frames
+     * @param   binary_t& body [out] DATA payload
+     * @param   bool& end_stream [out] END_STREAM is set in HEADERS (HEAD)
+     * @remarks DATA frames are written by http2_session (flow control), see respond
+     */
+    http_response& get_response_h2(binary_t& headers, binary_t& body, bool& end_stream);
+
+    virtual std::string get_version_str();
+
+    http_response& operator=(const http_response& object);
+
+    http_response& set_hpack_session(hpack_dynamic_table* session);
+    http_response& set_version(uint8 version);
+    http_response& set_stream_id(uint32 stream_id);
+    hpack_dynamic_table* get_hpack_session();
+    uint8 get_version();
+    uint32 get_stream_id();
+
+    void addref();
+    void release();
+
+   protected:
+    void set_http_router(http_router* router);
+    /**
+     * @brief   status line and headers (HTTP/1.1)
+     * @param   std::string& head [out] status line, headers
+     * @param   basic_stream& encoded [out] the body if Content-Encoding is applied
+     * @param   sendbuf_t& body [out] content, encoded or the mapped document, empty if HEAD or generated
+     */
+    http_response& get_response_headers(std::string& head, basic_stream& encoded, sendbuf_t& body);
+    bool is_head_request();
+
+    t_shared_reference<http_response> _shared;
+
+   private:
+    http_router* _router;
+    http_request* _request;
+    http_header _header;
+    std::string _content_type;
+    basic_stream _content;
+    int _statuscode;
+    html_document* _document;
+    uint64 _offset;
+    uint64 _length;
+    http_body_producer_t _producer;
+
+    hpack_dynamic_table* _hpsess;
+    uint8 _version;
+    uint32 _stream_id;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,91 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_HTTP_ROUTETREE__
+#define __HOTPLACE_SDK_NET_HTTP_ROUTETREE__
+
+#include <sdk/net/http/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   compressed radix tree of URI patterns (see t_trie, an edge holds a string instead of a character)
+ * @remarks
+ *          /api/test       literal
+ *          /users/:id      a segment is captured as "id"
+ *          /static/*       the rest of the path is captured as "*"
+ *          /files/*path    the rest of the path is captured as "path"
+ *
+ *          priority literal > parameter > wildcard, backtracking if the rest does not match
+ *          /users/me and /users/:id can be registered together
+ * @sample
+ *          http_route_tree tree;
+ *          tree.add("/users/:id", 0);
+ *          tree.add("/static/*", 1);
+ *
+ *          int index = -1;
+ *          http_route_tree::params_t params;
+ *          tree.find("/users/1", index, &params);  // 0, ("id", "1")
+ */
+class http_route_tree {
+   public:
+    typedef std::vector<std::pair<std::string, std::string>> params_t;
+
+    http_route_tree();
+    ~http_route_tree();
+
+    /**
+     * @brief   add
+     * @param   const std::string& pattern [in]
+     * @param   int index [in]
+     * @return  error code (see error.hpp)
+     *          invalid_parameter   an empty parameter name, a wildcard not at the end
+     *          already_exist       the pattern is registered, or a parameter has another name at the same position (/users/:id, /users/:name)
+     */
+    return_t add(const std::string& pattern, int index);
+    /**
+     * @brief   find
+     * @param   const char* path [in]
+     * @param   int& index [out]
+     * @param   params_t* params [outopt]
+     * @return  error code (see error.hpp)
+     */
+    return_t find(const char* path, int& index, params_t* params = nullptr) const;
+    return_t find(const std::string& path, int& index, params_t* params = nullptr) const;
+
+    void clear();
+
+   protected:
+    struct node {
+        std::string label;            // a compressed edge
+        std::string indices;          // the first characters of children
+        std::vector<node*> children;  // literal
+        node* param;                  // :name
+        std::string param_name;       // name of the parameter
+        int wildcard;                 // *name, index
+        std::string wildcard_name;    // name of the wildcard
+        int index;                    // -1 if not registered
+
+        node() : param(nullptr), wildcard(-1), index(-1) {}
+        ~node();
+    };
+
+    bool lookup(const node* n, const char* path, size_t size, size_t pos, int& index, params_t& params) const;
+
+   private:
+    node* _root;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,417 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *          OVERLAPPED
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_SERVER_NETWORKSESSION__
+#define __HOTPLACE_SDK_NET_SERVER_NETWORKSESSION__
+
+#include <sdk/io/basic/sharded_mlfq.hpp>
+#include <sdk/net/basic/types.hpp>                 // dgram_t
+#include <sdk/net/http/http2/http2_session.hpp>  // http2_session
+#include <sdk/net/server/network_stream.hpp>     // network_stream
+#include <sdk/net/types.hpp>
+#include <unordered_map>
+
+namespace hotplace {
+namespace net {
+
+#define NETWORK_SESSION_SHARDS 64
+
+struct network_session_buffer_t {
+#if defined __linux__
+    char* buffer;
+    size_t buflen;
+
+    /* recvmmsg, see set_batch */
+    std::vector<char> mbin;
+    std::vector<dgram_t> dgrams;
+    size_t batch;
+#elif defined _WIN32 || defined _WIN64
+    /* windows overlapped */
+    // assign per socket
+    OVERLAPPED overlapped;
+    WSABUF wsabuf;
+#endif
+
+    std::vector<char> bin;
+    size_t bufsize;
+
+    network_session_buffer_t() : bufsize(1500) {
+#if defined __linux__
+        batch = 1;
+#endif
+        init();
+    }
+    void init() {
+        bin.resize(bufsize);  // do nothing if capacity == size()
+#if defined __linux__
+        buffer = &bin[0];
+        buflen = bin.size();
+#elif defined _WIN32 || defined _WIN64
+        memset(&overlapped, 0, sizeof(OVERLAPPED));
+        wsabuf.len = bin.size();
+        wsabuf.buf = &bin[0];
+#endif
+    }
+    void set_bufsize(size_t size) {
+        if (size) {
+            bufsize = size;
+        }
+    }
+#if defined __linux__
+    /**
+     * @brief   recvmmsg buffers
+     * @param   size_t count [in] datagrams per recvmmsg, 1 recvfrom
+     * @param   size_t size [inopt] size of each buffer, bufsize if 0 (UDP_GRO needs 65535)
+     */
+    void set_batch(size_t count, size_t size = 0) {
+        batch = count ? count : 1;
+        if (batch > 1) {
+            size_t slot = size ? size : bufsize;
+            mbin.resize(batch * slot);
+            dgrams.resize(batch);
+            for (size_t i = 0; i < batch; i++) {
+                dgrams[i].ptr = &mbin[i * slot];
+                dgrams[i].bufsize = slot;
+            }
+        }
+    }
+#endif
+};
+
+/**
+ * @sa
+ *      network_session::socket_info
+ *      network_server netserver_cb_type_t::netserver_cb_socket
+ */
+struct network_session_socket_t {
+    handle_t event_socket;
+    sockaddr_storage_t cli_addr;  // both ipv4 and ipv6
+
+    network_session_socket_t() : event_socket((handle_t)INVALID_SOCKET) {}
+};
+
+struct network_session_t {
+    network_session_socket_t netsock;
+    network_session_buffer_t buf;
+
+    void* mplexer_handle;
+    server_socket* svr_socket;
+    tls_context_t* tls_handle;
+    int priority;
+    bool edge_triggered;  // read until EAGAIN, see serverconf_edge_triggered
+
+    network_session_t() : mplexer_handle(nullptr), svr_socket(nullptr), tls_handle(nullptr), priority(0), edge_triggered(false) {}
+    network_session_socket_t* socket_info() { return &netsock; }
+    network_session_buffer_t& get_buffer() { return buf; }
+};
+
+/**
+ * @brief session data
+ */
+class network_session_data : public skey_value {
+   public:
+    network_session_data() {}
+    virtual ~network_session_data() {}
+};
+
+/**
+ * @brief session
+ */
+class network_session {
+    friend class network_server;
+
+   public:
+    network_session(server_socket* svr_socket);
+    virtual ~network_session();
+
+    /**
+     * @remarks
+     *          recycled by t_object_pool, a derived class (size differs) is allocated by malloc
+     */
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static void get_pool_stat(object_pool_stat_t* stat);
+
+    /**
+     * @brief   connect handler
+     * @param   handle_t            event_socket  [IN]
+     * @param   sockaddr_storage_t* sockaddr    [IN]
+     * @param   tls_context_t*      tls_handle  [IN]
+     * @return  error code (see error.hpp)
+     * @remarks copy socket and address
+     */
+    return_t connected(handle_t event_socket, sockaddr_storage_t* sockaddr, tls_context_t* tls_handle);
+    /**
+     * @brief   dtls
+     */
+    return_t dtls_session_open(handle_t listen_sock);
+    /**
+     * @brief   dtls
+     */
+    return_t dtls_session_handshake();
+    /**
+     * @brief in windows call wsarecv to read asynchronously
+     * @return  error code (see error.hpp)
+     */
+    return_t ready_to_read();
+
+    /**
+     * @brief send
+     * @param const char*         data_ptr        [IN]
+     * @param size_t              size_data       [IN]
+     * @return  error code (see error.hpp)
+     */
+    return_t send(const char* data_ptr, size_t size_data);
+    return_t send(const byte_t* data_ptr, size_t size_data);
+    return_t sendto(const char* data_ptr, size_t size_data, sockaddr_storage_t* addr);
+    return_t sendto(const byte_t* data_ptr, size_t size_data, sockaddr_storage_t* addr);
+    /**
+     * @brief   send datagrams in a batch
+     * @param   dgram_t*    dgrams  [IN] ptr, size, segment (UDP_SEGMENT), addr, addrlen
+     * @param   size_t      count   [IN]
+     * @param   size_t*     cbcount [OUTOPT] number of datagrams sent
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] sendmmsg, a single syscall per 64 datagrams
+     */
+    return_t sendmmsg(dgram_t* dgrams, size_t count, size_t* cbcount = nullptr);
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   const sendbuf_t* bufs   [IN] ptr, size
+     * @param   size_t          count   [IN]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] writev, TLS gathers small pieces into a record
+     */
+    return_t sendv(const sendbuf_t* bufs, size_t count);
+    /**
+     * @brief   send a file
+     * @param   handle_t    fd      [IN]
+     * @param   uint64      offset  [IN]
+     * @param   size_t      size    [IN]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  TLS, send the content instead
+     * @remarks
+     *          [linux] sendfile
+     */
+    return_t sendfile(handle_t fd, uint64 offset, size_t size);
+
+    /**
+     * @brief return socket information
+     */
+    network_session_socket_t* socket_info();
+    network_session_buffer_t* get_buffer();
+
+#if defined _WIN32 || defined _WIN64
+    /**
+     * @brief in windows return wsabuf structure
+     */
+    WSABUF* wsabuf_read();
+#endif
+    /**
+     * @brief return raw-stream
+     */
+    network_stream* getstream();
+    /**
+     * @brief return composed-stream
+     */
+    network_stream* getrequest();
+
+    /**
+     * @brief   [epoll] EPOLLET|EPOLLONESHOT, drain a socket in produce
+     */
+    void set_edge_triggered(bool enable);
+
+    /**
+     * @brief return priority
+     */
+    int get_priority();
+    /**
+     * @brief elevate priority
+     * @param   int priority        [IN]
+     */
+    void set_priority(int priority);
+
+    int addref();
+    /**
+     * @brief release object if not referenced
+     */
+    virtual int release();
+    /**
+     * @brief produce, push into stream
+     * @param   t_sharded_mlfq<network_session>*    q               [IN]
+     * @param   byte_t*                             buf_read        [IN]
+     * @param   size_t                              size_buf_read   [IN]
+     * @param   const sockaddr_storage_t*           addr            [inopt]
+     * @remarks
+     */
+    return_t produce(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+    /**
+     * @brief consume from stream and put into request, then read stream buffer list from request
+     * @param   network_protocol_group* protocol_group              [IN]
+     * @param   network_stream_data**   ptr_network_stream_buffer   [OUT] see network_stream::consume
+     */
+    return_t consume(network_protocol_group* protocol_group, network_stream_data** ptr_network_stream_buffer);
+
+    server_socket* get_server_socket();
+    network_session_data* get_session_data();
+    http2_session& get_http2_session();
+
+    return_t dgram_get_sockaddr(sockaddr_storage_t* addr);
+
+   protected:
+    return_t produce_stream(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+    return_t produce_dgram(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+
+   private:
+    network_session_t _session;
+    network_stream _stream;
+    network_stream _request;
+    network_session_data _session_data;
+
+    http2_session _http2_session;
+
+    t_shared_reference<network_session> _shared;
+    critical_section _lock;
+};
+
+/**
+ * @brief network_session container
+ */
+class network_session_manager {
+   public:
+    network_session_manager();
+    ~network_session_manager();
+
+    void set_server_conf(server_conf* conf);
+    server_conf* get_server_conf();
+
+    /**
+     * @brief   [TCP/TLS] new network_session
+     * @param   handle_t            event_socket      [IN]
+     * @param   sockaddr_storage_t* sockaddr        [IN]
+     * @param   server_socket*      svr_socket      [IN]
+     * @param   tls_context_t*      tls_handle      [IN]
+     * @param   network_session**   ptr_session_object  [OUT] use release to free
+     * @return  error code (see error.hpp)
+     */
+    return_t connected(handle_t event_socket, sockaddr_storage_t* sockaddr, server_socket* svr_socket, tls_context_t* tls_handle,
+                       network_session** ptr_session_object);
+    /**
+     * @brief   [TCP/TLS] find a network session
+     * @param   handle_t            event_socket          [IN]
+     * @param   network_session**   ptr_session_object  [OUT] referenced, call release
+     * @return  error code (see error.hpp)
+     * @example
+     *          network_session* session = session_manager.find (event_socket);
+     *          if (nullptr != session)
+     *          {
+     *              session->release (); // decrease reference counter
+     *          }
+     */
+    return_t find(handle_t event_socket, network_session** ptr_session_object);
+    /**
+     * @brief   [TCP/TLS] operator[socket]
+     * @return  error code (see error.hpp)
+     * @remarks
+     * @example
+     *          network_session* session = session_manager[event_socket];
+     *          if (nullptr != session)
+     *          {
+     *              session->release (); // decrease reference counter
+     *          }
+     */
+    network_session* operator[](handle_t event_socket);
+    /**
+     * @brief   [TCP/TLS] remove from session list
+     * @param   handle_t            event_socket          [IN]
+     * @param   network_session**   ptr_session_object  [OUT]
+     * @return  error code (see error.hpp)
+     */
+    return_t ready_to_close(handle_t event_socket, network_session** ptr_session_object);
+
+    /**
+     * @brief   [UDP] handle udp data without cookie secret
+     */
+    return_t get_dgram_session(handle_t listen_sock, server_socket* svr_socket, tls_context_t* tls_handle, network_session** ptr_session_object);
+    /**
+     * @brief   [DTLS] handle dtls session
+     */
+    return_t get_dgram_cookie_session(handle_t listen_sock, const sockaddr_storage_t* sockaddr, server_socket* svr_socket, tls_context_t* tls_handle,
+                                      network_session** ptr_session_object);
+    /**
+     * @brief   [DTLS] find DTLS session
+     * @remarks
+     *          network_session* session_object = nullptr;
+     *          ret = session_manager.find(&sa, &session_object); // refcount++
+     *          if (errorcode_t::success == ret) {
+     *              // do something
+     *              session_object->release(); // refcount--
+     *          } else {
+     *              // do something
+     *          }
+     */
+    return_t dgram_find(const sockaddr_storage_t* sockaddr, network_session** ptr_session_object);
+
+   protected:
+    void shutdown();
+
+   private:
+    /**
+     * @brief   [UDP/DTLS] peer address (family, port, address), see dgram_key
+     */
+    struct dgram_key_t {
+        uint16 family;
+        uint16 port;
+        uint32 scope;
+        byte_t addr[16];
+
+        bool operator==(const dgram_key_t& rhs) const;
+    };
+    struct dgram_key_hash {
+        size_t operator()(const dgram_key_t& key) const;
+    };
+
+    typedef std::unordered_map<handle_t, network_session*> network_session_map_t;
+    typedef std::pair<network_session_map_t::iterator, bool> network_session_map_pib_t;
+    typedef std::unordered_map<dgram_key_t, network_session*, dgram_key_hash> dgram_session_map_t;
+    typedef std::pair<dgram_session_map_t::iterator, bool> dgram_session_map_pib_t;
+
+    /**
+     * @remarks
+     *          a read event locks only the shard of the socket (or the peer address), not the whole table
+     *          descriptors are dense small integers, so (socket % NETWORK_SESSION_SHARDS) spreads evenly
+     */
+    struct session_shard_t {
+        critical_section lock;
+        network_session_map_t session_map;
+        dgram_session_map_t dgram_map;
+    };
+
+    session_shard_t& get_shard(handle_t event_socket);
+    session_shard_t& get_shard(const dgram_key_t& key);
+    static void dgram_key(dgram_key_t& key, const sockaddr_storage_t* addr);
+
+    session_shard_t _shards[NETWORK_SESSION_SHARDS];
+    server_conf* _server_conf;
+};
+
+typedef struct network_session_buffer_t net_session_buffer_t;
+typedef struct network_session_socket_t net_session_socket_t;
+typedef struct network_session_t net_session_t;
+typedef network_session_data net_session_data;
+typedef network_session net_session;
+typedef network_session_manager net_session_manager;
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,211 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_SERVER_NETWORKSTREAM__
+#define __HOTPLACE_SDK_NET_SERVER_NETWORKSTREAM__
+
+#include <sdk/io/basic/object_pool.hpp>
+#include <sdk/net/server/network_protocol.hpp>
+#include <sdk/net/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+#define NETWORK_STREAM_SLAB 2048
+
+/**
+ * @brief stream data that produced and consumed by network_stream
+ * @remarks
+ *          an instance is recycled by t_object_pool, and so is the content up to NETWORK_STREAM_SLAB bytes (see assign)
+ */
+class network_stream_data {
+    friend class network_stream;
+
+   public:
+    network_stream_data();
+    ~network_stream_data();
+
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+    /**
+     * @brief   pool counters
+     * @param   object_pool_stat_t* object [out] network_stream_data
+     * @param   object_pool_stat_t* slab [out] content (NETWORK_STREAM_SLAB)
+     */
+    static void get_pool_stat(object_pool_stat_t* object, object_pool_stat_t* slab);
+
+    /**
+     * @brief assign
+     * @param   byte_t* ptr     [IN]
+     * @param   size_t  size    [IN]
+     * @remarks
+     *          copy into a slab if size <= NETWORK_STREAM_SLAB
+     */
+    return_t assign(byte_t* ptr, size_t size);
+    /**
+     * @brief   take ownership of the allocated buffer (no copy)
+     * @param   byte_t* base    [IN] allocated by malloc, free on destruct
+     * @param   byte_t* ptr     [IN] content, base <= ptr
+     * @param   size_t  size    [IN]
+     */
+    return_t attach(byte_t* base, byte_t* ptr, size_t size);
+    /**
+     * @brief content size
+     */
+    size_t size();
+    /**
+     * @brief content
+     */
+    byte_t* content();
+
+    /**
+     * @brief next node
+     */
+    network_stream_data* next();
+    void set_next(network_stream_data* next);
+
+    int get_priority();
+    void set_priority(int priority);
+
+    int addref();
+    /**
+     * @brief destruct
+     */
+    int release();
+
+    /*
+     * udp client address
+     */
+    void set_sockaddr(const sockaddr_storage_t* cliaddr);
+    void get_sockaddr(sockaddr_storage_t* cliaddr);
+    const sockaddr_storage_t* get_sockaddr();
+
+   protected:
+    void free_base();
+
+   private:
+    t_shared_reference<network_stream_data> _instance;
+    byte_t* _base;
+    bool _slab;  // _base from the slab
+    byte_t* _ptr;
+    size_t _size;
+    network_stream_data* _next;
+    int _priority;
+    sockaddr_storage_t* _addr;  // udp, nullptr or &_sockaddr
+    sockaddr_storage_t _sockaddr;
+};
+
+/**
+ * @brief network_stream_data container
+ *        member of network_session
+ * @remarks
+ *          stream data (produce without address) is appended into a contiguous receive buffer
+ *          protocols parse the receive buffer in place, from the read cursor
+ *          datagrams (produce with address) are queued as network_stream_data
+ */
+class network_stream {
+   public:
+    network_stream();
+    ~network_stream();
+
+    /**
+     * @brief produce
+     * @param   byte_t* buf_read         [IN]
+     * @param   size_t  size_buf_read    [IN]
+     * @param   const sockaddr_storage_t* addr [inopt]
+     * @remarks
+     *          copied once into the receive buffer (stream) or into network_stream_data (datagram)
+     */
+    return_t produce(byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+    /**
+     * @brief data ready
+     */
+    bool ready();
+    /**
+     * @brief consume
+     * @param   network_stream_data**  ptr_buffer_object    [OUT] use release to free
+     * @return error code (see error.hpp)
+     * @remarks
+     *          network_stream_data* buffer;
+     *          stream.consume (&buffer);
+     *          while (buffer)
+     *          {
+     *              item = buffer;
+     *              do_something (item->content(), item->size());
+     *              buffer = buffer->next ();
+     *              item->release ();
+     *          }
+     */
+    return_t consume(network_stream_data** ptr_buffer_object);
+    /**
+     * @brief read from stream using protocol interpreter
+     * @param   network_protocol_group* protocol_group  [IN]
+     * @param   network_stream*        from             [IN]
+     * @return error code (see error.hpp)
+     */
+    return_t read(network_protocol_group* protocol_group, network_stream* from);
+    /**
+     * @brief write into stream using protocol interpreter
+     * @param   network_protocol_group* protocol_group  [IN]
+     * @param   network_stream*        target           [IN]
+     * @return error code (see error.hpp)
+     */
+    return_t write(network_protocol_group* protocol, network_stream* target);
+
+   protected:
+    /**
+     * @brief write if no protocol interpreter exist
+     * @param   network_stream*        target           [OUT]
+     * @return error code (see error.hpp)
+     */
+    return_t do_write(network_stream* target);
+    /**
+     * @brief write using protocol interpreter
+     * @param   network_protocol_group* protocol        [IN]
+     * @param   network_stream*        target           [OUT]
+     * @return error code (see error.hpp)
+     */
+    return_t do_writep(network_protocol_group* protocol, network_stream* target);
+
+    /**
+     * @brief append into the receive buffer
+     * @param   byte_t* ptr     [IN]
+     * @param   size_t  size    [IN]
+     */
+    return_t append(byte_t* ptr, size_t size);
+    /**
+     * @brief detach the receive buffer
+     * @param   network_stream_data** ptr_buffer_object [OUT]
+     */
+    return_t detach(network_stream_data** ptr_buffer_object);
+    /**
+     * @brief discard the receive buffer
+     */
+    void discard();
+
+    typedef std::list<network_stream_data*> network_stream_list_t;
+
+   private:
+    critical_section _lock;
+    network_stream_list_t _queue;
+
+    byte_t* _buffer;            // contiguous receive buffer (stream)
+    size_t _capacity;           // allocated size, including a null pad byte
+    size_t _begin;              // read cursor
+    size_t _end;                // write cursor
+    size_t _need;               // size of the message announced by protocol (see network_protocol::read_stream)
+    protocol_cursor_t _cursor;  // resumable parse state of the message
+    sockaddr_storage_t _addr;   // datagram appended lastly
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
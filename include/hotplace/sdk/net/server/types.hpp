@@ -0,0 +1,34 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_NET_SERVER_TYPES__
+#define __HOTPLACE_SDK_NET_SERVER_TYPES__
+
+#include <sdk/net/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+// net/server
+
+class network_server;
+class network_session;
+class network_session_data;
+class network_session_manager;
+class network_stream;
+class network_stream_data;
+class network_protocol;
+class network_protocol_group;
+class server_conf;
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
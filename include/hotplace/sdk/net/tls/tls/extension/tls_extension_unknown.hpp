@@ -0,0 +1,34 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS_TLSEXTENSION_UNKNOWN__
+#define __HOTPLACE_SDK_NET_TLS_TLSEXTENSION_UNKNOWN__
+
+#include <sdk/net/tls/tls/extension/tls_extension.hpp>
+
+namespace hotplace {
+namespace net {
+
+class tls_extension_unknown : public tls_extension {
+   public:
+    tls_extension_unknown(uint16 type, tls_session* session);
+
+   protected:
+    virtual return_t do_read_body(const byte_t* stream, size_t size, size_t& pos);
+    virtual return_t do_write_body(binary_t& bin);
+
+   protected:
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,31 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS_TLSHANDSHAKE_END_OF_EARLY_DATA__
+#define __HOTPLACE_SDK_NET_TLS_TLSHANDSHAKE_END_OF_EARLY_DATA__
+
+#include <sdk/net/tls/tls/handshake/tls_handshake.hpp>
+
+namespace hotplace {
+namespace net {
+
+class tls_handshake_end_of_early_data : public tls_handshake {
+   public:
+    tls_handshake_end_of_early_data(tls_session* session);
+
+    virtual void run_scheduled(tls_direction_t dir);
+
+   protected:
+    virtual return_t do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size);
+    virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
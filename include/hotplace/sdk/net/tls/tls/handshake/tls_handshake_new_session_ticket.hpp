@@ -0,0 +1,39 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS_TLSHANDSHAKE_NEW_SESSION_TICKET__
+#define __HOTPLACE_SDK_NET_TLS_TLSHANDSHAKE_NEW_SESSION_TICKET__
+
+#include <sdk/net/tls/tls/handshake/tls_handshake.hpp>
+
+namespace hotplace {
+namespace net {
+
+class tls_handshake_new_session_ticket : public tls_handshake {
+   public:
+    tls_handshake_new_session_ticket(tls_session* session);
+
+   protected:
+    virtual return_t do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size);
+    virtual return_t do_read_body(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
+    /**
+     * @brief   server, a ticket issued by tls_resumption
+     */
+    virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
+
+   private:
+    uint32 _ticket_lifetime;
+    uint32 _ticket_age_add;
+    binary_t _ticket_nonce;
+    binary_t _ticket;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,36 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS_TLSRECORD_ALERT__
+#define __HOTPLACE_SDK_NET_TLS_TLSRECORD_ALERT__
+
+#include <sdk/net/tls/tls/record/tls_record.hpp>
+
+namespace hotplace {
+namespace net {
+
+class tls_record_alert : public tls_record {
+   public:
+    tls_record_alert(tls_session* session);
+    tls_record_alert(tls_session* session, uint8 level, uint8 desc);
+
+    virtual return_t read_plaintext(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
+
+   protected:
+    virtual return_t do_read_body(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
+    virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
+
+   private:
+    uint8 _level;
+    uint8 _desc;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
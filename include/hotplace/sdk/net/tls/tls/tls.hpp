@@ -0,0 +1,86 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ * studying
+ *  RFC 8446
+ *  RFC 5246
+ *  -- RFC 8996 --
+ *  RFC 4346
+ *  RFC 2246
+ *
+ * RFC 8446 2.  Protocol Overview
+ *
+ *        Client                                           Server
+ *
+ * Key  ^ ClientHello
+ * Exch | + key_share*
+ *      | + signature_algorithms*
+ *      | + psk_key_exchange_modes*
+ *      v + pre_shared_key*       -------->
+ *                                                   ServerHello  ^ Key
+ *                                                  + key_share*  | Exch
+ *                                             + pre_shared_key*  v
+ *                                         {EncryptedExtensions}  ^  Server
+ *                                         {CertificateRequest*}  v  Params
+ *                                                {Certificate*}  ^
+ *                                          {CertificateVerify*}  | Auth
+ *                                                    {Finished}  v
+ *                                <--------  [Application Data*]
+ *      ^ {Certificate*}
+ * Auth | {CertificateVerify*}
+ *      v {Finished}              -------->
+ *        [Application Data]      <------->  [Application Data]
+ *
+ *               +  Indicates noteworthy extensions sent in the
+ *                  previously noted message.
+ *
+ *               *  Indicates optional or situation-dependent
+ *                  messages/extensions that are not always sent.
+ *
+ *               {} Indicates messages protected using keys
+ *                  derived from a [sender]_handshake_traffic_secret.
+ *
+ *               [] Indicates messages protected using keys
+ *                  derived from [sender]_application_traffic_secret_N.
+ *
+ *                Figure 1: Message Flow for Full TLS Handshake
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS__
+#define __HOTPLACE_SDK_NET_TLS__
+
+#include <sdk/base/system/critical_section.hpp>
+#include <sdk/base/system/types.hpp>
+#include <sdk/crypto/basic/crypto_key.hpp>
+#include <sdk/crypto/basic/types.hpp>
+#include <sdk/net/tls/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   dump
+ * @param   stream_t* s [out]
+ * @param   const byte_t* stream [in]
+ * @param   size_t size [in]
+ * @param   size_t& pos [inout]
+ * @remarks
+ */
+return_t tls_dump_record(tls_session* session, const byte_t* stream, size_t size, size_t& pos, tls_direction_t dir = from_server);
+return_t tls_dump_handshake(tls_session* session, const byte_t* stream, size_t size, size_t& pos, tls_direction_t dir = from_server);
+return_t tls_dump_extension(tls_hs_type_t hstype, tls_session* session, const byte_t* stream, size_t size, size_t& pos);
+
+bool is_kindof_tls13(uint16 ver);
+bool is_kindof_tls(uint16 ver);
+bool is_kindof_dtls(uint16 ver);
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -0,0 +1,26 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file    odbc.hpp
+ * @author  Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_ODBC__
+#define __HOTPLACE_SDK_ODBC__
+
+#if defined SUPPORT_FEATURE_ODBC
+
+#include <sdk/base.hpp>
+#include <sdk/odbc/basic/odbc_connector.hpp>
+#include <sdk/odbc/basic/odbc_diagnose.hpp>
+#include <sdk/odbc/basic/odbc_field.hpp>
+#include <sdk/odbc/basic/odbc_query.hpp>
+#include <sdk/odbc/basic/odbc_record.hpp>
+#include <sdk/odbc/types.hpp>
+
+#endif
+
+#endif
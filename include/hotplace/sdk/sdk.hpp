@@ -0,0 +1,20 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file    sdk.hpp
+ * @author  Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK__
+#define __HOTPLACE_SDK__
+
+#include <sdk/base.hpp>
+#include <sdk/crypto.hpp>
+#include <sdk/io.hpp>
+#include <sdk/net.hpp>
+#include <sdk/odbc.hpp>
+
+#endif
@@ -13,7 +13,7 @@
 
 namespace hotplace {
 
-huffman_coding::huffman_coding() {}
+huffman_coding::huffman_coding() : _packed_enable(true), _packed_ready(false) { memset(_packed, 0, sizeof(_packed)); }
 
 huffman_coding::~huffman_coding() {
     _measure.clear();
@@ -97,6 +97,7 @@ huffman_coding &huffman_coding::infer() {
 
         _btree.clean(root);
     }
+    build_table();
 
     return *this;
 }
@@ -191,6 +192,7 @@ huffman_coding &huffman_coding::imports(const hc_code_t *table) {
         _range.test(size);
 #endif
     }
+    build_table();
 
     return *this;
 }
@@ -251,13 +253,19 @@ return_t huffman_coding::expect(const byte_t *source, size_t size, size_t &size_
             __leave2;
         }
 
-        t_maphint_const<uint8, std::string> hint(_codetable);
         size_t i = 0;
         const byte_t *p = source;
-        for (i = 0; i < size; i++) {
-            std::string code;
-            hint.find(p[i], &code);
-            sum += code.size();
+        if (packed()) {
+            for (i = 0; i < size; i++) {
+                sum += _packed[p[i]].bits;
+            }
+        } else {
+            t_maphint_const<uint8, std::string> hint(_codetable);
+            for (i = 0; i < size; i++) {
+                std::string code;
+                hint.find(p[i], &code);
+                sum += code.size();
+            }
         }
 
         /**
@@ -328,6 +336,11 @@ return_t huffman_coding::encode(binary_t &bin, const byte_t *source, size_t size
 #endif
         usepad &= (code_msize >= 5);  // overwrite usepad
 
+        if (packed()) {
+            ret = encode_packed(bin, source, size, usepad);
+            __leave2;
+        }
+
         // align to MSB
         for (p = source, i = 0; i < size; i++) {
             std::string code;
@@ -428,6 +441,11 @@ return_t huffman_coding::decode(stream_t *stream, const byte_t *source, size_t s
             __leave2;
         }
 
+        if (packed()) {
+            ret = decode_packed(stream, source, size);
+            __leave2;
+        }
+
         std::string que;
         std::string token;
 
@@ -470,6 +488,9 @@ return_t huffman_coding::decode(stream_t *stream, const byte_t *source, size_t s
             }
         }
 
+        if (que.size() > 7) {
+            ret = errorcode_t::bad_data;  // padding longer than 7 bits
+        }
         for (auto e : que) {
             if ('1' != e) {
                 ret = errorcode_t::bad_data;
@@ -508,4 +529,193 @@ bool huffman_coding::decodable() {
 
 size_t huffman_coding::sizeof_codetable() { return _codetable.size(); }
 
+huffman_coding &huffman_coding::set_packed(bool enable) {
+    _packed_enable = enable;
+    return *this;
+}
+
+bool huffman_coding::packed() const { return _packed_enable && _packed_ready; }
+
+void huffman_coding::build_table() {
+    struct tree_node_t {
+        int child[2];
+        int symbol;  // -1 internal node
+        int state;   // index of internal node
+        bool ones;   // all 1s from the root
+        int depth;   // bits from the root
+
+        tree_node_t() : symbol(-1), state(-1), ones(true), depth(0) { child[0] = child[1] = -1; }
+    };
+
+    _packed_ready = false;
+    memset(_packed, 0, sizeof(_packed));
+    _decode_table.clear();
+
+    __try2 {
+        std::vector<tree_node_t> nodes;
+        std::vector<int> states;  // internal nodes
+        nodes.resize(1);
+        nodes[0].state = 0;
+        states.push_back(0);
+
+        bool valid = true;
+        size_t code_msize = (size_t)-1;
+        for (const auto &item : _codetable) {
+            const std::string &code = item.second;
+            size_t bits = code.size();
+            if ((0 == bits) || (bits > 32)) {
+                valid = false;
+                break;
+            }
+            if (bits < code_msize) {
+                code_msize = bits;
+            }
+
+            uint32 value = 0;
+            int node = 0;
+            for (size_t i = 0; i < bits; i++) {
+                int bit = ('1' == code[i]) ? 1 : 0;
+                value = (value << 1) | bit;
+                if (-1 != nodes[node].symbol) {
+                    break;  // prefix of the other code
+                }
+                int next = nodes[node].child[bit];
+                if (-1 == next) {
+                    next = nodes.size();
+                    tree_node_t temp;
+                    temp.ones = nodes[node].ones && bit;
+                    temp.depth = nodes[node].depth + 1;
+                    nodes.push_back(temp);
+                    nodes[node].child[bit] = next;
+                }
+                node = next;
+            }
+            if ((-1 != nodes[node].symbol) || (-1 != nodes[node].child[0]) || (-1 != nodes[node].child[1])) {
+                valid = false;  // not a prefix code
+                break;
+            }
+            nodes[node].symbol = item.first;
+
+            _packed[item.first].code = value;
+            _packed[item.first].bits = bits;
+        }
+        if ((false == valid) || _codetable.empty() || (code_msize <= 4)) {
+            __leave2;
+        }
+
+        for (size_t i = 1; i < nodes.size(); i++) {
+            if (-1 == nodes[i].symbol) {
+                nodes[i].state = states.size();
+                states.push_back(i);
+            }
+        }
+        if (states.size() > 0xffff) {
+            __leave2;
+        }
+
+        _decode_table.resize(states.size() << 4);
+        for (size_t s = 0; s < states.size(); s++) {
+            for (int nibble = 0; nibble < 16; nibble++) {
+                decode_entry_t &entry = _decode_table[(s << 4) | nibble];
+                entry.state = 0;
+                entry.flags = 0;
+                entry.symbol = 0;
+
+                int node = states[s];
+                for (int n = 3; n >= 0; n--) {
+                    node = nodes[node].child[(nibble >> n) & 1];
+                    if (-1 == node) {
+                        entry.flags = decode_fail;
+                        break;
+                    }
+                    if (-1 != nodes[node].symbol) {
+                        entry.flags |= decode_emit;
+                        entry.symbol = nodes[node].symbol;
+                        node = 0;
+                    }
+                }
+                if (-1 != node) {
+                    entry.state = nodes[node].state;
+                    // RFC 7541 5.2.  String Literal Representation
+                    //   padding strictly longer than 7 bits MUST be treated as a decoding error
+                    if (nodes[node].ones && (nodes[node].depth <= 7)) {
+                        entry.flags |= decode_accept;
+                    }
+                }
+            }
+        }
+
+        _packed_ready = true;
+    }
+    __finally2 {
+        if (false == _packed_ready) {
+            memset(_packed, 0, sizeof(_packed));
+            _decode_table.clear();
+        }
+    }
+}
+
+return_t huffman_coding::encode_packed(binary_t &bin, const byte_t *source, size_t size, bool usepad) const {
+    return_t ret = errorcode_t::success;
+    uint64 acc = 0;  // the lower nbits are pending
+    size_t nbits = 0;
+
+    bin.reserve(bin.size() + size);
+    for (size_t i = 0; i < size; i++) {
+        const packed_code_t &item = _packed[source[i]];
+        acc = (acc << item.bits) | item.code;
+        nbits += item.bits;
+        while (nbits >= 8) {
+            nbits -= 8;
+            bin.push_back((byte_t)(acc >> nbits));
+        }
+    }
+    if (nbits) {
+        size_t padsize = 8 - nbits;
+        acc <<= padsize;
+        if (usepad) {
+            acc |= (1 << padsize) - 1;  // the most significant bits of EOS
+        }
+        bin.push_back((byte_t)acc);
+    }
+
+    return ret;
+}
+
+return_t huffman_coding::decode_packed(stream_t *stream, const byte_t *source, size_t size) const {
+    return_t ret = errorcode_t::success;
+    byte_t buf[256];
+    size_t len = 0;
+    uint16 state = 0;
+    uint8 flags = decode_accept;
+
+    for (size_t i = 0; (i < size) && (errorcode_t::success == ret); i++) {
+        byte_t b = source[i];
+        for (int shift = 4; shift >= 0; shift -= 4) {
+            const decode_entry_t &entry = _decode_table[(state << 4) | ((b >> shift) & 0x0f)];
+            if (decode_fail & entry.flags) {
+                ret = errorcode_t::bad_data;
+                break;
+            }
+            if (decode_emit & entry.flags) {
+                buf[len++] = entry.symbol;
+                if (sizeof(buf) == len) {
+                    stream->write(buf, len);
+                    len = 0;
+                }
+            }
+            state = entry.state;
+            flags = entry.flags;
+        }
+    }
+    if (len) {
+        stream->write(buf, len);
+    }
+    if ((errorcode_t::success == ret) && (0 == (decode_accept & flags))) {
+        ret = errorcode_t::bad_data;  // padding not corresponding to the most significant bits of EOS
+    }
+
+    return ret;
+}
+
 }  // namespace hotplace
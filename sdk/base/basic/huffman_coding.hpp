@@ -19,6 +19,7 @@
 #include <sdk/base/nostd/range.hpp>
 #include <sdk/base/nostd/tree.hpp>
 #include <sdk/base/pattern/trie.hpp>
+#include <vector>
 
 #define SWITCH_HUFFMANCODING_TRIE 1
 
@@ -167,6 +168,13 @@ class huffman_coding {
      * @brief   check min(code len in bits) >= 5
      */
     bool decodable();
+    /**
+     * @brief   bit-packed encoder and 4-bit state table decoder (default true)
+     * @remarks
+     *          false - bitstring encoder and trie decoder (see SWITCH_HUFFMANCODING_TRIE), for comparison
+     *          codes longer than 32 bits are always handled by the bitstring/trie implementation
+     */
+    huffman_coding &set_packed(bool enable);
 
     size_t sizeof_codetable();
 
@@ -175,7 +183,33 @@ class huffman_coding {
     void build(typename btree_t::node_t *&p);
     void infer(hc_temp &hc, typename btree_t::node_t *t);
 
+    /**
+     * @brief   build _packed and _decode_table from _codetable
+     * @remarks
+     *          _decode_table[state << 4 | nibble], a state is an internal node of the code tree (root 0)
+     *          min(code len in bits) >= 5, so a nibble emits a symbol at most once
+     */
+    void build_table();
+    bool packed() const;
+    return_t encode_packed(binary_t &bin, const byte_t *source, size_t size, bool usepad) const;
+    return_t decode_packed(stream_t *stream, const byte_t *source, size_t size) const;
+
    private:
+    struct packed_code_t {
+        uint32 code;  // LSB aligned
+        uint8 bits;   // 0 if not in the code table
+    };
+    enum decode_flag_t {
+        decode_emit = 1,    // symbol
+        decode_fail = 2,    // no such code
+        decode_accept = 4,  // at most 7 bits, all 1s so far, a valid padding (EOS prefix)
+    };
+    struct decode_entry_t {
+        uint16 state;
+        uint8 flags;
+        uint8 symbol;
+    };
+
     measure_tree_t _measure;
     btree_t _btree;
     map_t _m;
@@ -186,6 +220,10 @@ class huffman_coding {
     t_trie<char> _trie;
     t_range<size_t> _range;
 #endif
+    bool _packed_enable;
+    bool _packed_ready;
+    packed_code_t _packed[256];
+    std::vector<decode_entry_t> _decode_table;
 };
 
 }  // namespace hotplace
@@ -78,7 +78,7 @@ return_t openssl_crypt::encrypt(crypt_context_t *handle, const unsigned char *pl
         size_t size_out_allocated = plainsize + EVP_MAX_BLOCK_LENGTH;
         __try_new_catch(output_allocated, new byte_t[size_out_allocated + 1], ret, __leave2);
 
-        ret = encrypt_internal(handle, plaintext, plainsize, output_allocated, &size_out_allocated, nullptr, nullptr);
+        ret = encrypt_internal(handle, plaintext, plainsize, output_allocated, &size_out_allocated);
         if (errorcode_t::success != ret) {
             __leave2;
         }
@@ -134,16 +134,21 @@ return_t openssl_crypt::encrypt(crypt_context_t *handle, const unsigned char *pl
         size_t size_len = plainsize + EVP_MAX_BLOCK_LENGTH;
         ciphertext.resize(size_len);
 
-        ret = encrypt_internal(handle, plaintext, plainsize, &ciphertext[0], &size_len, &aad, &tag);
+        size_t tagsize = 16;  // GCM, CCM, Poly1305
+        tag.resize(tagsize);
+
+        ret = encrypt_internal(handle, plaintext, plainsize, &ciphertext[0], &size_len, aad.data(), aad.size(), &tag[0], &tagsize);
         if (errorcode_t::success != ret) {
             __leave2;
         }
 
         ciphertext.resize(size_len);
+        tag.resize(tagsize);
     }
     __finally2 {
         if (errorcode_t::success != ret) {
             ciphertext.resize(0);
+            tag.resize(0);
         }
     }
 
@@ -154,6 +159,12 @@ return_t openssl_crypt::encrypt(crypt_context_t *handle, const binary_t &plainte
     return encrypt(handle, &plaintext[0], plaintext.size(), ciphertext, aad, tag);
 }
 
+return_t openssl_crypt::encrypt(crypt_context_t *handle, const unsigned char *plaintext, size_t plainsize, unsigned char *ciphertext, const byte_t *aad,
+                                size_t aadsize, byte_t *tag, size_t &tagsize) {
+    size_t size_len = plainsize;
+    return encrypt_internal(handle, plaintext, plainsize, ciphertext, &size_len, aad, aadsize, tag, &tagsize);
+}
+
 return_t openssl_crypt::decrypt(crypt_context_t *handle, const unsigned char *ciphertext, size_t ciphersize, unsigned char **plaintext, size_t *plainsize) {
     return_t ret = errorcode_t::success;
     byte_t *output_allocated = nullptr;
@@ -167,7 +178,7 @@ return_t openssl_crypt::decrypt(crypt_context_t *handle, const unsigned char *ci
         size_t size_out_allocated = ciphersize + EVP_MAX_BLOCK_LENGTH;
         __try_new_catch(output_allocated, new byte_t[size_out_allocated + 1], ret, __leave2);
 
-        ret = decrypt_internal(handle, ciphertext, ciphersize, output_allocated, &size_out_allocated, nullptr, nullptr);
+        ret = decrypt_internal(handle, ciphertext, ciphersize, output_allocated, &size_out_allocated);
         if (errorcode_t::success != ret) {
             __leave2;
         }
@@ -223,7 +234,7 @@ return_t openssl_crypt::decrypt(crypt_context_t *handle, const unsigned char *ci
         size_t size_len = ciphersize + EVP_MAX_BLOCK_LENGTH;
         plaintext.resize(size_len);
 
-        ret = decrypt_internal(handle, ciphertext, ciphersize, &plaintext[0], &size_len, &aad, &tag);
+        ret = decrypt_internal(handle, ciphertext, ciphersize, &plaintext[0], &size_len, aad.data(), aad.size(), tag.data(), tag.size());
         if (errorcode_t::success != ret) {
             __leave2;
         }
@@ -243,6 +254,12 @@ return_t openssl_crypt::decrypt(crypt_context_t *handle, const binary_t &ciphert
     return decrypt(handle, &ciphertext[0], ciphertext.size(), plaintext, aad, tag);
 }
 
+return_t openssl_crypt::decrypt(crypt_context_t *handle, const unsigned char *ciphertext, size_t ciphersize, unsigned char *plaintext, const byte_t *aad,
+                                size_t aadsize, const byte_t *tag, size_t tagsize) {
+    size_t size_len = ciphersize;
+    return decrypt_internal(handle, ciphertext, ciphersize, plaintext, &size_len, aad, aadsize, tag, tagsize);
+}
+
 return_t openssl_crypt::free_data(unsigned char *data) {
     return_t ret = errorcode_t::success;
 
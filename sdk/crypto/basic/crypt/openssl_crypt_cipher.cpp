@@ -259,8 +259,51 @@ return_t openssl_crypt::set(crypt_context_t *handle, crypt_ctrl_t id, uint16 par
     return ret;
 }
 
+return_t openssl_crypt::set(crypt_context_t *handle, crypt_item_t item, const binary_t &value) { return set(handle, item, value.data(), value.size()); }
+
+return_t openssl_crypt::set(crypt_context_t *handle, crypt_item_t item, const byte_t *value, size_t size) {
+    return_t ret = errorcode_t::success;
+    openssl_crypt_context_t *context = static_cast<openssl_crypt_context_t *>(handle);
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+        if ((nullptr == value) && size) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+        if (OPENSSL_CRYPT_CONTEXT_SIGNATURE != context->signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+        switch (item) {
+            case crypt_item_t::item_iv: {
+                // see open, EVP_MAX_IV_LENGTH
+                binary_t &iv = context->datamap[crypt_item_t::item_iv];
+                if (size > iv.size()) {
+                    ret = errorcode_t::bad_data;
+                    break;
+                }
+                std::fill(iv.begin(), iv.end(), 0);
+                if (size) {
+                    memcpy(&iv[0], value, size);
+                }
+            } break;
+            default:
+                ret = errorcode_t::not_supported;
+                break;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned char *plaintext, size_t plainsize, unsigned char *ciphertext,
-                                         size_t *ciphersize, const binary_t *aad, binary_t *tag) {
+                                         size_t *ciphersize, const byte_t *aad, size_t aadsize, byte_t *tag, size_t *tagsize) {
     return_t ret = errorcode_t::success;
     openssl_crypt_context_t *context = static_cast<openssl_crypt_context_t *>(handle);
 
@@ -280,7 +323,18 @@ return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned
             __leave2;
         }
 
-        size_t size_expect = plainsize + EVP_MAX_BLOCK_LENGTH;
+        // AEAD writes as many bytes as the input (in place)
+        size_t size_expect = plainsize;
+        switch (context->mode) {
+            case crypt_mode_t::gcm:
+            case crypt_mode_t::ccm:
+            case crypt_mode_t::ccm8:
+            case crypt_mode_t::mode_poly1305:
+                break;
+            default:
+                size_expect += EVP_MAX_BLOCK_LENGTH;
+                break;
+        }
         if (*ciphersize < size_expect) {
             ret = errorcode_t::insufficient_buffer;
             __leave2;
@@ -323,7 +377,7 @@ return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned
         }
 
         if (is_aead) {
-            if ((nullptr == aad) || (nullptr == tag)) {
+            if (((nullptr == aad) && aadsize) || (nullptr == tag) || (nullptr == tagsize)) {
                 ret = errorcode_t::invalid_parameter;
                 __leave2_trace(ret);
             }
@@ -381,7 +435,12 @@ return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned
                 }
             }
 
-            ret_cipher = EVP_CipherUpdate(context->encrypt_context, nullptr, &size_update, &(*aad)[0], aad->size());
+            if (tag_size > *tagsize) {
+                ret = errorcode_t::insufficient_buffer;
+                __leave2;
+            }
+
+            ret_cipher = EVP_CipherUpdate(context->encrypt_context, nullptr, &size_update, aad, aadsize);
             if (1 > ret_cipher) {
                 ret = errorcode_t::internal_error;
                 __leave2_trace_openssl(ret);
@@ -444,12 +503,14 @@ return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned
         }
 
         if (is_aead) {
-            tag->resize(tag_size);
-            ret_cipher = EVP_CIPHER_CTX_ctrl(context->encrypt_context, EVP_CTRL_AEAD_GET_TAG, tag->size(), &(*tag)[0]);
+            ret_cipher = EVP_CIPHER_CTX_ctrl(context->encrypt_context, EVP_CTRL_AEAD_GET_TAG, tag_size, tag);
             if (1 > ret_cipher) {
                 ret = errorcode_t::internal_error;
                 __leave2_trace_openssl(ret);
             }
+            *tagsize = tag_size;
+        } else if (tagsize) {
+            *tagsize = 0;
         }
 
         *ciphersize = (size_update + size_final);
@@ -466,7 +527,7 @@ return_t openssl_crypt::encrypt_internal(crypt_context_t *handle, const unsigned
 }
 
 return_t openssl_crypt::decrypt_internal(crypt_context_t *handle, const unsigned char *ciphertext, size_t ciphersize, unsigned char *plaintext,
-                                         size_t *plainsize, const binary_t *aad, const binary_t *tag) {
+                                         size_t *plainsize, const byte_t *aad, size_t aadsize, const byte_t *tag, size_t tagsize) {
     return_t ret = errorcode_t::success;
     openssl_crypt_context_t *context = static_cast<openssl_crypt_context_t *>(handle);
 
@@ -486,7 +547,18 @@ return_t openssl_crypt::decrypt_internal(crypt_context_t *handle, const unsigned
             __leave2;
         }
 
-        size_t size_necessary = ciphersize + EVP_MAX_BLOCK_LENGTH;
+        // AEAD writes as many bytes as the input (in place)
+        size_t size_necessary = ciphersize;
+        switch (context->mode) {
+            case crypt_mode_t::gcm:
+            case crypt_mode_t::ccm:
+            case crypt_mode_t::ccm8:
+            case crypt_mode_t::mode_poly1305:
+                break;
+            default:
+                size_necessary += EVP_MAX_BLOCK_LENGTH;
+                break;
+        }
         if (*plainsize < size_necessary) {
             ret = errorcode_t::insufficient_buffer;
             __leave2;
@@ -514,7 +586,7 @@ return_t openssl_crypt::decrypt_internal(crypt_context_t *handle, const unsigned
         }
 
         if (is_aead) {
-            if ((nullptr == aad) || (nullptr == tag)) {
+            if (((nullptr == aad) && aadsize) || (nullptr == tag)) {
                 ret = errorcode_t::invalid_parameter;
                 __leave2_trace(ret);
             }
@@ -526,21 +598,21 @@ return_t openssl_crypt::decrypt_internal(crypt_context_t *handle, const unsigned
                 EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_CCM_SET_L, lsize, nullptr);
                 // EVP_CTRL_CCM_SET_IVLEN for Nonce (15-L)
                 EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_CCM_SET_IVLEN, nonce_size, nullptr);
-                EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_AEAD_SET_TAG, tag->size(), (void *)&(*tag)[0]);
+                EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_AEAD_SET_TAG, tagsize, (void *)tag);
 
                 binary_t &key = context->datamap[crypt_item_t::item_cek];
                 EVP_CipherInit_ex(context->decrypt_context, nullptr, nullptr, &key[0], &iv[0], 0);
 
                 ret_cipher = EVP_CipherUpdate(context->decrypt_context, nullptr, &size_update, nullptr, ciphersize);
             } else if (crypt_mode_t::gcm == context->mode || crypt_mode_t::mode_poly1305 == context->mode) {
-                ret_cipher = EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_AEAD_SET_TAG, tag->size(), (void *)&(*tag)[0]);
+                ret_cipher = EVP_CIPHER_CTX_ctrl(context->decrypt_context, EVP_CTRL_AEAD_SET_TAG, tagsize, (void *)tag);
                 if (1 != ret_cipher) {
                     ret = errorcode_t::internal_error;
                     __leave2_trace_openssl(ret);
                 }
             }
 
-            ret_cipher = EVP_CipherUpdate(context->decrypt_context, nullptr, &size_update, &(*aad)[0], aad->size());
+            ret_cipher = EVP_CipherUpdate(context->decrypt_context, nullptr, &size_update, aad, aadsize);
             if (1 != ret_cipher) {
                 ret = errorcode_t::internal_error;
                 __leave2_trace_openssl(ret);
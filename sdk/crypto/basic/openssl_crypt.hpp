@@ -220,6 +220,25 @@ class openssl_crypt : public crypt_t {
      *          }
      */
     virtual return_t set(crypt_context_t* handle, crypt_ctrl_t id, uint16 param);
+    /**
+     * @brief set
+     * @param crypt_context_t* handle [in]
+     * @param crypt_item_t item [in] item_iv
+     * @param const binary_t& value [in]
+     * @return error code (see error.hpp)
+     * @remarks
+     *          replace the IV of an opened context, the key schedule is kept
+     *          ex. a nonce per record (TLS, QUIC)
+     * @example
+     *          crypt.open(&handle, crypt_algorithm_t::aes128, crypt_mode_t::gcm, key, iv);
+     *          for (...) {
+     *              crypt.set(handle, crypt_item_t::item_iv, nonce);
+     *              crypt.encrypt(handle, plaintext, ciphertext, aad, tag);
+     *          }
+     *          crypt.close(handle);
+     */
+    return_t set(crypt_context_t* handle, crypt_item_t item, const binary_t& value);
+    return_t set(crypt_context_t* handle, crypt_item_t item, const byte_t* value, size_t size);
 
     /**
      * @brief symmetric encrypt
@@ -275,6 +294,20 @@ class openssl_crypt : public crypt_t {
      * @return error code (see error.hpp)
      */
     virtual return_t encrypt(crypt_context_t* handle, const binary_t& plaintext, binary_t& ciphertext, const binary_t& aad, binary_t& tag);
+    /**
+     * @brief encrypt (GCM/CCM) in place
+     * @param crypt_context_t* handle [in]
+     * @param const unsigned char* plaintext [in]
+     * @param size_t plainsize [in]
+     * @param unsigned char* ciphertext [out] plainsize bytes, ciphertext == plaintext allowed
+     * @param const byte_t* aad [in]
+     * @param size_t aadsize [in]
+     * @param byte_t* tag [out]
+     * @param size_t& tagsize [inout] capacity, written
+     * @return error code (see error.hpp)
+     */
+    return_t encrypt(crypt_context_t* handle, const unsigned char* plaintext, size_t plainsize, unsigned char* ciphertext, const byte_t* aad, size_t aadsize,
+                     byte_t* tag, size_t& tagsize);
 
     /**
      * @brief symmetric decrypt
@@ -332,6 +365,20 @@ class openssl_crypt : public crypt_t {
      * @return error code (see error.hpp)
      */
     virtual return_t decrypt(crypt_context_t* handle, const binary_t& ciphertext, binary_t& plaintext, const binary_t& aad, const binary_t& tag);
+    /**
+     * @brief decrypt (GCM/CCM) in place
+     * @param crypt_context_t* handle [in]
+     * @param const unsigned char* ciphertext [in]
+     * @param size_t ciphersize [in]
+     * @param unsigned char* plaintext [out] ciphersize bytes, plaintext == ciphertext allowed
+     * @param const byte_t* aad [in]
+     * @param size_t aadsize [in]
+     * @param const byte_t* tag [in]
+     * @param size_t tagsize [in]
+     * @return error code (see error.hpp)
+     */
+    return_t decrypt(crypt_context_t* handle, const unsigned char* ciphertext, size_t ciphersize, unsigned char* plaintext, const byte_t* aad, size_t aadsize,
+                     const byte_t* tag, size_t tagsize);
 
     /**
      * @brief free memory
@@ -565,10 +612,13 @@ class openssl_crypt : public crypt_t {
                                   const binary_t& scv, const byte_t* ciphertext, size_t size, binary_t& plaintext, binary_t& tag);
 
    protected:
+    /**
+     * @param   size_t* tagsize [inout] capacity, written
+     */
     return_t encrypt_internal(crypt_context_t* handle, const unsigned char* plaintext, size_t plainsize, unsigned char* ciphertext, size_t* ciphersize,
-                              const binary_t* aad = nullptr, binary_t* tag = nullptr);
+                              const byte_t* aad = nullptr, size_t aadsize = 0, byte_t* tag = nullptr, size_t* tagsize = nullptr);
     return_t decrypt_internal(crypt_context_t* handle, const unsigned char* ciphertext, size_t ciphersize, unsigned char* plaintext, size_t* plainsize,
-                              const binary_t* aad = nullptr, const binary_t* tag = nullptr);
+                              const byte_t* aad = nullptr, size_t aadsize = 0, const byte_t* tag = nullptr, size_t tagsize = 0);
 };
 
 /**
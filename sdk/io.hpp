@@ -18,8 +18,10 @@
 /* basic */
 #include <sdk/io/basic/json.hpp>
 #include <sdk/io/basic/mlfq.hpp>
+#include <sdk/io/basic/object_pool.hpp>
 #include <sdk/io/basic/parser.hpp>
 #include <sdk/io/basic/payload.hpp>
+#include <sdk/io/basic/sharded_mlfq.hpp>
 #include <sdk/io/basic/zlib.hpp>
 
 /* CBOR */
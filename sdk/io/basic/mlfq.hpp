@@ -122,6 +122,14 @@ class t_mlfq {
 
     return_t cancel(TYPENAME_T* source, void* param);
 
+    /**
+     * @brief   wake up a thread waiting in get
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          nothing is posted, the woken get returns errorcode_t::not_found if no data
+     */
+    return_t wakeup();
+
     /**
      * @brief   clear
      * @param   void*             param   [IN] see binder(..., void* param)
@@ -277,6 +285,11 @@ return_t t_mlfq<TYPENAME_T, BINDER_T>::cancel(TYPENAME_T* source, void* param) {
     return ret;
 }
 
+template <typename TYPENAME_T, typename BINDER_T>
+return_t t_mlfq<TYPENAME_T, BINDER_T>::wakeup() {
+    return _semaphore.signal();
+}
+
 template <typename TYPENAME_T, typename BINDER_T>
 size_t t_mlfq<TYPENAME_T, BINDER_T>::size() {
     return _size;
@@ -0,0 +1,187 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#ifndef __HOTPLACE_SDK_IO_BASIC_OBJECTPOOL__
+#define __HOTPLACE_SDK_IO_BASIC_OBJECTPOOL__
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+#include <sdk/base/system/critical_section.hpp>
+#include <sdk/base/types.hpp>
+#include <vector>
+
+namespace hotplace {
+namespace io {
+
+struct object_pool_stat_t {
+    uint64 hit;   // recycled
+    uint64 miss;  // malloc
+    uint64 free;  // returned to the system (the depot is full)
+
+    object_pool_stat_t() : hit(0), miss(0), free(0) {}
+};
+
+/**
+ * @brief   fixed-size block pool
+ * @param   size_t BLOCK_SIZE [IN]
+ * @remarks
+ *          per-thread cache (no lock) in front of a shared depot (critical_section)
+ *          a block freed by the other thread (network thread allocates, consumer thread releases) is cached by the freeing thread
+ *          and handed back to the depot in batches, so the depot lock is taken once per POOL_BATCH blocks
+ *
+ *          one instance per BLOCK_SIZE, see get_instance
+ *
+ *          class object {
+ *              static void* operator new(size_t size) { return t_object_pool<sizeof(object)>::get_instance().alloc(); }
+ *              static void operator delete(void* ptr) { t_object_pool<sizeof(object)>::get_instance().free(ptr); }
+ *          };
+ */
+template <size_t BLOCK_SIZE>
+class t_object_pool {
+   public:
+    static constexpr size_t POOL_BATCH = 32;       // blocks moved between a thread cache and the depot at once
+    static constexpr size_t POOL_CACHE = 64;       // blocks per thread cache
+    static constexpr size_t POOL_DEPOT = 1 << 14;  // blocks kept in the depot, more are returned to the system
+
+    static t_object_pool& get_instance();
+
+    /**
+     * @brief   allocate a block (BLOCK_SIZE bytes)
+     * @return  nullptr if out of memory
+     */
+    void* alloc();
+    /**
+     * @brief   recycle a block
+     */
+    void free(void* ptr);
+    /**
+     * @brief   counters
+     */
+    void get_stat(object_pool_stat_t* stat);
+
+   protected:
+    t_object_pool();
+    ~t_object_pool();
+
+    struct cache_t {
+        std::vector<void*> blocks;
+
+        cache_t() { blocks.reserve(POOL_CACHE + POOL_BATCH); }
+        ~cache_t() { get_instance().flush(this, 0); }  // thread exit
+    };
+    static cache_t& get_cache();
+
+    void fill(cache_t* cache);
+    void flush(cache_t* cache, size_t keep);
+
+   private:
+    critical_section _lock;
+    std::vector<void*> _depot;
+    std::atomic<uint64> _hit;
+    std::atomic<uint64> _miss;
+    std::atomic<uint64> _free;
+};
+
+template <size_t BLOCK_SIZE>
+t_object_pool<BLOCK_SIZE>& t_object_pool<BLOCK_SIZE>::get_instance() {
+    static t_object_pool<BLOCK_SIZE> instance;
+    return instance;
+}
+
+template <size_t BLOCK_SIZE>
+t_object_pool<BLOCK_SIZE>::t_object_pool() : _hit(0), _miss(0), _free(0) {
+    // do nothing
+}
+
+template <size_t BLOCK_SIZE>
+t_object_pool<BLOCK_SIZE>::~t_object_pool() {
+    critical_section_guard guard(_lock);
+    for (auto ptr : _depot) {
+        ::free(ptr);
+    }
+    _depot.clear();
+}
+
+template <size_t BLOCK_SIZE>
+typename t_object_pool<BLOCK_SIZE>::cache_t& t_object_pool<BLOCK_SIZE>::get_cache() {
+    // thread_local objects are destroyed before the static instance (get_instance)
+    get_instance();
+    static thread_local cache_t cache;
+    return cache;
+}
+
+template <size_t BLOCK_SIZE>
+void* t_object_pool<BLOCK_SIZE>::alloc() {
+    void* ptr = nullptr;
+    cache_t& cache = get_cache();
+
+    if (cache.blocks.empty()) {
+        fill(&cache);
+    }
+    if (cache.blocks.empty()) {
+        ptr = malloc(BLOCK_SIZE);
+        _miss.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        ptr = cache.blocks.back();
+        cache.blocks.pop_back();
+        _hit.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ptr;
+}
+
+template <size_t BLOCK_SIZE>
+void t_object_pool<BLOCK_SIZE>::free(void* ptr) {
+    if (ptr) {
+        cache_t& cache = get_cache();
+        cache.blocks.push_back(ptr);
+        if (cache.blocks.size() > POOL_CACHE) {
+            flush(&cache, POOL_CACHE - POOL_BATCH);
+        }
+    }
+}
+
+template <size_t BLOCK_SIZE>
+void t_object_pool<BLOCK_SIZE>::get_stat(object_pool_stat_t* stat) {
+    if (stat) {
+        stat->hit = _hit.load(std::memory_order_relaxed);
+        stat->miss = _miss.load(std::memory_order_relaxed);
+        stat->free = _free.load(std::memory_order_relaxed);
+    }
+}
+
+template <size_t BLOCK_SIZE>
+void t_object_pool<BLOCK_SIZE>::fill(cache_t* cache) {
+    critical_section_guard guard(_lock);
+    size_t count = (_depot.size() < POOL_BATCH) ? _depot.size() : POOL_BATCH;
+    cache->blocks.insert(cache->blocks.end(), _depot.end() - count, _depot.end());
+    _depot.resize(_depot.size() - count);
+}
+
+template <size_t BLOCK_SIZE>
+void t_object_pool<BLOCK_SIZE>::flush(cache_t* cache, size_t keep) {
+    critical_section_guard guard(_lock);
+    while (cache->blocks.size() > keep) {
+        void* ptr = cache->blocks.back();
+        cache->blocks.pop_back();
+        if (_depot.size() < POOL_DEPOT) {
+            _depot.push_back(ptr);
+        } else {
+            ::free(ptr);
+            _free.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+}  // namespace io
+}  // namespace hotplace
+
+#endif
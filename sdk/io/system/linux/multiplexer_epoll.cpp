@@ -12,6 +12,7 @@
  * https://man7.org/linux/man-pages/man2/epoll_create.2.html
  *  epoll_create    linux 2.6.8, glibc 2.3.2
  *  epoll_create1   linux 2.6.27, glibc 2.9
+ *  EPOLLEXCLUSIVE  linux 4.5
  */
 
 #include <sys/epoll.h>
@@ -28,12 +29,22 @@ namespace io {
 #ifndef EPOLLRDHUP
 #define EPOLLRDHUP 0
 #endif
+#ifndef EPOLLEXCLUSIVE
+#define EPOLLEXCLUSIVE 0
+#endif
+
+#define MULTIPLEXER_EPOLL_EVENTS (EPOLLIN | EPOLLHUP | EPOLLRDHUP)
+#define MULTIPLEXER_EPOLL_EVENTS_ONESHOT (MULTIPLEXER_EPOLL_EVENTS | EPOLLONESHOT)
+#define MULTIPLEXER_EPOLL_EVENTS_EDGE_TRIGGERED (MULTIPLEXER_EPOLL_EVENTS_ONESHOT | EPOLLET)
+// epoll_event.data.u64, the low 32 bits hold the descriptor
+#define MULTIPLEXER_EPOLL_DATA_REARM (1ULL << 32) /* bind, re-armed by event_loop_run */
+#define MULTIPLEXER_EPOLL_DATA_FD(data) ((handle_t)(int)(uint32)((data).u64))
 
 typedef struct _multiplexer_epoll_context_t : public multiplexer_context_t {
     uint32 signature;
     handle_t epoll_fd;
     int concurrent;
-    struct epoll_event* events;
+    uint32 options;  // see multiplexer_option_t
     multiplexer_controller_context_t* handle_controller;
 } multiplexer_epoll_context_t;
 
@@ -49,7 +60,6 @@ return_t multiplexer_epoll::open(multiplexer_context_t** handle, size_t concurre
     return_t ret = errorcode_t::success;
     multiplexer_epoll_context_t* context = nullptr;
     handle_t epollfd = -1;
-    struct epoll_event* events = nullptr;
     multiplexer_controller_context_t* handle_controller = nullptr;
     multiplexer_controller controller;
 
@@ -61,12 +71,6 @@ return_t multiplexer_epoll::open(multiplexer_context_t** handle, size_t concurre
             __leave2;
         }
 
-        events = (struct epoll_event*)malloc(sizeof(struct epoll_event) * concurrent);
-        if (nullptr == events) {
-            ret = errorcode_t::out_of_memory;
-            __leave2;
-        }
-
         epollfd = epoll_create(concurrent);
         if (epollfd < 0) {
             ret = errno;
@@ -75,17 +79,14 @@ return_t multiplexer_epoll::open(multiplexer_context_t** handle, size_t concurre
 
         context->signature = MULTIPLEXER_EPOLL_CONTEXT_SIGNATURE;
         context->epoll_fd = epollfd;
-        context->events = events;
         context->concurrent = concurrent;
+        context->options = 0;
         context->handle_controller = handle_controller;
 
         *handle = context;
     }
     __finally2 {
         if (errorcode_t::success != ret) {
-            if (nullptr != events) {
-                free(events);
-            }
             if (-1 != epollfd) {
                 ::close(epollfd);
             }
@@ -116,7 +117,6 @@ return_t multiplexer_epoll::close(multiplexer_context_t* handle) {
         event_loop_break(handle);
 
         ::close(context->epoll_fd);
-        free(context->events);
 
         controller.close(context->handle_controller);
 
@@ -146,8 +146,28 @@ return_t multiplexer_epoll::bind(multiplexer_context_t* handle, handle_t eventso
 
         struct epoll_event ev;
         memset(&ev, 0, sizeof(ev));
-        ev.events = EPOLLIN | EPOLLHUP | EPOLLRDHUP;
-        ev.data.fd = eventsource;
+        ev.events = MULTIPLEXER_EPOLL_EVENTS;
+        ev.data.u64 = (uint32)eventsource;
+
+        bool edge_triggered = (multiplexer_option_t::mux_option_edge_triggered & context->options) ? true : false;
+        int acceptconn = 0;
+        socklen_t optlen = sizeof(acceptconn);
+        getsockopt(eventsource, SOL_SOCKET, SO_ACCEPTCONN, &acceptconn, &optlen);
+        if (acceptconn) {
+            if (edge_triggered) {
+                // wake up one waiter per incoming connection
+                ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+            }
+        } else {
+            int socktype = 0;
+            typeof_socket((socket_t)eventsource, socktype);
+            if (SOCK_STREAM == socktype) {
+                // exactly one thread per readable socket, see event_loop_run
+                // without EPOLLONESHOT a level-triggered event is reported to every waiting thread
+                ev.events = edge_triggered ? MULTIPLEXER_EPOLL_EVENTS_EDGE_TRIGGERED : MULTIPLEXER_EPOLL_EVENTS_ONESHOT;
+                ev.data.u64 |= MULTIPLEXER_EPOLL_DATA_REARM;
+            }
+        }
         int ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_ADD, eventsource, &ev);
         if (ret_epoll_ctl < 0) {
             ret = errno;
@@ -176,8 +196,9 @@ return_t multiplexer_epoll::unbind(multiplexer_context_t* handle, handle_t event
         }
 
         struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
         ev.events = EPOLLIN;
-        ev.data.fd = eventsource;
+        ev.data.u64 = (uint32)eventsource;
         int ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_DEL, eventsource, &ev);
         if (ret_epoll_ctl < 0) {
             ret = errno;
@@ -191,11 +212,90 @@ return_t multiplexer_epoll::unbind(multiplexer_context_t* handle, handle_t event
     return ret;
 }
 
+return_t multiplexer_epoll::bind_oneshot(multiplexer_context_t* handle, handle_t eventsource, uint32 flags) {
+    return_t ret = errorcode_t::success;
+    multiplexer_epoll_context_t* context = (multiplexer_epoll_context_t*)handle;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (MULTIPLEXER_EPOLL_CONTEXT_SIGNATURE != context->signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLONESHOT;
+        if (SOCK_WAIT_READABLE & flags) {
+            ev.events |= (EPOLLIN | EPOLLRDHUP);
+        }
+        if (SOCK_WAIT_WRITABLE & flags) {
+            ev.events |= EPOLLOUT;
+        }
+        ev.data.u64 = (uint32)eventsource; /* re-armed by the caller */
+
+        int ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_MOD, eventsource, &ev);
+        if ((ret_epoll_ctl < 0) && (ENOENT == errno)) {
+            ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_ADD, eventsource, &ev);
+        }
+        if (ret_epoll_ctl < 0) {
+            ret = errno;
+            __leave2;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t multiplexer_epoll::bind_writable(multiplexer_context_t* handle, handle_t eventsource, handle_t socket) {
+    return_t ret = errorcode_t::success;
+    multiplexer_epoll_context_t* context = (multiplexer_epoll_context_t*)handle;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (MULTIPLEXER_EPOLL_CONTEXT_SIGNATURE != context->signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLOUT | EPOLLONESHOT;
+        ev.data.u64 = (uint32)socket; /* the event is reported for the socket, not for the duplicate */
+
+        int ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_MOD, eventsource, &ev);
+        if ((ret_epoll_ctl < 0) && (ENOENT == errno)) {
+            ret_epoll_ctl = epoll_ctl(context->epoll_fd, EPOLL_CTL_ADD, eventsource, &ev);
+        }
+        if (ret_epoll_ctl < 0) {
+            ret = errno;
+            __leave2;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
 return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle_t listenfd, TYPE_CALLBACK_HANDLEREXV event_callback_routine, void* parameter) {
     return_t ret = errorcode_t::success;
     multiplexer_epoll_context_t* context = (multiplexer_epoll_context_t*)handle;
     arch_t token_handle = 0;
     multiplexer_controller controller;
+    struct epoll_event* events = nullptr;
 
     __try2 {
         if (nullptr == handle) {
@@ -207,6 +307,13 @@ return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle
             __leave2;
         }
 
+        // per-thread, concurrent event loops must not share the result array
+        events = (struct epoll_event*)malloc(sizeof(struct epoll_event) * context->concurrent);
+        if (nullptr == events) {
+            ret = errorcode_t::out_of_memory;
+            __leave2;
+        }
+
         ret = controller.event_loop_new(context->handle_controller, &token_handle);
         if (errorcode_t::success != ret) {
             __leave2;
@@ -215,6 +322,7 @@ return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle
         int socktype = 0;
         typeof_socket((socket_t)listenfd, socktype);
         bool is_dgram = (SOCK_DGRAM == socktype);
+        bool edge_triggered = (multiplexer_option_t::mux_option_edge_triggered & context->options) ? true : false;
 
         while (true) {
             bool ret_event_loop_test_broken = controller.event_loop_test_broken(context->handle_controller, token_handle);
@@ -222,7 +330,7 @@ return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle
                 break;
             }
 
-            int ret_epoll_wait = epoll_wait(context->epoll_fd, context->events, context->concurrent, 100);  // 100ms
+            int ret_epoll_wait = epoll_wait(context->epoll_fd, events, context->concurrent, 100);  // 100ms
             if (0 == ret_epoll_wait) {
                 continue;
             }
@@ -239,15 +347,27 @@ return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle
                 void* data_vector[4] = {
                     nullptr,
                 };
+                handle_t eventsource = MULTIPLEXER_EPOLL_DATA_FD(events[i].data);
                 data_vector[0] = handle;
-                data_vector[1] = (void*)(arch_t)context->events[i].data.fd;
+                data_vector[1] = (void*)(arch_t)eventsource;
 
-                if (context->events[i].data.fd == listenfd) {
+                if (eventsource == listenfd) {
                     multiplexer_event_type_t type = (is_dgram ? multiplexer_event_type_t::mux_dgram : multiplexer_event_type_t::mux_connect);
                     event_callback_routine(type, 2, data_vector, &callback_control, parameter);
-                } else if (context->events[i].events & EPOLLIN) {
+                } else if (events[i].events & EPOLLIN) {
                     event_callback_routine(multiplexer_event_type_t::mux_read, 2, data_vector, &callback_control, parameter);
-                } else if (context->events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) {
+                    if ((MULTIPLEXER_EPOLL_DATA_REARM & events[i].data.u64) && (STOP_CONTROL != callback_control)) {
+                        // EPOLLONESHOT, re-arm after the callback has read the socket (drained if edge-triggered)
+                        struct epoll_event ev;
+                        memset(&ev, 0, sizeof(ev));
+                        ev.events = edge_triggered ? MULTIPLEXER_EPOLL_EVENTS_EDGE_TRIGGERED : MULTIPLEXER_EPOLL_EVENTS_ONESHOT;
+                        ev.data.u64 = events[i].data.u64;
+                        epoll_ctl(context->epoll_fd, EPOLL_CTL_MOD, eventsource, &ev);
+                    }
+                } else if (events[i].events & EPOLLOUT) {
+                    // see bind_oneshot, bind_writable
+                    event_callback_routine(multiplexer_event_type_t::mux_write, 2, data_vector, &callback_control, parameter);
+                } else if (events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) {
                     event_callback_routine(multiplexer_event_type_t::mux_disconnect, 2, data_vector, &callback_control, parameter);
                 }
             }
@@ -256,7 +376,9 @@ return_t multiplexer_epoll::event_loop_run(multiplexer_context_t* handle, handle
         controller.event_loop_close(context->handle_controller, token_handle);
     }
     __finally2 {
-        // do nothing
+        if (nullptr != events) {
+            free(events);
+        }
     }
 
     return ret;
@@ -318,7 +440,28 @@ return_t multiplexer_epoll::post(multiplexer_context_t* handle, uint32 size_veco
     return ret;
 }
 
-return_t multiplexer_epoll::setoption(multiplexer_context_t* handle, arch_t optionvalue, size_t size_optionvalue) { return errorcode_t::not_supported; }
+return_t multiplexer_epoll::setoption(multiplexer_context_t* handle, arch_t optionvalue, size_t size_optionvalue) {
+    return_t ret = errorcode_t::success;
+    multiplexer_epoll_context_t* context = (multiplexer_epoll_context_t*)handle;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+        if (MULTIPLEXER_EPOLL_CONTEXT_SIGNATURE != context->signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        context->options = (uint32)optionvalue;
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
 
 multiplexer_type_t multiplexer_epoll::type() { return mux_type_epoll; }
 
@@ -35,6 +35,20 @@ enum multiplexer_event_type_t {
     mux_dgram = 5,      /* datagram read */
 };
 
+/**
+ * @brief   multiplexer option (see setoption)
+ */
+enum multiplexer_option_t {
+    /**
+     * epoll
+     *  without the option, a stream client socket bound by bind is EPOLLONESHOT and re-armed after mux_read as well
+     *  client socket   EPOLLET | EPOLLONESHOT, re-armed after mux_read unless the callback sets STOP_CONTROL
+     *  listen socket   EPOLLEXCLUSIVE (linux 4.5~)
+     *  an event is delivered to exactly one event_loop_run thread, so the callback must read until EAGAIN
+     */
+    mux_option_edge_triggered = (1 << 0),
+};
+
 typedef struct {
 } multiplexer_context_t;
 typedef struct {
@@ -233,6 +247,31 @@ class multiplexer_epoll {
      * @return  error code (see error.hpp)
      */
     return_t unbind(multiplexer_context_t* handle, handle_t eventsource, void* data);
+    /**
+     * @brief   bind or re-arm for a single notification (EPOLLONESHOT)
+     * @param   multiplexer_context_t* handle [IN] handle
+     * @param   handle_t eventsource [IN] client socket
+     * @param   uint32 flags [IN] see SOCK_WAIT_FLAGS
+     *              SOCK_WAIT_READABLE  mux_read
+     *              SOCK_WAIT_WRITABLE  mux_write
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          an event is delivered to exactly one event_loop_run thread and never re-armed by event_loop_run
+     *          call unbind before bind to switch to the normal mode
+     */
+    return_t bind_oneshot(multiplexer_context_t* handle, handle_t eventsource, uint32 flags);
+    /**
+     * @brief   a single writable notification (EPOLLOUT|EPOLLONESHOT) reported as mux_write of the socket
+     * @param   multiplexer_context_t* handle [IN] handle
+     * @param   handle_t eventsource [IN] a duplicate (dup) of the socket, registered instead of the socket
+     * @param   handle_t socket [IN] client socket, data[1] of mux_write
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          the readable registration of the socket (see bind) is left as it is, no other thread starts reading
+     *          call unbind (eventsource) before closing the duplicate, epoll keeps the registration while the socket is open
+     * @sa      network_session::send
+     */
+    return_t bind_writable(multiplexer_context_t* handle, handle_t eventsource, handle_t socket);
 
     /**
      * @brief loop
@@ -243,9 +282,12 @@ class multiplexer_epoll {
      *              data[1] eventsource depends on multiplexer_event_type_t
      *              multiplexer_event_type_t::mux_connect listen-socket
      *              multiplexer_event_type_t::mux_read client-socket
+     *              multiplexer_event_type_t::mux_write client-socket (see bind_oneshot, bind_writable)
+     *              CALLBACK_CONTROL* STOP_CONTROL - do not re-arm a stream client socket bound by bind
      * @param   void* user_context [IN]
      * @return  error code (see error.hpp)
      * @reamrks
+     *          each event loop owns its own epoll_event array
      */
     return_t event_loop_run(multiplexer_context_t* handle, handle_t listenfd, TYPE_CALLBACK_HANDLEREXV lpfnEventHandler, void* user_context);
     /**
@@ -275,10 +317,14 @@ class multiplexer_epoll {
     /**
      * @brief   setoption
      * @param   multiplexer_context_t* handle [IN]
-     * @param   arch_t optionvalue [IN]
-     * @param   size_t size_optionvalue [IN]
+     * @param   arch_t optionvalue [IN] see multiplexer_option_t
+     * @param   size_t size_optionvalue [IN] reserved
      * @return  error code (see error.hpp)
-     * @remarks reserved
+     * @remarks
+     *          call before bind
+     *
+     *          mplexer.open(&handle, 1024);
+     *          mplexer.setoption(handle, multiplexer_option_t::mux_option_edge_triggered, 0);
      */
     return_t setoption(multiplexer_context_t* handle, arch_t optionvalue, size_t size_optionvalue);
     /**
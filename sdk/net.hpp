@@ -32,10 +32,12 @@
 #include <sdk/net/http/http_authentication_resolver.hpp>
 #include <sdk/net/http/http_client.hpp>
 #include <sdk/net/http/http_header.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_protocol.hpp>
 #include <sdk/net/http/http_request.hpp>
 #include <sdk/net/http/http_resource.hpp>
 #include <sdk/net/http/http_response.hpp>
+#include <sdk/net/http/http_route_tree.hpp>
 #include <sdk/net/http/http_router.hpp>
 #include <sdk/net/http/http_server.hpp>
 #include <sdk/net/http/http_server_builder.hpp>
@@ -92,6 +94,7 @@
 #include <sdk/net/tls/tls/tls.hpp>
 #include <sdk/net/tls/tls_advisor.hpp>
 #include <sdk/net/tls/tls_protection.hpp>
+#include <sdk/net/tls/tls_resumption.hpp>
 #include <sdk/net/tls/tls_session.hpp>
 #include <sdk/net/tls/types.hpp>
 
@@ -129,6 +132,7 @@
 #include <sdk/net/tls/tls/extension/tls_extension_alps.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_builder.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_compress_certificate.hpp>
+#include <sdk/net/tls/tls/extension/tls_extension_early_data.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_ec_point_formats.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_encrypted_client_hello.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_key_share.hpp>
@@ -58,6 +58,31 @@ class server_socket : public basic_socket {
      *          do nothing, return errorcode_t::success
      */
     virtual return_t tls_accept(socket_t clisock, tls_context_t** tls_handle) { return errorcode_t::not_supported; }
+    /**
+     * @brief   non-blocking tls accept
+     * @param   socket_t        clisock         [IN] client socket
+     * @param   tls_context_t** tls_handle      [OUT] Tls context
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          see tls_accept_continue
+     */
+    virtual return_t tls_accept_begin(socket_t clisock, tls_context_t** tls_handle) { return errorcode_t::not_supported; }
+    /**
+     * @brief   progress a tls accept without blocking
+     * @param   tls_context_t*  tls_handle      [IN] Tls context
+     * @param   uint32*         wait            [OUT] see SOCK_WAIT_FLAGS
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    call again when the socket is ready
+     */
+    virtual return_t tls_accept_continue(tls_context_t* tls_handle, uint32* wait) { return errorcode_t::not_supported; }
+    /**
+     * @brief   TLS 1.3 0-RTT early data read during the tls accept
+     * @param   tls_context_t*  tls_handle      [IN] Tls context
+     * @param   binary_t&       data            [OUT] moved out
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_found  no early data
+     */
+    virtual return_t tls_accept_early_data(tls_context_t* tls_handle, binary_t& data) { return errorcode_t::not_supported; }
     /**
      * @brief   tls_stop_accept
      */
@@ -92,6 +117,18 @@ class server_socket : public basic_socket {
                               socklen_t* addrlen) {
         return errorcode_t::success;
     }
+    /**
+     * @brief   receive datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [INOUT] ptr, bufsize [IN] size, segment, addr, addrlen [OUT]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT] number of datagrams received
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          does not block
+     */
+    virtual return_t recvmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) { return errorcode_t::not_supported; }
     /**
      * @brief   send
      * @param   socket_t        sock            [IN]
@@ -100,6 +137,7 @@ class server_socket : public basic_socket {
      * @param   size_t          size_data       [IN]
      * @param   size_t*         cbsent          [OUT]
      * @return  error code (see error.hpp)
+     *          errorcode_t::pending    the send buffer is full, *cbsent bytes are sent, the rest when writable (see network_session::writable)
      */
     virtual return_t send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent) { return errorcode_t::success; }
     /**
@@ -117,6 +155,48 @@ class server_socket : public basic_socket {
                             socklen_t addrlen) {
         return errorcode_t::success;
     }
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const sendbuf_t* bufs           [IN] ptr, size
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    see send
+     * @remarks
+     *          the pieces are not copied into a contiguous buffer
+     */
+    virtual return_t sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent) {
+        return errorcode_t::not_supported;
+    }
+    /**
+     * @brief   send a file
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   handle_t        fd              [IN] file
+     * @param   uint64          offset          [IN]
+     * @param   size_t          size            [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  TLS, the caller sends the content
+     *          errorcode_t::pending        see send
+     * @remarks
+     *          [linux] sendfile, the content is not copied into the user space
+     */
+    virtual return_t sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent) {
+        return errorcode_t::not_supported;
+    }
+    /**
+     * @brief   send datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [IN] ptr, size, segment, addr, addrlen
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT] number of datagrams sent
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t sendmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) { return errorcode_t::not_supported; }
 
    protected:
 };
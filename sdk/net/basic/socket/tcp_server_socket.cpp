@@ -9,6 +9,10 @@
  */
 
 #include <sdk/net/basic/socket/tcp_server_socket.hpp>
+#if defined __linux__
+#include <sys/sendfile.h>
+#include <sys/uio.h>
+#endif
 
 namespace hotplace {
 namespace net {
@@ -69,7 +73,8 @@ return_t tcp_server_socket::read(socket_t sock, tls_context_t* tls_handle, int m
 #if defined _WIN32 || defined _WIN64
         int ret_routine = ::recv(sock, ptr_data, (int)size_data, 0);
 #elif defined __linux__
-        int ret_routine = ::recv(sock, ptr_data, size_data, 0);
+        int flags = (tls_io_flag_t::dontwait_msg & mode) ? MSG_DONTWAIT : 0;
+        int ret_routine = ::recv(sock, ptr_data, size_data, flags);
 #endif
         if (-1 == ret_routine) {
             ret = get_lasterror(ret_routine);
@@ -88,24 +93,144 @@ return_t tcp_server_socket::read(socket_t sock, tls_context_t* tls_handle, int m
 
 return_t tcp_server_socket::send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent) {
     return_t ret = errorcode_t::success;
+    size_t sent = 0;
 
     __try2 {
 #if defined _WIN32 || defined _WIN64
         int ret_routine = ::send(sock, ptr_data, (int)size_data, 0);
-#elif defined __linux__
-        int ret_routine = ::send(sock, ptr_data, size_data, 0);
-#endif
         if (-1 == ret_routine) {
             ret = get_lasterror(ret_routine);
-        } else if (0 == ret_routine) {
-            // closed
+        } else {
+            sent = ret_routine;
+        }
+#elif defined __linux__
+        while (sent < size_data) {
+            int ret_routine = ::send(sock, ptr_data + sent, size_data - sent, 0);
+            if (-1 == ret_routine) {
+                ret = get_lasterror(ret_routine);
+                if (errorcode_t::eagain == ret) {
+                    // the send buffer is full, continued when writable (see network_session::writable)
+                    ret = errorcode_t::pending;
+                }
+                break;
+            }
+            sent += ret_routine;
+        }
+#endif
+    }
+    __finally2 {
+        if (nullptr != cbsent) {
+            *cbsent = sent;
+        }
+    }
+
+    return ret;
+}
+
+return_t tcp_server_socket::sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent) {
+    return_t ret = errorcode_t::success;
+    size_t sent = 0;
+
+    __try2 {
+        if (tls_handle) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+#if defined __linux__
+        off_t pos = offset;
+        while (sent < size) {
+            ssize_t ret_routine = ::sendfile(sock, fd, &pos, size - sent);
+            if (-1 == ret_routine) {
+                ret = get_lasterror(ret_routine);
+                if (errorcode_t::eagain == ret) {
+                    // the send buffer is full, continued when writable (see network_session::writable)
+                    ret = errorcode_t::pending;
+                }
+                break;
+            } else if (0 == ret_routine) {
+                // truncated
+                ret = errorcode_t::unexpected;
+                break;
+            }
+            sent += ret_routine;
         }
+#else
+        ret = errorcode_t::not_supported;
+#endif
+    }
+    __finally2 {
         if (nullptr != cbsent) {
-            *cbsent = ret_routine;
+            *cbsent = sent;
+        }
+    }
+
+    return ret;
+}
+
+return_t tcp_server_socket::sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent) {
+    return_t ret = errorcode_t::success;
+    size_t sent = 0;
+
+    __try2 {
+        if ((nullptr == bufs) && count) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+#if defined __linux__
+        size_t i = 0;    // the current piece
+        size_t pos = 0;  // sent in the current piece
+        while (i < count) {
+            struct iovec iov[64];
+            int iovcnt = 0;
+            for (size_t k = i; (k < count) && (iovcnt < 64); k++) {
+                size_t skip = (k == i) ? pos : 0;
+                if (bufs[k].size > skip) {
+                    iov[iovcnt].iov_base = (void*)(bufs[k].ptr + skip);
+                    iov[iovcnt].iov_len = bufs[k].size - skip;
+                    iovcnt++;
+                }
+            }
+            if (0 == iovcnt) {
+                break;
+            }
+
+            ssize_t ret_routine = ::writev(sock, iov, iovcnt);
+            if (-1 == ret_routine) {
+                ret = get_lasterror(ret_routine);
+                if (errorcode_t::eagain == ret) {
+                    // the send buffer is full, continued when writable (see network_session::writable)
+                    ret = errorcode_t::pending;
+                }
+                break;
+            }
+            sent += ret_routine;
+
+            // partial write
+            size_t written = ret_routine;
+            while ((i < count) && (written >= bufs[i].size - pos)) {
+                written -= (bufs[i].size - pos);
+                pos = 0;
+                i++;
+            }
+            pos += written;
         }
+#else
+        for (size_t i = 0; i < count; i++) {
+            size_t size = 0;
+            ret = send(sock, tls_handle, bufs[i].ptr, bufs[i].size, &size);
+            if (errorcode_t::success != ret) {
+                break;
+            }
+            sent += size;
+        }
+#endif
     }
     __finally2 {
-        // do nothing
+        if (nullptr != cbsent) {
+            *cbsent = sent;
+        }
     }
 
     return ret;
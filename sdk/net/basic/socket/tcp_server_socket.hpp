@@ -45,7 +45,7 @@ class tcp_server_socket : public server_socket {
      * @brief   read
      * @param   socket_t        sock            [IN]
      * @param   tls_context_t*  tls_handle      [IN] nullptr
-     * @param   int             mode            [IN] ignore, it defines operation mode. see also transport_layer_security_server.
+     * @param   int             mode            [IN] tls_io_flag_t::dontwait_msg (MSG_DONTWAIT), see also transport_layer_security_server.
      * @param   char*           ptr_data        [OUT]
      * @param   size_t          size_data       [IN]
      * @param   size_t*         cbread          [OUT]
@@ -62,8 +62,34 @@ class tcp_server_socket : public server_socket {
      * @param   size_t          size_data       [IN]
      * @param   size_t*         cbsent          [OUT]
      * @return  error code (see error.hpp)
+     *          errorcode_t::pending    the send buffer is full, *cbsent bytes are sent (see network_session::writable)
      */
     virtual return_t send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent);
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   const sendbuf_t* bufs           [IN] ptr, size
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    see send
+     * @remarks
+     *          [linux] writev, a partial write is continued until the send buffer is full
+     */
+    virtual return_t sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent);
+    /**
+     * @brief   send a file
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr, not supported if not nullptr
+     * @param   handle_t        fd              [IN] file
+     * @param   uint64          offset          [IN]
+     * @param   size_t          size            [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    see send, a slow client is not cut off mid-body
+     */
+    virtual return_t sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent);
 
     virtual int socket_type();
 
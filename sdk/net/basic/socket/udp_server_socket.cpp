@@ -104,6 +104,153 @@ return_t udp_server_socket::sendto(socket_t sock, tls_context_t* tls_handle, con
     return ret;
 }
 
+#define UDP_MMSG_MAX 64
+
+return_t udp_server_socket::recvmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == dgrams || nullptr == cbcount) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        *cbcount = 0;
+
+#if defined __linux__
+        struct mmsghdr msgs[UDP_MMSG_MAX];
+        struct iovec iovs[UDP_MMSG_MAX];
+        char controls[UDP_MMSG_MAX][CMSG_SPACE(sizeof(int))];
+
+        if (count > UDP_MMSG_MAX) {
+            count = UDP_MMSG_MAX;
+        }
+
+        memset(msgs, 0, sizeof(struct mmsghdr) * count);
+        for (size_t i = 0; i < count; i++) {
+            iovs[i].iov_base = dgrams[i].ptr;
+            iovs[i].iov_len = dgrams[i].bufsize;
+            msgs[i].msg_hdr.msg_name = &dgrams[i].addr;
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage_t);
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = controls[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+        }
+
+        int ret_recv = ::recvmmsg(sock, msgs, count, MSG_DONTWAIT, nullptr);
+        if (-1 == ret_recv) {
+            ret = get_lasterror(ret_recv);
+            __leave2;
+        }
+
+        for (int i = 0; i < ret_recv; i++) {
+            dgram_t& dgram = dgrams[i];
+            dgram.size = msgs[i].msg_len;
+            dgram.addrlen = msgs[i].msg_hdr.msg_namelen;
+            dgram.segment = 0;
+#if defined UDP_GRO
+            for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg; cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg)) {
+                if ((SOL_UDP == cmsg->cmsg_level) && (UDP_GRO == cmsg->cmsg_type)) {
+                    int segment = 0;
+                    memcpy(&segment, CMSG_DATA(cmsg), sizeof(int));
+                    dgram.segment = segment;
+                }
+            }
+#endif
+        }
+        *cbcount = ret_recv;
+#elif defined _WIN32 || defined _WIN64
+        if (count) {
+            size_t cbread = 0;
+            dgram_t& dgram = dgrams[0];
+            dgram.addrlen = sizeof(sockaddr_storage_t);
+            dgram.segment = 0;
+            ret = recvfrom(sock, tls_handle, 0, dgram.ptr, dgram.bufsize, &cbread, (sockaddr*)&dgram.addr, &dgram.addrlen);
+            if (errorcode_t::success == ret || errorcode_t::more_data == ret) {
+                dgram.size = cbread;
+                *cbcount = 1;
+                ret = errorcode_t::success;
+            }
+        }
+#endif
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t udp_server_socket::sendmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == dgrams || nullptr == cbcount) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        *cbcount = 0;
+
+#if defined __linux__
+        struct mmsghdr msgs[UDP_MMSG_MAX];
+        struct iovec iovs[UDP_MMSG_MAX];
+        char controls[UDP_MMSG_MAX][CMSG_SPACE(sizeof(uint16))];
+
+        size_t sent = 0;
+        while (sent < count) {
+            size_t batch = count - sent;
+            if (batch > UDP_MMSG_MAX) {
+                batch = UDP_MMSG_MAX;
+            }
+
+            memset(msgs, 0, sizeof(struct mmsghdr) * batch);
+            for (size_t i = 0; i < batch; i++) {
+                dgram_t& dgram = dgrams[sent + i];
+                iovs[i].iov_base = dgram.ptr;
+                iovs[i].iov_len = dgram.size;
+                msgs[i].msg_hdr.msg_name = &dgram.addr;
+                msgs[i].msg_hdr.msg_namelen = dgram.addrlen;
+                msgs[i].msg_hdr.msg_iov = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+#if defined UDP_SEGMENT
+                if (dgram.segment && (dgram.size > dgram.segment)) {
+                    // GSO, the kernel splits into dgram.segment sized datagrams
+                    msgs[i].msg_hdr.msg_control = controls[i];
+                    msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+                    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr);
+                    cmsg->cmsg_level = SOL_UDP;
+                    cmsg->cmsg_type = UDP_SEGMENT;
+                    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16));
+                    memcpy(CMSG_DATA(cmsg), &dgram.segment, sizeof(uint16));
+                }
+#endif
+            }
+
+            int ret_send = ::sendmmsg(sock, msgs, batch, 0);
+            if (-1 == ret_send) {
+                ret = get_lasterror(ret_send);
+                break;
+            }
+            sent += ret_send;
+        }
+        *cbcount = sent;
+#elif defined _WIN32 || defined _WIN64
+        for (size_t i = 0; i < count; i++) {
+            size_t cbsent = 0;
+            dgram_t& dgram = dgrams[i];
+            ret = sendto(sock, tls_handle, dgram.ptr, dgram.size, &cbsent, (sockaddr*)&dgram.addr, dgram.addrlen);
+            if (errorcode_t::success != ret) {
+                break;
+            }
+            (*cbcount)++;
+        }
+#endif
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 int udp_server_socket::socket_type() { return SOCK_DGRAM; }
 
 }  // namespace net
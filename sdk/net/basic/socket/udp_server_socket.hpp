@@ -61,6 +61,20 @@ class udp_server_socket : public server_socket {
      */
     virtual return_t recvfrom(socket_t sock, tls_context_t* tls_handle, int mode, char* ptr_data, size_t size_data, size_t* cbread, struct sockaddr* addr,
                               socklen_t* addrlen);
+    /**
+     * @brief   receive datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [INOUT]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] recvmmsg(MSG_DONTWAIT), a single syscall
+     *                  if UDP_GRO is enabled, dgram_t::segment is the size of coalesced segments
+     *          [windows] recvfrom
+     */
+    virtual return_t recvmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount);
     /**
      * @brief   send
      * @param   socket_t        sock            [IN]
@@ -74,6 +88,20 @@ class udp_server_socket : public server_socket {
      */
     virtual return_t sendto(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent, const struct sockaddr* addr,
                             socklen_t addrlen);
+    /**
+     * @brief   send datagrams in a batch
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN] nullptr
+     * @param   dgram_t*        dgrams          [IN]
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbcount         [OUT]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] sendmmsg
+     *                  if dgram_t::segment is set, UDP_SEGMENT (GSO) splits a datagram into segments
+     *          [windows] sendto
+     */
+    virtual return_t sendmmsg(socket_t sock, tls_context_t* tls_handle, dgram_t* dgrams, size_t count, size_t* cbcount);
 
     virtual int socket_type();
 };
@@ -17,27 +17,38 @@
  * Date         Name                Description
  */
 
+#include <sdk/base/system/critical_section.hpp>
 #include <sdk/crypto/basic/openssl_sdk.hpp>
 #include <sdk/io/system/socket.hpp>
 #include <sdk/net/basic/tls/sdk.hpp>
 #include <sdk/net/basic/tls/tls.hpp>
 #include <sdk/net/basic/tls/tlscert.hpp>
+#if defined __linux__
+#include <sys/sendfile.h>
+#include <sys/uio.h>
+#endif
 
 namespace hotplace {
 namespace net {
 
 #define TLS_CONTEXT_SIGNATURE 0x20120119
 
+#if defined __linux__ && defined SSL_OP_ENABLE_KTLS && !defined OPENSSL_NO_KTLS
+#define __TLS_KTLS__
+#endif
+
 typedef struct _tls_context_t {
     uint32 _signature;
     uint32 _flags;  // see tls_flag_t
     socket_t _fd;
     SSL* _ssl;
+    critical_section _lock;  // an SSL object is not used concurrently (read from the network thread, write from the consumers)
+    binary_t _early_data;    // 0-RTT, read during the handshake, see get_early_data
 
     _tls_context_t() : _signature(0), _flags(0), _fd(-1), _ssl(nullptr) {}
 } tls_context_t;
 
-transport_layer_security::transport_layer_security(SSL_CTX* ctx) : _ctx(ctx) {
+transport_layer_security::transport_layer_security(SSL_CTX* ctx) : _ctx(ctx), _flags(0) {
     if (nullptr == ctx) {
         throw errorcode_t::insufficient;
     }
@@ -45,7 +56,7 @@ transport_layer_security::transport_layer_security(SSL_CTX* ctx) : _ctx(ctx) {
     _shared.make_share(this);
 }
 
-transport_layer_security::transport_layer_security(tlscert* cert) : _ctx(nullptr) {
+transport_layer_security::transport_layer_security(tlscert* cert) : _ctx(nullptr), _flags(0) {
     if (cert) {
         _ctx = cert->get_ctx();
     }
@@ -58,10 +69,58 @@ transport_layer_security::transport_layer_security(tlscert* cert) : _ctx(nullptr
 
 transport_layer_security::~transport_layer_security() { SSL_CTX_free(_ctx); }
 
+transport_layer_security& transport_layer_security::enable_ktls(bool enable) {
+    if (enable) {
+        _flags |= tls_flag_t::tls_ktls;
+    } else {
+        _flags &= ~tls_flag_t::tls_ktls;
+    }
+    return *this;
+}
+
+transport_layer_security& transport_layer_security::enable_early_data(uint32 max_early_data_size) {
+    // max_early_data_size in the NewSessionTicket, the early data more than recv_max_early_data is an error
+    // OpenSSL rejects a replayed ticket (single use in the session cache), see SSL_OP_NO_ANTI_REPLAY
+    SSL_CTX_set_max_early_data(_ctx, max_early_data_size);
+    SSL_CTX_set_recv_max_early_data(_ctx, max_early_data_size);
+    if (max_early_data_size) {
+        _flags |= tls_flag_t::tls_early_data;
+    } else {
+        _flags &= ~tls_flag_t::tls_early_data;
+    }
+    return *this;
+}
+
 int transport_layer_security::addref() { return _shared.addref(); }
 
 int transport_layer_security::release() { return _shared.delref(); }
 
+/**
+ * @brief   send (kTLS, the plaintext is written to the socket)
+ * @return  errorcode_t::pending - the send buffer is full, *size_sent bytes are sent
+ * @remarks
+ *          never waits, the caller continues when the socket is writable (see network_session::writable)
+ */
+static return_t ktls_send(socket_t fd, const char* data, size_t size, int flags, size_t* size_sent) {
+    return_t ret = errorcode_t::success;
+    size_t pos = 0;
+    while (pos < size) {
+        int ret_send = ::send(fd, data + pos, size - pos, flags);
+        if (-1 == ret_send) {
+            ret = get_lasterror(ret_send);
+            if (errorcode_t::eagain == ret) {
+                ret = errorcode_t::pending;
+            }
+            break;
+        }
+        pos += ret_send;
+    }
+    if (size_sent) {
+        *size_sent = pos;
+    }
+    return ret;
+}
+
 return_t transport_layer_security::tls_open(tls_context_t** handle, socket_t fd, uint32 flags) {
     return_t ret = errorcode_t::success;
     tls_context_t* context = nullptr;
@@ -81,6 +140,13 @@ return_t transport_layer_security::tls_open(tls_context_t** handle, socket_t fd,
         }
         SSL_set_fd(ssl, (int)fd);
 
+#if defined __TLS_KTLS__
+        if (flags & tls_flag_t::tls_ktls) {
+            // the keys are installed into the kernel at the end of the handshake, see set_ktls_io
+            SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+        }
+#endif
+
         context->_fd = fd;
         context->_ssl = ssl;
         context->_flags = flags;
@@ -185,6 +251,10 @@ return_t transport_layer_security::close(tls_context_t* handle) {
 }
 
 return_t transport_layer_security::connect(tls_context_t** handle, int type, const char* address, uint16 port, uint32 wto) {
+    return connect(handle, type, address, port, wto, nullptr);
+}
+
+return_t transport_layer_security::connect(tls_context_t** handle, int type, const char* address, uint16 port, uint32 wto, SSL_SESSION* session) {
     return_t ret = errorcode_t::success;
     socket_t fd = INVALID_SOCKET;
     BIO* sbio_read = nullptr;
@@ -215,6 +285,10 @@ return_t transport_layer_security::connect(tls_context_t** handle, int type, con
             __leave2;
         }
 
+        if (session) {
+            SSL_set_session(context->_ssl, session);
+        }
+
         ret = do_connect(context, wto);
         if (errorcode_t::success != ret) {
             __leave2;
@@ -321,7 +395,7 @@ return_t transport_layer_security::tls_handshake(tls_context_t** handle, socket_
          * non-blocking     passed
          */
 
-        int flags = tls_flag_t::closesocket_ondestroy | tls_flag_t::tls_nbio;
+        int flags = tls_flag_t::closesocket_ondestroy | tls_flag_t::tls_nbio | (_flags & tls_flag_t::tls_ktls);
         ret = tls_open(&context, fd, flags);
         if (errorcode_t::success != ret) {
             __leave2;
@@ -332,7 +406,10 @@ return_t transport_layer_security::tls_handshake(tls_context_t** handle, socket_
             __leave2;
         }
 
-        ret = set_tls_io(context, 0);
+        ret = set_ktls_io(context);
+        if (errorcode_t::success != ret) {
+            ret = set_tls_io(context, 0);
+        }
         if (errorcode_t::success != ret) {
             __leave2;
         }
@@ -347,6 +424,110 @@ return_t transport_layer_security::tls_handshake(tls_context_t** handle, socket_
     return ret;
 }
 
+return_t transport_layer_security::tls_handshake_begin(tls_context_t** handle, socket_t fd) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (nullptr == _ctx) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        int flags = tls_flag_t::closesocket_ondestroy | tls_flag_t::tls_nbio | (_flags & (tls_flag_t::tls_ktls | tls_flag_t::tls_early_data));
+        ret = tls_open(handle, fd, flags);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        SSL_set_accept_state((*handle)->_ssl);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t transport_layer_security::tls_handshake_continue(tls_context_t* handle, uint32* wait) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == handle || nullptr == wait) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (TLS_CONTEXT_SIGNATURE != handle->_signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        *wait = 0;
+
+        auto ssl = handle->_ssl;
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        // the early data follows the ClientHello, SSL_read_early_data until EndOfEarlyData (or rejected, not offered)
+        while (tls_flag_t::tls_early_data & handle->_flags) {
+            char buf[4096];
+            size_t readbytes = 0;
+            int rc = SSL_read_early_data(ssl, buf, sizeof(buf), &readbytes);
+            if (SSL_READ_EARLY_DATA_SUCCESS == rc) {
+                handle->_early_data.insert(handle->_early_data.end(), buf, buf + readbytes);
+            } else if (SSL_READ_EARLY_DATA_FINISH == rc) {
+                handle->_flags &= ~tls_flag_t::tls_early_data; /* SSL_accept */
+            } else {
+                int condition = SSL_get_error(ssl, rc);
+                if (SSL_ERROR_WANT_WRITE == condition) {
+                    *wait = SOCK_WAIT_WRITABLE;
+                    ret = errorcode_t::pending;
+                } else if (SSL_ERROR_WANT_READ == condition) {
+                    *wait = SOCK_WAIT_READABLE;
+                    ret = errorcode_t::pending;
+                } else {
+                    ret = errorcode_t::error_handshake;
+                }
+                break;
+            }
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        int rc = SSL_accept(ssl);
+        if (rc < 1) {
+            int condition = SSL_get_error(ssl, rc);
+            switch (condition) {
+                case SSL_ERROR_WANT_WRITE:
+                    *wait = SOCK_WAIT_WRITABLE;
+                    ret = errorcode_t::pending;
+                    break;
+                case SSL_ERROR_WANT_READ:
+                    *wait = SOCK_WAIT_READABLE;
+                    ret = errorcode_t::pending;
+                    break;
+                default:
+                    ret = (0 == rc) ? errorcode_t::disconnect : errorcode_t::error_handshake;
+                    break;
+            }
+            __leave2;
+        }
+
+        ret = set_ktls_io(handle);
+        if (errorcode_t::success != ret) {
+            ret = set_tls_io(handle, 0);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t transport_layer_security::dtls_handshake(tls_context_t* handle, sockaddr* addr, socklen_t addrlen) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -667,6 +848,57 @@ return_t transport_layer_security::set_tls_io(tls_context_t* handle, int type) {
     return ret;
 }
 
+return_t transport_layer_security::set_ktls_io(tls_context_t* handle) {
+    return_t ret = errorcode_t::not_supported;
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (TLS_CONTEXT_SIGNATURE != handle->_signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        if (0 == (tls_flag_t::tls_ktls & handle->_flags)) {
+            __leave2;
+        }
+
+#if defined __TLS_KTLS__
+        auto ssl = handle->_ssl;
+        // SSL_set_fd, a socket BIO on both sides
+        bool ktls_send = BIO_get_ktls_send(SSL_get_wbio(ssl));
+        bool ktls_recv = BIO_get_ktls_recv(SSL_get_rbio(ssl));
+        if ((false == ktls_send) && (false == ktls_recv)) {
+            // the tls ULP is not available, or the cipher suite is not supported by the kernel
+            __leave2;
+        }
+
+        /**
+         *  a socket BIO on the offloaded side
+         *  a memory BIO on the other side (see read, send)
+         *      OpenSSL 3.0 offloads the receive side of TLS 1.2 only
+         */
+        if (ktls_send) {
+            handle->_flags |= tls_flag_t::tls_ktls_send;
+        } else {
+            SSL_set0_wbio(ssl, BIO_new(BIO_s_mem()));
+        }
+        if (ktls_recv) {
+            handle->_flags |= tls_flag_t::tls_ktls_recv;
+        } else {
+            SSL_set0_rbio(ssl, BIO_new(BIO_s_mem()));
+        }
+        ret = errorcode_t::success;
+#endif
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t transport_layer_security::read(tls_context_t* handle, int mode, void* buffer, size_t buffer_size, size_t* cbread) {
     return_t ret = errorcode_t::success;
     int rc = 0;
@@ -686,9 +918,64 @@ return_t transport_layer_security::read(tls_context_t* handle, int mode, void* b
             *cbread = 0;
         }
 
+        if (tls_flag_t::tls_ktls_recv & handle->_flags) {
+            /**
+             *  the kernel decrypts the records, no BIO_write
+             *  a record other than application data (alert, handshake) fails a plain recv with EIO
+             *  SSL_read reads the socket BIO (recvmsg, TLS_GET_RECORD_TYPE) and handles the control records
+             */
+            if (tls_io_flag_t::read_ssl_read & mode) {
+                critical_section_guard guard(handle->_lock);
+                rc = SSL_read(handle->_ssl, buffer, (int)buffer_size);
+                if (rc <= 0) {
+                    int condition = SSL_get_error(handle->_ssl, rc);
+                    if (SSL_ERROR_WANT_READ == condition || SSL_ERROR_WANT_WRITE == condition) {
+                        ret = errorcode_t::pending;
+                    } else if (SSL_ERROR_ZERO_RETURN == condition) {
+                        ret = errorcode_t::disconnect; /* close_notify */
+                    } else {
+                        ret = errorcode_t::internal_error;
+                    }
+                } else if (nullptr != cbread) {
+                    *cbread = rc;
+                }
+            } else if (tls_io_flag_t::read_socket_recv & mode) {
+#if defined __linux__
+                // readable, the record is read by read_ssl_read (see network_session::produce)
+                int flag = MSG_PEEK;
+                if (tls_io_flag_t::dontwait_msg & mode) {
+                    flag |= MSG_DONTWAIT;
+                }
+                char control[CMSG_SPACE(sizeof(unsigned char))];  // TLS_GET_RECORD_TYPE
+                struct iovec iov;
+                iov.iov_base = buffer;
+                iov.iov_len = 1;
+                struct msghdr msg;
+                memset(&msg, 0, sizeof(msg));
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                msg.msg_control = control;
+                msg.msg_controllen = sizeof(control);
+                rc = ::recvmsg(handle->_fd, &msg, flag);
+                if (0 == rc) { /* gracefully closed */
+                    ret = errorcode_t::disconnect;
+                } else if (-1 == rc) {
+                    ret = get_lasterror(rc);
+                }
+#endif
+            }
+            __leave2;
+        }
+
         size_t size_read = buffer_size;
         if (tls_io_flag_t::read_socket_recv & mode) {
-            rc = ::recv(handle->_fd, (char*)buffer, buffer_size, 0);
+            int flag = 0;
+#if defined __linux__
+            if (tls_io_flag_t::dontwait_msg & mode) {
+                flag = MSG_DONTWAIT;
+            }
+#endif
+            rc = ::recv(handle->_fd, (char*)buffer, buffer_size, flag);
             if (0 == rc) { /* gracefully closed */
                 ret = errorcode_t::disconnect;
                 __leave2;
@@ -707,6 +994,8 @@ return_t transport_layer_security::read(tls_context_t* handle, int mode, void* b
         auto ssl = handle->_ssl;
         auto rbio = SSL_get_rbio(ssl);
 
+        critical_section_guard guard(handle->_lock);
+
         if (tls_io_flag_t::read_bio_write & mode) {
             BIO_write(rbio, buffer, (int)size_read);
         }
@@ -723,6 +1012,8 @@ return_t transport_layer_security::read(tls_context_t* handle, int mode, void* b
                 int condition = SSL_get_error(ssl, rc);
                 if (SSL_ERROR_WANT_READ == condition || SSL_ERROR_WANT_WRITE == condition) {
                     ret = errorcode_t::pending;
+                } else if (SSL_ERROR_ZERO_RETURN == condition) {
+                    ret = errorcode_t::disconnect; /* close_notify */
                 } else {
                     ret = errorcode_t::internal_error;
                 }
@@ -840,6 +1131,36 @@ return_t transport_layer_security::send(tls_context_t* handle, int mode, const c
         auto ssl = handle->_ssl;
         auto wbio = SSL_get_wbio(ssl);
 
+        if (tls_flag_t::tls_ktls_send & handle->_flags) {
+            // the kernel encrypts the records
+            if (tls_io_flag_t::send_ssl_write & mode) {
+                size_t pos = 0;
+                while (true) {
+                    size_t cbsent = 0;
+                    {
+                        critical_section_guard guard(handle->_lock);
+                        ret = ktls_send(handle->_fd, data + pos, size_data - pos, 0, &cbsent);
+                    }
+                    pos += cbsent;
+                    if ((errorcode_t::pending != ret) || (tls_io_flag_t::dontwait_msg & mode)) {
+                        break;  // dontwait_msg, the caller continues (see tls_server_socket::send)
+                    }
+                    // a blocking caller (tls_client_socket), the lock is not held while waiting
+                    ret = wait_socket(handle->_fd, 1000, SOCK_WAIT_WRITABLE);
+                    if (errorcode_t::success != ret) {
+                        break;
+                    }
+                }
+                if (size_sent) {
+                    *size_sent = pos;
+                }
+            }
+            __leave2;
+        }
+
+        // the records are sent in the order they are written
+        critical_section_guard guard(handle->_lock);
+
         if (tls_io_flag_t::send_ssl_write & mode) {
             int ret_write = SSL_write(ssl, data, (int)size_data);
 
@@ -853,7 +1174,7 @@ return_t transport_layer_security::send(tls_context_t* handle, int mode, const c
         }
 
         if (tls_io_flag_t::send_bio_read & mode) {
-            int written = BIO_number_written(wbio);
+            int written = BIO_ctrl_pending(wbio);
 
             int ret_read = 0;
             std::vector<char> buf;
@@ -876,6 +1197,188 @@ return_t transport_layer_security::send(tls_context_t* handle, int mode, const c
     return ret;
 }
 
+return_t transport_layer_security::sendv(tls_context_t* handle, const sendbuf_t* bufs, size_t count, size_t* size_sent) {
+    return_t ret = errorcode_t::success;
+    size_t sent = 0;
+
+    __try2 {
+        if ((nullptr == handle) || ((nullptr == bufs) && count)) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (TLS_CONTEXT_SIGNATURE != handle->_signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        auto ssl = handle->_ssl;
+        auto wbio = SSL_get_wbio(ssl);
+        const size_t record_size = 16384;  // RFC 8446 5.1. 2^14
+
+        // the records are sent in the order they are written
+        critical_section_guard guard(handle->_lock);
+
+        if (tls_flag_t::tls_ktls_send & handle->_flags) {
+            // MSG_MORE, the kernel gathers the pieces into records
+            // errorcode_t::pending, the caller sends the rest when the socket is writable (see network_session::sendv)
+            int more = 0;
+#if defined __linux__
+            more = MSG_MORE;
+#endif
+            for (size_t i = 0; i < count; i++) {
+                size_t cbsent = 0;
+                ret = ktls_send(handle->_fd, bufs[i].ptr, bufs[i].size, (i + 1 < count) ? more : 0, &cbsent);
+                sent += cbsent;
+                if (errorcode_t::success != ret) {
+                    break;
+                }
+            }
+            __leave2;
+        }
+
+        // at most a record is kept in the memory BIO, it is sent before the next SSL_write
+        std::vector<char> gather;
+        std::vector<char> record;
+        auto lambda_drain = [&]() -> return_t {
+            return_t ret_value = errorcode_t::success;
+            int pending = BIO_ctrl_pending(wbio);
+            if (pending > 0) {
+                record.resize(pending);
+                int ret_read = BIO_read(wbio, &record[0], pending);
+                if (ret_read < 1) {
+                    ret_value = get_opensslerror(ret_read);
+                } else {
+                    size_t pos = 0;
+                    while (pos < (size_t)ret_read) {
+                        int ret_send = ::send(handle->_fd, &record[pos], ret_read - pos, 0);
+                        if (-1 == ret_send) {
+                            ret_value = get_lasterror(ret_send);
+                            if (errorcode_t::eagain == ret_value) {
+                                // non-blocking socket, wait until the send buffer is drained
+                                ret_value = wait_socket(handle->_fd, 1000, SOCK_WAIT_WRITABLE);
+                                if (errorcode_t::success == ret_value) {
+                                    continue;
+                                }
+                            }
+                            break;
+                        }
+                        pos += ret_send;
+                    }
+                }
+            }
+            return ret_value;
+        };
+        auto lambda_write = [&](const char* data, size_t size) -> return_t {
+            return_t ret_value = errorcode_t::success;
+            while (size) {
+                size_t chunk = (size > record_size) ? record_size : size;
+                int ret_write = SSL_write(ssl, data, (int)chunk);
+                if (ret_write < 1) {
+                    ret_value = get_opensslerror(ret_write);
+                    break;
+                }
+                sent += ret_write;
+                data += ret_write;
+                size -= ret_write;
+
+                ret_value = lambda_drain();
+                if (errorcode_t::success != ret_value) {
+                    break;
+                }
+            }
+            return ret_value;
+        };
+        auto lambda_flush = [&]() -> return_t {
+            return_t ret_value = errorcode_t::success;
+            if (false == gather.empty()) {
+                ret_value = lambda_write(&gather[0], gather.size());
+                gather.clear();
+            }
+            return ret_value;
+        };
+
+        for (size_t i = 0; (errorcode_t::success == ret) && (i < count); i++) {
+            const sendbuf_t& item = bufs[i];
+            if (0 == item.size) {
+                continue;
+            }
+            if (gather.size() + item.size > record_size) {
+                ret = lambda_flush();
+            }
+            if (errorcode_t::success != ret) {
+                break;
+            }
+            if (item.size < record_size) {
+                gather.insert(gather.end(), item.ptr, item.ptr + item.size);
+            } else {
+                ret = lambda_write(item.ptr, item.size);
+            }
+        }
+        if (errorcode_t::success == ret) {
+            ret = lambda_flush();
+        }
+    }
+    __finally2 {
+        if (size_sent) {
+            *size_sent = sent;
+        }
+    }
+    return ret;
+}
+
+return_t transport_layer_security::sendfile(tls_context_t* handle, handle_t fd, uint64 offset, size_t size, size_t* size_sent) {
+    return_t ret = errorcode_t::success;
+    size_t sent = 0;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (TLS_CONTEXT_SIGNATURE != handle->_signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        if (0 == (tls_flag_t::tls_ktls_send & handle->_flags)) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+#if defined __linux__
+        critical_section_guard guard(handle->_lock);
+
+        off_t pos = offset;
+        while (sent < size) {
+            ssize_t ret_routine = ::sendfile(handle->_fd, fd, &pos, size - sent);
+            if (-1 == ret_routine) {
+                ret = get_lasterror(ret_routine);
+                if (errorcode_t::eagain == ret) {
+                    // the send buffer is full, continued when writable (see network_session::writable)
+                    ret = errorcode_t::pending;
+                }
+                break;
+            } else if (0 == ret_routine) {
+                // truncated
+                ret = errorcode_t::unexpected;
+                break;
+            }
+            sent += ret_routine;
+        }
+#else
+        ret = errorcode_t::not_supported;
+#endif
+    }
+    __finally2 {
+        if (size_sent) {
+            *size_sent = sent;
+        }
+    }
+    return ret;
+}
+
 return_t transport_layer_security::sendto(tls_context_t* handle, int mode, const char* data, size_t size_data, size_t* size_sent, const struct sockaddr* addr,
                                           socklen_t addrlen) {
     return_t ret = errorcode_t::success;
@@ -942,6 +1445,67 @@ socket_t transport_layer_security::get_socket(tls_context_t* handle) {
     return fd;
 }
 
+SSL_SESSION* transport_layer_security::get_session(tls_context_t* handle) {
+    SSL_SESSION* session = nullptr;
+
+    if ((nullptr != handle) && (TLS_CONTEXT_SIGNATURE == handle->_signature)) {
+        critical_section_guard guard(handle->_lock);
+        session = SSL_get1_session(handle->_ssl);
+        if (session && (0 == SSL_SESSION_is_resumable(session))) {
+            SSL_SESSION_free(session);
+            session = nullptr;
+        }
+    }
+    return session;
+}
+
+bool transport_layer_security::is_session_reused(tls_context_t* handle) {
+    bool ret_value = false;
+
+    if ((nullptr != handle) && (TLS_CONTEXT_SIGNATURE == handle->_signature)) {
+        ret_value = (1 == SSL_session_reused(handle->_ssl));
+    }
+    return ret_value;
+}
+
+uint32 transport_layer_security::get_ktls(tls_context_t* handle) {
+    uint32 ret_value = 0;
+
+    if ((nullptr != handle) && (TLS_CONTEXT_SIGNATURE == handle->_signature)) {
+        ret_value = handle->_flags & (tls_flag_t::tls_ktls_send | tls_flag_t::tls_ktls_recv);
+    }
+    return ret_value;
+}
+
+return_t transport_layer_security::get_early_data(tls_context_t* handle, binary_t& data) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        data.clear();
+
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        if (TLS_CONTEXT_SIGNATURE != handle->_signature) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        // the thread running tls_handshake_continue
+        if (handle->_early_data.empty()) {
+            ret = errorcode_t::not_found;
+            __leave2;
+        }
+        data.swap(handle->_early_data);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 SSL_CTX* transport_layer_security::get() { return _ctx; }
 
 }  // namespace net
@@ -20,6 +20,10 @@ namespace net {
 enum tls_flag_t {
     closesocket_ondestroy = (1 << 0),
     tls_nbio = (1 << 1),
+    tls_ktls = (1 << 2),        // try kernel TLS after the handshake (linux, SSL_OP_ENABLE_KTLS)
+    tls_ktls_send = (1 << 3),   // the records are encrypted by the kernel (send, sendfile)
+    tls_ktls_recv = (1 << 4),   // the records are decrypted by the kernel (recv)
+    tls_early_data = (1 << 5),  // server, read 0-RTT early data before SSL_accept (SSL_read_early_data)
 };
 
 /**
@@ -47,6 +51,37 @@ class transport_layer_security {
     transport_layer_security(tlscert* cert);
     ~transport_layer_security();
 
+    /**
+     * @brief   kernel TLS (opt-in)
+     * @param   bool enable [in]
+     * @remarks
+     *          the negotiated keys are installed into the kernel (setsockopt TCP_ULP "tls") after the handshake
+     *          AES-GCM, ChaCha20-Poly1305 (if the kernel supports)
+     *          falls back to SSL_read/SSL_write if the tls ULP is not available (modprobe tls)
+     *
+     *          kTLS send   send, sendv, sendfile go to the socket directly, errorcode_t::pending if the send buffer is full
+     *          kTLS recv   read_ssl_read reads the socket BIO, OpenSSL handles a record other than application_data (alert)
+     *
+     *          transport_layer_security tls(sslctx);
+     *          tls.enable_ktls();
+     *          tls_server_socket tls_socket(&tls);
+     */
+    transport_layer_security& enable_ktls(bool enable = true);
+    /**
+     * @brief   TLS 1.3 0-RTT early data (server, opt-in)
+     * @param   uint32 max_early_data_size [in] 0 disabled
+     * @remarks
+     *          RFC 8446 4.2.10.  Early Data Indication
+     *          the tickets issued allow max_early_data_size, tls_handshake_continue reads the early data (SSL_read_early_data)
+     *          the early data is available before the handshake completes, see get_early_data
+     *          the early data is replayable, see RFC 8470 (425 Too Early)
+     *
+     *          transport_layer_security tls(sslctx);
+     *          tls.enable_early_data(16384);
+     *          tls_server_socket tls_socket(&tls);
+     */
+    transport_layer_security& enable_early_data(uint32 max_early_data_size);
+
     /**
      * @brief   TLS
      * @param   tls_context_t** handle  [out]
@@ -81,6 +116,17 @@ class transport_layer_security {
      * @remarks set closesocket_ondestroy flag
      */
     return_t connect(tls_context_t** handle, int type, const char* addr, uint16 port, uint32 wtoseconds = NET_DEFAULT_TIMEOUT);
+    /**
+     * @brief   connect and resume a session
+     * @param   tls_context_t** handle      [out]
+     * @param   int             type        [in]
+     * @param   const char*     addr        [in]
+     * @param   uint16          port        [in]
+     * @param   uint32          wtoseconds  [in] seconds
+     * @param   SSL_SESSION*    session     [inopt] see get_session, a full handshake if nullptr or not accepted
+     * @return  error code (see error.hpp)
+     */
+    return_t connect(tls_context_t** handle, int type, const char* addr, uint16 port, uint32 wtoseconds, SSL_SESSION* session);
     /**
      * @brief   connect to
      * @param   tls_context_t** handle      [out]
@@ -117,6 +163,30 @@ class transport_layer_security {
      *          ret = ssl->tls_handshake (handle, cli_socket); // handshake
      */
     return_t tls_handshake(tls_context_t** handle, socket_t sock);
+    /**
+     * @brief   non-blocking tls accept (handshake)
+     * @param   tls_context_t** handle      [out]
+     * @param   socket_t        sock        [in] socket
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          no handshake message is exchanged, see tls_handshake_continue
+     *
+     *          cli_socket = accept (...);
+     *          ret = ssl->tls_handshake_begin (&handle, cli_socket);
+     *          // readable
+     *          ret = ssl->tls_handshake_continue (handle, &wait);
+     *          // errorcode_t::pending - wait for SOCK_WAIT_READABLE/SOCK_WAIT_WRITABLE and call again
+     */
+    return_t tls_handshake_begin(tls_context_t** handle, socket_t sock);
+    /**
+     * @brief   progress a handshake without blocking
+     * @param   tls_context_t*  handle      [in]
+     * @param   uint32*         wait        [out] see SOCK_WAIT_FLAGS
+     * @return  error code (see error.hpp)
+     *          errorcode_t::success    handshake finished
+     *          errorcode_t::pending    call again when the socket is ready (see wait)
+     */
+    return_t tls_handshake_continue(tls_context_t* handle, uint32* wait);
     /**
      * @brief   dtls accept (handshake)
      * @param   tls_context_t* handle [in]
@@ -181,8 +251,36 @@ class transport_layer_security {
      * @param   size_t          size_data   [in]
      * @param   size_t*         size_sent   [out]
      * @return  error code (see error.hpp)
+     *          errorcode_t::pending    kTLS send and dontwait_msg, the send buffer is full, *size_sent bytes are sent
      */
     return_t send(tls_context_t* handle, int mode, const char* data, size_t size_data, size_t* size_sent);
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   tls_context_t*      handle      [in]
+     * @param   const sendbuf_t*    bufs        [in]
+     * @param   size_t              count       [in]
+     * @param   size_t*             size_sent   [out] plaintext
+     * @return  error code (see error.hpp)
+     *          errorcode_t::pending    kTLS send, the send buffer is full, *size_sent bytes are sent
+     * @remarks
+     *          small pieces (status line, headers, chunk size) are gathered into a record, large pieces are written by reference
+     *          each record is sent to the socket as it is written, the memory BIO does not hold more than a record
+     */
+    return_t sendv(tls_context_t* handle, const sendbuf_t* bufs, size_t count, size_t* size_sent);
+    /**
+     * @brief   send a file
+     * @param   tls_context_t*  handle      [in]
+     * @param   handle_t        fd          [in] file
+     * @param   uint64          offset      [in]
+     * @param   size_t          size        [in]
+     * @param   size_t*         size_sent   [out]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  not offloaded, the caller sends the content
+     *          errorcode_t::pending        the send buffer is full, *size_sent bytes are sent
+     * @remarks
+     *          [linux] kTLS send, the content is not copied into the user space
+     */
+    return_t sendfile(tls_context_t* handle, handle_t fd, uint64 offset, size_t size, size_t* size_sent);
     /**
      * @brief   sendto
      * @param   tls_context_t*          handle      [in]
@@ -200,6 +298,35 @@ class transport_layer_security {
      * @param   tls_context_t*  handle  [in]
      */
     socket_t get_socket(tls_context_t* handle);
+    /**
+     * @brief   the session to resume
+     * @param   tls_context_t*  handle  [in]
+     * @return  nullptr if not resumable, call SSL_SESSION_free
+     * @remarks
+     *          TLS 1.3 a session ticket (NewSessionTicket) is sent after the handshake, call after the first response is read
+     */
+    SSL_SESSION* get_session(tls_context_t* handle);
+    /**
+     * @brief   abbreviated handshake
+     * @param   tls_context_t*  handle  [in]
+     */
+    bool is_session_reused(tls_context_t* handle);
+    /**
+     * @brief   kernel TLS
+     * @param   tls_context_t*  handle  [in]
+     * @return  tls_ktls_send, tls_ktls_recv (see tls_flag_t)
+     */
+    uint32 get_ktls(tls_context_t* handle);
+    /**
+     * @brief   the early data read so far
+     * @param   tls_context_t*  handle  [in]
+     * @param   binary_t&       data    [out] moved out, empty if none
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_found  no early data
+     * @remarks
+     *          call after tls_handshake_continue, both errorcode_t::pending and errorcode_t::success
+     */
+    return_t get_early_data(tls_context_t* handle, binary_t& data);
 
     int addref();
     int release();
@@ -228,9 +355,17 @@ class transport_layer_security {
      * @return  error code (see error.hpp)
      */
     return_t do_accept(tls_context_t* handle);
+    /**
+     * @brief   kTLS after the handshake, a memory BIO on the other side
+     * @param   tls_context_t*  handle  [in]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  not offloaded
+     */
+    return_t set_ktls_io(tls_context_t* handle);
 
    private:
     SSL_CTX* _ctx;
+    uint32 _flags;  // see tls_flag_t
     t_shared_reference<transport_layer_security> _shared;
 };
 
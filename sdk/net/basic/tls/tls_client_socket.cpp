@@ -23,6 +23,10 @@ tls_client_socket::tls_client_socket(transport_layer_security* tls) : tcp_client
 tls_client_socket::~tls_client_socket() { _tls->release(); }
 
 return_t tls_client_socket::connect(socket_t* sock, tls_context_t** tls_handle, const char* address, uint16 port, uint32 timeout) {
+    return connect(sock, tls_handle, address, port, timeout, nullptr);
+}
+
+return_t tls_client_socket::connect(socket_t* sock, tls_context_t** tls_handle, const char* address, uint16 port, uint32 timeout, SSL_SESSION* session) {
     return_t ret = errorcode_t::success;
 
     __try2 {
@@ -31,7 +35,7 @@ return_t tls_client_socket::connect(socket_t* sock, tls_context_t** tls_handle,
             __leave2;
         }
         tls_context_t* handle = nullptr;
-        ret = _tls->connect(&handle, SOCK_STREAM, address, port, timeout);
+        ret = _tls->connect(&handle, SOCK_STREAM, address, port, timeout, session);
         if (errorcode_t::success == ret) {
             *sock = _tls->get_socket(handle);
             *tls_handle = handle;
@@ -104,6 +104,17 @@ class tls_client_socket : public tcp_client_socket {
      * @return  error code (see error.hpp)
      */
     virtual return_t connect(socket_t* sock, tls_context_t** tls_handle, const char* address, uint16 port, uint32 timeout);
+    /**
+     * @brief   open and connect, resume a session
+     * @param   socket_t*       sock            [OUT]
+     * @param   tls_context_t** tls_handle      [OUT]
+     * @param   const char*     address         [IN]
+     * @param   uint16          port            [IN]
+     * @param   uint32          timeout         [IN] second
+     * @param   SSL_SESSION*    session         [INOPT] see transport_layer_security::get_session
+     * @return  error code (see error.hpp)
+     */
+    return_t connect(socket_t* sock, tls_context_t** tls_handle, const char* address, uint16 port, uint32 timeout, SSL_SESSION* session);
     /**
      * @brief   connect
      * @oaram   socket_t sock [in]
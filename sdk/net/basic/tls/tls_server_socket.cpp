@@ -26,10 +26,12 @@ tls_server_socket::~tls_server_socket() { _tls->release(); }
 return_t tls_server_socket::close(socket_t sock, tls_context_t* tls_handle) {
     return_t ret = errorcode_t::success;
     __try2 {
-        if (_tls) {
+        if (_tls && tls_handle) {
+            /* closesocket_ondestroy (see tls_handshake, tls_handshake_begin), do not close a reused descriptor twice */
             _tls->close(tls_handle);
+        } else {
+            close_socket(sock, true, 0);
         }
-        close_socket(sock, true, 0);
     }
     __finally2 {
         // do nothing
@@ -51,6 +53,14 @@ return_t tls_server_socket::tls_accept(socket_t clisock, tls_context_t** tls_han
     return ret;
 }
 
+return_t tls_server_socket::tls_accept_begin(socket_t clisock, tls_context_t** tls_handle) {
+    return _tls->tls_handshake_begin(tls_handle, clisock); /* new TLS_CONTEXT, to release see close member */
+}
+
+return_t tls_server_socket::tls_accept_continue(tls_context_t* tls_handle, uint32* wait) { return _tls->tls_handshake_continue(tls_handle, wait); }
+
+return_t tls_server_socket::tls_accept_early_data(tls_context_t* tls_handle, binary_t& data) { return _tls->get_early_data(tls_handle, data); }
+
 return_t tls_server_socket::tls_stop_accept() {
     return_t ret = errorcode_t::success;
     openssl_thread_end();  // ssl23_accept memory leak, call for each thread
@@ -68,7 +78,7 @@ return_t tls_server_socket::read(socket_t sock, tls_context_t* tls_handle, int m
 
 return_t tls_server_socket::send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent) {
     return_t ret = errorcode_t::success;
-    int mode = tls_io_flag_t::send_all;
+    int mode = tls_io_flag_t::send_all | tls_io_flag_t::dontwait_msg; /* kTLS, see network_session::send */
     __try2 { ret = _tls->send(tls_handle, mode, ptr_data, size_data, cbsent); }
     __finally2 {
         // do nothing
@@ -76,6 +86,19 @@ return_t tls_server_socket::send(socket_t sock, tls_context_t* tls_handle, const
     return ret;
 }
 
+return_t tls_server_socket::sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent) {
+    return_t ret = errorcode_t::success;
+    __try2 { ret = _tls->sendv(tls_handle, bufs, count, cbsent); }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t tls_server_socket::sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent) {
+    return _tls->sendfile(tls_handle, fd, offset, size, cbsent);
+}
+
 bool tls_server_socket::support_tls() { return true; }
 
 }  // namespace net
@@ -44,6 +44,28 @@ class tls_server_socket : public tcp_server_socket {
      * @return  error code (see error.hpp)
      */
     virtual return_t tls_accept(socket_t clisock, tls_context_t** tls_handle);
+    /**
+     * @brief   non-blocking Tls accept
+     * @param   socket_t        clisock         [IN] client socket
+     * @param   tls_context_t** tls_handle      [OUT] Tls context
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t tls_accept_begin(socket_t clisock, tls_context_t** tls_handle);
+    /**
+     * @brief   progress a Tls accept
+     * @param   tls_context_t*  tls_handle      [IN] Tls context
+     * @param   uint32*         wait            [OUT] see SOCK_WAIT_FLAGS
+     * @return  error code (see error.hpp)
+     */
+    virtual return_t tls_accept_continue(tls_context_t* tls_handle, uint32* wait);
+    /**
+     * @brief   TLS 1.3 0-RTT early data read during the tls accept
+     * @param   tls_context_t*  tls_handle      [IN] Tls context
+     * @param   binary_t&       data            [OUT] moved out
+     * @return  error code (see error.hpp)
+     * @sa      transport_layer_security::enable_early_data
+     */
+    virtual return_t tls_accept_early_data(tls_context_t* tls_handle, binary_t& data);
     /**
      * @brief   tls_stop_accept
      */
@@ -69,6 +91,30 @@ class tls_server_socket : public tcp_server_socket {
      * @return  error code (see error.hpp)
      */
     virtual return_t send(socket_t sock, tls_context_t* tls_handle, const char* ptr_data, size_t size_data, size_t* cbsent);
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   const sendbuf_t* bufs           [IN] ptr, size
+     * @param   size_t          count           [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     * @sa      transport_layer_security::sendv
+     */
+    virtual return_t sendv(socket_t sock, tls_context_t* tls_handle, const sendbuf_t* bufs, size_t count, size_t* cbsent);
+    /**
+     * @brief   send a file
+     * @param   socket_t        sock            [IN]
+     * @param   tls_context_t*  tls_handle      [IN]
+     * @param   handle_t        fd              [IN] file
+     * @param   uint64          offset          [IN]
+     * @param   size_t          size            [IN]
+     * @param   size_t*         cbsent          [OUT]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  not offloaded (see transport_layer_security::enable_ktls), the caller sends the content
+     * @sa      transport_layer_security::sendfile
+     */
+    virtual return_t sendfile(socket_t sock, tls_context_t* tls_handle, handle_t fd, uint64 offset, size_t size, size_t* cbsent);
 
     virtual bool support_tls();
 
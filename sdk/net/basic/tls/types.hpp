@@ -27,6 +27,7 @@ enum tls_io_flag_t {
     read_epoll = (read_bio_write | read_socket_recv),                // 0000 0110
     send_all = (send_ssl_write | send_bio_read | send_socket_send),  // 0011 1000
     peek_msg = (1 << 6),                                             // 0100 0000
+    dontwait_msg = (1 << 7),                                         // 1000 0000
 };
 
 struct _tls_context_t;
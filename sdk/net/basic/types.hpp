@@ -26,6 +26,21 @@ class tcp_server_socket;
 class udp_client_socket;
 class udp_server_socket;
 
+/**
+ * @brief   datagram
+ * @sa      server_socket::recvmmsg, server_socket::sendmmsg
+ */
+struct dgram_t {
+    char* ptr;                // buffer
+    size_t bufsize;           // recvmmsg [in] size of buffer
+    size_t size;              // recvmmsg [out] size of datagram, sendmmsg [in] size of datagram
+    uint16 segment;           // recvmmsg [out] UDP_GRO segment size, sendmmsg [in] UDP_SEGMENT size, 0 if not segmented
+    sockaddr_storage_t addr;  // recvmmsg [out], sendmmsg [in]
+    socklen_t addrlen;        // recvmmsg [out], sendmmsg [in]
+
+    dgram_t() : ptr(nullptr), bufsize(0), size(0), segment(0), addrlen(sizeof(sockaddr_storage_t)) { memset(&addr, 0, sizeof(addr)); }
+};
+
 }  // namespace net
 }  // namespace hotplace
 
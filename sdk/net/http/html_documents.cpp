@@ -8,6 +8,8 @@
  * Date         Name                Description
  */
 
+#include <sys/stat.h>
+
 #include <sdk/base/string/string.hpp>
 #include <sdk/io/stream/file_stream.hpp>
 #include <sdk/net/http/html_documents.hpp>
@@ -17,9 +19,63 @@
 namespace hotplace {
 namespace net {
 
-html_documents::html_documents() : _use(false) {}
+html_document::html_document() : _mtime(0) { _shared.make_share(this); }
+
+html_document::~html_document() { _fs.close(); }
 
-html_documents::html_documents(const std::string& root_uri, const std::string& directory) : _use(false) { add_documents_root(root_uri, directory); }
+return_t html_document::open(const std::string& local) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        struct stat st;
+        if ((0 != stat(local.c_str(), &st)) || (S_IFREG != (st.st_mode & S_IFMT))) {
+            ret = errorcode_t::not_found;
+            __leave2;
+        }
+
+        ret = _fs.open(local.c_str());
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        _fs.begin_mmap();
+
+        _local = local;
+        _mtime = st.st_mtime;
+        _etag = format("\"%llx-%llx\"", (unsigned long long)size(), (unsigned long long)_mtime);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+bool html_document::test() {
+    struct stat st;
+    return (0 == stat(_local.c_str(), &st)) && (st.st_mtime == _mtime) && ((uint64)st.st_size == size());
+}
+
+handle_t html_document::get_handle() { return (handle_t)_fs; }
+
+const byte_t* html_document::data() { return _fs.data(); }
+
+uint64 html_document::size() { return _fs.size(); }
+
+const std::string& html_document::get_etag() { return _etag; }
+
+void html_document::addref() { _shared.addref(); }
+
+void html_document::release() { _shared.delref(); }
+
+html_documents::html_documents() : _use(false), _capacity(64 << 20), _capacity_entries(256) {}
+
+html_documents::html_documents(const std::string& root_uri, const std::string& directory) : _use(false), _capacity(64 << 20), _capacity_entries(256) {
+    add_documents_root(root_uri, directory);
+}
+
+html_documents::~html_documents() {
+    for (auto& pair : _cache_map) {
+        pair.second.document->release();
+    }
+}
 
 bool html_documents::test() { return _use; }
 
@@ -54,6 +110,22 @@ html_documents& html_documents::set_default_document(const std::string& document
     return *this;
 }
 
+html_documents& html_documents::set_cache_capacity(size_t capacity, size_t entries) {
+    critical_section_guard guard(_lock);
+    _capacity = capacity;
+    _capacity_entries = entries;
+    evict();
+    return *this;
+}
+
+void html_documents::get_stat(html_documents_stat_t* stat) {
+    if (stat) {
+        critical_section_guard guard(_lock);
+        *stat = _stat;
+        stat->entries = _cache_map.size();
+    }
+}
+
 bool html_documents::get_local(const std::string& uri, std::string& local) {
     bool ret_value = false;
 
@@ -81,50 +153,95 @@ bool html_documents::get_local(const std::string& uri, std::string& local) {
 
 return_t html_documents::load(const std::string& uri, std::string& content_type, binary_t& content) {
     return_t ret = errorcode_t::success;
+    html_document* document = nullptr;
     __try2 {
-        // todo compare timestamp
+        content.clear();
 
         get_content_type(uri, content_type);
 
-        // search from cache
-        ret = search_cache(uri, content);
-        if (errorcode_t::success == ret) {
+        ret = open(uri, &document);
+        if (errorcode_t::success != ret) {
             __leave2;
         }
 
-        // if not found, try to read from file
-        ret = loadfile(uri, content);
-        if (errorcode_t::success == ret) {
-            insert_cache(uri, content);
-        }
+        content.insert(content.end(), document->data(), document->data() + document->size());
     }
     __finally2 {
-        // do nothing
+        if (document) {
+            document->release();
+        }
     }
     return ret;
 }
 
 return_t html_documents::loadable(const std::string& uri, std::string& content_type) {
     return_t ret = errorcode_t::success;
+    html_document* document = nullptr;
     __try2 {
-        // todo compare timestamp
-
         get_content_type(uri, content_type);
 
-        // search from cache
-        critical_section_guard guard(_lock);
-        std::map<std::string, binary_t>::iterator iter = _cache_map.find(uri);
-        if (_cache_map.end() != iter) {
+        ret = open(uri, &document);
+    }
+    __finally2 {
+        if (document) {
+            document->release();
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief   RFC 9110 14.1.2.  Byte Ranges
+ * @param   const std::string& value [in] bytes=0-499, bytes=500-, bytes=-500
+ * @param   uint64 size [in]
+ * @param   uint64& offset [out]
+ * @param   uint64& length [out]
+ * @return  error code (see error.hpp)
+ *          errorcode_t::out_of_range   416 Range Not Satisfiable
+ *          errorcode_t::not_supported  ignore the Range header (multiple ranges, other units)
+ */
+static return_t parse_range(const std::string& value, uint64 size, uint64& offset, uint64& length) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        constexpr char constexpr_bytes[] = "bytes=";
+        if ((0 != value.compare(0, sizeof(constexpr_bytes) - 1, constexpr_bytes)) || (std::string::npos != value.find(','))) {
+            ret = errorcode_t::not_supported;
             __leave2;
         }
 
-        // if not found, try to read from file
-        std::string local;
-        if (get_local(uri, local)) {
-            file_stream fs;
-            ret = fs.open(local.c_str());
+        std::string spec = value.substr(sizeof(constexpr_bytes) - 1);
+        size_t pos = spec.find('-');
+        if ((std::string::npos == pos) || (std::string::npos != spec.find_first_not_of("0123456789-"))) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+        std::string first = spec.substr(0, pos);
+        std::string last = spec.substr(pos + 1);
+
+        if (first.empty()) {
+            // suffix-range
+            uint64 suffix = last.empty() ? 0 : strtoull(last.c_str(), nullptr, 10);
+            if ((0 == suffix) || (0 == size)) {
+                ret = errorcode_t::out_of_range;
+                __leave2;
+            }
+            length = (suffix < size) ? suffix : size;
+            offset = size - length;
         } else {
-            ret = errorcode_t::not_found;
+            offset = strtoull(first.c_str(), nullptr, 10);
+            uint64 end = last.empty() ? size - 1 : strtoull(last.c_str(), nullptr, 10);
+            if ((false == last.empty()) && (end < offset)) {
+                ret = errorcode_t::not_supported;  // invalid, ignored
+                __leave2;
+            }
+            if (offset >= size) {
+                ret = errorcode_t::out_of_range;
+                __leave2;
+            }
+            if (end >= size) {
+                end = size - 1;
+            }
+            length = end - offset + 1;
         }
     }
     __finally2 {
@@ -135,56 +252,181 @@ return_t html_documents::loadable(const std::string& uri, std::string& content_t
 
 return_t html_documents::compose(const std::string& uri, http_response* response) {
     return_t ret = errorcode_t::success;
-    if (test()) {
+    html_document* document = nullptr;
+    __try2 {
+        if (false == test()) {
+            ret = errorcode_t::not_available;
+            __leave2;
+        }
+        if (nullptr == response) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
         std::string content_type;
-        binary_t content;
-        ret = load(uri, content_type, content);
+        get_content_type(uri, content_type);
+
+        std::string path = uri;
+        if (ends_with(path, "/")) {
+            path += _document;  // index.html
+        }
+
+        const std::string* accept_encoding = nullptr;
+        const std::string* if_none_match = nullptr;
+        const std::string* range = nullptr;
+        http_request* request = response->get_http_request();
+        if (request) {
+            http_header& header = request->get_http_header();
+            accept_encoding = header.find(http_field_accept_encoding);
+            if_none_match = header.find(http_field_if_none_match);
+            range = header.find(http_field_range);
+        }
+
+        // precompressed
+        bool gzip = false;
+        if (accept_encoding && http_header::get_qvalue(*accept_encoding, "gzip")) {  // gzip;q=0 refuses
+            gzip = (errorcode_t::success == open(path + ".gz", &document));
+        }
+        if (nullptr == document) {
+            ret = open(path, &document);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+        }
+
+        http_header& header = response->get_http_header();
+        const std::string& etag = document->get_etag();
+        uint64 size = document->size();
+
+        // RFC 9110 13.1.2.  If-None-Match
+        if (if_none_match && (("*" == *if_none_match) || (std::string::npos != if_none_match->find(etag)))) {
+            header.add("ETag", etag);
+            response->compose(304);
+            __leave2;
+        }
+
+        header.add("Accept-Ranges", "bytes").add("ETag", etag);
+        if (gzip) {
+            header.add("Content-Encoding", "gzip").add("Vary", "Accept-Encoding");
+        }
+
+        // RFC 9110 14.2.  Range Requests
+        int status_code = 200;
+        uint64 offset = 0;
+        uint64 length = size;
+        if (range && (false == range->empty())) {
+            return_t check = parse_range(*range, size, offset, length);
+            if (errorcode_t::success == check) {
+                status_code = 206;
+                header.add("Content-Range", format("bytes %llu-%llu/%llu", (unsigned long long)offset, (unsigned long long)(offset + length - 1),
+                                                   (unsigned long long)size));
+            } else if (errorcode_t::out_of_range == check) {
+                header.add("Content-Range", format("bytes */%llu", (unsigned long long)size));
+                response->compose(416);
+                __leave2;
+            } else {
+                offset = 0;
+                length = size;
+            }
+        }
+
+        response->compose(status_code, content_type, document, offset, length);
+    }
+    __finally2 {
+        if (document) {
+            document->release();
+        }
+    }
+    return ret;
+}
+
+return_t html_documents::open(const std::string& uri, html_document** document) {
+    return_t ret = errorcode_t::success;
+    html_document* item = nullptr;
+    __try2 {
+        if (nullptr == document) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        ret = search_cache(uri, document);
         if (errorcode_t::success == ret) {
-            response->compose(200, content_type, "%.*s", (unsigned)content.size(), &content[0]);
+            __leave2;
         }
-    } else {
-        ret = errorcode_t::not_available;
+
+        std::string local;
+        if (false == get_local(uri, local)) {
+            ret = errorcode_t::not_found;
+            __leave2;
+        }
+
+        item = new html_document;
+        ret = item->open(local);
+        if (errorcode_t::success != ret) {
+            item->release();
+            __leave2;
+        }
+
+        insert_cache(uri, item);
+        *document = item;
+    }
+    __finally2 {
+        // do nothing
     }
     return ret;
 }
 
-return_t html_documents::search_cache(const std::string& uri, binary_t& content) {
+return_t html_documents::search_cache(const std::string& uri, html_document** document) {
     return_t ret = errorcode_t::success;
     critical_section_guard guard(_lock);
-    std::map<std::string, binary_t>::iterator iter = _cache_map.find(uri);
-    if (_cache_map.end() != iter) {
-        content = iter->second;
-    } else {
+    auto iter = _cache_map.find(uri);
+    if (_cache_map.end() == iter) {
         ret = errorcode_t::not_found;
+    } else {
+        cache_entry_t& entry = iter->second;
+        if (entry.document->test()) {
+            _lru.splice(_lru.begin(), _lru, entry.lru);
+            entry.document->addref();
+            *document = entry.document;
+            _stat.hit++;
+        } else {
+            // modified
+            _stat.bytes -= entry.document->size();
+            entry.document->release();
+            _lru.erase(entry.lru);
+            _cache_map.erase(iter);
+            ret = errorcode_t::not_found;
+        }
     }
     return ret;
 }
 
-return_t html_documents::insert_cache(const std::string& uri, binary_t& content) {
+return_t html_documents::insert_cache(const std::string& uri, html_document* document) {
     return_t ret = errorcode_t::success;
     critical_section_guard guard(_lock);
-    _cache_map.insert(std::make_pair(uri, content));
+    _stat.miss++;
+    if ((document->size() <= _capacity) && (_cache_map.end() == _cache_map.find(uri))) {
+        cache_entry_t entry;
+        document->addref();
+        entry.document = document;
+        entry.lru = _lru.insert(_lru.begin(), uri);
+        _cache_map.insert(std::make_pair(uri, entry));
+        _stat.bytes += document->size();
+        evict();
+    }
     return ret;
 }
 
-return_t html_documents::loadfile(const std::string& uri, binary_t& content) {
-    return_t ret = errorcode_t::success;
-
-    content.clear();
-
-    std::string local;
-    if (get_local(uri, local)) {
-        file_stream fs;
-        ret = fs.open(local.c_str());
-        if (errorcode_t::success == ret) {
-            fs.begin_mmap();
-            content.insert(content.end(), fs.data(), fs.data() + fs.size());
-        }
-    } else {
-        ret = errorcode_t::not_found;
+void html_documents::evict() {
+    // the least recently used, each document keeps a descriptor open (RLIMIT_NOFILE)
+    while (((_stat.bytes > _capacity) || (_cache_map.size() > _capacity_entries)) && (false == _lru.empty())) {
+        auto iter = _cache_map.find(_lru.back());
+        _stat.bytes -= iter->second.document->size();
+        iter->second.document->release();
+        _cache_map.erase(iter);
+        _lru.pop_back();
+        _stat.evict++;
     }
-
-    return ret;
 }
 
 return_t html_documents::get_content_type(const std::string& uri, std::string& content_type) {
@@ -12,16 +12,71 @@
 #ifndef __HOTPLACE_SDK_NET_HTTP_HTML_DOCUMENTS__
 #define __HOTPLACE_SDK_NET_HTTP_HTML_DOCUMENTS__
 
+#include <list>
 #include <map>
+#include <sdk/io/stream/file_stream.hpp>
 #include <sdk/net/http/types.hpp>
 
 namespace hotplace {
 namespace net {
 
+/**
+ * @brief   a mapped file (see html_documents)
+ * @remarks
+ *          referenced by the cache and by http_response, the file is closed when the last reference is released
+ *          an evicted document is still sent
+ */
+class html_document {
+   public:
+    html_document();
+    ~html_document();
+
+    /**
+     * @brief   open
+     * @param   const std::string& local [in]
+     * @return  error code (see error.hpp)
+     */
+    return_t open(const std::string& local);
+    /**
+     * @brief   false if the file is modified since open
+     */
+    bool test();
+
+    handle_t get_handle();
+    const byte_t* data();
+    uint64 size();
+    /**
+     * @brief   RFC 9110 8.8.3.  ETag
+     * @remarks "size-mtime" (hex)
+     */
+    const std::string& get_etag();
+
+    void addref();
+    void release();
+
+   private:
+    t_shared_reference<html_document> _shared;
+    file_stream _fs;
+    std::string _local;
+    time_t _mtime;
+    std::string _etag;
+};
+
+struct html_documents_stat_t {
+    uint64 hit;
+    uint64 miss;
+    uint64 evict;
+    size_t entries;  // cached documents
+    size_t bytes;    // sum of sizes
+
+    html_documents_stat_t() : hit(0), miss(0), evict(0), entries(0), bytes(0) {}
+};
+
 class html_documents {
    public:
     html_documents();
     html_documents(const std::string& root_uri, const std::string& directory);
+    ~html_documents();
 
     bool test();
 
@@ -35,6 +90,15 @@ class html_documents {
     html_documents& add_documents_root(const std::string& root_uri, const std::string& directory);
     html_documents& add_content_type(const std::string& dot_ext, const std::string& content_type);
     html_documents& set_default_document(const std::string& document);
+    /**
+     * @brief   cache
+     * @param   size_t capacity [in] bytes (sum of file sizes), the least recently used documents are closed (default 64MB)
+     * @param   size_t entries [inopt] documents (open descriptors), default 256
+     * @remarks
+     *          a document larger than capacity is opened per request
+     */
+    html_documents& set_cache_capacity(size_t capacity, size_t entries = 256);
+    void get_stat(html_documents_stat_t* stat);
 
     /**
      * @brief   content-type
@@ -63,8 +127,20 @@ class html_documents {
      * @brief   compose response
      * @param   const std::string& uri [in]
      * @param   http_response* response [out]
+     * @remarks
+     *          RFC 9110 13.1.2.  If-None-Match     304 Not Modified
+     *          RFC 9110 14.2.  Range Requests      206 Partial Content (a single range), 416 Range Not Satisfiable
+     *          uri.gz is sent if exists and the client accepts gzip (Content-Encoding: gzip, q-value above 0)
+     *          the body is not copied, see http_response::respond (sendfile)
      */
     return_t compose(const std::string& uri, http_response* response);
+    /**
+     * @brief   open a document
+     * @param   const std::string& uri [in]
+     * @param   html_document** document [out] call release
+     * @return  error code (see error.hpp)
+     */
+    return_t open(const std::string& uri, html_document** document);
     /**
      * @brief   redirect
      * @param   const std::string& uri [in]
@@ -77,18 +153,26 @@ class html_documents {
     bool get_local(const std::string& uri, std::string& local);
 
    protected:
-    return_t search_cache(const std::string& uri, binary_t& content);
-    return_t insert_cache(const std::string& uri, binary_t& content);
-    return_t loadfile(const std::string& uri, binary_t& content);
+    return_t search_cache(const std::string& uri, html_document** document);
+    return_t insert_cache(const std::string& uri, html_document* document);
+    void evict();
 
    private:
+    struct cache_entry_t {
+        html_document* document;
+        std::list<std::string>::iterator lru;
+    };
+
     critical_section _lock;
     std::map<std::string, std::string> _urimap;         // map(uri, directory)
-    std::map<std::string, time_t> _timestamp_map;       // store file timestamp
-    std::map<std::string, binary_t> _cache_map;         // cache
+    std::map<std::string, cache_entry_t> _cache_map;    // cache
+    std::list<std::string> _lru;                        // the most recently used first
     std::map<std::string, std::string> _content_types;  // map(ext, content_type)
     std::string _document;
     bool _use;
+    size_t _capacity;
+    size_t _capacity_entries;
+    html_documents_stat_t _stat;
 };
 
 }  // namespace net
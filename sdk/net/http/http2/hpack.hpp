@@ -141,7 +141,6 @@ class hpack_static_table : public http_static_table {
 
    protected:
     hpack_static_table();
-    virtual void load();
 
    private:
     static hpack_static_table _instance;
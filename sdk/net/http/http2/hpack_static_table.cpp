@@ -9,34 +9,130 @@
  */
 
 #include <sdk/net/http/http2/hpack.hpp>
-#include <sdk/net/http/http_resource.hpp>
 
 namespace hotplace {
 namespace net {
 
+/**
+ * RFC 7541 HPACK: Header Compression for HTTP/2
+ * Appendix A.  Static Table Definition
+ */
+constexpr static_table_entry_t hpack_static_entries[] = {
+    {1, ":authority", nullptr},
+    {2, ":method", "GET"},
+    {3, ":method", "POST"},
+    {4, ":path", "/"},
+    {5, ":path", "/index.html"},
+    {6, ":scheme", "http"},
+    {7, ":scheme", "https"},
+    {8, ":status", "200"},
+    {9, ":status", "204"},
+    {10, ":status", "206"},
+    {11, ":status", "304"},
+    {12, ":status", "400"},
+    {13, ":status", "404"},
+    {14, ":status", "500"},
+    {15, "accept-charset", nullptr},
+    {16, "accept-encoding", "gzip,deflate"},
+    {17, "accept-language", nullptr},
+    {18, "accept-ranges", nullptr},
+    {19, "accept", nullptr},
+    {20, "access-control-allow-origin", nullptr},
+    {21, "age", nullptr},
+    {22, "allow", nullptr},
+    {23, "authorization", nullptr},
+    {24, "cache-control", nullptr},
+    {25, "content-disposition", nullptr},
+    {26, "content-encoding", nullptr},
+    {27, "content-language", nullptr},
+    {28, "content-length", nullptr},
+    {29, "content-location", nullptr},
+    {30, "content-range", nullptr},
+    {31, "content-type", nullptr},
+    {32, "cookie", nullptr},
+    {33, "date", nullptr},
+    {34, "etag", nullptr},
+    {35, "expect", nullptr},
+    {36, "expires", nullptr},
+    {37, "from", nullptr},
+    {38, "host", nullptr},
+    {39, "if-match", nullptr},
+    {40, "if-modified-since", nullptr},
+    {41, "if-none-match", nullptr},
+    {42, "if-range", nullptr},
+    {43, "if-unmodified-since", nullptr},
+    {44, "last-modified", nullptr},
+    {45, "link", nullptr},
+    {46, "location", nullptr},
+    {47, "max-forwards", nullptr},
+    {48, "proxy-authenticate", nullptr},
+    {49, "proxy-authorization", nullptr},
+    {50, "range", nullptr},
+    {51, "referer", nullptr},
+    {52, "refresh", nullptr},
+    {53, "retry-after", nullptr},
+    {54, "server", nullptr},
+    {55, "set-cookie", nullptr},
+    {56, "strict-transport-security", nullptr},
+    {57, "transfer-encoding", nullptr},
+    {58, "user-agent", nullptr},
+    {59, "vary", nullptr},
+    {60, "via", nullptr},
+    {61, "www-authenticate", nullptr},
+};
+
+constexpr uint8 hpack_static_name_slots[] = {
+    36, 33, 0, 44, 2, 0, 0, 0, 0, 0, 0, 17, 46, 0, 0, 0,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 28, 0,
+    0, 55, 0, 48, 0, 15, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+    0, 38, 56, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 58, 29, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 49, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 53, 40, 0, 0,
+    0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    8, 0, 0, 0, 0, 20, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 27, 0, 0, 0, 0, 0, 0, 0, 18, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 21, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 59,
+    0, 52, 0, 16, 0, 0, 61, 0, 19, 0, 0, 0, 0, 39, 0, 42,
+    0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 57, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 30, 35, 0, 0, 34, 0, 0, 0, 0, 0, 47,
+    0, 0, 0, 54, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 32,
+};
+
+constexpr uint8 hpack_static_field_slots[] = {
+    30, 0, 0, 0, 47, 0, 3, 0, 19, 0, 0, 0, 0, 0, 0, 54,
+    0, 61, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0,
+    17, 5, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 57, 0, 10, 0, 16, 0, 0, 0, 28,
+    0, 0, 42, 0, 13, 11, 36, 31, 0, 0, 0, 37, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0, 50, 0, 0, 0, 40, 0, 44, 0, 55, 0, 0, 0, 0,
+    35, 0, 0, 0, 52, 53, 0, 0, 0, 43, 0, 0, 0, 0, 0, 33,
+    0, 0, 0, 25, 41, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 0, 1, 0, 45, 0, 46, 0, 0, 0, 20, 15, 0, 0,
+    0, 23, 0, 0, 0, 0, 0, 0, 12, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, 56, 9, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 59, 2, 0, 0, 0, 0, 0,
+    27, 0, 0, 34, 0, 48, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 49, 0, 0, 18, 0, 39, 29, 32, 0, 0, 22, 0,
+};
+
+constexpr static_table_hash_t hpack_static_names = {218, 255, hpack_static_name_slots};
+constexpr static_table_hash_t hpack_static_fields = {592, 255, hpack_static_field_slots};
+
+static_assert(sizeof(hpack_static_name_slots) == hpack_static_names.mask + 1, "hpack static table");
+static_assert(sizeof(hpack_static_field_slots) == hpack_static_fields.mask + 1, "hpack static table");
+static_assert(http_static_table::verify(hpack_static_entries, RTL_NUMBER_OF(hpack_static_entries), hpack_static_names, hpack_static_fields),
+              "hpack static table");
+
 hpack_static_table hpack_static_table::_instance;
 
-hpack_static_table* hpack_static_table::get_instance() {
-    _instance.load();
-    return &_instance;
-}
-
-hpack_static_table::hpack_static_table() : http_static_table() {}
-
-void hpack_static_table::load() {
-    if (_static_table.empty()) {
-        critical_section_guard guard(_lock);
-        if (_static_table.empty()) {
-            // RFC 7541 Appendix A.  Static Table Definition
-            // if (_static_table.empty()) ...
-            auto lambda = [&](uint32 index, const char* name, const char* value) -> void {
-                _static_table.insert(std::make_pair(name, std::make_pair(value ? value : "", index)));
-                _static_table_index.insert(std::make_pair(index, std::make_pair(name, value ? value : "")));
-            };
-            http_resource::get_instance()->for_each_hpack_static_table(lambda);
-        }
-    }
-}
+hpack_static_table* hpack_static_table::get_instance() { return &_instance; }
+
+hpack_static_table::hpack_static_table()
+    : http_static_table(hpack_static_entries, RTL_NUMBER_OF(hpack_static_entries), &hpack_static_names, &hpack_static_fields) {}
 
 }  // namespace net
 }  // namespace hotplace
@@ -211,6 +211,10 @@ class http2_frame_headers : public http2_frame {
 
     void set_fragment(const binary_t& fragment);
     const binary_t& get_fragment();
+    /**
+     * @brief   weight (0..255, weight - 1), if PRIORITY flag is set
+     */
+    uint8 get_weight();
 
    private:
     uint8 _padlen;
@@ -235,6 +239,11 @@ class http2_frame_priority : public http2_frame {
     virtual return_t write(binary_t& frame);
     virtual void dump(stream_t* s);
 
+    /**
+     * @brief   weight (0..255, weight - 1)
+     */
+    uint8 get_weight();
+
    private:
     bool _exclusive;
     uint32 _dependency;
@@ -256,6 +265,13 @@ class http2_frame_rst_stream : public http2_frame {
     virtual return_t write(binary_t& frame);
     virtual void dump(stream_t* s);
 
+    /**
+     * @brief   set error code
+     * @param   uint32 errorcode [in] see h2_errorcodes_t
+     */
+    http2_frame_rst_stream& set_errorcode(uint32 errorcode);
+    uint32 get_errorcode();
+
    private:
     uint32 _errorcode;
 };
@@ -343,6 +359,13 @@ class http2_frame_goaway : public http2_frame {
      * @param   uint32 errorcode [in] see h2_errorcodes_t
      */
     http2_frame_goaway& set_errorcode(uint32 errorcode);
+    uint32 get_errorcode();
+    /**
+     * @brief   set the last stream identifier processed
+     * @param   uint32 last_id [in]
+     */
+    http2_frame_goaway& set_last_id(uint32 last_id);
+    uint32 get_last_id();
 
     void set_debug(const binary_t& debug);
     const binary_t& get_debug();
@@ -367,6 +390,9 @@ class http2_frame_window_update : public http2_frame {
     virtual return_t write(binary_t& frame);
     virtual void dump(stream_t* s);
 
+    http2_frame_window_update& set_increment(uint32 increment);
+    uint32 get_increment();
+
    private:
     uint32 _increment;
 };
@@ -94,6 +94,15 @@ http2_frame_goaway& http2_frame_goaway::set_errorcode(uint32 errorcode) {
     return *this;
 }
 
+uint32 http2_frame_goaway::get_errorcode() { return _errorcode; }
+
+http2_frame_goaway& http2_frame_goaway::set_last_id(uint32 last_id) {
+    _last_id = last_id & 0x7fffffff;
+    return *this;
+}
+
+uint32 http2_frame_goaway::get_last_id() { return _last_id; }
+
 void http2_frame_goaway::set_debug(const binary_t& debug) { _debug = debug; }
 
 const binary_t& http2_frame_goaway::get_debug() { return _debug; }
@@ -133,5 +133,7 @@ void http2_frame_headers::set_fragment(const binary_t& fragment) { _fragment = f
 
 const binary_t& http2_frame_headers::get_fragment() { return _fragment; }
 
+uint8 http2_frame_headers::get_weight() { return _weight; }
+
 }  // namespace net
 }  // namespace hotplace
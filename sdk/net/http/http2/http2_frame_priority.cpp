@@ -93,5 +93,7 @@ void http2_frame_priority::dump(stream_t* s) {
     }
 }
 
+uint8 http2_frame_priority::get_weight() { return _weight; }
+
 }  // namespace net
 }  // namespace hotplace
@@ -80,5 +80,12 @@ void http2_frame_rst_stream::dump(stream_t* s) {
     }
 }
 
+http2_frame_rst_stream& http2_frame_rst_stream::set_errorcode(uint32 errorcode) {
+    _errorcode = errorcode;
+    return *this;
+}
+
+uint32 http2_frame_rst_stream::get_errorcode() { return _errorcode; }
+
 }  // namespace net
 }  // namespace hotplace
@@ -80,5 +80,12 @@ void http2_frame_window_update::dump(stream_t* s) {
     }
 }
 
+http2_frame_window_update& http2_frame_window_update::set_increment(uint32 increment) {
+    _increment = increment & 0x7fffffff;
+    return *this;
+}
+
+uint32 http2_frame_window_update::get_increment() { return _increment; }
+
 }  // namespace net
 }  // namespace hotplace
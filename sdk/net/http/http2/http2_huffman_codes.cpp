@@ -16,6 +16,7 @@ namespace net {
 // RFC 7541 Appendix B. Huffman Code
 
 const huffman_coding::hc_code_t _h2hcodes[] = {
+    {0, "1111111111000"},
     {1, "11111111111111111011000"},
     {2, "1111111111111111111111100010"},
     {3, "1111111111111111111111100011"},
@@ -52,7 +52,9 @@ return_t http2_protocol::is_kind_of(void* stream, size_t stream_size) {
                     if (flags & mask_flags) {
                         ret = errorcode_t::mismatch;
                     } else {
-                        if ((h2_frame_data <= type) || (type <= h2_frame_continuation)) {
+                        // RFC 9113 5.5.  Extending HTTP/2, extension frame types are small numbers (ex. 0x10 PRIORITY_UPDATE)
+                        // the type of an HTTP/1.1 request line ("HEAD ", "POST ") is a printable character
+                        if (type < 0x20) {
                             __leave2;
                         } else {
                             ret = errorcode_t::mismatch;
@@ -72,7 +74,8 @@ return_t http2_protocol::is_kind_of(void* stream, size_t stream_size) {
     return ret;
 }
 
-return_t http2_protocol::read_stream(basic_stream* stream, size_t* request_size, protocol_state_t* state, int* priority) {
+return_t http2_protocol::read_stream(byte_t* stream, size_t stream_size, size_t* request_size, protocol_state_t* state, int* priority,
+                                     protocol_cursor_t* cursor) {
     return_t ret = errorcode_t::success;
     __try2 {
         if (nullptr == stream || nullptr == request_size || nullptr == state) {
@@ -84,8 +87,7 @@ return_t http2_protocol::read_stream(basic_stream* stream, size_t* request_size,
             *priority = 0;
         }
 
-        byte_t* stream_data = stream->data();
-        uint32 stream_size = stream->size();
+        byte_t* stream_data = stream;
 
         // RFC 7540 3.5. HTTP/2 Connection Preface
         // 0x505249202a20485454502f322e300d0a0d0a534d0d0a0d0a
@@ -137,6 +139,7 @@ return_t http2_protocol::read_stream(basic_stream* stream, size_t* request_size,
             if (stream_size < frame_header_size + pos) {
                 *state = protocol_state_t::protocol_state_data;
             } else if (stream_size < frame_header_size + len + pos) {
+                *request_size = frame_header_size + len + pos;  // resume when the frame is received
                 *state = protocol_state_t::protocol_state_header;
             } else {
                 *request_size = frame_header_size + len + pos;
@@ -27,7 +27,23 @@
 namespace hotplace {
 namespace net {
 
-http2_session::http2_session() : _enable_push(false) {}
+// RFC 9113 6.9.2.  Initial Flow-Control Window Size
+//  When an HTTP/2 connection is first established, new streams are created with an initial flow-control window size of 65,535 octets.
+//  The connection flow-control window is also 65,535 octets.
+const uint32 h2_default_window = 65535;
+const uint32 h2_recv_initial_window = 0xa00000;  // SETTINGS_INITIAL_WINDOW_SIZE (server)
+const size_t h2_buffer_limit = 0x40000;          // generated content queued per stream (see refill)
+
+http2_session::http2_session()
+    : _enable_push(false),
+      _window(h2_default_window),
+      _initial_window(h2_default_window),
+      _max_frame_size(16384),
+      _recv_consumed(0),
+      _recv_window(h2_default_window),
+      _last_stream_id(0) {}
+
+http2_session::h2_recv_t::h2_recv_t() : lookup(false), consumed(0), window(h2_recv_initial_window) {}
 
 http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data_array[], http_server* server, http_request** request) {
     return_t ret = errorcode_t::success;
@@ -114,11 +130,67 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
                 trace_debug_event(category_net, net_event_netsession_consume_http2, &bs);
             }
 
-            req->add_content(frame.get_data());
+            http_body_sink_t sink;
+            {
+                critical_section_guard guard(_lock);
+                auto& recv = _recv[stream_id];
+                if (false == recv.lookup) {
+                    recv.lookup = true;
+                    server->get_http_router().get_sink(req, recv.sink);
+                }
+                sink = recv.sink;
+            }
+
+            // RFC 9113 6.9.1.  The Flow-Control Window
+            //  The entire DATA frame payload is included in flow control, including the Pad Length and Padding fields if present.
+            binary_t frames;
+            const binary_t& data = frame.get_data();
+            return_t result = receive(stream_id, payload_size, frames);
+            if (errorcode_t::success != result) {
+                // do nothing
+            } else if (sink) {
+                // streaming, the content is not buffered
+                result = sink(session, req, data.data(), data.size(), (h2_flag_end_stream & hdr->flags) ? true : false);
+            } else {
+                req->add_content(data);
+
+                if (completion && req->get_http_header().contains("Content-Type", "application/x-www-form-urlencoded")) {
+                    auto const& content = req->get_content();
+                    req->get_http_uri().set_query(content);
+                }
+            }
+
+            if (errorcode_t::success == result) {
+                acknowledge(stream_id, payload_size, frames);
+            } else if (errorcode_t::pending == result) {
+                if (payload_size > data.size()) {
+                    acknowledge(stream_id, payload_size - data.size(), frames);  // padding
+                }
+            } else if (errorcode_t::disconnect == result) {
+                // GOAWAY
+                completion = false;
+                reset = true;
+            } else if (errorcode_t::bad_data == result) {
+                // RST_STREAM, the connection window is kept
+                acknowledge(0, payload_size, frames);
+
+                completion = false;
+                reset = true;
+            } else {
+                acknowledge(0, payload_size, frames);
+
+                http2_frame_rst_stream rst;
+                rst.set_errorcode(h2_errorcodes_t::h2_cancel).set_stream_id(stream_id);
+                rst.write(frames);
 
-            if (req->get_http_header().contains("Content-Type", "application/x-www-form-urlencoded")) {
-                auto const& content = req->get_content();
-                req->get_http_uri().set_query(content);
+                completion = false;
+                reset = true;
+            }
+            if (false == frames.empty()) {
+                session->send(&frames[0], frames.size());
+            }
+            if (errorcode_t::disconnect == result) {
+                session->shutdown();
             }
         } else if (h2_frame_t::h2_frame_headers == hdr->type) {
             http2_frame_headers frame;
@@ -136,6 +208,17 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
                 req->get_http_header().add(name, value);
             };
             frame.read_compressed_header(frame.get_fragment(), lambda);
+
+            {
+                critical_section_guard guard(_lock);
+                if (stream_id > _last_stream_id) {
+                    _last_stream_id = stream_id;
+                }
+                auto& stream = get_stream(stream_id);
+                if (h2_flag_t::h2_flag_priority & frame.get_flags()) {
+                    stream.weight = frame.get_weight() + 1;
+                }
+            }
         } else if (h2_frame_t::h2_frame_priority == hdr->type) {
             http2_frame_priority frame;
             frame.read(hdr, frame_size);
@@ -143,6 +226,8 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
                 frame.dump(&bs);
                 trace_debug_event(category_net, net_event_netsession_consume_http2, &bs);
             }
+
+            set_weight(stream_id, frame.get_weight());
         } else if (h2_frame_t::h2_frame_rst_stream == hdr->type) {
             http2_frame_rst_stream frame;
             frame.read(hdr, frame_size);
@@ -151,6 +236,9 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
                 trace_debug_event(category_net, net_event_netsession_consume_http2, &bs);
             }
             reset = true;
+
+            critical_section_guard guard(_lock);
+            close_stream(stream_id);
         } else if (h2_frame_t::h2_frame_settings == hdr->type) {
             http2_frame_settings frame;
             frame.read(hdr, frame_size);
@@ -188,12 +276,29 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
             if (frame.get_flags()) {
                 resp_settings.set_flags(h2_flag_ack);
             } else {
-                resp_settings.add(h2_settings_enable_push, 0).add(h2_settings_max_concurrent_streams, 100).add(h2_settings_initial_window_size, 0xa00000);
+                resp_settings.add(h2_settings_enable_push, 0).add(h2_settings_max_concurrent_streams, 100).add(h2_settings_initial_window_size, h2_recv_initial_window);
             }
 
             resp_settings.write(bin_resp);
 
+            critical_section_guard guard(_lock);
+            return_t result = errorcode_t::success;
+            if (0 == frame.get_flags()) {
+                // RFC 9113 6.9.2.  Initial Flow-Control Window Size
+                uint32 window_size = 0;
+                if (errorcode_t::success == frame.find(h2_settings_initial_window_size, window_size)) {
+                    result = update_settings(h2_settings_initial_window_size, window_size, bin_resp);
+                }
+                uint32 frame_size = 0;
+                if ((errorcode_t::success == result) && (errorcode_t::success == frame.find(h2_settings_max_frame_size, frame_size))) {
+                    result = update_settings(h2_settings_max_frame_size, frame_size, bin_resp);
+                }
+            }
+
             session->send((char*)&bin_resp[0], bin_resp.size());
+            if (errorcode_t::disconnect == result) {
+                session->shutdown();  // GOAWAY
+            }
         } else if (h2_frame_t::h2_frame_push_promise == hdr->type) {
             http2_frame_push_promise frame;
             frame.read(hdr, frame_size);
@@ -230,6 +335,18 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
                 frame.dump(&bs);
                 trace_debug_event(category_net, net_event_netsession_consume_http2, &bs);
             }
+
+            binary_t frames;
+            critical_section_guard guard(_lock);
+            return_t result = update_window(stream_id, frame.get_increment(), frames);
+            if (false == frames.empty()) {
+                session->send(&frames[0], frames.size());
+            }
+            if (errorcode_t::disconnect == result) {
+                session->shutdown();  // GOAWAY
+            } else if (errorcode_t::bad_data == result) {
+                reset = true;  // RST_STREAM
+            }
         } else if (h2_frame_t::h2_frame_continuation == hdr->type) {
             http2_frame_continuation frame;
             frame.read(hdr, frame_size);
@@ -248,11 +365,14 @@ http2_session& http2_session::consume(uint32 type, uint32 data_count, void* data
          * after handling DATA, HEADERS, CONTINUATION frames
          */
         if (completion) {
-            *request = new http_request(*req);
+            *request = new http_request(std::move(*req));
         }
         if (completion || reset) {
             _flags.erase(stream_id);
             _headers.erase(stream_id);
+
+            critical_section_guard guard(_lock);
+            _recv.erase(stream_id);
         }
     }
     __finally2 {
@@ -270,5 +390,545 @@ http2_session& http2_session::enable_push(bool enable) {
 
 bool http2_session::is_push_enabled() { return _enable_push; }
 
+/**
+ * @brief   DATA frame
+ * @remarks no padding, the payload is copied once (http2_frame_data copies twice)
+ */
+static void write_data_frame(binary_t& frames, uint32 stream_id, uint8 flags, const byte_t* data, size_t size) {
+    http2_frame_header_t hdr;
+    hdr.len[0] = (byte_t)(size >> 16);
+    hdr.len[1] = (byte_t)(size >> 8);
+    hdr.len[2] = (byte_t)size;
+    hdr.type = h2_frame_t::h2_frame_data;
+    hdr.flags = flags;
+    hdr.stream_id = hton32(stream_id);
+
+    frames.insert(frames.end(), (byte_t*)&hdr, (byte_t*)&hdr + sizeof(hdr));
+    if (size) {
+        frames.insert(frames.end(), data, data + size);
+    }
+}
+
+return_t http2_session::send(network_session* session, uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        // frames are sent in the order they are written
+        critical_section_guard guard(_lock);
+
+        binary_t frames;
+        ret = write(stream_id, headers, content, end_stream, frames);
+        if (false == frames.empty()) {
+            session->send(&frames[0], frames.size());
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::write(uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+
+    critical_section_guard guard(_lock);
+
+    frames.insert(frames.end(), headers.begin(), headers.end());
+
+    if (end_stream) {
+        close_stream(stream_id);
+    } else if (content.empty()) {
+        // DATA frames with no payload are not flow controlled
+        write_data_frame(frames, stream_id, h2_flag_end_stream, nullptr, 0);
+        close_stream(stream_id);
+    } else {
+        auto& stream = get_stream(stream_id);
+        if ((stream.pos < stream.content.size()) || (false == stream.end)) {
+            ret = errorcode_t::already_exist;  // a response is in progress
+        } else {
+            stream.content = std::move(content);
+            stream.pos = 0;
+            stream.deficit = 0;
+            _active.push_back(stream_id);
+
+            schedule(frames);
+        }
+    }
+
+    return ret;
+}
+
+return_t http2_session::send_chunk(network_session* session, uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        // frames are sent in the order they are written
+        critical_section_guard guard(_lock);
+
+        binary_t frames;
+        ret = write_chunk(stream_id, headers, content, end_stream, frames);
+        if (false == frames.empty()) {
+            session->send(&frames[0], frames.size());
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::write_chunk(uint32 stream_id, const binary_t& headers, binary_t& content, bool end_stream, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        critical_section_guard guard(_lock);
+
+        auto& stream = get_stream(stream_id);
+        bool queued = (stream.pos < stream.content.size());
+        if ((queued && stream.end) || stream.producer) {
+            ret = errorcode_t::already_exist;  // a response is in progress
+            __leave2;
+        }
+
+        frames.insert(frames.end(), headers.begin(), headers.end());
+
+        if (queued) {
+            // blocked by the window, the unsent part is kept
+            // the sent part is dropped when it is a half of the queue or more, not per chunk
+            if (stream.pos >= (stream.content.size() >> 1)) {
+                stream.content.erase(stream.content.begin(), stream.content.begin() + stream.pos);
+                stream.pos = 0;
+            }
+            stream.content.insert(stream.content.end(), content.begin(), content.end());
+        } else {
+            stream.content = std::move(content);
+            stream.pos = 0;
+        }
+        stream.end = end_stream;
+
+        if (stream.content.empty()) {
+            if (end_stream) {
+                // DATA frames with no payload are not flow controlled
+                write_data_frame(frames, stream_id, h2_flag_end_stream, nullptr, 0);
+                close_stream(stream_id);
+            }
+        } else {
+            if (false == queued) {
+                stream.deficit = 0;
+                _active.push_back(stream_id);
+            }
+            schedule(frames);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::send(network_session* session, uint32 stream_id, const binary_t& headers, http_body_producer_t producer) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        // frames are sent in the order they are written
+        critical_section_guard guard(_lock);
+
+        binary_t frames;
+        ret = write(stream_id, headers, producer, frames);
+        if (false == frames.empty()) {
+            session->send(&frames[0], frames.size());
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::write(uint32 stream_id, const binary_t& headers, http_body_producer_t producer, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == producer) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        critical_section_guard guard(_lock);
+
+        auto& stream = get_stream(stream_id);
+        if ((stream.pos < stream.content.size()) || (false == stream.end)) {
+            ret = errorcode_t::already_exist;  // a response is in progress
+            __leave2;
+        }
+
+        frames.insert(frames.end(), headers.begin(), headers.end());
+
+        stream.content.clear();
+        stream.pos = 0;
+        stream.end = false;
+        stream.producer = producer;
+
+        refill(stream_id, stream, frames);
+        if (stream.pos < stream.content.size()) {
+            stream.deficit = 0;
+            _active.push_back(stream_id);
+            schedule(frames);
+        } else {
+            close_stream(stream_id);  // an empty body
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::update_window(uint32 stream_id, uint32 increment, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        critical_section_guard guard(_lock);
+
+        // RFC 9113 6.9.  WINDOW_UPDATE
+        //  A receiver MUST treat the receipt of a WINDOW_UPDATE frame with a flow-control window increment of 0 as a stream error of type
+        //  PROTOCOL_ERROR; errors on the connection flow-control window MUST be treated as a connection error.
+        // RFC 9113 6.9.1.  The Flow-Control Window
+        //  A sender MUST NOT allow a flow-control window to exceed 2^31-1 octets. ... For streams, the sender sends a RST_STREAM with an error
+        //  code of FLOW_CONTROL_ERROR; for the connection, a GOAWAY frame with an error code of FLOW_CONTROL_ERROR is sent.
+        increment &= 0x7fffffff;
+
+        if (0 == stream_id) {
+            if (0 == increment) {
+                goaway(h2_errorcodes_t::h2_protocol_error, frames);
+                ret = errorcode_t::disconnect;
+                __leave2;
+            }
+            if (_window + increment > 0x7fffffff) {
+                goaway(h2_errorcodes_t::h2_flow_control_error, frames);
+                ret = errorcode_t::disconnect;
+                __leave2;
+            }
+            _window += increment;
+        } else {
+            auto iter = _streams.find(stream_id);
+            if (_streams.end() == iter) {
+                __leave2;  // closed
+            }
+            auto& stream = iter->second;
+            if (0 == increment) {
+                reset_stream(stream_id, h2_errorcodes_t::h2_protocol_error, frames);
+                ret = errorcode_t::bad_data;
+                __leave2;
+            }
+            if (stream.window + increment > 0x7fffffff) {
+                reset_stream(stream_id, h2_errorcodes_t::h2_flow_control_error, frames);
+                ret = errorcode_t::bad_data;
+                __leave2;
+            }
+            stream.window += increment;
+        }
+
+        schedule(frames);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::update_settings(uint16 id, uint32 value, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        critical_section_guard guard(_lock);
+
+        if (h2_settings_initial_window_size == id) {
+            // RFC 9113 6.5.2.  Defined Settings
+            //  Values above the maximum flow-control window size of 2^31-1 MUST be treated as a connection error of type FLOW_CONTROL_ERROR.
+            // RFC 9113 6.9.2.  Initial Flow-Control Window Size
+            //  a SETTINGS frame can alter the initial flow-control window size for streams with active flow-control windows
+            //  the change can cause the available space in a flow-control window to become negative
+            //  An endpoint MUST treat a change to SETTINGS_INITIAL_WINDOW_SIZE that causes any flow-control window to exceed the maximum size
+            //  as a connection error of type FLOW_CONTROL_ERROR.
+            bool overflow = (value > 0x7fffffff);
+            for (auto iter = _streams.begin(); (false == overflow) && (_streams.end() != iter); iter++) {
+                overflow = (iter->second.window + (int64)value - _initial_window > 0x7fffffff);
+            }
+            if (overflow) {
+                goaway(h2_errorcodes_t::h2_flow_control_error, frames);
+                ret = errorcode_t::disconnect;
+                __leave2;
+            }
+            for (auto& item : _streams) {
+                item.second.window += (int64)value - _initial_window;
+            }
+            _initial_window = value;
+        } else if (h2_settings_max_frame_size == id) {
+            // RFC 9113 6.5.2.  Defined Settings
+            //  between the initial value (2^14) and the maximum allowed frame size (2^24-1)
+            //  Values outside this range MUST be treated as a connection error of type PROTOCOL_ERROR.
+            if ((value < 0x4000) || (value > 0xffffff)) {
+                goaway(h2_errorcodes_t::h2_protocol_error, frames);
+                ret = errorcode_t::disconnect;
+                __leave2;
+            }
+            _max_frame_size = value;
+        } else {
+            __leave2;
+        }
+
+        schedule(frames);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+http2_session& http2_session::set_weight(uint32 stream_id, uint8 weight) {
+    critical_section_guard guard(_lock);
+    auto iter = _streams.find(stream_id);
+    if (_streams.end() != iter) {
+        iter->second.weight = weight + 1;
+    }
+    return *this;
+}
+
+int64 http2_session::get_window(uint32 stream_id) {
+    int64 ret = 0;
+    critical_section_guard guard(_lock);
+    if (0 == stream_id) {
+        ret = _window;
+    } else {
+        auto iter = _streams.find(stream_id);
+        ret = (_streams.end() == iter) ? _initial_window : iter->second.window;
+    }
+    return ret;
+}
+
+size_t http2_session::get_pending_streams() {
+    critical_section_guard guard(_lock);
+    return _active.size();
+}
+
+return_t http2_session::acknowledge(network_session* session, uint32 stream_id, uint32 size) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        binary_t frames;
+        ret = acknowledge(stream_id, size, frames);
+        if (false == frames.empty()) {
+            session->send(&frames[0], frames.size());
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t http2_session::acknowledge(uint32 stream_id, uint32 size, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+
+    critical_section_guard guard(_lock);
+
+    auto window_update = [&](uint32 id, uint32 increment) -> void {
+        http2_frame_window_update frame;
+        frame.set_increment(increment).set_stream_id(id);
+        frame.write(frames);
+    };
+
+    // connection
+    _recv_consumed += size;
+    if (_recv_consumed >= (h2_default_window >> 1)) {
+        window_update(0, _recv_consumed);
+        _recv_window += _recv_consumed;
+        _recv_consumed = 0;
+    }
+
+    // stream (not closed)
+    auto iter = _recv.find(stream_id);
+    if (_recv.end() != iter) {
+        auto& recv = iter->second;
+        recv.consumed += size;
+        if (recv.consumed >= (h2_recv_initial_window >> 1)) {
+            window_update(stream_id, recv.consumed);
+            recv.window += recv.consumed;
+            recv.consumed = 0;
+        }
+    }
+
+    return ret;
+}
+
+return_t http2_session::receive(uint32 stream_id, uint32 size, binary_t& frames) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        critical_section_guard guard(_lock);
+
+        _recv_window -= size;
+        if (_recv_window < 0) {
+            // RFC 9113 5.4.1.  Connection Error Handling
+            goaway(h2_errorcodes_t::h2_flow_control_error, frames);
+            ret = errorcode_t::disconnect;
+            __leave2;
+        }
+
+        auto& recv = _recv[stream_id];
+        recv.window -= size;
+        if (recv.window < 0) {
+            // RFC 9113 5.4.2.  Stream Error Handling
+            reset_stream(stream_id, h2_errorcodes_t::h2_flow_control_error, frames);
+            ret = errorcode_t::bad_data;
+            __leave2;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+http2_session::h2_stream_t& http2_session::get_stream(uint32 stream_id) {
+    auto pib = _streams.insert(std::make_pair(stream_id, h2_stream_t()));
+    if (pib.second) {
+        pib.first->second.window = _initial_window;
+    }
+    return pib.first->second;
+}
+
+void http2_session::schedule(binary_t& frames) {
+    /**
+     * deficit round robin
+     *  each round a stream earns quantum bytes (weight), and sends DATA frames as long as the deficit covers them
+     *  a stream blocked by its own window loses its deficit, a stream blocked by the connection window keeps it
+     *  a stream served moves to the back, so the next WINDOW_UPDATE continues the round
+     */
+    bool progress = true;
+    while (progress && (_window > 0) && (false == _active.empty())) {
+        progress = false;
+        size_t count = _active.size();
+        for (size_t i = 0; (i < count) && (_window > 0); i++) {
+            uint32 stream_id = _active.front();
+            auto& stream = _streams[stream_id];
+            refill(stream_id, stream, frames);
+            size_t size = stream.content.size();
+
+            if (stream.window > 0) {
+                stream.deficit += ((size_t)_max_frame_size * stream.weight) >> 4;
+                while (stream.pos < size) {
+                    size_t chunk = size - stream.pos;
+                    if (chunk > _max_frame_size) {
+                        chunk = _max_frame_size;
+                    }
+                    if ((int64)chunk > _window) {
+                        chunk = _window;
+                    }
+                    if ((int64)chunk > stream.window) {
+                        chunk = stream.window;
+                    }
+                    if ((0 == chunk) || (chunk > stream.deficit)) {
+                        break;
+                    }
+
+                    bool last = (stream.pos + chunk == size) && stream.end;
+                    write_data_frame(frames, stream_id, last ? h2_flag_end_stream : 0, &stream.content[stream.pos], chunk);
+                    if (istraceable()) {
+                        basic_stream bs;
+                        bs.printf("[h2] DATA stream %u size %zi window %lli/%lli\n", stream_id, chunk, (long long)_window, (long long)stream.window);
+                        trace_debug_event(category_net, net_event_httpresponse, &bs);
+                    }
+
+                    stream.pos += chunk;
+                    stream.deficit -= chunk;
+                    stream.window -= chunk;
+                    _window -= chunk;
+                }
+            }
+
+            if ((stream.pos >= size) && stream.producer) {
+                refill(stream_id, stream, frames);
+                size = stream.content.size();
+            }
+
+            if (stream.pos >= size) {
+                _active.pop_front();
+                // a stream waiting for the next chunk (write_chunk) keeps its window
+                if (stream.end) {
+                    _streams.erase(stream_id);
+                }
+            } else {
+                if (stream.window <= 0) {
+                    stream.deficit = 0;
+                } else {
+                    progress = true;
+                }
+                _active.splice(_active.end(), _active, _active.begin());
+            }
+        }
+    }
+}
+
+void http2_session::refill(uint32 stream_id, h2_stream_t& stream, binary_t& frames) {
+    if (stream.producer) {
+        // the sent part is dropped when it is a half of the queue or more
+        if (stream.pos >= (stream.content.size() >> 1)) {
+            stream.content.erase(stream.content.begin(), stream.content.begin() + stream.pos);
+            stream.pos = 0;
+        }
+
+        bool sent = (stream.pos >= stream.content.size());
+        while (stream.content.size() - stream.pos < h2_buffer_limit) {
+            binary_t chunk;
+            return_t result = stream.producer(chunk);
+            stream.content.insert(stream.content.end(), chunk.begin(), chunk.end());
+            if (errorcode_t::success != result) {
+                stream.producer = nullptr;
+                stream.end = true;
+                break;
+            }
+        }
+
+        if (sent && stream.end && (stream.pos >= stream.content.size())) {
+            // DATA frames with no payload are not flow controlled
+            write_data_frame(frames, stream_id, h2_flag_end_stream, nullptr, 0);
+        }
+    }
+}
+
+void http2_session::close_stream(uint32 stream_id) {
+    if (_streams.erase(stream_id)) {
+        _active.remove(stream_id);
+    }
+}
+
+void http2_session::reset_stream(uint32 stream_id, uint32 errorcode, binary_t& frames) {
+    http2_frame_rst_stream frame;
+    frame.set_errorcode(errorcode).set_stream_id(stream_id);
+    frame.write(frames);
+
+    close_stream(stream_id);
+    _recv.erase(stream_id);
+}
+
+void http2_session::goaway(uint32 errorcode, binary_t& frames) {
+    http2_frame_goaway frame;
+    frame.set_last_id(_last_stream_id).set_errorcode(errorcode);
+    frame.write(frames);
+}
+
 }  // namespace net
 }  // namespace hotplace
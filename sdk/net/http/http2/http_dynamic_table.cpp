@@ -15,44 +15,40 @@
 namespace hotplace {
 namespace net {
 
-http_dynamic_table::http_dynamic_table() : _type(header_compression_hpack), _inserted(0), _dropped(0), _capacity(0), _tablesize(0) {}
+http_dynamic_table::http_dynamic_table()
+    : _capacity(0), _inserted(0), _dropped(0), _ring(16), _ring_mask(15), _type(header_compression_hpack), _tablesize(0) {}
 
 void http_dynamic_table::for_each(std::function<void(const std::string&, const std::string&)> v) {
     if (v) {
-        for (auto item : _dynamic_map) {
-            v(item.first, item.second.first);
+        // latest first (index order)
+        for (size_t ent = _inserted; ent > _dropped; ent--) {
+            auto entry = get_entry(ent - 1);
+            v(entry->name, entry->value);
         }
     }
 }
 
-bool http_dynamic_table::operator==(const http_dynamic_table& rhs) { return (_type == rhs._type) && (_dynamic_map == rhs._dynamic_map); }
+bool http_dynamic_table::operator==(const http_dynamic_table& rhs) {
+    bool ret = (_type == rhs._type) && (_inserted == rhs._inserted) && (_dropped == rhs._dropped);
+    for (size_t ent = _dropped; ret && (ent < _inserted); ent++) {
+        const auto& lentry = _ring[ent & _ring_mask];
+        const auto& rentry = rhs._ring[ent & rhs._ring_mask];
+        ret = (lentry.name == rentry.name) && (lentry.value == rentry.value);
+    }
+    return ret;
+}
 
-bool http_dynamic_table::operator!=(const http_dynamic_table& rhs) { return (_type != rhs._type) || (_dynamic_map != rhs._dynamic_map); }
+bool http_dynamic_table::operator!=(const http_dynamic_table& rhs) { return false == (*this == rhs); }
+
+static size_t hash_field(size_t name_hash, const std::string& value) {
+    size_t h = std::hash<std::string>()(value);
+    return name_hash ^ (h + 0x9e3779b97f4a7c15ULL + (name_hash << 6) + (name_hash >> 2));
+}
 
 match_result_t http_dynamic_table::match(uint32 flags, const std::string& name, const std::string& value, size_t& index) {
     match_result_t state = match_result_t::not_matched;
 
-    auto lbound = _dynamic_map.lower_bound(name);
-    auto ubound = _dynamic_map.upper_bound(name);
-    std::priority_queue<size_t> pq;
-    std::priority_queue<size_t> nr;
-
-    for (auto iter = lbound; iter != ubound; iter++) {
-        const auto& k = iter->first;
-        const auto& v = iter->second;  // pair(value, entry)
-        const auto& val = v.first;
-        const auto& ent = v.second;
-        if ((name == k) && (value == val)) {
-            pq.push(ent);  // using greater
-        }
-        if (qpack_name_reference & flags) {
-            if (name == k) {
-                nr.push(ent);
-            }
-        }
-    }
-
-    auto get_entry = [&](size_t ent, size_t& idx) -> void {
+    auto get_index = [&](size_t ent, size_t& idx) -> void {
         /**
          * get index from ent
          *
@@ -87,14 +83,19 @@ match_result_t http_dynamic_table::match(uint32 flags, const std::string& name,
         }
     };
 
-    if (pq.size()) {
-        state = match_result_t::all_matched_dynamic;
-        auto const& ent = pq.top();  // biggest = latest
-        get_entry(ent, index);
-    } else if (nr.size()) {
-        state = match_result_t::key_matched_dynamic;
-        auto const& ent = nr.top();
-        get_entry(ent, index);
+    if (_inserted > _dropped) {
+        size_t name_hash = std::hash<std::string>()(name);
+        size_t ent = index_find(_field_index, hash_field(name_hash, value), name, &value);
+        if ((size_t)-1 != ent) {
+            state = match_result_t::all_matched_dynamic;
+            get_index(ent, index);
+        } else if (qpack_name_reference & flags) {
+            ent = index_find(_name_index, name_hash, name, nullptr);
+            if ((size_t)-1 != ent) {
+                state = match_result_t::key_matched_dynamic;
+                get_index(ent, index);
+            }
+        }
     }
 
     return state;
@@ -117,32 +118,16 @@ return_t http_dynamic_table::select(uint32 flags, size_t index, std::string& nam
             }
         }
 
-        if (_dynamic_reversemap.size()) {
-            /**
-             * refer hpack_dynamic_table::match
-             * index = _inserted - v.second - 1
-             * v.second = _inserted - index - 1
-             */
-            const auto& t = _inserted - index - 1;
-            auto riter = _dynamic_reversemap.find(t);
-            if (_dynamic_reversemap.end() != riter) {
-                const auto& pne = riter->second;  // pair(name, entry size)
-                const auto& nam = pne.first;
-                auto lbound = _dynamic_map.lower_bound(nam);
-                auto ubound = _dynamic_map.upper_bound(nam);
-
-                for (auto iter = lbound; iter != ubound; iter++) {
-                    const auto& pve = iter->second;  // pair(value, entry)
-                    const auto& val = pve.first;
-                    const auto& ent = pve.second;
-                    if (t == ent) {
-                        name = nam;
-                        value = val;
-                        ret = errorcode_t::success;
-                        break;
-                    }
-                }
-            }
+        /**
+         * refer hpack_dynamic_table::match
+         * index = _inserted - ent - 1
+         * ent = _inserted - index - 1
+         */
+        if (index < _inserted - _dropped) {
+            auto entry = get_entry(_inserted - index - 1);
+            name = entry->name;
+            value = entry->value;
+            ret = errorcode_t::success;
         }
 
         if (errorcode_t::success == ret) {
@@ -175,24 +160,39 @@ return_t http_dynamic_table::commit() {
 
     critical_section_guard guard(_lock);
     while (false == _commit_queue.empty()) {
-        commit_pair item = _commit_queue.front();
+        commit_pair item = std::move(_commit_queue.front());
         _commit_queue.pop();
 
-        auto const& name = item.name;
-        auto const& value = item.value;
-
         // RFC 7541 4.1.  Calculating Table Size
         // RFC 9204 3.2.1.  Dynamic Table Size
         size_t entrysize = 0;
-        http_header_compression::sizeof_entry(name, value, entrysize);
+        http_header_compression::sizeof_entry(item.name, item.value, entrysize);
 
         if (entrysize < _capacity) {
             _tablesize += entrysize;
 
             evict();
 
-            _dynamic_map.insert({name, {value, _inserted}});
-            _dynamic_reversemap.insert({_inserted, {name, entrysize}});
+            if (_inserted - _dropped > _ring_mask) {
+                // full, double the ring
+                std::vector<table_entry_t> ring((_ring_mask + 1) << 1);
+                size_t mask = ring.size() - 1;
+                for (size_t ent = _dropped; ent < _inserted; ent++) {
+                    ring[ent & mask] = std::move(_ring[ent & _ring_mask]);
+                }
+                _ring.swap(ring);
+                _ring_mask = mask;
+            }
+
+            auto entry = get_entry(_inserted);
+            entry->name = std::move(item.name);
+            entry->value = std::move(item.value);
+            entry->entrysize = entrysize;
+            entry->name_hash = std::hash<std::string>()(entry->name);
+            entry->field_hash = hash_field(entry->name_hash, entry->value);
+
+            index_insert(_name_index, entry->name_hash, _inserted);
+            index_insert(_field_index, entry->field_hash, _inserted);
 
             if (_hook) {
                 _hook(category_net, net_event_header_compression_insert);
@@ -200,7 +200,7 @@ return_t http_dynamic_table::commit() {
 
             if (istraceable()) {
                 basic_stream bs;
-                bs.printf("insert entry[%zi] %s=%s\n", _inserted, name.c_str(), value.c_str());
+                bs.printf("insert entry[%zi] %s=%s\n", _inserted, entry->name.c_str(), entry->value.c_str());
                 trace_debug_event(category_net, net_event_header_compression_insert, &bs);
             }
 
@@ -216,46 +216,97 @@ return_t http_dynamic_table::commit() {
 return_t http_dynamic_table::evict() {
     return_t ret = errorcode_t::success;
 
-    while (_dynamic_reversemap.size() && (_tablesize > _capacity)) {
+    while ((_inserted > _dropped) && (_tablesize > _capacity)) {
         // RFC 7541 4.2.  Maximum Table Size
         // RFC 7541 4.4.  Entry Eviction When Adding New Entries
         // RFC 9204 3.2.2.  Dynamic Table Capacity and Eviction
-        auto entry = _dropped;
-        auto back = _dynamic_reversemap.find(entry);
-
-        if (_dynamic_reversemap.end() != back) {
-            auto const& t = back->first;   // entry
-            auto const& k = back->second;  // (name, entry size)
-
-            auto const& name = k.first;
-            auto const& entrysize = k.second;
-
-            _tablesize -= entrysize;
-
-            auto lbound = _dynamic_map.lower_bound(name);
-            auto ubound = _dynamic_map.upper_bound(name);
-
-            for (auto iter = lbound; iter != ubound; iter++) {
-                auto const& v = iter->second;  // pair(value, entry)
-                auto const& val = v.first;
-                auto const& ent = v.second;
-                if (ent == t) {
-                    if (_hook) {
-                        _hook(category_net, net_event_header_compression_evict);
-                    }
-
-                    if (istraceable()) {
-                        basic_stream bs;
-                        bs.printf("evict entry[%zi] %s=%s\n", entry, name.c_str(), val.c_str());
-                        trace_debug_event(category_net, net_event_header_compression_evict, &bs);
-                    }
-                    _dynamic_map.erase(iter);
-                    break;
+        // the index slots of the dropped entry are skipped (see index_find)
+        auto entry = get_entry(_dropped);
+
+        _tablesize -= entry->entrysize;
+
+        if (_hook) {
+            _hook(category_net, net_event_header_compression_evict);
+        }
+
+        if (istraceable()) {
+            basic_stream bs;
+            bs.printf("evict entry[%zi] %s=%s\n", _dropped, entry->name.c_str(), entry->value.c_str());
+            trace_debug_event(category_net, net_event_header_compression_evict, &bs);
+        }
+
+        entry->name.clear();
+        entry->value.clear();
+        _dropped++;
+    }
+
+    return ret;
+}
+
+http_dynamic_table::table_entry_t* http_dynamic_table::get_entry(size_t entry) { return &_ring[entry & _ring_mask]; }
+
+void http_dynamic_table::index_insert(index_t& index, size_t hash, size_t entry) {
+    if ((index.used + 1) << 1 > index.slots.size()) {
+        // more than half used (including dropped entries)
+        index_rebuild(index, &index == &_field_index);
+    }
+
+    size_t mask = index.slots.size() - 1;
+    size_t pos = hash & mask;
+    while ((size_t)-1 != index.slots[pos].entry) {
+        pos = (pos + 1) & mask;
+    }
+    index.slots[pos].hash = hash;
+    index.slots[pos].entry = entry;
+    index.used++;
+}
+
+void http_dynamic_table::index_rebuild(index_t& index, bool field) {
+    size_t entries = _inserted - _dropped + 1;
+    size_t size = 16;
+    while (size < (entries << 2)) {
+        size <<= 1;
+    }
+
+    index_slot_t empty;
+    empty.hash = 0;
+    empty.entry = (size_t)-1;
+    index.slots.assign(size, empty);
+    index.used = 0;
+
+    size_t mask = size - 1;
+    for (size_t ent = _dropped; ent < _inserted; ent++) {
+        auto entry = get_entry(ent);
+        size_t hash = field ? entry->field_hash : entry->name_hash;
+        size_t pos = hash & mask;
+        while ((size_t)-1 != index.slots[pos].entry) {
+            pos = (pos + 1) & mask;
+        }
+        index.slots[pos].hash = hash;
+        index.slots[pos].entry = ent;
+        index.used++;
+    }
+}
+
+size_t http_dynamic_table::index_find(index_t& index, size_t hash, const std::string& name, const std::string* value) {
+    size_t ret = (size_t)-1;
+
+    if (false == index.slots.empty()) {
+        size_t mask = index.slots.size() - 1;
+        size_t pos = hash & mask;
+        while (true) {
+            const auto& slot = index.slots[pos];
+            if ((size_t)-1 == slot.entry) {
+                break;
+            }
+            // the latest live entry
+            if ((hash == slot.hash) && (slot.entry >= _dropped) && (slot.entry < _inserted) && (((size_t)-1 == ret) || (slot.entry > ret))) {
+                auto entry = get_entry(slot.entry);
+                if ((name == entry->name) && ((nullptr == value) || (*value == entry->value))) {
+                    ret = slot.entry;
                 }
             }
-
-            _dynamic_reversemap.erase(back);
-            _dropped++;
+            pos = (pos + 1) & mask;
         }
     }
 
@@ -297,7 +348,7 @@ uint8 http_dynamic_table::get_type() { return _type; }
 
 void http_dynamic_table::set_type(uint8 type) { _type = type; }
 
-size_t http_dynamic_table::dynamic_map_size() { return _dynamic_map.size(); }
+size_t http_dynamic_table::dynamic_map_size() { return _inserted - _dropped; }
 
 void http_dynamic_table::set_debug_hook(std::function<void(trace_category_t, uint32 event)> fn) { _hook = fn; }
 
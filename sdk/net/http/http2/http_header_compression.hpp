@@ -256,9 +256,34 @@ enum header_compression_cmd_t {
     qpack_cmd_postbase_index = 3,
 };
 
+/**
+ * @brief   static table entry
+ * @sa      hpack_static_entries, qpack_static_entries
+ */
+struct static_table_entry_t {
+    uint32 index;
+    const char* name;
+    const char* value;  // nullptr means empty
+};
+
+/**
+ * @brief   perfect hash
+ * @remarks
+ *          slot = fnv1a(key, seed) & mask, slots[slot] = position + 1 (0 empty)
+ *          the seed and the slots are generated once (the tables never change) and verified by static_assert
+ *              name        the first entry with the name (key_matched)
+ *              name/value  the entry (all_matched)
+ */
+struct static_table_hash_t {
+    uint32 seed;
+    uint32 mask;
+    const uint8* slots;
+};
+
 /**
  * @brief   static table
  * @remarks cannot access directly, use hpack_static_table or qpack_static_table instead
+ *          constexpr tables, no lock, no allocation
  */
 class http_static_table {
    public:
@@ -285,20 +310,49 @@ class http_static_table {
      * @return  size of static table
      */
     virtual size_t size();
+    /**
+     * @brief   for_each
+     */
+    void for_each(std::function<void(uint32 index, const char* name, const char* value)> func);
+
+    /**
+     * @brief   FNV-1a (constexpr, C++11)
+     */
+    static constexpr uint32 fnv1a(const char* s, uint32 h) { return (s && *s) ? fnv1a(s + 1, (h ^ (uint8)*s) * 16777619u) : h; }
+    static constexpr uint32 fnv1a_mix(uint32 h) { return h ^ (h >> 15); }
+    static constexpr uint32 hash_name(const char* name, uint32 seed) { return fnv1a_mix(fnv1a(name, 2166136261u ^ seed)); }
+    static constexpr uint32 hash_field(const char* name, const char* value, uint32 seed) {
+        return fnv1a_mix(fnv1a(value, fnv1a(name, 2166136261u ^ seed) * 16777619u));  // name 0x00 value
+    }
+    static constexpr bool streq(const char* lhs, const char* rhs) { return (*lhs == *rhs) && ((0 == *lhs) || streq(lhs + 1, rhs + 1)); }
+    /**
+     * @brief   verify slots (static_assert)
+     */
+    static constexpr bool verify(const static_table_entry_t* entries, size_t size, const static_table_hash_t& names, const static_table_hash_t& fields,
+                                 size_t pos = 0) {
+        return (pos >= size) || (verify_name(entries, pos, names.slots[hash_name(entries[pos].name, names.seed) & names.mask]) &&
+                                 ((pos + 1) == fields.slots[hash_field(entries[pos].name, entries[pos].value, fields.seed) & fields.mask]) &&
+                                 verify(entries, size, names, fields, pos + 1));
+    }
 
    protected:
-    http_static_table();
+    http_static_table(const static_table_entry_t* entries, size_t size, const static_table_hash_t* names, const static_table_hash_t* fields);
 
-    virtual void load();
+    static constexpr bool verify_name(const static_table_entry_t* entries, size_t pos, size_t slot) {
+        return (slot > 0) && (slot - 1 <= pos) && streq(entries[slot - 1].name, entries[pos].name) && first_name(entries, slot - 1);
+    }
+    static constexpr bool first_name(const static_table_entry_t* entries, size_t pos, size_t i = 0) {
+        return (i >= pos) || ((false == streq(entries[i].name, entries[pos].name)) && first_name(entries, pos, i + 1));
+    }
 
-   protected:
-    typedef std::pair<std::string, size_t> table_entry_t;
-    typedef std::multimap<std::string, table_entry_t> static_table_t;
-    typedef std::map<size_t, std::pair<std::string, std::string>> static_table_index_t;
+    static uint32 hash_name(const std::string& name, uint32 seed);
+    static uint32 hash_field(const std::string& name, const std::string& value, uint32 seed);
 
-    critical_section _lock;
-    static_table_t _static_table;
-    static_table_index_t _static_table_index;
+   private:
+    const static_table_entry_t* _entries;
+    size_t _size;
+    const static_table_hash_t* _names;
+    const static_table_hash_t* _fields;
 };
 
 /**
@@ -393,17 +447,52 @@ class http_dynamic_table {
     size_t _dropped;
 
    private:
-    typedef std::pair<std::string, size_t> table_entry_t;
-    typedef std::multimap<std::string, table_entry_t> dynamic_map_t;  // table_entry_t(value, entry)
-    typedef std::map<size_t, table_entry_t> dynamic_reversemap_t;     // table_entry_t(name, entry size)
+    /**
+     * @remarks
+     *          entry is an absolute number (0, 1, 2, ...), [_dropped, _inserted) are in the table
+     *          _ring[entry & _ring_mask], the oldest is evicted in O(1)
+     */
+    struct table_entry_t {
+        std::string name;
+        std::string value;
+        size_t entrysize;
+        size_t name_hash;
+        size_t field_hash;  // name and value
+    };
+    /**
+     * @remarks
+     *          open addressing (linear probing), entry hash
+     *          an evicted entry (< _dropped) is skipped, and removed when the index is rebuilt (see index_insert)
+     */
+    struct index_slot_t {
+        size_t hash;
+        size_t entry;  // (size_t)-1 empty
+    };
+    struct index_t {
+        std::vector<index_slot_t> slots;
+        size_t used;
+
+        index_t() : used(0) {}
+    };
     struct commit_pair {
         std::string name;
         std::string value;
     };
     typedef std::queue<commit_pair> commit_queue_t;
 
-    dynamic_map_t _dynamic_map;
-    dynamic_reversemap_t _dynamic_reversemap;
+    table_entry_t* get_entry(size_t entry);
+    void index_insert(index_t& index, size_t hash, size_t entry);
+    void index_rebuild(index_t& index, bool field);
+    /**
+     * @brief   the latest entry
+     * @return  (size_t)-1 if not found
+     */
+    size_t index_find(index_t& index, size_t hash, const std::string& name, const std::string* value);
+
+    std::vector<table_entry_t> _ring;
+    size_t _ring_mask;
+    index_t _name_index;
+    index_t _field_index;
     commit_queue_t _commit_queue;
 
     uint8 _type;  // see header_compression_type_t
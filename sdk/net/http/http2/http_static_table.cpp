@@ -14,25 +14,27 @@
 namespace hotplace {
 namespace net {
 
-http_static_table::http_static_table() {}
+http_static_table::http_static_table(const static_table_entry_t* entries, size_t size, const static_table_hash_t* names, const static_table_hash_t* fields)
+    : _entries(entries), _size(size), _names(names), _fields(fields) {}
 
 match_result_t http_static_table::match(uint32 flags, const std::string& name, const std::string& value, size_t& index) {
     match_result_t state = match_result_t::not_matched;
     index = 0;
 
     __try2 {
-        auto liter = _static_table.lower_bound(name);
-        auto uiter = _static_table.upper_bound(name);
+        uint8 slot = _names->slots[hash_name(name, _names->seed) & _names->mask];
+        if ((0 == slot) || (name != _entries[slot - 1].name)) {
+            __leave2;
+        }
+        index = _entries[slot - 1].index;  // :path: /sample/path
+        state = match_result_t::key_matched;
 
-        for (auto iter = liter; iter != uiter; iter++) {
-            if (iter == liter) {
-                index = iter->second.second;  // :path: /sample/path
-                state = match_result_t::key_matched;
-            }
-            if (value == iter->second.first) {
-                index = iter->second.second;
+        slot = _fields->slots[hash_field(name, value, _fields->seed) & _fields->mask];
+        if (slot) {
+            const auto& entry = _entries[slot - 1];
+            if ((name == entry.name) && (value == (entry.value ? entry.value : ""))) {
+                index = entry.index;
                 state = match_result_t::all_matched;
-                break;
             }
         }
     }
@@ -45,14 +47,16 @@ match_result_t http_static_table::match(uint32 flags, const std::string& name, c
 return_t http_static_table::select(uint32 flags, size_t index, std::string& name, std::string& value) {
     return_t ret = errorcode_t::not_found;
     __try2 {
-        static_table_index_t::iterator iter = _static_table_index.find(index);
-        if (_static_table_index.end() == iter) {
+        // index (HPACK 1.., QPACK 0..)
+        size_t pos = index - _entries[0].index;
+        if ((index < _entries[0].index) || (pos >= _size)) {
             ret = errorcode_t::not_found;
             __leave2;
         } else {
-            name = iter->second.first;
+            const auto& entry = _entries[pos];
+            name = entry.name;
             if ((hpack_layout_index | hpack_layout_name_value) & flags) {
-                value = iter->second.second;
+                value = entry.value ? entry.value : "";
                 ret = errorcode_t::success;
             }
         }
@@ -63,9 +67,36 @@ return_t http_static_table::select(uint32 flags, size_t index, std::string& name
     return ret;
 }
 
-size_t http_static_table::size() { return _static_table.size(); }
+size_t http_static_table::size() { return _size; }
+
+void http_static_table::for_each(std::function<void(uint32 index, const char* name, const char* value)> func) {
+    if (func) {
+        for (size_t i = 0; i < _size; i++) {
+            const auto& entry = _entries[i];
+            func(entry.index, entry.name, entry.value);
+        }
+    }
+}
 
-void http_static_table::load() {}
+uint32 http_static_table::hash_name(const std::string& name, uint32 seed) {
+    uint32 h = 2166136261u ^ seed;
+    for (auto c : name) {
+        h = (h ^ (uint8)c) * 16777619u;
+    }
+    return fnv1a_mix(h);
+}
+
+uint32 http_static_table::hash_field(const std::string& name, const std::string& value, uint32 seed) {
+    uint32 h = 2166136261u ^ seed;
+    for (auto c : name) {
+        h = (h ^ (uint8)c) * 16777619u;
+    }
+    h *= 16777619u;  // 0x00
+    for (auto c : value) {
+        h = (h ^ (uint8)c) * 16777619u;
+    }
+    return fnv1a_mix(h);
+}
 
 }  // namespace net
 }  // namespace hotplace
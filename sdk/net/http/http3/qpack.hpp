@@ -203,7 +203,6 @@ class qpack_static_table : public http_static_table {
 
    protected:
     qpack_static_table();
-    virtual void load();
 
    private:
     static qpack_static_table _instance;
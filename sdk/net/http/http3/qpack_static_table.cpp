@@ -9,33 +9,184 @@
  */
 
 #include <sdk/net/http/http3/qpack.hpp>
-#include <sdk/net/http/http_resource.hpp>
 
 namespace hotplace {
 namespace net {
 
+/**
+ * RFC 9204 QPACK: Field Compression for HTTP/3
+ * Appendix A.  Static Table
+ */
+constexpr static_table_entry_t qpack_static_entries[] = {
+    {0, ":authority", nullptr},
+    {1, ":path", "/"},
+    {2, "age", "0"},
+    {3, "content-disposition", nullptr},
+    {4, "content-length", "0"},
+    {5, "cookie", nullptr},
+    {6, "date", nullptr},
+    {7, "etag", nullptr},
+    {8, "if-modified-since", nullptr},
+    {9, "if-none-match", nullptr},
+    {10, "last-modified", nullptr},
+    {11, "link", nullptr},
+    {12, "location", nullptr},
+    {13, "referer", nullptr},
+    {14, "set-cookie", nullptr},
+    {15, ":method", "CONNECT"},
+    {16, ":method", "DELETE"},
+    {17, ":method", "GET"},
+    {18, ":method", "HEAD"},
+    {19, ":method", "OPTIONS"},
+    {20, ":method", "POST"},
+    {21, ":method", "PUT"},
+    {22, ":scheme", "http"},
+    {23, ":scheme", "https"},
+    {24, ":status", "103"},
+    {25, ":status", "200"},
+    {26, ":status", "304"},
+    {27, ":status", "404"},
+    {28, ":status", "503"},
+    {29, "accept", "*/*"},
+    {30, "accept", "application/dns-message"},
+    {31, "accept-encoding", "gzip, deflate, br"},
+    {32, "accept-ranges", "bytes"},
+    {33, "access-control-allow-headers", "cache-control"},
+    {34, "access-control-allow-headers", "content-type"},
+    {35, "access-control-allow-origin", "*"},
+    {36, "cache-control", "max-age=0"},
+    {37, "cache-control", "max-age=2592000"},
+    {38, "cache-control", "max-age=604800"},
+    {39, "cache-control", "no-cache"},
+    {40, "cache-control", "no-store"},
+    {41, "cache-control", "public, max-age=31536000"},
+    {42, "content-encoding", "br"},
+    {43, "content-encoding", "gzip"},
+    {44, "content-type", "application/dns-message"},
+    {45, "content-type", "application/javascript"},
+    {46, "content-type", "application/json"},
+    {47, "content-type", "application/x-www-form-urlencoded"},
+    {48, "content-type", "image/gif"},
+    {49, "content-type", "image/jpeg"},
+    {50, "content-type", "image/png"},
+    {51, "content-type", "text/css"},
+    {52, "content-type", "text/html;charset=utf-8"},
+    {53, "content-type", "text/plain"},
+    {54, "content-type", "text/plain;charset=utf-8"},
+    {55, "range", "bytes=0-"},
+    {56, "strict-transport-security", "max-age=31536000"},
+    {57, "strict-transport-security", "max-age=31536000;includesubdomains"},
+    {58, "strict-transport-security", "max-age=31536000;includesubdomains;preload"},
+    {59, "vary", "accept-encoding"},
+    {60, "vary", "origin"},
+    {61, "x-content-type-options", "nosniff"},
+    {62, "x-xss-protection", "1; mode=block"},
+    {63, ":status", "100"},
+    {64, ":status", "204"},
+    {65, ":status", "206"},
+    {66, ":status", "302"},
+    {67, ":status", "400"},
+    {68, ":status", "403"},
+    {69, ":status", "421"},
+    {70, ":status", "425"},
+    {71, ":status", "500"},
+    {72, "accept-language", nullptr},
+    {73, "access-control-allow-credentials", "FALSE"},
+    {74, "access-control-allow-credentials", "TRUE"},
+    {75, "access-control-allow-headers", "*"},
+    {76, "access-control-allow-methods", "get"},
+    {77, "access-control-allow-methods", "get, post, options"},
+    {78, "access-control-allow-methods", "options"},
+    {79, "access-control-expose-headers", "content-length"},
+    {80, "access-control-request-headers", "content-type"},
+    {81, "access-control-request-method", "get"},
+    {82, "access-control-request-method", "post"},
+    {83, "alt-svc", "clear"},
+    {84, "authorization", nullptr},
+    {85, "content-security-policy", "script-src 'none';object-src 'none';base-uri 'none'"},
+    {86, "early-data", "1"},
+    {87, "expect-ct", nullptr},
+    {88, "forwarded", nullptr},
+    {89, "if-range", nullptr},
+    {90, "origin", nullptr},
+    {91, "purpose", "prefetch"},
+    {92, "server", nullptr},
+    {93, "timing-allow-origin", "*"},
+    {94, "upgrade-insecure-requests", "1"},
+    {95, "user-agent", nullptr},
+    {96, "x-forwarded-for", nullptr},
+    {97, "x-frame-options", "deny"},
+    {98, "x-frame-options", "sameorigin"},
+};
+
+constexpr uint8 qpack_static_name_slots[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0,
+    73, 4, 1, 57, 15, 7, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 11, 0, 9, 0, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 33, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 88,
+    0, 0, 0, 0, 0, 94, 0, 12, 93, 0, 0, 5, 0, 0, 0, 0,
+    8, 6, 0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0,
+    13, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 23, 37, 0, 0, 81, 0,
+    30, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 97, 0, 0, 25,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 84, 96, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0, 0, 10, 95, 0, 0, 0, 0, 98,
+    0, 0, 0, 0, 0, 80, 87, 0, 0, 0, 92, 32, 0, 0, 0, 0,
+    0, 0, 0, 74, 0, 85, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 89, 0, 0, 0,
+    90, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr uint8 qpack_static_field_slots[] = {
+    0, 0, 0, 96, 57, 0, 76, 0, 0, 0, 0, 68, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0,
+    27, 80, 0, 0, 78, 23, 0, 15, 0, 43, 14, 0, 92, 0, 0, 0,
+    52, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 97, 0, 87, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0,
+    77, 0, 0, 0, 33, 0, 10, 0, 0, 0, 0, 29, 0, 0, 40, 0,
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 62, 0, 0,
+    8, 0, 58, 0, 0, 0, 0, 32, 30, 0, 0, 42, 0, 0, 75, 0,
+    0, 0, 0, 0, 74, 79, 0, 0, 0, 0, 0, 0, 0, 26, 24, 0,
+    3, 0, 72, 98, 0, 0, 0, 0, 0, 31, 0, 0, 54, 0, 0, 0,
+    0, 55, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 7, 69, 0,
+    0, 65, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    44, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88,
+    90, 0, 0, 0, 0, 0, 0, 83, 0, 82, 0, 47, 0, 0, 93, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 16, 0,
+    11, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0, 34, 0, 60, 36, 0, 0, 0, 0, 66, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 49, 0, 0,
+    61, 70, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 85, 0, 0, 0,
+    0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+    0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 67, 0, 48, 99, 0, 0,
+    0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 25, 46, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 20, 0, 84, 0, 0, 0, 1, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 95,
+    0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0,
+    0, 0, 0, 53, 0, 0, 0, 81, 0, 0, 94, 0, 0, 0, 0, 0,
+};
+
+constexpr static_table_hash_t qpack_static_names = {796, 255, qpack_static_name_slots};
+constexpr static_table_hash_t qpack_static_fields = {7912, 511, qpack_static_field_slots};
+
+static_assert(sizeof(qpack_static_name_slots) == qpack_static_names.mask + 1, "qpack static table");
+static_assert(sizeof(qpack_static_field_slots) == qpack_static_fields.mask + 1, "qpack static table");
+static_assert(http_static_table::verify(qpack_static_entries, RTL_NUMBER_OF(qpack_static_entries), qpack_static_names, qpack_static_fields),
+              "qpack static table");
+
 qpack_static_table qpack_static_table::_instance;
 
-qpack_static_table* qpack_static_table::get_instance() {
-    _instance.load();
-    return &_instance;
-}
-
-qpack_static_table::qpack_static_table() : http_static_table() {}
-
-void qpack_static_table::load() {
-    if (_static_table.empty()) {
-        critical_section_guard guard(_lock);
-        if (_static_table.empty()) {
-            // RFC 9204 Appendix A.  Static Table
-            auto lambda = [&](uint32 index, const char* name, const char* value) -> void {
-                _static_table.insert(std::make_pair(name, std::make_pair(value ? value : "", index)));
-                _static_table_index.insert(std::make_pair(index, std::make_pair(name, value ? value : "")));
-            };
-            http_resource::get_instance()->for_each_qpack_static_table(lambda);
-        }
-    }
-}
+qpack_static_table* qpack_static_table::get_instance() { return &_instance; }
+
+qpack_static_table::qpack_static_table()
+    : http_static_table(qpack_static_entries, RTL_NUMBER_OF(qpack_static_entries), &qpack_static_names, &qpack_static_fields) {}
 
 }  // namespace net
 }  // namespace hotplace
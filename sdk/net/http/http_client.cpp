@@ -8,54 +8,448 @@
  * Date         Name                Description
  */
 
+#include <algorithm>
+#include <sdk/base/system/datetime.hpp>
+#include <sdk/io/system/socket.hpp>
 #include <sdk/net/basic/socket/tcp_client_socket.hpp>
 #include <sdk/net/basic/socket/udp_client_socket.hpp>
 #include <sdk/net/basic/tls/dtls_client_socket.hpp>
 #include <sdk/net/basic/tls/tls_client_socket.hpp>
 #include <sdk/net/http/http_client.hpp>
-#include <sdk/net/http/http_protocol.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_request.hpp>
 #include <sdk/net/http/http_response.hpp>
-#include <sdk/net/server/network_protocol.hpp>
-#include <sdk/net/server/network_stream.hpp>
 
 namespace hotplace {
 namespace net {
 
-http_client::http_client() : _socket(0), _client_socket(nullptr), _tls_context(nullptr), _tlsctx(nullptr), _wto(1000) {
+/**
+ * @brief   status-line and the connection options of a response
+ */
+class http_client_parser : public http_parser {
+   public:
+    http_client_parser() : http_parser(), status(0), http10(false), close(false), keep_alive(false) {}
+
+    int status;
+    bool http10;      // HTTP/1.0
+    bool close;       // Connection: close
+    bool keep_alive;  // Connection: keep-alive
+
+    /**
+     * @brief   RFC 9112 9.3 Persistence
+     */
+    bool persist() { return http10 ? (keep_alive && (false == close)) : (false == close); }
+
+   protected:
+    virtual void on_start_line(const char* version, size_t version_size, const char* status_code, size_t status_size) {
+        constexpr char constexpr_http10[] = "HTTP/1.0";
+        http10 = (sizeof(constexpr_http10) - 1 == version_size) && (0 == strnicmp(version, constexpr_http10, version_size));
+        status = atoi(std::string(status_code, status_size).c_str());
+    }
+    virtual void on_header(const char* name, size_t name_size, const char* value, size_t value_size) {
+        constexpr char constexpr_connection[] = "Connection";
+        if ((sizeof(constexpr_connection) - 1 == name_size) && (0 == strnicmp(name, constexpr_connection, name_size))) {
+            std::string options(value, value_size);
+            std::transform(options.begin(), options.end(), options.begin(), tolower);
+            if (std::string::npos != options.find("close")) {
+                close = true;
+            }
+            if (std::string::npos != options.find("keep-alive")) {
+                keep_alive = true;
+            }
+        }
+    }
+};
+
+/**
+ * @brief   the size of the response at the front of the stream
+ * @param   const char* stream [in]
+ * @param   size_t size [in]
+ * @param   bool head [in] response to HEAD
+ * @param   bool eof [in] the connection is closed
+ * @param   size_t* message_size [out]
+ * @param   int* status [out]
+ * @param   bool* keepalive [out]
+ * @return  error code (see error.hpp)
+ *          more_data       receive and call again
+ *          bad_response    truncated or malformed
+ * @remarks
+ *          RFC 9112 6.3 Message Body Length
+ *              HEAD, 1xx, 204, 304     no content
+ *              chunked, Content-Length
+ *              otherwise               until the connection is closed
+ */
+static return_t frame_response(const char* stream, size_t size, bool head, bool eof, size_t* message_size, int* status, bool* keepalive) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        constexpr char constexpr_header_end[] = "\r\n\r\n";
+        const char* end = std::search(stream, stream + size, constexpr_header_end, constexpr_header_end + 4);
+        if (stream + size == end) {
+            ret = eof ? errorcode_t::bad_response : errorcode_t::more_data;
+            __leave2;
+        }
+        size_t header_size = (end - stream) + 4;
+
+        http_client_parser parser;
+        protocol_cursor_t cursor;
+        return_t test = parser.parse(&cursor, stream, header_size);
+        if ((errorcode_t::success != test) && (errorcode_t::more_data != test)) {
+            ret = errorcode_t::bad_response;
+            __leave2;
+        }
+
+        *status = parser.status;
+        *keepalive = parser.persist() && (101 != parser.status);
+
+        if (head || ((parser.status >= 100) && (parser.status < 200)) || (204 == parser.status) || (304 == parser.status)) {
+            *message_size = header_size;
+            __leave2;
+        }
+
+        if ((http_parser_flag_t::http_parser_chunked | http_parser_flag_t::http_parser_content_length) & cursor.flags) {
+            test = parser.parse(&cursor, stream, size);
+            if (errorcode_t::success == test) {
+                *message_size = cursor.pos;
+            } else if ((errorcode_t::more_data == test) && (false == eof)) {
+                ret = errorcode_t::more_data;
+            } else {
+                ret = errorcode_t::bad_response;
+            }
+        } else {
+            *keepalive = false;
+            if (eof) {
+                *message_size = size;
+            } else {
+                ret = errorcode_t::more_data;
+            }
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+/**
+ * @brief   RFC 6454 3.2 Origin (scheme, host, port)
+ */
+static std::string get_origin(const url_info_t& url_info) {
+    basic_stream bs;
+    bs.printf("%s://%s:%i", url_info.scheme.c_str(), url_info.host.c_str(), url_info.port);
+    return bs.c_str();
+}
+
+http_client::http_client()
+    : _client_socket(nullptr),
+      _tls_client_socket(nullptr),
+      _tls(nullptr),
+      _tlsctx(nullptr),
+      _wto(1000),
+      _keepalive(30 * 1000),
+      _max_connections(6),
+      _pipelining(1),
+      _stopping(false),
+      _outstanding(0)
+#if defined __linux__
+      ,
+      _mplexer_handle(nullptr),
+      _thread(nullptr)
+#endif
+{
     tlscert_open_simple(tlscert_flag_tls, &_tlsctx);
-    _tls_client_socket = new tls_client_socket(new transport_layer_security(_tlsctx));
+    _tls = new transport_layer_security(_tlsctx);
+    _tls_client_socket = new tls_client_socket(_tls);
     _client_socket = new tcp_client_socket;
 }
 
 http_client::~http_client() {
+#if defined __linux__
+    if (_thread) {
+        _mplexer.event_loop_break_concurrent(_mplexer_handle, 1);
+        _thread->join();
+        delete _thread;
+    }
+#endif
+
+    std::list<connection_t*> busy;
+    std::list<posted_t> posted;
+    {
+        critical_section_guard guard(_lock);
+        _stopping = true;
+        for (auto& item : _posted) {
+            busy.push_back(item.second);
+        }
+        for (auto& item : _origins) {
+            posted.splice(posted.end(), item.second.posted);
+        }
+    }
+    for (auto conn : busy) {
+        fail(conn, errorcode_t::canceled);
+    }
+    for (auto& item : posted) {
+        item.inflight.callback(errorcode_t::canceled, nullptr);
+    }
+    signal(posted.size());
+
+#if defined __linux__
+    if (_mplexer_handle) {
+        _mplexer.close(_mplexer_handle);
+    }
+#endif
+
     close();
 
+    for (auto& item : _origins) {
+        if (item.second.session) {
+            SSL_SESSION_free(item.second.session);
+        }
+    }
+
     if (_tls_client_socket) {
         _tls_client_socket->release();
     }
     if (_client_socket) {
         delete _client_socket;
     }
+    _tls->release();
     SSL_CTX_free(_tlsctx);
 }
 
-tcp_client_socket* http_client::try_connect() {
+return_t http_client::acquire(const url_info_t& url_info, connection_t** conn, bool* reused) {
     return_t ret = errorcode_t::success;
     tcp_client_socket* client = nullptr;
+    connection_t* item = nullptr;
+    SSL_SESSION* session = nullptr;
+    std::string origin;
+
     __try2 {
-        if ("https" == _url_info.scheme) {
+        if (nullptr == conn) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        *conn = nullptr;
+        if (reused) {
+            *reused = false;
+        }
+
+        if ("https" == url_info.scheme) {
             client = _tls_client_socket;
-        } else if ("http" == _url_info.scheme) {
+        } else if ("http" == url_info.scheme) {
             client = _client_socket;
         } else {
+            ret = errorcode_t::not_supported;
             __leave2;
         }
 
-        if (0 == _socket) {
-            ret = client->connect(&_socket, &_tls_context, _url_info.host.c_str(), _url_info.port, 5);
+        origin = get_origin(url_info);
+
+        std::list<connection_t*> expired;
+        {
+            critical_section_guard guard(_lock);
+
+            if (_stopping) {
+                ret = errorcode_t::canceled;
+                __leave2;
+            }
+
+            origin_t& o = _origins[origin];
+            o.url_info = url_info;
+
+            struct timespec now;
+            struct timespec diff;
+            time_monotonic(now);
+            while (o.idle.size() && (nullptr == item)) {
+                connection_t* candidate = o.idle.front();
+                o.idle.pop_front();
+
+                // closed by the server (readable, EOF) or timed out
+                time_diff(diff, candidate->idle, now);
+                uint64 idle = (diff.tv_sec * 1000) + (diff.tv_nsec / 1000000);
+                if ((idle >= _keepalive) || (errorcode_t::success == wait_socket(candidate->sock, 0, SOCK_WAIT_READABLE))) {
+                    o.count--;
+                    _stat.expire++;
+                    expired.push_back(candidate);
+                } else {
+                    item = candidate;
+                    _stat.reuse++;
+                }
+            }
+
+            if (nullptr == item) {
+                if (o.count >= _max_connections) {
+                    ret = errorcode_t::max_reached;
+                } else {
+                    o.count++;  // reserved
+                    if (o.session) {
+                        session = o.session;
+                        SSL_SESSION_up_ref(session);
+                    }
+                }
+            }
+        }
+
+        for (auto candidate : expired) {
+            close(candidate);
+        }
+
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        if (item) {
+            if (reused) {
+                *reused = true;
+            }
+        } else {
+            item = new connection_t;
+            item->origin = origin;
+            item->client = client;
+
+            if (_tls_client_socket == client) {
+                ret = _tls_client_socket->connect(&item->sock, &item->tls_handle, url_info.host.c_str(), url_info.port, 5, session);
+            } else {
+                ret = client->connect(&item->sock, &item->tls_handle, url_info.host.c_str(), url_info.port, 5);
+            }
+
+            critical_section_guard guard(_lock);
             if (errorcode_t::success == ret) {
-                client->set_wto(_wto);
+                _stat.connect++;
+                if (item->tls_handle && _tls->is_session_reused(item->tls_handle)) {
+                    _stat.resume++;
+                }
+            } else {
+                _origins[origin].count--;
+                delete item;
+                item = nullptr;
+                __leave2;
+            }
+        }
+
+        *conn = item;
+    }
+    __finally2 {
+        if (session) {
+            SSL_SESSION_free(session);
+        }
+    }
+
+    return ret;
+}
+
+void http_client::release(connection_t* conn, bool keepalive) {
+    if (conn) {
+        std::string origin = conn->origin;
+        bool reuse = keepalive && _keepalive && conn->buffer.empty() && conn->queue.empty();
+
+        {
+            critical_section_guard guard(_lock);
+            origin_t& o = _origins[origin];
+
+            // TLS 1.3 NewSessionTicket is received after the handshake
+            if (conn->tls_handle) {
+                SSL_SESSION* session = _tls->get_session(conn->tls_handle);
+                if (session) {
+                    if (o.session) {
+                        SSL_SESSION_free(o.session);
+                    }
+                    o.session = session;
+                }
+            }
+
+            if (reuse && (false == _stopping)) {
+                time_monotonic(conn->idle);
+                o.idle.push_front(conn);
+                conn = nullptr;
+            } else {
+                o.count--;
+            }
+        }
+
+        if (conn) {
+            close(conn);
+        }
+
+        drain(origin);
+    }
+}
+
+void http_client::close(connection_t* conn) {
+    if (conn) {
+        conn->client->close(conn->sock, conn->tls_handle);
+        delete conn;
+    }
+}
+
+return_t http_client::send(connection_t* conn, const char* data, size_t size) {
+    return_t ret = errorcode_t::success;
+    size_t pos = 0;
+
+    while (pos < size) {
+        size_t cbsent = 0;
+        ret = conn->client->send(conn->sock, conn->tls_handle, data + pos, size - pos, &cbsent);
+        if (errorcode_t::success != ret) {
+            break;
+        }
+        if (0 == cbsent) {
+            ret = errorcode_t::error_send;
+            break;
+        }
+        pos += cbsent;
+    }
+
+    return ret;
+}
+
+return_t http_client::receive(connection_t* conn, uint32 wto) {
+    return_t ret = errorcode_t::success;
+    char buf[1 << 14];
+
+    __try2 {
+        if (wto) {
+            ret = wait_socket(conn->sock, wto, SOCK_WAIT_READABLE);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+        }
+
+        if (conn->tls_handle) {
+            // ciphertext
+            size_t cbread = 0;
+            int mode = tls_io_flag_t::read_socket_recv | tls_io_flag_t::read_bio_write | tls_io_flag_t::dontwait_msg;
+            ret = _tls->read(conn->tls_handle, mode, buf, sizeof(buf), &cbread);
+            if (errorcode_t::eagain == ret) {
+                ret = errorcode_t::success;
+            }
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+
+            // plaintext, until SSL_ERROR_WANT_READ
+            while (true) {
+                return_t test = _tls->read(conn->tls_handle, tls_io_flag_t::read_ssl_read, buf, sizeof(buf), &cbread);
+                if ((errorcode_t::success != test) && (errorcode_t::more_data != test)) {
+                    break;
+                }
+                conn->buffer.append(buf, cbread);
+            }
+        } else {
+#if defined __linux__
+            int rc = ::recv(conn->sock, buf, sizeof(buf), MSG_DONTWAIT);
+#elif defined _WIN32 || defined _WIN64
+            int rc = ::recv(conn->sock, buf, (int)sizeof(buf), 0);
+#endif
+            if (0 == rc) {
+                ret = errorcode_t::disconnect;
+            } else if (-1 == rc) {
+                ret = get_lasterror(rc);
+                if (errorcode_t::eagain == ret) {
+                    ret = errorcode_t::success;
+                }
+            } else {
+                conn->buffer.append(buf, rc);
             }
         }
     }
@@ -63,7 +457,37 @@ tcp_client_socket* http_client::try_connect() {
         // do nothing
     }
 
-    return client;
+    return ret;
+}
+
+return_t http_client::read_response(connection_t* conn, bool head, bool eof, http_response** response, bool* keepalive) {
+    return_t ret = errorcode_t::success;
+
+    *response = nullptr;
+    *keepalive = false;
+
+    while (true) {
+        size_t message_size = 0;
+        int status = 0;
+        ret = frame_response(conn->buffer.c_str(), conn->buffer.size(), head, eof, &message_size, &status, keepalive);
+        if (errorcode_t::success != ret) {
+            break;
+        }
+
+        // RFC 9110 15.2 Informational 1xx, the final response follows
+        if ((status >= 100) && (status < 200) && (101 != status)) {
+            conn->buffer.erase(0, message_size);
+            continue;
+        }
+
+        http_response* resp = new http_response;
+        resp->open(conn->buffer.c_str(), message_size);
+        conn->buffer.erase(0, message_size);
+        *response = resp;
+        break;
+    }
+
+    return ret;
 }
 
 http_client& http_client::request(const std::string& url, http_response** response) {
@@ -81,8 +505,6 @@ http_client& http_client::request(http_request& request, http_response** respons
 
 http_client& http_client::do_request_and_response(const url_info_t& url_info, http_request& request, http_response** response) {
     return_t ret = errorcode_t::success;
-    tcp_client_socket* client = nullptr;
-    http_response* resp = nullptr;
 
     __try2 {
         if (nullptr == response) {
@@ -92,61 +514,445 @@ http_client& http_client::do_request_and_response(const url_info_t& url_info, ht
 
         *response = nullptr;
 
-        client = try_connect();
+        if (nullptr == request.get_http_header().find(http_field_host)) {
+            request.get_http_header().add("Host", basic_stream("%s:%i", url_info.host.c_str(), url_info.port).c_str());
+        }
 
-        // connected
-        if (_socket) {
-            basic_stream request_stream;
-            request.get_request(request_stream);
+        basic_stream request_stream;
+        request.get_request(request_stream);
+        bool head = ("HEAD" == request.get_method());
 
-            size_t cbsent = 0;
-            ret = client->send(_socket, _tls_context, request_stream.c_str(), request_stream.size(), &cbsent);
-            if (errorcode_t::success == ret) {
-                network_protocol_group group;
-                http_protocol http;
-                network_stream stream_read;
-                network_stream stream_interpreted;
-                group.add(&http);
+        // RFC 9112 9.3.1 a kept-alive connection closed by the server, retry once on a new connection
+        bool stale = false;
+        ret = do_request(url_info, request_stream, head, response, &stale);
+        if (stale) {
+            ret = do_request(url_info, request_stream, head, response, &stale);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return *this;
+}
+
+return_t http_client::do_request(const url_info_t& url_info, const basic_stream& stream, bool head, http_response** response, bool* stale) {
+    return_t ret = errorcode_t::success;
+    connection_t* conn = nullptr;
+    bool reused = false;
+    bool keepalive = false;
+    bool eof = false;
+
+    __try2 {
+        *stale = false;
 
-                std::vector<char> buf;
-                const size_t bufsize = 1 << 7;
-                size_t sizeread = 0;
-                buf.resize(bufsize);
+        ret = acquire(url_info, &conn, &reused);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        ret = send(conn, stream.c_str(), stream.size());
+        if (errorcode_t::success != ret) {
+            *stale = reused;
+            __leave2;
+        }
+
+        while (true) {
+            ret = read_response(conn, head, eof, response, &keepalive);
+            if ((errorcode_t::more_data != ret) || eof) {
+                break;
+            }
+            return_t test = receive(conn, _wto);
+            if (errorcode_t::disconnect == test) {
+                eof = true;
+            } else if (errorcode_t::success != test) {
+                ret = test;
+                break;
+            }
+        }
+
+        if (eof && reused && conn->buffer.empty() && (nullptr == *response)) {
+            *stale = true;
+        }
+    }
+    __finally2 {
+        if (conn) {
+            release(conn, (errorcode_t::success == ret) && keepalive && (false == eof));
+        }
+    }
+
+    return ret;
+}
+
+http_client& http_client::pipeline(std::vector<http_request*>& requests, std::vector<http_response*>& responses) {
+    return_t ret = errorcode_t::success;
+    connection_t* conn = nullptr;
+    bool keepalive = true;
+    bool eof = false;
+    std::vector<bool> heads;
 
-                ret = client->read(_socket, _tls_context, &buf[0], bufsize, &sizeread);
+    __try2 {
+        responses.clear();
+        responses.resize(requests.size(), nullptr);
+
+        std::string request_stream;
+        for (auto request : requests) {
+            if (nullptr == request->get_http_header().find(http_field_host)) {
+                request->get_http_header().add("Host", basic_stream("%s:%i", _url_info.host.c_str(), _url_info.port).c_str());
+            }
+            basic_stream bs;
+            request->get_request(bs);
+            request_stream.append(bs.c_str(), bs.size());
+            heads.push_back("HEAD" == request->get_method());
+        }
+
+        ret = acquire(_url_info, &conn);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
 
-                stream_read.produce((byte_t*)&buf[0], sizeread);
-                while (errorcode_t::more_data == ret) {
-                    ret = client->more(_socket, _tls_context, &buf[0], bufsize, &sizeread);
+        ret = send(conn, request_stream.c_str(), request_stream.size());
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
 
-                    stream_read.produce((byte_t*)&buf[0], sizeread);
+        // in order
+        size_t i = 0;
+        while ((i < requests.size()) && keepalive) {
+            bool persist = false;
+            ret = read_response(conn, heads[i], eof, &responses[i], &persist);
+            if (errorcode_t::success == ret) {
+                keepalive = persist;
+                i++;
+            } else if ((errorcode_t::more_data == ret) && (false == eof)) {
+                return_t test = receive(conn, _wto);
+                if (errorcode_t::disconnect == test) {
+                    eof = true;
+                } else if (errorcode_t::success != test) {
+                    ret = test;
+                    break;
                 }
+            } else {
+                break;
+            }
+        }
+    }
+    __finally2 {
+        if (conn) {
+            release(conn, (errorcode_t::success == ret) && keepalive && (false == eof));
+        }
+    }
 
-                stream_read.write(&group, &stream_interpreted);
-                network_stream_data* data = nullptr;
-                stream_interpreted.consume(&data);
-                if (data) {
-                    resp = new http_response;
-                    resp->open((char*)data->content(), data->size());
-                    *response = resp;
+    return *this;
+}
 
-                    data->release();
+return_t http_client::post(const std::string& url, http_response_callback_t callback) {
+    url_info_t url_info;
+    split_url(url.c_str(), &url_info);
+
+    http_request request;
+    request.compose(http_method_t::HTTP_GET, url_info.uri, "");
+
+    return do_post(url_info, request, callback);
+}
+
+return_t http_client::post(http_request& request, http_response_callback_t callback) { return do_post(_url_info, request, callback); }
+
+return_t http_client::do_post(const url_info_t& url_info, http_request& request, http_response_callback_t callback) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == callback) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+#if defined __linux__
+        {
+            critical_section_guard guard(_lock);
+            if (nullptr == _thread) {
+                ret = _mplexer.open(&_mplexer_handle, 32);
+                if (errorcode_t::success != ret) {
+                    __leave2;
                 }
+                _thread = new thread(event_loop_thread, this);
+                _thread->start();
             }
         }
+#else
+        ret = errorcode_t::not_supported;
+        __leave2;
+#endif
+
+        if (nullptr == request.get_http_header().find(http_field_host)) {
+            request.get_http_header().add("Host", basic_stream("%s:%i", url_info.host.c_str(), url_info.port).c_str());
+        }
+
+        std::list<posted_t> items;
+        items.resize(1);
+        posted_t& item = items.front();
+        basic_stream request_stream;
+        request.get_request(request_stream);
+        std::string method = request.get_method();
+        item.request.assign(request_stream.c_str(), request_stream.size());
+        item.inflight.head = ("HEAD" == method);
+        item.inflight.callback = callback;
+        item.idempotent = ("GET" == method) || ("HEAD" == method);
+
+        connection_t* conn = nullptr;
+        ret = acquire(url_info, &conn);
+        if (errorcode_t::max_reached == ret) {
+            std::string origin = get_origin(url_info);
+            {
+                critical_section_guard guard(_lock);
+                _outstanding++;
+                origin_t& o = _origins[origin];
+                o.posted.splice(o.posted.end(), items);
+            }
+            drain(origin);  // released in the meantime
+            ret = errorcode_t::success;
+            __leave2;
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        {
+            critical_section_guard guard(_lock);
+            _outstanding++;
+        }
+        dispatch(conn, items);
     }
     __finally2 {
         // do nothing
     }
 
-    return *this;
+    return ret;
+}
+
+void http_client::dispatch(connection_t* conn, std::list<posted_t>& items) {
+    return_t ret = errorcode_t::success;
+    std::string requests;
+
+    {
+        critical_section_guard guard(_lock);
+        for (auto& item : items) {
+            requests += item.request;
+            conn->queue.push_back(item.inflight);
+        }
+        _posted[conn->sock] = conn;
+    }
+
+    ret = send(conn, requests.c_str(), requests.size());
+#if defined __linux__
+    if (errorcode_t::success == ret) {
+        ret = _mplexer.bind_oneshot(_mplexer_handle, conn->sock, SOCK_WAIT_READABLE);
+    }
+#endif
+    if (errorcode_t::success != ret) {
+        fail(conn, ret);
+    }
+}
+
+void http_client::drain(const std::string& origin) {
+    while (true) {
+        std::list<posted_t> items;
+        url_info_t url_info;
+        {
+            critical_section_guard guard(_lock);
+            auto iter = _origins.find(origin);
+            if (_stopping || (_origins.end() == iter)) {
+                break;
+            }
+            origin_t& o = iter->second;
+            if (o.posted.empty() || (o.idle.empty() && (o.count >= _max_connections))) {
+                break;
+            }
+            url_info = o.url_info;
+
+            // RFC 9112 9.3.2 pipelining, idempotent methods
+            items.splice(items.end(), o.posted, o.posted.begin());
+            while (o.posted.size() && (items.size() < _pipelining) && items.back().idempotent && o.posted.front().idempotent) {
+                items.splice(items.end(), o.posted, o.posted.begin());
+            }
+        }
+
+        connection_t* conn = nullptr;
+        return_t ret = acquire(url_info, &conn);
+        if (errorcode_t::success == ret) {
+            dispatch(conn, items);
+        } else if (errorcode_t::max_reached == ret) {
+            critical_section_guard guard(_lock);
+            origin_t& o = _origins[origin];
+            o.posted.splice(o.posted.begin(), items);
+            break;
+        } else {
+            for (auto& item : items) {
+                item.inflight.callback(ret, nullptr);
+            }
+            signal(items.size());
+        }
+    }
+}
+
+void http_client::complete(connection_t* conn, bool eof) {
+    return_t ret = errorcode_t::success;
+    bool keepalive = true;
+
+    while (keepalive) {
+        inflight_t inflight;
+        {
+            critical_section_guard guard(_lock);
+            if (conn->queue.empty()) {
+                break;
+            }
+            inflight = conn->queue.front();
+        }
+
+        http_response* response = nullptr;
+        ret = read_response(conn, inflight.head, eof, &response, &keepalive);
+        if (errorcode_t::success != ret) {
+            break;
+        }
+
+        {
+            critical_section_guard guard(_lock);
+            conn->queue.pop_front();
+        }
+        inflight.callback(errorcode_t::success, response);
+        response->release();
+        signal(1);
+    }
+
+    bool done = false;
+    {
+        critical_section_guard guard(_lock);
+        done = conn->queue.empty();
+    }
+
+    if ((errorcode_t::success != ret) && (errorcode_t::more_data != ret)) {
+        fail(conn, ret);
+    } else if (eof || (false == keepalive)) {
+        fail(conn, errorcode_t::disconnect);  // the rest is not responded
+    } else if (done) {
+#if defined __linux__
+        _mplexer.unbind(_mplexer_handle, conn->sock, nullptr);
+#endif
+        {
+            critical_section_guard guard(_lock);
+            _posted.erase(conn->sock);
+        }
+        release(conn, true);
+    } else {
+#if defined __linux__
+        _mplexer.bind_oneshot(_mplexer_handle, conn->sock, SOCK_WAIT_READABLE);
+#endif
+    }
+}
+
+void http_client::fail(connection_t* conn, return_t result) {
+    std::list<inflight_t> queue;
+    {
+        critical_section_guard guard(_lock);
+        queue.swap(conn->queue);
+        _posted.erase(conn->sock);
+    }
+#if defined __linux__
+    _mplexer.unbind(_mplexer_handle, conn->sock, nullptr);
+#endif
+
+    release(conn, false);
+
+    for (auto& inflight : queue) {
+        inflight.callback(result, nullptr);
+    }
+    signal(queue.size());
+}
+
+void http_client::signal(size_t count) {
+    if (count) {
+        {
+            critical_section_guard guard(_lock);
+            _outstanding -= count;
+        }
+        _completed.signal();
+    }
+}
+
+return_t http_client::wait(uint32 milliseconds) {
+    return_t ret = errorcode_t::success;
+    struct timespec begin;
+    struct timespec now;
+    struct timespec diff;
+
+    time_monotonic(begin);
+    while (true) {
+        {
+            critical_section_guard guard(_lock);
+            if (0 == _outstanding) {
+                break;
+            }
+        }
+
+        time_monotonic(now);
+        time_diff(diff, begin, now);
+        uint64 elapsed = (diff.tv_sec * 1000) + (diff.tv_nsec / 1000000);
+        if (elapsed >= milliseconds) {
+            ret = errorcode_t::timeout;
+            break;
+        }
+        _completed.wait(100);
+    }
+
+    return ret;
+}
+
+return_t http_client::event_loop_thread(void* param) {
+    return_t ret = errorcode_t::success;
+#if defined __linux__
+    http_client* client = static_cast<http_client*>(param);
+    ret = client->_mplexer.event_loop_run(client->_mplexer_handle, (handle_t)INVALID_SOCKET, event_handler, client);
+#endif
+    return ret;
+}
+
+return_t http_client::event_handler(uint32 type, uint32 count, void* data[], CALLBACK_CONTROL* control, void* param) {
+    return_t ret = errorcode_t::success;
+    http_client* client = static_cast<http_client*>(param);
+    socket_t sock = (socket_t)(arch_t)data[1];
+    connection_t* conn = nullptr;
+
+    {
+        critical_section_guard guard(client->_lock);
+        auto iter = client->_posted.find(sock);
+        if (client->_posted.end() != iter) {
+            conn = iter->second;
+        }
+    }
+
+    if (conn) {
+        if (multiplexer_event_type_t::mux_read == type) {
+            return_t test = client->receive(conn, 0);
+            client->complete(conn, errorcode_t::success != test);
+        } else if (multiplexer_event_type_t::mux_disconnect == type) {
+            client->complete(conn, true);
+        }
+    }
+    return ret;
 }
 
 http_client& http_client::close() {
-    if (_socket) {
-        _tls_client_socket->close(_socket, _tls_context);
-        _socket = 0;
-        _tls_context = nullptr;
+    std::list<connection_t*> idle;
+    {
+        critical_section_guard guard(_lock);
+        for (auto& item : _origins) {
+            origin_t& o = item.second;
+            o.count -= o.idle.size();
+            idle.splice(idle.end(), o.idle);
+        }
+    }
+    for (auto conn : idle) {
+        close(conn);
     }
     return *this;
 }
@@ -159,11 +965,7 @@ http_client& http_client::set_url(const std::string& url) {
 }
 
 http_client& http_client::set_url(const url_info_t& url_info) {
-    if ((_url_info.scheme != url_info.scheme) || (_url_info.host != url_info.host) || (_url_info.port != url_info.port)) {
-        close();
-    }
     _url_info = url_info;
-
     return *this;
 }
 
@@ -174,5 +976,35 @@ http_client& http_client::set_wto(uint32 milliseconds) {
     return *this;
 }
 
+http_client& http_client::set_keepalive(uint32 milliseconds) {
+    _keepalive = milliseconds;
+    return *this;
+}
+
+http_client& http_client::set_max_connections(uint32 count) {
+    if (count) {
+        _max_connections = count;
+    }
+    return *this;
+}
+
+http_client& http_client::set_pipelining(uint32 depth) {
+    if (depth) {
+        _pipelining = depth;
+    }
+    return *this;
+}
+
+void http_client::get_stat(http_client_stat_t* stat) {
+    if (stat) {
+        critical_section_guard guard(_lock);
+        *stat = _stat;
+        stat->idle = 0;
+        for (auto& item : _origins) {
+            stat->idle += item.second.idle.size();
+        }
+    }
+}
+
 }  // namespace net
 }  // namespace hotplace
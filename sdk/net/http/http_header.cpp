@@ -10,19 +10,58 @@
  * Date         Name                Description
  */
 
+#include <algorithm>
 #include <sdk/io/string/string.hpp>
 #include <sdk/net/http/http_header.hpp>
 
 namespace hotplace {
 namespace net {
 
-http_header::http_header() : _version(1) {
-    // do nothing
+// lowercase, see http_field_t
+constexpr const char* http_field_names[] = {
+    "",
+    ":authority",
+    ":method",
+    ":path",
+    ":scheme",
+    ":status",
+    "accept",
+    "accept-encoding",
+    "accept-ranges",
+    "alt-svc",
+    "authorization",
+    "cache-control",
+    "connection",
+    "content-encoding",
+    "content-length",
+    "content-range",
+    "content-type",
+    "cookie",
+    "etag",
+    "host",
+    "if-none-match",
+    "keep-alive",
+    "location",
+    "range",
+    "te",
+    "transfer-encoding",
+    "upgrade",
+    "user-agent",
+    "www-authenticate",
+};
+static_assert(RTL_NUMBER_OF(http_field_names) == http_field_count, "http_field_t");
+
+// case-insensitive FNV-1a
+constexpr uint32 fnv1a_lower(const char* s, uint32 h) {
+    return *s ? fnv1a_lower(s + 1, (h ^ (uint8)(((*s >= 'A') && (*s <= 'Z')) ? (*s + 0x20) : *s)) * 16777619u) : h;
 }
+constexpr uint32 field_hash(http_field_t id) { return fnv1a_lower(http_field_names[id], 2166136261u); }
+
+http_header::http_header() : _version(1) { memset(_index, 0, sizeof(_index)); }
 
 http_header::http_header(const http_header& object) {
-    _names = object._names;
-    _headers = object._headers;
+    _fields = object._fields;
+    memcpy(_index, object._index, sizeof(_index));
     _version = object._version;
 }
 
@@ -30,17 +69,168 @@ http_header::~http_header() {
     // do nothing
 }
 
-http_header& http_header::add(const std::string& name, const std::string& value) {
+uint32 http_header::hash_name(const char* name, size_t size) {
+    uint32 h = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        char c = name[i];
+        h = (h ^ (uint8)(((c >= 'A') && (c <= 'Z')) ? (c + 0x20) : c)) * 16777619u;
+    }
+    return h;
+}
+
+http_field_t http_header::get_field(const char* name, size_t size) { return get_field(name, size, hash_name(name, size)); }
+
+http_field_t http_header::get_field(const char* name, size_t size, uint32 hash) {
+    http_field_t id = http_field_unknown;
+
+    // a duplicate hash does not compile
+    switch (hash) {
+        case field_hash(http_field_authority):
+            id = http_field_authority;
+            break;
+        case field_hash(http_field_method):
+            id = http_field_method;
+            break;
+        case field_hash(http_field_path):
+            id = http_field_path;
+            break;
+        case field_hash(http_field_scheme):
+            id = http_field_scheme;
+            break;
+        case field_hash(http_field_status):
+            id = http_field_status;
+            break;
+        case field_hash(http_field_accept):
+            id = http_field_accept;
+            break;
+        case field_hash(http_field_accept_encoding):
+            id = http_field_accept_encoding;
+            break;
+        case field_hash(http_field_accept_ranges):
+            id = http_field_accept_ranges;
+            break;
+        case field_hash(http_field_alt_svc):
+            id = http_field_alt_svc;
+            break;
+        case field_hash(http_field_authorization):
+            id = http_field_authorization;
+            break;
+        case field_hash(http_field_cache_control):
+            id = http_field_cache_control;
+            break;
+        case field_hash(http_field_connection):
+            id = http_field_connection;
+            break;
+        case field_hash(http_field_content_encoding):
+            id = http_field_content_encoding;
+            break;
+        case field_hash(http_field_content_length):
+            id = http_field_content_length;
+            break;
+        case field_hash(http_field_content_range):
+            id = http_field_content_range;
+            break;
+        case field_hash(http_field_content_type):
+            id = http_field_content_type;
+            break;
+        case field_hash(http_field_cookie):
+            id = http_field_cookie;
+            break;
+        case field_hash(http_field_etag):
+            id = http_field_etag;
+            break;
+        case field_hash(http_field_host):
+            id = http_field_host;
+            break;
+        case field_hash(http_field_if_none_match):
+            id = http_field_if_none_match;
+            break;
+        case field_hash(http_field_keep_alive):
+            id = http_field_keep_alive;
+            break;
+        case field_hash(http_field_location):
+            id = http_field_location;
+            break;
+        case field_hash(http_field_range):
+            id = http_field_range;
+            break;
+        case field_hash(http_field_te):
+            id = http_field_te;
+            break;
+        case field_hash(http_field_transfer_encoding):
+            id = http_field_transfer_encoding;
+            break;
+        case field_hash(http_field_upgrade):
+            id = http_field_upgrade;
+            break;
+        case field_hash(http_field_user_agent):
+            id = http_field_user_agent;
+            break;
+        case field_hash(http_field_www_authenticate):
+            id = http_field_www_authenticate;
+            break;
+        default:
+            break;
+    }
+
+    if (http_field_unknown != id) {
+        const char* known = http_field_names[id];
+        if ((size != strlen(known)) || strnicmp(name, known, size)) {
+            id = http_field_unknown;  // collision
+        }
+    }
+    return id;
+}
+
+size_t http_header::lookup(const char* name, size_t size, uint32 hash, http_field_t id) {
+    size_t pos = (size_t)-1;
+
+    if (http_field_unknown != id) {
+        if (_index[id]) {
+            pos = _index[id] - 1;
+        }
+    } else {
+        for (size_t i = 0; i < _fields.size(); i++) {
+            const field_t& item = _fields[i];
+            if ((hash == item.hash) && (size == item.name.size()) && (0 == strnicmp(name, item.name.c_str(), size))) {
+                pos = i;
+                break;
+            }
+        }
+    }
+    return pos;
+}
+
+http_header& http_header::add(const std::string& name, const std::string& value) { return add(name.c_str(), name.size(), value.c_str(), value.size()); }
+
+http_header& http_header::add(const char* name, size_t name_size, const char* value, size_t value_size) {
     __try2 {
+        if ((nullptr == name) || (nullptr == value)) {
+            __leave2;
+        }
+
+        uint32 hash = hash_name(name, name_size);
+        http_field_t id = get_field(name, name_size, hash);
+
         critical_section_guard guard(_lock);
 
-        std::string key = (1 == get_version()) ? name : lowername(name);
+        // the first one is kept
+        if ((size_t)-1 != lookup(name, name_size, hash, id)) {
+            __leave2;
+        }
+
+        if (_fields.empty()) {
+            _fields.reserve(16);
+        }
+        _fields.emplace_back(hash, id, name, name_size, value, value_size);
+        if (http_field_unknown != id) {
+            _index[id] = _fields.size();
+        }
 
-        http_header_map_pib_t pib = _headers.insert(std::make_pair(key, value));
-        if (true == pib.second) {
-            _names.push_back(key);
-        } else {
-            // pib.first->second = value;
+        if (2 == get_version()) {
+            // RFC 9113 8.2.  HTTP Fields - field names MUST be converted to lowercase
+            std::string& key = _fields.back().name;
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
         }
     }
     __finally2 {
@@ -51,35 +241,49 @@ http_header& http_header::add(const std::string& name, const std::string& value)
 
 http_header& http_header::clear() {
     critical_section_guard guard(_lock);
-    _names.clear();
-    _headers.clear();
+    _fields.clear();
+    memset(_index, 0, sizeof(_index));
     return *this;
 }
 
-std::string http_header::get(const std::string& name, std::string& value) {
-    std::string ret_value;
-
-    value.clear();
+const std::string* http_header::find(const std::string& name) { return find(name.c_str(), name.size()); }
 
-    std::string key = (1 == get_version()) ? name : lowername(name);
-
-    http_header_map_t::iterator iter = _headers.find(key);
-    if (_headers.end() != iter) {
-        value = iter->second;
-        ret_value = value.c_str();
+const std::string* http_header::find(const char* name, size_t size) {
+    const std::string* ret_value = nullptr;
+    if (name) {
+        uint32 hash = hash_name(name, size);
+        size_t pos = lookup(name, size, hash, get_field(name, size, hash));
+        if ((size_t)-1 != pos) {
+            ret_value = &_fields[pos].value;
+        }
     }
+    return ret_value;
+}
 
+const std::string* http_header::find(http_field_t id) {
+    const std::string* ret_value = nullptr;
+    if ((id < http_field_count) && _index[id]) {
+        ret_value = &_fields[_index[id] - 1].value;
+    }
     return ret_value;
 }
 
+std::string http_header::get(const std::string& name, std::string& value) {
+    value.clear();
+
+    const std::string* item = find(name);
+    if (item) {
+        value = *item;
+    }
+    return value;
+}
+
 std::string http_header::get(const std::string& name) {
     std::string ret_value;
 
-    std::string key = (1 == get_version()) ? name : lowername(name);
-
-    http_header_map_t::iterator iter = _headers.find(key);
-    if (_headers.end() != iter) {
-        ret_value = iter->second;
+    const std::string* item = find(name);
+    if (item) {
+        ret_value = *item;
     }
     return ret_value;
 }
@@ -87,15 +291,9 @@ std::string http_header::get(const std::string& name) {
 bool http_header::contains(const std::string& name, const std::string& value) {
     bool ret_value = false;
 
-    std::string key = (1 == get_version()) ? name : lowername(name);
-
-    http_header_map_t::iterator iter = _headers.find(key);
-    if (_headers.end() != iter) {
-        std::string body = iter->second;
-        size_t pos = body.find(value);
-        if (std::string::npos != pos) {
-            ret_value = true;
-        }
+    const std::string* item = find(name);
+    if (item && (std::string::npos != item->find(value))) {
+        ret_value = true;
     }
     return ret_value;
 }
@@ -105,24 +303,17 @@ const char* http_header::get_token(const std::string& name, unsigned index, std:
 
     token.clear();
 
-    std::string content;
-    std::string temp;
-
-    std::string key = (1 == get_version()) ? name : lowername(name);
-
-    http_header_map_t::iterator iter = _headers.find(key);
-    if (_headers.end() != iter) {
-        content = iter->second;
-
+    const std::string* item = find(name);
+    if (item) {
         size_t pos = 0;
         size_t current = 0;
         while (current <= index) {
-            temp = tokenize(content, _T (" "), pos);
+            std::string temp = tokenize(*item, _T (" "), pos);
             if (true == temp.empty()) {
                 break;
             }
             if (current == index) {
-                token = temp;
+                token = std::move(temp);
                 ret_value = token.c_str();
             }
             current++;
@@ -135,8 +326,13 @@ const char* http_header::get_token(const std::string& name, unsigned index, std:
 return_t http_header::get_headers(std::string& contents) {
     return_t ret = errorcode_t::success;
 
-    auto lambda = [&](const std::string& name, const std::string& value) -> void { contents += format("%s: %s\r\n", name.c_str(), value.c_str()); };
-    get_headers(lambda);
+    critical_section_guard guard(_lock);
+    for (const auto& item : _fields) {
+        contents += item.name;
+        contents += ": ";
+        contents += item.value;
+        contents += "\r\n";
+    }
 
     return ret;
 }
@@ -151,11 +347,8 @@ return_t http_header::get_headers(std::function<void(const std::string&, const s
         }
 
         critical_section_guard guard(_lock);
-        t_maphint<std::string, std::string> hint(_headers);
-        for (const auto& key : _names) {
-            std::string value;
-            hint.find(key, &value);
-            f(key, value);
+        for (const auto& item : _fields) {
+            f(item.name, item.value);
         }
     }
     __finally2 {
@@ -194,10 +387,83 @@ return_t http_header::to_keyvalue(const std::string& value, skey_value& kv) {
     return ret;
 }
 
+uint16 http_header::get_qvalue(const std::string& value, const char* coding) {
+    uint16 ret_value = 0;
+    uint16 wildcard = 0;
+    bool found = false;
+
+    auto lambda_trim = [](const std::string& str, size_t begin, size_t end) -> std::string {
+        while ((begin < end) && ((' ' == str[begin]) || ('\t' == str[begin]))) {
+            begin++;
+        }
+        while ((begin < end) && ((' ' == str[end - 1]) || ('\t' == str[end - 1]))) {
+            end--;
+        }
+        return str.substr(begin, end - begin);
+    };
+    // qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+    auto lambda_qvalue = [](const std::string& param) -> uint16 {
+        uint16 q = 0;
+        if (param.size() && isdigit(param[0])) {
+            q = (param[0] - '0') * 1000;
+            if ((param.size() > 1) && ('.' == param[1])) {
+                uint16 weight = 100;
+                for (size_t i = 2; (i < param.size()) && (i < 5) && isdigit(param[i]); i++) {
+                    q += (param[i] - '0') * weight;
+                    weight /= 10;
+                }
+            }
+        }
+        return (q > 1000) ? 1000 : q;
+    };
+
+    // coding *( OWS ";" OWS "q=" qvalue ), ...
+    size_t pos = 0;
+    while (coding && (pos < value.size())) {
+        size_t end = value.find(',', pos);
+        if (std::string::npos == end) {
+            end = value.size();
+        }
+        size_t semicolon = value.find(';', pos);
+        if (semicolon > end) {
+            semicolon = end;
+        }
+
+        std::string name = lambda_trim(value, pos, semicolon);
+        uint16 q = 1000;
+        if (semicolon < end) {
+            std::string param = lambda_trim(value, semicolon + 1, end);
+            if ((param.size() > 2) && ('q' == tolower(param[0])) && ('=' == param[1])) {
+                q = lambda_qvalue(param.substr(2));
+            }
+        }
+        if (0 == stricmp(name.c_str(), coding)) {
+            ret_value = q;
+            found = true;
+        } else if ("*" == name) {
+            wildcard = q;
+        }
+        pos = end + 1;
+    }
+    if (false == found) {
+        ret_value = wildcard;
+    }
+
+    return ret_value;
+}
+
 http_header& http_header::operator=(const http_header& object) {
     critical_section_guard guard(_lock);
-    _names = object._names;
-    _headers = object._headers;
+    _fields = object._fields;
+    memcpy(_index, object._index, sizeof(_index));
+    return *this;
+}
+
+http_header& http_header::operator=(http_header&& object) {
+    critical_section_guard guard(_lock);
+    _fields = std::move(object._fields);
+    memcpy(_index, object._index, sizeof(_index));
+    memset(object._index, 0, sizeof(object._index));
     return *this;
 }
 
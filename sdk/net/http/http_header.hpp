@@ -12,14 +12,57 @@
 #ifndef __HOTPLACE_SDK_NET_HTTP_HEADER__
 #define __HOTPLACE_SDK_NET_HTTP_HEADER__
 
-#include <list>
-#include <map>
 #include <sdk/base/basic/keyvalue.hpp>
 #include <sdk/net/http/types.hpp>
+#include <vector>
 
 namespace hotplace {
 namespace net {
 
+/**
+ * @brief   well-known header fields (interned)
+ * @sa      http_header::find, http_header::get_field
+ */
+enum http_field_t : uint8 {
+    http_field_unknown = 0,
+    http_field_authority,          // :authority
+    http_field_method,             // :method
+    http_field_path,               // :path
+    http_field_scheme,             // :scheme
+    http_field_status,             // :status
+    http_field_accept,             // Accept
+    http_field_accept_encoding,    // Accept-Encoding
+    http_field_accept_ranges,      // Accept-Ranges
+    http_field_alt_svc,            // Alt-Svc
+    http_field_authorization,      // Authorization
+    http_field_cache_control,      // Cache-Control
+    http_field_connection,         // Connection
+    http_field_content_encoding,   // Content-Encoding
+    http_field_content_length,     // Content-Length
+    http_field_content_range,      // Content-Range
+    http_field_content_type,       // Content-Type
+    http_field_cookie,             // Cookie
+    http_field_etag,               // ETag
+    http_field_host,               // Host
+    http_field_if_none_match,      // If-None-Match
+    http_field_keep_alive,         // Keep-Alive
+    http_field_location,           // Location
+    http_field_range,              // Range
+    http_field_te,                 // TE
+    http_field_transfer_encoding,  // Transfer-Encoding
+    http_field_upgrade,            // Upgrade
+    http_field_user_agent,         // User-Agent
+    http_field_www_authenticate,   // WWW-Authenticate
+    http_field_count,
+};
+
+/**
+ * @brief   header fields
+ * @remarks
+ *          a flat vector in the order added, a name is hashed once (case-insensitive FNV-1a)
+ *          a well-known field is found by its index (see http_field_t), others by the hash
+ *          RFC 9110 5.1.  Field Names - field names are case-insensitive
+ */
 class http_header {
    public:
     http_header();
@@ -35,6 +78,7 @@ class http_header {
      *          header.add ("WWW-Authenticate", "Basic realm=\"protected\"");
      */
     http_header& add(const std::string& name, const std::string& value);
+    http_header& add(const char* name, size_t name_size, const char* value, size_t value_size);
 
     /**
      * @brief   clear
@@ -63,6 +107,17 @@ class http_header {
      *          std::string cnonce = kv.get("cnonce");
      */
     static return_t to_keyvalue(const std::string& value, skey_value& kv);
+    /**
+     * @brief   RFC 9110 12.4.2.  Quality Values
+     * @param   const std::string& value [in] Accept-Encoding (RFC 9110 12.5.3)
+     * @param   const char* coding [in] case-insensitive
+     * @return  weight in thousandths (0..1000), 0 if not acceptable
+     * @sample
+     *          http_header::get_qvalue("gzip;q=0, deflate", "gzip");       // 0, refused
+     *          http_header::get_qvalue("gzip;q=0.5, deflate", "gzip");     // 500
+     *          http_header::get_qvalue("deflate, *;q=0.1", "gzip");        // 100, "*" matches a coding not listed
+     */
+    static uint16 get_qvalue(const std::string& value, const char* coding);
 
     /**
      * @brief   read a header
@@ -74,6 +129,20 @@ class http_header {
      */
     std::string get(const std::string& name, std::string& value);
     std::string get(const std::string& name);
+    /**
+     * @brief   find a header, the value is not copied
+     * @param   const std::string& name [in] case-insensitive
+     * @param   http_field_t id [in]
+     * @return  value, nullptr if not found
+     * @sample
+     *          const std::string* value = header.find(http_field_content_length);
+     *          if (value) {
+     *              size = atoi(value->c_str());
+     *          }
+     */
+    const std::string* find(const std::string& name);
+    const std::string* find(const char* name, size_t size);
+    const std::string* find(http_field_t id);
     /**
      * @brief   contains
      * @param   const std::string& name [in]
@@ -107,17 +176,36 @@ class http_header {
     return_t get_headers(std::function<void(const std::string&, const std::string&)> f);
 
     http_header& operator=(const http_header& object);
+    http_header& operator=(http_header&& object);
 
     http_header& set_version(uint8 version);
     uint8 get_version();
 
+    /**
+     * @brief   well-known field
+     * @param   const char* name [in] case-insensitive
+     * @param   size_t size [in]
+     * @return  http_field_unknown if not well-known
+     */
+    static http_field_t get_field(const char* name, size_t size);
+
    protected:
+    static uint32 hash_name(const char* name, size_t size);
+    static http_field_t get_field(const char* name, size_t size, uint32 hash);
+    size_t lookup(const char* name, size_t size, uint32 hash, http_field_t id);
+
    private:
-    typedef std::list<std::string> http_header_list_t;
-    typedef std::map<std::string, std::string> http_header_map_t;
-    typedef std::pair<http_header_map_t::iterator, bool> http_header_map_pib_t;
-    http_header_list_t _names;
-    http_header_map_t _headers;
+    struct field_t {
+        uint32 hash;  // case-insensitive
+        uint8 id;     // http_field_t
+        std::string name;
+        std::string value;
+
+        field_t(uint32 h, uint8 i, const char* n, size_t nsize, const char* v, size_t vsize) : hash(h), id(i), name(n, nsize), value(v, vsize) {}
+    };
+    typedef std::vector<field_t> fields_t;
+    fields_t _fields;
+    uint32 _index[http_field_count];  // position + 1, 0 if not present
     uint8 _version;
     critical_section _lock;
 };
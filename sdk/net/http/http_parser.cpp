@@ -0,0 +1,391 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *  RFC 9112 HTTP/1.1
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include <string.h>
+
+#include <sdk/net/http/http_parser.hpp>
+
+namespace hotplace {
+namespace net {
+
+http_parser::http_parser() {
+    // do nothing
+}
+
+http_parser::~http_parser() {
+    // do nothing
+}
+
+return_t http_parser::parse(protocol_cursor_t* cursor, const char* stream, size_t size, size_t* need) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (need) {
+            *need = 0;
+        }
+
+        if (nullptr == cursor || nullptr == stream) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        bool eof = (http_parser_flag_t::http_parser_eof & cursor->flags) ? true : false;
+
+        while ((errorcode_t::success == ret) && (http_parser_phase_t::http_parser_complete != cursor->phase)) {
+            switch (cursor->phase) {
+                case http_parser_phase_t::http_parser_start_line:
+                case http_parser_phase_t::http_parser_header:
+                case http_parser_phase_t::http_parser_chunk_size:
+                case http_parser_phase_t::http_parser_trailer: {
+                    size_t line_end = 0;
+                    size_t next = 0;
+                    ret = getline(cursor, stream, size, &line_end, &next);
+                    if (errorcode_t::success != ret) {
+                        break;
+                    }
+
+                    const char* line = stream + cursor->pos;
+                    size_t line_size = line_end - cursor->pos;
+
+                    if (http_parser_phase_t::http_parser_start_line == cursor->phase) {
+                        if (0 == line_size) {
+                            // RFC 9112 2.2 SHOULD ignore at least one empty line (CRLF) received prior to the request-line
+                        } else {
+                            ret = parse_start_line(cursor, line, line_size);
+                            cursor->phase = http_parser_phase_t::http_parser_header;
+                        }
+                    } else if (http_parser_phase_t::http_parser_chunk_size == cursor->phase) {
+                        size_t chunk_size = 0;
+                        ret = parse_chunk_size(line, line_size, &chunk_size);
+                        if (0 == chunk_size) {
+                            cursor->phase = http_parser_phase_t::http_parser_trailer;  // last-chunk
+                        } else {
+                            cursor->value = chunk_size;
+                            cursor->phase = http_parser_phase_t::http_parser_chunk_data;
+                        }
+                    } else if (line_size) {
+                        ret = parse_header(cursor, line, line_size);  // field line or trailer
+                    } else if (http_parser_phase_t::http_parser_trailer == cursor->phase) {
+                        cursor->phase = http_parser_phase_t::http_parser_complete;
+                    } else if (http_parser_flag_t::http_parser_chunked & cursor->flags) {
+                        cursor->phase = http_parser_phase_t::http_parser_chunk_size;
+                    } else if (http_parser_flag_t::http_parser_transfer_encoding & cursor->flags) {
+                        // RFC 9112 6.3 the final coding is not chunked
+                        if (http_parser_flag_t::http_parser_response & cursor->flags) {
+                            cursor->value = (size_t)-1;  // until the connection is closed
+                            cursor->phase = http_parser_phase_t::http_parser_content;
+                        } else {
+                            ret = errorcode_t::bad_data;  // 400 and close
+                        }
+                    } else if (http_parser_flag_t::http_parser_content_length & cursor->flags) {
+                        if (0 == (http_parser_flag_t::http_parser_framed & cursor->flags)) {
+                            cursor->value += next;  // end of content
+                        }
+                        cursor->phase = http_parser_phase_t::http_parser_content;
+                    } else {
+                        cursor->phase = http_parser_phase_t::http_parser_complete;
+                    }
+                    cursor->pos = next;
+                } break;
+                case http_parser_phase_t::http_parser_content:
+                    if (size < cursor->value) {
+                        if (eof) {
+                            on_content(stream + cursor->pos, size - cursor->pos);
+                            cursor->pos = size;
+                            cursor->phase = http_parser_phase_t::http_parser_complete;
+                        } else {
+                            if (need) {
+                                *need = ((size_t)-1 == cursor->value) ? 0 : cursor->value;
+                            }
+                            ret = errorcode_t::more_data;
+                        }
+                    } else {
+                        on_content(stream + cursor->pos, cursor->value - cursor->pos);
+                        cursor->pos = cursor->value;
+                        cursor->phase = http_parser_phase_t::http_parser_complete;
+                    }
+                    break;
+                case http_parser_phase_t::http_parser_chunk_data: {
+                    size_t chunk_end = cursor->pos + cursor->value;
+                    if (size < chunk_end + 2) {
+                        if (eof) {
+                            on_content(stream + cursor->pos, ((size < chunk_end) ? size : chunk_end) - cursor->pos);
+                            cursor->pos = size;
+                            cursor->phase = http_parser_phase_t::http_parser_complete;
+                        } else {
+                            if (need) {
+                                *need = chunk_end + 2;
+                            }
+                            ret = errorcode_t::more_data;
+                        }
+                    } else if (('\r' != stream[chunk_end]) || ('\n' != stream[chunk_end + 1])) {
+                        ret = errorcode_t::bad_data;
+                    } else {
+                        on_content(stream + cursor->pos, cursor->value);
+                        cursor->pos = chunk_end + 2;
+                        cursor->value = 0;
+                        cursor->phase = http_parser_phase_t::http_parser_chunk_size;
+                    }
+                } break;
+                default:
+                    ret = errorcode_t::bad_data;
+                    break;
+            }
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+void http_parser::on_start_line(const char* method, size_t method_size, const char* target, size_t target_size) {
+    // do nothing
+}
+
+void http_parser::on_header(const char* name, size_t name_size, const char* value, size_t value_size) {
+    // do nothing
+}
+
+void http_parser::on_content(const char* data, size_t size) {
+    // do nothing
+}
+
+return_t http_parser::getline(protocol_cursor_t* cursor, const char* stream, size_t size, size_t* line_end, size_t* next) {
+    return_t ret = errorcode_t::success;
+
+    // memchr is vectorized (SSE2/AVX2) in glibc
+    const char* lf = nullptr;
+    if (cursor->pos < size) {
+        lf = (const char*)memchr(stream + cursor->pos, '\n', size - cursor->pos);
+    }
+
+    if (lf) {
+        size_t eol = lf - stream;
+        *next = eol + 1;
+        if ((eol > cursor->pos) && ('\r' == stream[eol - 1])) {
+            eol--;
+        }
+        *line_end = eol;
+    } else if ((http_parser_flag_t::http_parser_eof & cursor->flags) && (cursor->pos <= size)) {
+        // the last line without CRLF
+        *line_end = size;
+        *next = size;
+        if (cursor->pos == size) {
+            // no more lines
+            cursor->phase = http_parser_phase_t::http_parser_trailer;
+        }
+    } else {
+        ret = errorcode_t::more_data;
+    }
+
+    return ret;
+}
+
+return_t http_parser::parse_start_line(protocol_cursor_t* cursor, const char* line, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    const char* method = line;
+    const char* sp = (const char*)memchr(line, ' ', size);
+    size_t method_size = sp ? (sp - line) : size;
+    const char* target = sp ? (sp + 1) : line + size;
+    size_t remain = size - (target - line);
+    while (remain && (' ' == *target)) {
+        target++;
+        remain--;
+    }
+    sp = (const char*)memchr(target, ' ', remain);
+    size_t target_size = sp ? (sp - target) : remain;
+
+    if (0 == method_size) {
+        ret = errorcode_t::bad_data;
+    } else {
+        // status-line = HTTP-version SP status-code SP [ reason-phrase ]
+        if ((method_size > 5) && (0 == strncmp(method, "HTTP/", 5))) {
+            cursor->flags |= http_parser_flag_t::http_parser_response;
+        }
+        on_start_line(method, method_size, target, target_size);
+    }
+
+    return ret;
+}
+
+return_t http_parser::parse_header(protocol_cursor_t* cursor, const char* line, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        const char* colon = (const char*)memchr(line, ':', size);
+        if (nullptr == colon) {
+            __leave2;  // ignore
+        }
+
+        size_t name_size = colon - line;
+        if ((0 == name_size) || (' ' == line[name_size - 1]) || ('\t' == line[name_size - 1]) || (' ' == line[0]) || ('\t' == line[0])) {
+            // RFC 9112 5.1 No whitespace is allowed between the field name and colon
+            // RFC 9112 5.2 obs-fold
+            ret = errorcode_t::bad_data;
+            __leave2;
+        }
+
+        const char* value = colon + 1;
+        size_t value_size = size - name_size - 1;
+        while (value_size && ((' ' == *value) || ('\t' == *value))) {
+            value++;
+            value_size--;
+        }
+        while (value_size && ((' ' == value[value_size - 1]) || ('\t' == value[value_size - 1]))) {
+            value_size--;
+        }
+
+        if ((http_parser_phase_t::http_parser_header == cursor->phase) && (0 == (http_parser_flag_t::http_parser_framed & cursor->flags))) {
+            constexpr char constexpr_content_length[] = "Content-Length";
+            constexpr char constexpr_transfer_encoding[] = "Transfer-Encoding";
+
+            if ((sizeof(constexpr_content_length) - 1 == name_size) && (0 == strnicmp(line, constexpr_content_length, name_size))) {
+                size_t length = 0;
+                if (0 == value_size) {
+                    ret = errorcode_t::bad_data;
+                    __leave2;
+                }
+                for (size_t i = 0; i < value_size; i++) {
+                    char c = value[i];
+                    if ((c < '0') || (c > '9') || (length > ((size_t)-1 - 9) / 10)) {
+                        ret = errorcode_t::bad_data;
+                        break;
+                    }
+                    length = (length * 10) + (c - '0');
+                }
+                if (errorcode_t::success != ret) {
+                    __leave2;
+                }
+                if ((http_parser_flag_t::http_parser_content_length & cursor->flags) && (length != cursor->value)) {
+                    ret = errorcode_t::bad_data;  // RFC 9112 6.3 differing field values
+                    __leave2;
+                }
+                if (http_parser_flag_t::http_parser_transfer_encoding & cursor->flags) {
+                    ret = errorcode_t::bad_data;  // RFC 9112 6.3 both Transfer-Encoding and Content-Length, request smuggling
+                    __leave2;
+                }
+                cursor->value = length;
+                cursor->flags |= http_parser_flag_t::http_parser_content_length;
+            } else if ((sizeof(constexpr_transfer_encoding) - 1 == name_size) && (0 == strnicmp(line, constexpr_transfer_encoding, name_size))) {
+                ret = parse_transfer_encoding(cursor, value, value_size);
+                if (errorcode_t::success != ret) {
+                    __leave2;
+                }
+            }
+        }
+
+        on_header(line, name_size, value, value_size);
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t http_parser::parse_transfer_encoding(protocol_cursor_t* cursor, const char* value, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        constexpr char constexpr_chunked[] = "chunked";
+
+        if (http_parser_flag_t::http_parser_content_length & cursor->flags) {
+            ret = errorcode_t::bad_data;  // RFC 9112 6.3 both Transfer-Encoding and Content-Length, request smuggling
+            __leave2;
+        }
+        if (http_parser_flag_t::http_parser_chunked & cursor->flags) {
+            ret = errorcode_t::bad_data;  // a coding after chunked (the previous field line)
+            __leave2;
+        }
+        cursor->flags |= http_parser_flag_t::http_parser_transfer_encoding;
+
+        // transfer-coding = token *( OWS ";" OWS transfer-parameter ), a comma separated list
+        bool chunked = false;
+        size_t pos = 0;
+        while (pos < size) {
+            const char* comma = (const char*)memchr(value + pos, ',', size - pos);
+            size_t end = comma ? (comma - value) : size;
+
+            const char* coding = value + pos;
+            size_t coding_size = end - pos;
+            const char* semicolon = (const char*)memchr(coding, ';', coding_size);
+            if (semicolon) {
+                coding_size = semicolon - coding;
+            }
+            while (coding_size && ((' ' == *coding) || ('\t' == *coding))) {
+                coding++;
+                coding_size--;
+            }
+            while (coding_size && ((' ' == coding[coding_size - 1]) || ('\t' == coding[coding_size - 1]))) {
+                coding_size--;
+            }
+
+            if (coding_size) {
+                if (chunked) {
+                    // RFC 9112 6.1 chunked MUST be the final coding and MUST NOT be applied more than once
+                    ret = errorcode_t::bad_data;
+                    break;
+                }
+                chunked = (sizeof(constexpr_chunked) - 1 == coding_size) && (0 == strnicmp(coding, constexpr_chunked, coding_size));
+            }
+            pos = end + 1;
+        }
+        if ((errorcode_t::success == ret) && chunked) {
+            cursor->flags |= http_parser_flag_t::http_parser_chunked;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t http_parser::parse_chunk_size(const char* line, size_t size, size_t* chunk_size) {
+    return_t ret = errorcode_t::success;
+    size_t value = 0;
+    size_t i = 0;
+
+    // chunk-size [ chunk-ext ] CRLF
+    for (i = 0; i < size; i++) {
+        char c = line[i];
+        int digit = 0;
+        if ((c >= '0') && (c <= '9')) {
+            digit = c - '0';
+        } else if ((c >= 'a') && (c <= 'f')) {
+            digit = c - 'a' + 10;
+        } else if ((c >= 'A') && (c <= 'F')) {
+            digit = c - 'A' + 10;
+        } else {
+            break;
+        }
+        if (value > ((size_t)-1 >> 4)) {
+            ret = errorcode_t::bad_data;
+            break;
+        }
+        value = (value << 4) | digit;
+    }
+
+    if (errorcode_t::success == ret) {
+        if ((0 == i) || ((i < size) && (';' != line[i]) && (' ' != line[i]) && ('\t' != line[i]))) {
+            ret = errorcode_t::bad_data;
+        }
+    }
+
+    *chunk_size = value;
+    return ret;
+}
+
+}  // namespace net
+}  // namespace hotplace
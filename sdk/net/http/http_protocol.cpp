@@ -11,6 +11,7 @@
  */
 
 #include <sdk/base/stream/basic_stream.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_protocol.hpp>
 
 namespace hotplace {
@@ -69,57 +70,58 @@ return_t http_protocol::is_kind_of(void* stream, size_t stream_size) {
     return ret;
 }
 
-return_t http_protocol::read_stream(basic_stream* stream, size_t* request_size, protocol_state_t* state, int* priority) {
-    const char* stream_data = (const char*)stream->data();
-    uint32 stream_size = stream->size();
+return_t http_protocol::read_stream(byte_t* stream, size_t stream_size, size_t* request_size, protocol_state_t* state, int* priority,
+                                    protocol_cursor_t* cursor) {
+    return_t ret = errorcode_t::success;
 
     __try2 {
+        if (nullptr == stream || nullptr == request_size || nullptr == state) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
         if (priority) {
             *priority = 0;
         }
 
-        size_t packet_size = get_constraints(protocol_constraints_t::protocol_packet_size);
-        if (packet_size && (stream_size > packet_size)) {
-            *state = protocol_state_t::protocol_state_large;
-            __leave2;
+        // resume where it stopped
+        protocol_cursor_t temp;
+        if (nullptr == cursor) {
+            cursor = &temp;
         }
 
-        const char* search_stream_data = stream_data;
-        /* "Content-Length: " */
-        char STRING_CONTENT_LENGTH__[] = {
-            'C', 'o', 'n', 't', 'e', 'n', 't', '-', 'L', 'e', 'n', 'g', 't', 'h', ':', ' ', 0,
-        };
-        const char* search_content_length = strstr(stream_data, STRING_CONTENT_LENGTH__);
-        if (search_content_length) {
-            const char* end_of_content_length = search_content_length + strlen(STRING_CONTENT_LENGTH__);
-            const char* search_carragereturn_newline = strstr(search_content_length, "\r\n\r\n");
-            if (search_carragereturn_newline) {
-                std::string content_length(end_of_content_length, search_carragereturn_newline - end_of_content_length);
-                int ret_atoi = atoi(content_length.c_str());
-
-                size_t size_need = (search_carragereturn_newline - stream_data) + 4 + ret_atoi;
-
-                if (size_need > stream_size) {
-                    *state = protocol_state_t::protocol_state_data;
-                } else {
-                    *request_size = size_need;
-                    *state = protocol_state_t::protocol_state_complete;
-                }
-            }
-        } else {
-            *state = protocol_state_t::protocol_state_data;
+        http_parser parser;
+        size_t need = 0;
+        return_t test = parser.parse(cursor, (const char*)stream, stream_size, &need);
 
-            const char* search_carragereturn_newline = strstr(search_stream_data, "\r\n\r\n");
-            if (search_carragereturn_newline) {
-                *request_size = (search_carragereturn_newline - stream_data + 4);
+        size_t packet_size = get_constraints(protocol_constraints_t::protocol_packet_size);
+        if (errorcode_t::success == test) {
+            if (packet_size && (cursor->pos > packet_size)) {
+                *state = protocol_state_t::protocol_state_large;
+            } else {
+                *request_size = cursor->pos;
                 *state = protocol_state_t::protocol_state_complete;
             }
+        } else if (errorcode_t::more_data == test) {
+            if (packet_size && ((stream_size > packet_size) || (need > packet_size))) {
+                *state = protocol_state_t::protocol_state_large;
+            } else {
+                *request_size = need;  // resume when received
+                *state = (cursor->phase < http_parser_phase_t::http_parser_content) ? protocol_state_t::protocol_state_header
+                                                                                     : protocol_state_t::protocol_state_data;
+            }
+        } else {
+            // RFC 9112 6.3 respond 400 and close the connection (see http_server::consume)
+            // the rest of the stream is not trusted, it is delivered with the message
+            cursor->flags |= http_parser_flag_t::http_parser_error;
+            *request_size = stream_size;
+            *state = protocol_state_t::protocol_state_complete;
         }
     }
     __finally2 {
         // do nothing
     }
-    return errorcode_t::success;
+    return ret;
 }
 
 const char* http_protocol::protocol_id() { return "http"; }
@@ -34,16 +34,19 @@ class http_protocol : public network_protocol {
     virtual return_t is_kind_of(void* stream, size_t stream_size);
     /**
      * @brief   read stream
-     * @param   IBufferStream*  stream          [IN]
-     * @param   size_t*         request_size    [INOUT]
+     * @param   byte_t*         stream          [IN]
+     * @param   size_t          stream_size     [IN]
+     * @param   size_t*         request_size    [OUT]
      * @param   PROTOCOL_STATE* state           [OUT]
      *                                              PROTOCOL_STATE_COMPLETE
      *                                              PROTOCOL_STATE_CRASH : drop
      * @param   int*            priority        [OUTOPT]
+     * @param   protocol_cursor_t* cursor       [INOPT]
      * @return  error code (see error.hpp)
      * @remarks
      */
-    virtual return_t read_stream(basic_stream* stream, size_t* request_size, protocol_state_t* state, int* priority = nullptr);
+    virtual return_t read_stream(byte_t* stream, size_t stream_size, size_t* request_size, protocol_state_t* state, int* priority = nullptr,
+                                 protocol_cursor_t* cursor = nullptr);
     /**
      * @brief   id
      */
@@ -13,6 +13,7 @@
 #include <sdk/io/string/string.hpp>
 #include <sdk/net/http/http2/hpack.hpp>
 #include <sdk/net/http/http2/http2_frame.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_request.hpp>
 #include <sdk/net/http/http_resource.hpp>
 #include <sdk/net/http/http_server.hpp>
@@ -32,13 +33,31 @@ http_request::http_request(const http_request& object) {
     _content = object._content;
     _header = object._header;
     _uri = object._uri;
+    _params = object._params;
+
+    get_http_header().set_version(_version);
+}
+
+http_request::http_request(http_request&& object) {
+    _shared.make_share(this);
+    _router = object._router;
+    _hpsess = object._hpsess;
+    _version = object._version;
+    _stream_id = object._stream_id;
+    _method = std::move(object._method);
+    _content = std::move(object._content);
+    _header = std::move(object._header);
+    _uri = object._uri;
+    _params = object._params;
 
     get_http_header().set_version(_version);
 }
 
 http_request::~http_request() { close(); }
 
-return_t http_request::open(const char* request, size_t size_request, uint32 flags) {
+return_t http_request::open(const char* request, size_t size_request, uint32 flags) { return open(request, size_request, flags, nullptr); }
+
+return_t http_request::open(const char* request, size_t size_request, uint32 flags, const protocol_cursor_t* cursor) {
     return_t ret = errorcode_t::success;
 
     __try2 {
@@ -49,13 +68,10 @@ return_t http_request::open(const char* request, size_t size_request, uint32 fla
 
         close();
 
-        std::string uri;
-        size_t pos = 0;
-
         if (1 == get_version()) {
-            open_h1(request, size_request, flags);
+            ret = open_h1(request, size_request, flags, cursor);
         } else if (2 == get_version()) {
-            open_h2(request, size_request, flags);
+            ret = open_h2(request, size_request, flags);
         }
     }
     __finally2 {
@@ -65,72 +81,57 @@ return_t http_request::open(const char* request, size_t size_request, uint32 fla
     return ret;
 }
 
-return_t http_request::open_h1(const char* request, size_t size_request, uint32 flags) {
+/**
+ * @brief   populate http_request while parsing
+ */
+class http_request_parser : public http_parser {
+   public:
+    http_request_parser(http_request* request) : http_parser(), _request(request) {}
+
+    std::string uri;
+
+   protected:
+    virtual void on_start_line(const char* method, size_t method_size, const char* target, size_t target_size) {
+        _request->_method.assign(method, method_size); /* GET, POST, ... */
+        uri.assign(target, target_size);
+        _request->_uri.open(uri);
+    }
+    virtual void on_header(const char* name, size_t name_size, const char* value, size_t value_size) {
+        _request->_header.add(name, name_size, value, value_size);
+    }
+    virtual void on_content(const char* data, size_t size) { _request->_content.append(data, size); }
+
+   private:
+    http_request* _request;
+};
+
+return_t http_request::open_h1(const char* request, size_t size_request, uint32 flags, const protocol_cursor_t* cursor) {
     return_t ret = errorcode_t::success;
-    return_t ret_getline = errorcode_t::success;
 
     __try2 {
-        std::string uri;
-        size_t pos = 0;
-
         /*
          * 1. request format
          *  GET /resource?a=1&b=2\r\n
          *  Content-Type: application/json\r\n
          *  \r\n
          *
-         * 2. loop
-         * while getline and tokenize(space or colon) do insert into map
-         * line 1 -> GET /resource?a=1&b=2
-         *           first token GET -> method
-         *           next token /resource?a=1&b=2 -> uri
-         * line 2 -> Content-Type: application/json
-         *           insert(make_pair("Content-Type", "application/json"))
-         * line 3 -> break loop if no space nor colon
+         * 2. parse once (see http_parser)
+         * request-line -> method, uri
+         * field line   -> insert(make_pair("Content-Type", "application/json"))
+         * content      -> Content-Length or chunked (decoded)
          */
 
-        size_t line = 1;
-        size_t epos = 0;
-        while (true) {
-            ret_getline = getline(request, size_request, pos, &epos);
-            if (errorcode_t::success != ret_getline) {
-                break;
-            }
-
-            std::string token, str(request + pos, epos - pos);
-            size_t tpos = 0;
-            token = tokenize(str, ": ", tpos);
-            token = rtrim(token);
-
-            if (0 == token.size()) {
-                break;
-            }
-
-            if ((epos <= size_request) && (tpos < size_request)) { /* if token (space, colon) not found */
-                while (isspace(str[tpos])) {
-                    tpos++; /* swallow trailing spaces */
-                }
-                if (1 == line) {
-                    _method = token; /* first token aka GET, POST, ... */
-
-                    size_t zpos = tpos;
-                    uri = tokenize(str, " ", zpos);
-                    _uri.open(uri);
-                } else {
-                    std::string remain = tokenize(str, "\r\n", tpos);  // std::string remain = str.substr(tpos);
-                    _header.add(token, remain);
-                }
-            }
-
-            pos = epos;
-            line++;
-        }
-
-        if (size_request > epos) {
-            _content.assign(request + epos, size_request - epos);
+        http_request_parser parser(this);
+        protocol_cursor_t temp;
+        if (cursor && (http_parser_phase_t::http_parser_complete == cursor->phase)) {
+            // the framing pass is reused, Content-Length and Transfer-Encoding are not examined again
+            temp.flags = cursor->flags | http_parser_flag_t::http_parser_framed;
+            temp.value = cursor->value;
         }
+        temp.flags |= http_parser_flag_t::http_parser_eof; /* the last line may not end with CRLF */
+        ret = parser.parse(&temp, request, size_request);
 
-        open_uri(uri, flags);
+        open_uri(parser.uri, flags);
     }
     __finally2 {
         // do nothing
@@ -143,8 +144,14 @@ return_t http_request::open_h2(const char* request, size_t size_request, uint32
     return_t ret = errorcode_t::success;
 
     __try2 {
-        _method = get_http_header().get(":method");
-        _uri.open(get_http_header().get(":path"));
+        const std::string* method = _header.find(http_field_method);
+        const std::string* path = _header.find(http_field_path);
+        if (method) {
+            _method = *method;
+        }
+        if (path) {
+            _uri.open(*path);
+        }
     }
     __finally2 {
         // do nothing
@@ -203,6 +210,7 @@ return_t http_request::close() {
     _method.clear();
     _content.clear();
     _uri.close();
+    _params.clear();
     return ret;
 }
 
@@ -212,6 +220,10 @@ http_header& http_request::get_http_header() { return _header; }
 
 http_uri& http_request::get_http_uri() { return _uri; }
 
+return_t http_request::param(const std::string& key, std::string& value) { return _params.query(key, value); }
+
+skey_value& http_request::get_params() { return _params; }
+
 std::string http_request::get_method() {
     // RFC 2616
     // 9.3 GET
@@ -224,7 +236,10 @@ std::string http_request::get_method() {
     if (1 == _version) {
         m = _method;
     } else if (2 == _version) {
-        m = get_http_header().get(":method");  // HTTP/2
+        const std::string* method = _header.find(http_field_method);  // HTTP/2
+        if (method) {
+            m = *method;
+        }
     }
     return m;
 }
@@ -276,18 +291,19 @@ http_request& http_request::operator=(const http_request& rhs) {
 
     _header = rhs._header;
     _uri = rhs._uri;
+    _params = rhs._params;
 
     return *this;
 }
 
 http_request& http_request::add_content(const char* buf, size_t bufsize) {
-    for (size_t i = 0; buf && (i < bufsize); i++) {
-        _content += buf[i];
+    if (buf && bufsize) {
+        _content.append(buf, bufsize);
     }
     return *this;
 }
 
-http_request& http_request::add_content(const binary_t& bin) { return add_content((char*)&bin[0], bin.size()); }
+http_request& http_request::add_content(const binary_t& bin) { return add_content((char*)bin.data(), bin.size()); }
 
 http_request& http_request::clear_content() {
     _content.clear();
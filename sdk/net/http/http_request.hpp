@@ -26,10 +26,15 @@ enum http_request_flag_t {
 
 class http_request {
     friend class http_router;
+    friend class http_request_parser;
 
    public:
     http_request();
     http_request(const http_request& object);
+    /**
+     * @brief   move the content (HTTP/2 completed request, see http2_session::consume)
+     */
+    http_request(http_request&& object);
     virtual ~http_request();
 
     /**
@@ -39,6 +44,17 @@ class http_request {
      * @return  error code (see error.hpp)
      */
     return_t open(const char* request, size_t size_request, uint32 flags = 0);
+    /**
+     * @brief   open (HTTP/1.1)
+     * @param   const char*     request         [IN]
+     * @param   size_t          size_request    [IN]
+     * @param   uint32          flags           [IN]
+     * @param   const protocol_cursor_t* cursor [IN] the cursor of the complete message (see http_protocol::read_stream)
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          the framing (Content-Length, Transfer-Encoding) is taken from the cursor, the message is not split twice
+     */
+    return_t open(const char* request, size_t size_request, uint32 flags, const protocol_cursor_t* cursor);
     return_t open(const char* request, uint32 flags = 0);
     return_t open(const basic_stream& request, uint32 flags = 0);
     return_t open(const std::string& request, uint32 flags = 0);
@@ -66,6 +82,21 @@ class http_request {
      * @brief   content
      */
     std::string get_content();
+    /**
+     * @brief   read a parameter captured by the router
+     * @param   const std::string& key [in]
+     * @param   std::string& value [out]
+     * @return  error code (see error.hpp)
+     * @sample
+     *          router.add("/users/:id", handler);
+     *          // GET /users/1
+     *          request->param("id", id);  // 1
+     */
+    return_t param(const std::string& key, std::string& value);
+    /**
+     * @brief   parameters captured by the router (see http_route_tree)
+     */
+    skey_value& get_params();
 
     /**
      * @brief   compose
@@ -109,8 +140,9 @@ class http_request {
      * @param   const char* request [in]
      * @param   size_t size_request [in]
      * @param   uint32 flags [inopt] reserved
+     * @param   const protocol_cursor_t* cursor [inopt] framing pass
      */
-    return_t open_h1(const char* request, size_t size_request, uint32 flags = 0);
+    return_t open_h1(const char* request, size_t size_request, uint32 flags = 0, const protocol_cursor_t* cursor = nullptr);
     return_t open_h2(const char* request, size_t size_request, uint32 flags = 0);
     /**
      * @brief   open URI
@@ -129,6 +161,7 @@ class http_request {
 
     http_header _header;
     http_uri _uri;
+    skey_value _params;
 
     http_router* _router;
     hpack_dynamic_table* _hpsess;
@@ -16,7 +16,9 @@
 #include <sdk/io/basic/zlib.hpp>
 #include <sdk/io/string/string.hpp>
 #include <sdk/net/http/http2/hpack.hpp>
+#include <sdk/net/http/html_documents.hpp>
 #include <sdk/net/http/http2/http2_frame.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_request.hpp>
 #include <sdk/net/http/http_resource.hpp>
 #include <sdk/net/http/http_response.hpp>
@@ -29,9 +31,13 @@ namespace net {
 constexpr char constexpr_deflate[] = "deflate";
 constexpr char constexpr_gzip[] = "gzip";
 
-http_response::http_response() : _router(nullptr), _request(nullptr), _statuscode(0), _hpsess(nullptr), _version(1), _stream_id(0) { _shared.make_share(this); }
+http_response::http_response()
+    : _router(nullptr), _request(nullptr), _statuscode(0), _document(nullptr), _offset(0), _length(0), _hpsess(nullptr), _version(1), _stream_id(0) {
+    _shared.make_share(this);
+}
 
-http_response::http_response(http_request* request) : _router(nullptr), _request(request), _statuscode(0), _hpsess(nullptr), _version(1), _stream_id(0) {
+http_response::http_response(http_request* request)
+    : _router(nullptr), _request(request), _statuscode(0), _document(nullptr), _offset(0), _length(0), _hpsess(nullptr), _version(1), _stream_id(0) {
     _shared.make_share(this);
     if (request) {
         request->addref();
@@ -57,6 +63,13 @@ http_response::http_response(const http_response& object) {
     _content_type = object._content_type;
     _content = object._content;
     _statuscode = object._statuscode;
+    _document = object._document;
+    if (_document) {
+        _document->addref();
+    }
+    _offset = object._offset;
+    _length = object._length;
+    _producer = object._producer;
 }
 
 http_response::~http_response() {
@@ -67,9 +80,30 @@ http_response::~http_response() {
     }
 }
 
+/**
+ * @brief   populate http_response while parsing
+ */
+class http_response_parser : public http_parser {
+   public:
+    http_response_parser(http_response* response) : http_parser(), _response(response) {}
+
+    std::string content;
+
+   protected:
+    virtual void on_start_line(const char* version, size_t version_size, const char* status, size_t status_size) {
+        _response->_statuscode = atoi(std::string(status, status_size).c_str()); /* HTTP/1.1 200 OK */
+    }
+    virtual void on_header(const char* name, size_t name_size, const char* value, size_t value_size) {
+        _response->_header.add(name, name_size, value, value_size);
+    }
+    virtual void on_content(const char* data, size_t size) { content.append(data, size); }
+
+   private:
+    http_response* _response;
+};
+
 return_t http_response::open(const char* response, size_t size_response) {
     return_t ret = errorcode_t::success;
-    return_t ret_getline = errorcode_t::success;
 
     __try2 {
         if (nullptr == response) {
@@ -78,60 +112,40 @@ return_t http_response::open(const char* response, size_t size_response) {
         }
 
         close();
+        _header.clear();
 
         if (1 != _version) {
             ret = errorcode_t::not_supported;
             __leave2;
         }
 
-        size_t line = 1;
-        size_t pos = 0, epos = 0;
-        while (true) {
-            ret_getline = getline(response, size_response, pos, &epos);
-            if (errorcode_t::success != ret_getline) {
-                break;
+        /*
+         * status-line  -> status code
+         * field line   -> header
+         * content      -> Content-Length or chunked (decoded), otherwise until the end (RFC 9112 6.3 read until the connection is closed)
+         */
+        http_response_parser parser(this);
+        protocol_cursor_t cursor;
+        cursor.flags = http_parser_flag_t::http_parser_eof; /* the last line may not end with CRLF */
+        ret = parser.parse(&cursor, response, size_response);
+        if (0 == ((http_parser_flag_t::http_parser_chunked | http_parser_flag_t::http_parser_content_length) & cursor.flags)) {
+            if (size_response > cursor.pos) {
+                parser.content.append(response + cursor.pos, size_response - cursor.pos);
             }
-
-            std::string token, str(response + pos, epos - pos);
-            size_t tpos = 0;
-            token = tokenize(str, ": ", tpos);
-            token = rtrim(token);
-
-            if (0 == token.size()) {
-                break;
-            }
-
-            if ((epos <= size_response) && (tpos < size_response)) { /* if token (space, colon) not found */
-                while (isspace(str[tpos])) {
-                    tpos++; /* swallow trailing spaces */
-                }
-                if (1 == line) {
-                    size_t lpos = 0;
-                    tokenize(str, " ", lpos);
-                    std::string status = tokenize(str, " ", lpos);
-                    _statuscode = atoi(status.c_str());
-                } else {
-                    std::string remain = tokenize(str, "\r\n", tpos);  // std::string remain = str.substr(tpos);
-                    _header.add(token, remain);
-                }
-            }
-
-            pos = epos;
-            line++;
         }
 
-        if (size_response > epos) {
-            byte_t* content = (byte_t*)response + epos;
-            size_t content_size = size_response - epos;
+        if (parser.content.size()) {
+            const byte_t* content = (const byte_t*)parser.content.c_str();
+            size_t content_size = parser.content.size();
 
             // RFC 2616 3.5 Content Codings
             // RFC 2616 14.11 Content-Encoding
-            std::string encoding = get_http_header().get("Content-Encoding");
-            if ("deflate" == encoding) {
+            const std::string* encoding = _header.find(http_field_content_encoding);
+            if (encoding && (constexpr_deflate == *encoding)) {
                 basic_stream inflated;
                 zlib_inflate(zlib_windowbits_t::windowbits_deflate, content, content_size, &inflated);
                 _content = inflated;
-            } else if ("gzip" == encoding) {
+            } else if (encoding && (constexpr_gzip == *encoding)) {
                 basic_stream inflated;
                 zlib_inflate(zlib_windowbits_t::windowbits_gzip, content, content_size, &inflated);
                 _content = inflated;
@@ -142,7 +156,10 @@ return_t http_response::open(const char* response, size_t size_response) {
 
         // RFC 2616 3.7 Media Types
         // RFC 2616 14.17 Content-Type
-        _header.get("Content-Type", _content_type);
+        const std::string* content_type = _header.find(http_field_content_type);
+        if (content_type) {
+            _content_type = *content_type;
+        }
     }
     __finally2 {
         // do nothing
@@ -176,6 +193,13 @@ return_t http_response::close() {
 
     _content_type.clear();
     _content.clear();
+    if (_document) {
+        _document->release();
+        _document = nullptr;
+    }
+    _offset = 0;
+    _length = 0;
+    _producer = nullptr;
 
     return ret;
 }
@@ -225,6 +249,29 @@ http_response& http_response::compose(int status_code, const std::string& conten
     return *this;
 }
 
+http_response& http_response::compose(int status_code, const std::string& content_type, html_document* document, uint64 offset, uint64 length) {
+    close();
+
+    _content_type = content_type;
+    if (document) {
+        document->addref();
+        _document = document;
+        _offset = offset;
+        _length = length;
+    }
+    _statuscode = status_code;
+    return *this;
+}
+
+http_response& http_response::compose(int status_code, const std::string& content_type, http_body_producer_t producer) {
+    close();
+
+    _content_type = content_type;
+    _producer = producer;
+    _statuscode = status_code;
+    return *this;
+}
+
 return_t http_response::respond(network_session* session) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -234,13 +281,69 @@ return_t http_response::respond(network_session* session) {
         }
 
         if (1 == _version) {
-            basic_stream bs;
-            get_response(bs);
-            session->send(bs.data(), bs.size());
+            // the capacity is kept, a response does not allocate for the headers
+            static thread_local std::string head;
+            basic_stream encoded;
+            sendbuf_t body;
+            get_response_headers(head, encoded, body);
+
+            if (_producer && (false == is_head_request())) {
+                // RFC 9112 7.1.  Chunked Transfer Coding
+                constexpr char constexpr_crlf[] = "\r\n";
+                constexpr char constexpr_last_chunk[] = "0\r\n\r\n";
+
+                binary_t chunk;
+                char size_line[24];
+                bool more = true;
+                bool first = true;
+                while (more && (errorcode_t::success == ret)) {
+                    chunk.clear();
+                    more = (errorcode_t::success == _producer(chunk));
+
+                    sendbuf_t bufs[5];
+                    size_t count = 0;
+                    if (first) {
+                        bufs[count++] = sendbuf_t(head.c_str(), head.size());
+                        first = false;
+                    }
+                    if (false == chunk.empty()) {
+                        int len = snprintf(size_line, sizeof(size_line), "%zx\r\n", chunk.size());
+                        bufs[count++] = sendbuf_t(size_line, len);
+                        bufs[count++] = sendbuf_t(&chunk[0], chunk.size());
+                        bufs[count++] = sendbuf_t(constexpr_crlf, 2);
+                    }
+                    if (false == more) {
+                        bufs[count++] = sendbuf_t(constexpr_last_chunk, 5);
+                    }
+                    if (count) {
+                        ret = session->sendv(bufs, count);
+                    }
+                }
+            } else if (_document && body.size && (false == session->get_server_socket()->support_tls())) {
+                ret = session->send(head.c_str(), head.size());
+                if (errorcode_t::success == ret) {
+                    // the file is not copied into the user space
+                    ret = session->sendfile(_document->get_handle(), _offset, _length);
+                    if (errorcode_t::not_supported == ret) {
+                        ret = session->send(body.ptr, body.size);
+                    }
+                }
+            } else {
+                // TLS gathers the headers and a small body into a record
+                sendbuf_t bufs[2] = {sendbuf_t(head.c_str(), head.size()), body};
+                ret = session->sendv(bufs, 2);
+            }
         } else if (2 == _version) {
-            binary_t bin;
-            get_response_h2(bin);
-            session->send(&bin[0], bin.size());
+            binary_t headers;
+            binary_t body;
+            bool end_stream = false;
+            get_response_h2(headers, body, end_stream);
+            if (_producer && (false == end_stream)) {
+                // pulled by the stream as the window allows (backpressure)
+                ret = session->get_http2_session().send(session, get_stream_id(), headers, _producer);
+            } else {
+                session->get_http2_session().send(session, get_stream_id(), headers, body, end_stream);
+            }
         }
     }
     __finally2 {
@@ -262,28 +365,62 @@ http_header& http_response::get_http_header() { return _header; }
 http_request* http_response::get_http_request() { return _request; }
 
 http_response& http_response::get_response(basic_stream& bs) {
+    bs.clear();
+
+    if (1 == _version) {
+        std::string head;
+        basic_stream encoded;
+        sendbuf_t body;
+        get_response_headers(head, encoded, body);
+
+        bs << head;
+        if (body.size) {
+            bs.write(body.ptr, body.size);
+        } else if (_producer && (false == is_head_request())) {
+            // RFC 9112 7.1.  Chunked Transfer Coding
+            binary_t chunk;
+            bool more = true;
+            while (more) {
+                chunk.clear();
+                more = (errorcode_t::success == _producer(chunk));
+                if (false == chunk.empty()) {
+                    bs.printf("%zx\r\n", chunk.size());
+                    bs.write(&chunk[0], chunk.size());
+                    bs << "\r\n";
+                }
+            }
+            bs << "0\r\n\r\n";
+        }
+    }
+    return *this;
+}
+
+http_response& http_response::get_response_headers(std::string& head, basic_stream& encoded, sendbuf_t& body) {
     constexpr char constexpr_content_type[] = "Content-Type";
     constexpr char constexpr_connection[] = "Connection";
     constexpr char constexpr_keep_alive[] = "Keep-Alive";
     constexpr char constexpr_content_length[] = "Content-Length";
     constexpr char constexpr_content_encoding[] = "Content-Encoding";
+    constexpr char constexpr_transfer_encoding[] = "Transfer-Encoding";
 
-    bs.clear();
+    head.clear();
+    encoded.clear();
+    body = sendbuf_t();
 
     if (1 == _version) {
         std::string accept_encoding;
-        basic_stream method;
         if (_request) {
             // RFC 2616 3.5 Content Codings
             // RFC 2616 14.3 Accept-Encoding
-            _request->get_http_header().get("Accept-Encoding", accept_encoding);
-            method = _request->get_method();
+            const std::string* value = _request->get_http_header().find(http_field_accept_encoding);
+            if (value) {
+                accept_encoding = *value;
+            }
         }
 
         http_resource* resource = http_resource::get_instance();
 
-        std::string headers;
-        if (_content_type.size() && content_size()) {
+        if (_content_type.size() && (content_size() || _document || _producer)) {
             // RFC 2616 3.7 Media Types
             // RFC 2616 14.17 Content-Type
             get_http_header().add(constexpr_content_type, content_type());
@@ -291,47 +428,65 @@ http_response& http_response::get_response(basic_stream& bs) {
         get_http_header().add(constexpr_connection, constexpr_keep_alive);
 
         // RFC 2616 5.1.1 Method
-        if (0 == strcmp("HEAD", method.c_str())) {
-            get_http_header().add(constexpr_content_length, "0").get_headers(headers);
-            bs << get_version_str() << " " << status_code() << " " << resource->load(status_code()) << "\r\n" << headers << "\r\n";
+        if (is_head_request()) {
+            get_http_header().add(constexpr_content_length, "0");
+        } else if (_document) {
+            // html_documents, Content-Encoding (a precompressed file) is given
+            get_http_header().add(constexpr_content_length, format("%zi", (size_t)_length));
+            body = sendbuf_t(_document->data() + _offset, _length);
+        } else if (_producer) {
+            // RFC 9112 7.1.  Chunked Transfer Coding
+            get_http_header().add(constexpr_transfer_encoding, "chunked");
         } else {
+            // not routed (ex. 301 Moved Permanently)
             auto router = get_http_router();
-            auto server = router->get_http_server();
-            auto& httpconf = server->get_http_conf();
-            std::string content_encoding_conf = httpconf.get(constexpr_content_encoding);
+            auto server = router ? router->get_http_server() : nullptr;
+            std::string content_encoding_conf;
+            if (server) {
+                content_encoding_conf = server->get_http_conf().get(constexpr_content_encoding);
+            }
 
             // RFC 2616 3.5 Content Codings
             // RFC 2616 14.11 Content-Encoding
-            if ((std::string::npos != content_encoding_conf.find(constexpr_deflate)) && (std::string::npos != accept_encoding.find(constexpr_deflate))) {
-                basic_stream encoded;
+            // RFC 9110 12.5.3 Accept-Encoding, q=0 refuses a coding
+            uint16 q_deflate = 0;
+            uint16 q_gzip = 0;
+            if (std::string::npos != content_encoding_conf.find(constexpr_deflate)) {
+                q_deflate = http_header::get_qvalue(accept_encoding, constexpr_deflate);
+            }
+            if (std::string::npos != content_encoding_conf.find(constexpr_gzip)) {
+                q_gzip = http_header::get_qvalue(accept_encoding, constexpr_gzip);
+            }
+            if (q_deflate && (q_deflate >= q_gzip)) {
                 zlib_deflate(zlib_windowbits_t::windowbits_deflate, (byte_t*)content(), content_size(), &encoded);
 
-                get_http_header()
-                    .add(constexpr_content_encoding, constexpr_deflate)
-                    .add(constexpr_content_length, format("%zi", encoded.size()))
-                    .get_headers(headers);
-                bs << get_version_str() << " " << status_code() << " " << resource->load(status_code()) << "\r\n" << headers << "\r\n";
-                bs.write(encoded.data(), encoded.size());
-            } else if ((std::string::npos != content_encoding_conf.find(constexpr_gzip)) && (std::string::npos != accept_encoding.find(constexpr_gzip))) {
-                basic_stream encoded;
+                get_http_header().add(constexpr_content_encoding, constexpr_deflate).add(constexpr_content_length, format("%zi", encoded.size()));
+                body = sendbuf_t(encoded.data(), encoded.size());
+            } else if (q_gzip) {
                 zlib_deflate(zlib_windowbits_t::windowbits_gzip, (byte_t*)content(), content_size(), &encoded);
 
-                get_http_header()
-                    .add(constexpr_content_encoding, constexpr_gzip)
-                    .add(constexpr_content_length, format("%zi", encoded.size()))
-                    .get_headers(headers);
-                bs << get_version_str() << " " << status_code() << " " << resource->load(status_code()) << "\r\n" << headers << "\r\n";
-                bs.write(encoded.data(), encoded.size());
+                get_http_header().add(constexpr_content_encoding, constexpr_gzip).add(constexpr_content_length, format("%zi", encoded.size()));
+                body = sendbuf_t(encoded.data(), encoded.size());
             } else /* "identity" */ {
-                get_http_header().add(constexpr_content_length, format("%zi", content_size())).get_headers(headers);
-
-                bs << get_version_str() << " " << status_code() << " " << resource->load(status_code()) << "\r\n" << headers << "\r\n";
-                bs.write(content(), content_size());
+                get_http_header().add(constexpr_content_length, format("%zi", content_size()));
+                body = sendbuf_t(content(), content_size());
             }
         }
+
+        head += get_version_str();
+        head += format(" %i ", status_code());
+        head += resource->load(status_code());
+        head += "\r\n";
+        get_http_header().get_headers(head);
+        head += "\r\n";
+
         if (istraceable()) {
             basic_stream dbs;
-            dump_memory(bs.data(), bs.size(), &dbs, 16, 2, 0, dump_notrunc);
+            dump_memory((byte_t*)head.c_str(), head.size(), &dbs, 16, 2, 0, dump_notrunc);
+            if (body.size) {
+                dbs.printf("\n");
+                dump_memory((byte_t*)body.ptr, body.size, &dbs, 16, 2, 0, dump_notrunc);
+            }
 
             trace_debug_event(category_net, net_event_httpresponse, &dbs);
         }
@@ -339,7 +494,36 @@ http_response& http_response::get_response(basic_stream& bs) {
     return *this;
 }
 
+bool http_response::is_head_request() { return _request && ("HEAD" == _request->get_method()); }
+
 http_response& http_response::get_response_h2(binary_t& bin) {
+    binary_t body;
+    bool end_stream = false;
+    get_response_h2(bin, body, end_stream);
+
+    // DATA
+    if ((2 == _version) && get_hpack_session()) {
+        if (_producer && (false == end_stream)) {
+            binary_t chunk;
+            bool more = true;
+            while (more) {
+                chunk.clear();
+                more = (errorcode_t::success == _producer(chunk));
+                body.insert(body.end(), chunk.begin(), chunk.end());
+            }
+        }
+
+        // no connection here, the windows are fully open and the body is fragmented by SETTINGS_MAX_FRAME_SIZE (see respond)
+        http2_session h2;
+        h2.update_settings(h2_settings_initial_window_size, 0x7fffffff, bin);
+        h2.update_window(0, 0x7fffffff - h2.get_window(0), bin);
+        h2.write(get_stream_id(), binary_t(), body, end_stream, bin);
+    }
+    return *this;
+}
+
+http_response& http_response::get_response_h2(binary_t& bin, binary_t& body, bool& end_stream) {
+    end_stream = false;
     if ((2 == _version) && get_hpack_session()) {
         std::string accept_encoding;
         std::string method;
@@ -354,13 +538,18 @@ http_response& http_response::get_response_h2(binary_t& bin) {
         // RFC 2616 5.1.1 Method
         if (0 == strcmp("HEAD", method.c_str())) {
             header_only = true;
+        } else if (_document) {
+            // html_documents, not encoded
         } else if (content_size()) {
             header_only = false;
 
             // RFC 2616 3.5 Content Codings
-            if (std::string::npos != accept_encoding.find("deflate")) {
+            // RFC 9110 12.5.3 Accept-Encoding, q=0 refuses a coding
+            uint16 q_deflate = http_header::get_qvalue(accept_encoding, "deflate");
+            uint16 q_gzip = http_header::get_qvalue(accept_encoding, "gzip");
+            if (q_deflate && (q_deflate >= q_gzip)) {
                 encoding = "deflate";
-            } else if (std::string::npos != accept_encoding.find("gzip")) {
+            } else if (q_gzip) {
                 encoding = "gzip";
             } else /* "identity" */ {
                 // do nothing
@@ -383,7 +572,6 @@ http_response& http_response::get_response_h2(binary_t& bin) {
         get_http_header().get_headers(lambda_enc_headder);
 
         http2_frame_headers headers;
-        http2_frame_data data;
 
         uint8 flags = h2_flag_end_headers;
         if (true == header_only) {
@@ -391,31 +579,32 @@ http_response& http_response::get_response_h2(binary_t& bin) {
         }
 
         headers.set_flags(flags).set_stream_id(get_stream_id()).load_hpack(hp);
-        data.set_flags(h2_flag_end_stream).set_stream_id(get_stream_id()).load_hpack(hp);
 
+        body.clear();
         if (false == header_only) {
-            binary_t encoded;
             if (false == encoding.empty()) {
                 auto router = get_http_router();
-                auto server = router->get_http_server();
-                auto& httpconf = server->get_http_conf();
-                std::string content_encoding_conf = httpconf.get("Content-Encoding");
+                auto server = router ? router->get_http_server() : nullptr;
+                std::string content_encoding_conf;
+                if (server) {
+                    content_encoding_conf = server->get_http_conf().get("Content-Encoding");
+                }
 
                 if (std::string::npos != content_encoding_conf.find(encoding)) {
                     // RFC 2616 3.5 Content Codings
                     if (constexpr_deflate == encoding) {
-                        zlib_deflate(zlib_windowbits_t::windowbits_deflate, (byte_t*)content(), content_size(), encoded);
+                        zlib_deflate(zlib_windowbits_t::windowbits_deflate, (byte_t*)content(), content_size(), body);
                         hp.encode_header("content-encoding", encoding);
-                        data.set_data(encoded);
                     } else if (constexpr_gzip == encoding) {
-                        zlib_deflate(zlib_windowbits_t::windowbits_gzip, (byte_t*)content(), content_size(), encoded);
+                        zlib_deflate(zlib_windowbits_t::windowbits_gzip, (byte_t*)content(), content_size(), body);
                         hp.encode_header("content-encoding", encoding);
-                        data.set_data(encoded);
                     }
                 }
             }
-            if (encoded.empty()) {
-                data.set_data(content(), content_size());
+            if (_document) {
+                body.insert(body.end(), _document->data() + _offset, _document->data() + _offset + _length);
+            } else if (body.empty()) {
+                body.insert(body.end(), content(), content() + content_size());
             }
         }
 
@@ -441,7 +630,9 @@ http_response& http_response::get_response_h2(binary_t& bin) {
 
         // HEADERS
         {
-            hp.encode_header("content-length", format("%zi", data.get_data().size()));
+            if (nullptr == _producer) {
+                hp.encode_header("content-length", format("%zi", body.size()));
+            }
             headers.set_fragment(hp.get_binary());
 
             headers.write(bin);
@@ -449,12 +640,7 @@ http_response& http_response::get_response_h2(binary_t& bin) {
             lambda_debug(&headers);
         }
 
-        // DATA
-        if (false == header_only) {
-            data.write(bin);
-
-            lambda_debug(&data);
-        }
+        end_stream = header_only;
     }
     return *this;
 }
@@ -472,6 +658,16 @@ http_response& http_response::operator=(const http_response& object) {
     _content_type = object._content_type;
     _content = object._content;
     _statuscode = object._statuscode;
+    if (object._document) {
+        object._document->addref();
+    }
+    if (_document) {
+        _document->release();
+    }
+    _document = object._document;
+    _offset = object._offset;
+    _length = object._length;
+    _producer = object._producer;
     return *this;
 }
 
@@ -22,6 +22,7 @@ namespace net {
 
 class http_response {
     friend class http_router;
+    friend class http_response_parser;
 
    public:
     http_response();
@@ -52,8 +53,33 @@ class http_response {
     http_response& compose(int status_code, const char* content_type, const char* content, ...);
     http_response& compose(int status_code, const std::string& content_type, const char* content, ...);
     http_response& compose(int status_code, const std::string& content_type, const binary_t& bin);
+    /**
+     * @brief   compose (html_documents)
+     * @param   int status_code [in]
+     * @param   const std::string& content_type [in]
+     * @param   html_document* document [in] referenced until close
+     * @param   uint64 offset [in]
+     * @param   uint64 length [in]
+     * @remarks
+     *          the body is not copied into the response
+     *          HTTP/1.1 respond sends the file (sendfile), HTTP/2 reads the mapped file
+     */
+    http_response& compose(int status_code, const std::string& content_type, html_document* document, uint64 offset, uint64 length);
+    /**
+     * @brief   compose (generated content)
+     * @param   int status_code [in]
+     * @param   const std::string& content_type [in]
+     * @param   http_body_producer_t producer [in] called until no_more
+     * @remarks
+     *          HTTP/1.1 Transfer-Encoding: chunked, a chunk is sent as it is produced
+     *          HTTP/2 DATA frames under flow control, the producer is kept by the stream and pulled as the window opens (http2_session::send)
+     *          the producer is consumed by respond (or get_response)
+     */
+    http_response& compose(int status_code, const std::string& content_type, http_body_producer_t producer);
     /**
      * @brief   respond
+     * @remarks
+     *          HTTP/1.1 the status line and the headers are written into a reusable buffer, the body is sent by reference (writev)
      * @example
      *          response.get_http_header().clear();
      *          response.compose(200, "text/html>", "<html><body></body></html>");
@@ -90,7 +116,15 @@ class http_response {
      * @brief   response
      */
     http_response& get_response(basic_stream& bs);  // HTTP/1.1
-    http_response& get_response_h2(binary_t& bin);  // HTTP/2
+    http_response& get_response_h2(binary_t& bin);  // HTTP/2, HEADERS and DATA frames (SETTINGS_MAX_FRAME_SIZE), not flow controlled
+    /**
+     * @brief   response (HTTP/2)
+     * @param   binary_t& headers [out] ALTSVC, HEADERS frames
+     * @param   binary_t& body [out] DATA payload
+     * @param   bool& end_stream [out] END_STREAM is set in HEADERS (HEAD)
+     * @remarks DATA frames are written by http2_session (flow control), see respond
+     */
+    http_response& get_response_h2(binary_t& headers, binary_t& body, bool& end_stream);
 
     virtual std::string get_version_str();
 
@@ -108,6 +142,14 @@ class http_response {
 
    protected:
     void set_http_router(http_router* router);
+    /**
+     * @brief   status line and headers (HTTP/1.1)
+     * @param   std::string& head [out] status line, headers
+     * @param   basic_stream& encoded [out] the body if Content-Encoding is applied
+     * @param   sendbuf_t& body [out] content, encoded or the mapped document, empty if HEAD or generated
+     */
+    http_response& get_response_headers(std::string& head, basic_stream& encoded, sendbuf_t& body);
+    bool is_head_request();
 
     t_shared_reference<http_response> _shared;
 
@@ -118,6 +160,10 @@ class http_response {
     std::string _content_type;
     basic_stream _content;
     int _statuscode;
+    html_document* _document;
+    uint64 _offset;
+    uint64 _length;
+    http_body_producer_t _producer;
 
     hpack_dynamic_table* _hpsess;
     uint8 _version;
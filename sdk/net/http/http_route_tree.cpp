@@ -0,0 +1,228 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include <string.h>
+
+#include <sdk/net/http/http_route_tree.hpp>
+
+namespace hotplace {
+namespace net {
+
+http_route_tree::node::~node() {
+    for (auto child : children) {
+        delete child;
+    }
+    if (param) {
+        delete param;
+    }
+}
+
+http_route_tree::http_route_tree() : _root(new node) {}
+
+http_route_tree::~http_route_tree() { delete _root; }
+
+return_t http_route_tree::add(const std::string& pattern, int index) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (index < 0) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        const char* p = pattern.c_str();
+        size_t size = pattern.size();
+        size_t pos = 0;
+        node* current = _root;
+
+        // a parameter and a wildcard begin a segment
+        auto is_special = [&](size_t i) -> bool { return ((':' == p[i]) || ('*' == p[i])) && ((0 == i) || ('/' == p[i - 1])); };
+
+        while (pos < size) {
+            if (is_special(pos)) {
+                size_t end = pos + 1;
+                while ((end < size) && ('/' != p[end])) {
+                    end++;
+                }
+                std::string name(p + pos + 1, end - pos - 1);
+
+                if (':' == p[pos]) {
+                    if (name.empty()) {
+                        ret = errorcode_t::invalid_parameter;
+                        break;
+                    }
+                    if (nullptr == current->param) {
+                        current->param = new node;
+                        current->param_name = name;
+                    } else if (name != current->param_name) {
+                        ret = errorcode_t::already_exist;
+                        break;
+                    }
+                    current = current->param;
+                    pos = end;
+                } else {
+                    if (end != size) {
+                        ret = errorcode_t::invalid_parameter;
+                        break;
+                    }
+                    if (-1 != current->wildcard) {
+                        ret = errorcode_t::already_exist;
+                        break;
+                    }
+                    current->wildcard = index;
+                    current->wildcard_name = name.empty() ? "*" : name;
+                    current = nullptr;
+                    break;
+                }
+            } else {
+                size_t end = pos + 1;
+                while ((end < size) && (false == is_special(end))) {
+                    end++;
+                }
+
+                size_t k = current->indices.find(p[pos]);
+                if (std::string::npos == k) {
+                    node* child = new node;
+                    child->label.assign(p + pos, end - pos);
+                    current->indices += p[pos];
+                    current->children.push_back(child);
+                    current = child;
+                    pos = end;
+                } else {
+                    node* child = current->children[k];
+
+                    // the longest common prefix
+                    size_t len = 0;
+                    while ((len < child->label.size()) && (pos + len < end) && (child->label[len] == p[pos + len])) {
+                        len++;
+                    }
+
+                    // split the edge
+                    if (len < child->label.size()) {
+                        node* prefix = new node;
+                        prefix->label = child->label.substr(0, len);
+                        child->label.erase(0, len);
+                        prefix->indices += child->label[0];
+                        prefix->children.push_back(child);
+                        current->children[k] = prefix;
+                        child = prefix;
+                    }
+                    current = child;
+                    pos += len;
+                }
+            }
+        }
+
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        if (current) {
+            if (-1 != current->index) {
+                ret = errorcode_t::already_exist;
+                __leave2;
+            }
+            current->index = index;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t http_route_tree::find(const char* path, int& index, params_t* params) const {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        index = -1;
+
+        if (nullptr == path) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        params_t captured;
+        bool test = lookup(_root, path, strlen(path), 0, index, captured);
+        if (false == test) {
+            ret = errorcode_t::not_found;
+            __leave2;
+        }
+
+        if (params) {
+            *params = std::move(captured);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t http_route_tree::find(const std::string& path, int& index, params_t* params) const { return find(path.c_str(), index, params); }
+
+bool http_route_tree::lookup(const node* n, const char* path, size_t size, size_t pos, int& index, params_t& params) const {
+    if (pos == size) {
+        if (-1 != n->index) {
+            index = n->index;
+            return true;
+        }
+        if (-1 != n->wildcard) {
+            params.push_back(std::make_pair(n->wildcard_name, std::string()));
+            index = n->wildcard;
+            return true;
+        }
+        return false;
+    }
+
+    // literal
+    size_t k = n->indices.find(path[pos]);
+    if (std::string::npos != k) {
+        const node* child = n->children[k];
+        const std::string& label = child->label;
+        if ((size - pos >= label.size()) && (0 == memcmp(path + pos, label.c_str(), label.size()))) {
+            if (lookup(child, path, size, pos + label.size(), index, params)) {
+                return true;
+            }
+        }
+    }
+
+    // parameter, a non-empty segment
+    if (n->param && ('/' != path[pos])) {
+        size_t end = pos;
+        while ((end < size) && ('/' != path[end])) {
+            end++;
+        }
+        params.push_back(std::make_pair(n->param_name, std::string(path + pos, end - pos)));
+        if (lookup(n->param, path, size, end, index, params)) {
+            return true;
+        }
+        params.pop_back();
+    }
+
+    // wildcard
+    if (-1 != n->wildcard) {
+        params.push_back(std::make_pair(n->wildcard_name, std::string(path + pos, size - pos)));
+        index = n->wildcard;
+        return true;
+    }
+
+    return false;
+}
+
+void http_route_tree::clear() {
+    delete _root;
+    _root = new node;
+}
+
+}  // namespace net
+}  // namespace hotplace
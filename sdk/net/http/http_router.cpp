@@ -17,7 +17,7 @@
 namespace hotplace {
 namespace net {
 
-http_router::http_router() : _http_server(nullptr) {}
+http_router::http_router() : _routes(nullptr), _http_server(nullptr) {}
 
 http_router::~http_router() { clear(); }
 
@@ -27,6 +27,12 @@ void http_router::clear() {
         provider->release();
     }
     _authenticate_map.clear();
+
+    _routes.store(nullptr);
+    for (auto snapshot : _snapshots) {
+        delete snapshot;
+    }
+    _snapshots.clear();
 }
 
 http_router& http_router::add(const char* uri, http_request_handler_t handler, http_authentication_provider* auth_provider, bool upref) {
@@ -59,6 +65,8 @@ http_router& http_router::add(const std::string& uri, http_request_handler_t han
         }
     }
 
+    invalidate();
+
     return *this;
 }
 
@@ -78,6 +86,8 @@ http_router& http_router::add(const std::string& uri, http_request_function_t ha
         }
     }
 
+    invalidate();
+
     return *this;
 }
 
@@ -86,6 +96,7 @@ http_router& http_router::add(int status_code, http_request_handler_t handler) {
     http_router_t router;
     router.handler = handler;
     _status_handler_map.insert(std::make_pair(status_code, router));
+    invalidate();
     return *this;
 }
 
@@ -94,9 +105,95 @@ http_router& http_router::add(int status_code, http_request_function_t handler)
     http_router_t router;
     router.stdfunc = handler;
     _status_handler_map.insert(std::make_pair(status_code, router));
+    invalidate();
+    return *this;
+}
+
+http_router& http_router::add_sink(const char* uri, http_body_sink_t sink) {
+    if (uri) {
+        add_sink(std::string(uri), sink);
+    }
     return *this;
 }
 
+http_router& http_router::add_sink(const std::string& uri, http_body_sink_t sink) {
+    critical_section_guard guard(_lock);
+    _sink_map.insert(std::make_pair(uri, sink));
+    invalidate();
+    return *this;
+}
+
+bool http_router::get_sink(http_request* request, http_body_sink_t& sink) {
+    bool ret_value = false;
+    auto entry = lookup(get_routes(), request);
+    if (entry && entry->sink) {
+        sink = entry->sink;
+        ret_value = true;
+    }
+    return ret_value;
+}
+
+void http_router::invalidate() { _routes.store(nullptr, std::memory_order_release); }
+
+const http_router::routes_t* http_router::get_routes() {
+    const routes_t* routes = _routes.load(std::memory_order_acquire);
+    if (nullptr == routes) {
+        critical_section_guard guard(_lock);
+
+        routes = _routes.load(std::memory_order_acquire);
+        if (nullptr == routes) {
+            routes_t* snapshot = new routes_t;
+
+            std::map<std::string, size_t> indexes;
+            auto entry_of = [&](const std::string& uri) -> routes_t::entry_t& {
+                auto iter = indexes.find(uri);
+                if (indexes.end() == iter) {
+                    iter = indexes.insert(std::make_pair(uri, snapshot->entries.size())).first;
+                    snapshot->entries.push_back(routes_t::entry_t());
+                }
+                return snapshot->entries[iter->second];
+            };
+            for (const auto& pair : _handler_map) {
+                entry_of(pair.first).router = pair.second;
+            }
+            for (const auto& pair : _sink_map) {
+                entry_of(pair.first).sink = pair.second;
+            }
+            for (const auto& pair : _authenticate_map) {
+                entry_of(pair.first).provider = pair.second;
+            }
+            for (const auto& pair : indexes) {
+                // a conflicting pattern (/users/:id, /users/:name) is not routed
+                snapshot->tree.add(pair.first, pair.second);
+            }
+            snapshot->status_handlers = _status_handler_map;
+
+            _snapshots.push_back(snapshot);
+            _routes.store(snapshot, std::memory_order_release);
+            routes = snapshot;
+        }
+    }
+    return routes;
+}
+
+const http_router::routes_t::entry_t* http_router::lookup(const routes_t* routes, http_request* request) {
+    const routes_t::entry_t* entry = nullptr;
+    if (routes && request) {
+        int index = -1;
+        http_route_tree::params_t params;
+        skey_value& kv = request->get_params();
+        kv.clear();
+        return_t ret = routes->tree.find(request->get_http_uri().get_uripath(), index, &params);
+        if (errorcode_t::success == ret) {
+            entry = &routes->entries[index];
+            for (const auto& pair : params) {
+                kv.set(pair.first, pair.second);
+            }
+        }
+    }
+    return entry;
+}
+
 return_t http_router::route(network_session* session, http_request* request, http_response* response) {
     return_t ret = errorcode_t::success;
     http_authentication_provider* provider = nullptr;
@@ -110,8 +207,13 @@ return_t http_router::route(network_session* session, http_request* request, htt
         request->set_http_router(this);
         response->set_http_router(this);
 
-        get_auth_provider(request, response, &provider);
-        if (provider) {
+        const routes_t* routes = get_routes();
+        const routes_t::entry_t* entry = lookup(routes, request);
+
+        if (entry && entry->provider) {
+            provider = entry->provider;
+            provider->addref();
+
             bool test = get_authenticate_resolver().resolve(provider, session, request, response);
             if (false == test) {
                 provider->request_auth(session, request, response);
@@ -119,41 +221,35 @@ return_t http_router::route(network_session* session, http_request* request, htt
             }
         }
 
-        http_router_t routing;
-        {
-            critical_section_guard guard(_lock);
-
-            auto route_not_found = [&](http_router_t& router) -> void {
-                status_handler_map_t::iterator status_iter = _status_handler_map.find(404);
-                if (_status_handler_map.end() != status_iter) {
-                    router = status_iter->second;
-                }
-            };
+        auto route_not_found = [&](http_router_t& router) -> void {
+            auto status_iter = routes->status_handlers.find(404);
+            if (routes->status_handlers.end() != status_iter) {
+                router = status_iter->second;
+            }
+        };
 
+        http_router_t routing;
+        if (entry && (entry->router.handler || entry->router.stdfunc)) {
+            routing = entry->router;
+        } else if (get_html_documents().test()) {
             const char* uri = request->get_http_uri().get_uripath();
-
-            handler_map_t::iterator iter = _handler_map.find(uri);
-            if (_handler_map.end() != iter) {
-                routing = iter->second;
-            } else if (get_html_documents().test()) {
-                return_t check = get_html_documents().compose(uri, response);
-                if (errorcode_t::success == check) {
-                    auto server = get_http_server();
-                    // RFC 7540 6.5.2.  Defined SETTINGS Parameters
-                    // SETTINGS_ENABLE_PUSH (0x2)
-                    if (session->get_http2_session().is_push_enabled()) {
-                        if (get_http2_serverpush().is_promised(request, server)) {
-                            get_http2_serverpush().push_promise(request, server, session);
-                            get_http2_serverpush().push(request, server, session);
-                        }
+            return_t check = get_html_documents().compose(uri, response);
+            if (errorcode_t::success == check) {
+                auto server = get_http_server();
+                // RFC 7540 6.5.2.  Defined SETTINGS Parameters
+                // SETTINGS_ENABLE_PUSH (0x2)
+                if (session->get_http2_session().is_push_enabled()) {
+                    if (get_http2_serverpush().is_promised(request, server)) {
+                        get_http2_serverpush().push_promise(request, server, session);
+                        get_http2_serverpush().push(request, server, session);
                     }
-                    __leave2;
-                } else {
-                    route_not_found(routing);
                 }
+                __leave2;
             } else {
                 route_not_found(routing);
             }
+        } else {
+            route_not_found(routing);
         }
 
         if (routing.handler) {
@@ -195,15 +291,9 @@ bool http_router::get_auth_provider(http_request* request, http_response* respon
             ret = errorcode_t::invalid_parameter;
             __leave2;
         } else {
-            critical_section_guard guard(_lock);
-
-            std::string uri = request->get_http_uri().get_uripath();
-
-            for (const auto& pair : _authenticate_map) {
-                if (uri == pair.first) {
-                    auth_provider = pair.second;
-                    break;
-                }
+            auto entry = lookup(get_routes(), request);
+            if (entry) {
+                auth_provider = entry->provider;
             }
         }
 
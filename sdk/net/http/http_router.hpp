@@ -12,12 +12,15 @@
 #ifndef __HOTPLACE_SDK_NET_HTTP_ROUTER__
 #define __HOTPLACE_SDK_NET_HTTP_ROUTER__
 
+#include <atomic>
+#include <list>
 #include <map>
 #include <sdk/net/http/auth/oauth2.hpp>             // oauth2_provider
 #include <sdk/net/http/html_documents.hpp>          // html_documents
 #include <sdk/net/http/http2/http2_serverpush.hpp>  // http2_serverpush
 #include <sdk/net/http/http_authentication_provider.hpp>
 #include <sdk/net/http/http_authentication_resolver.hpp>  // http_authentication_resolver
+#include <sdk/net/http/http_route_tree.hpp>               // http_route_tree
 #include <sdk/net/http/types.hpp>
 
 namespace hotplace {
@@ -34,6 +37,15 @@ class http_router {
 
     /**
      * @brief   register a handler
+     * @remarks
+     *          uri is a pattern (see http_route_tree)
+     *          captured parameters are available in the handler (see http_request::get_params)
+     * @sample
+     *          router.add("/users/:id", [&](network_session* session, http_request* request, http_response* response, http_router* router) -> void {
+     *                  std::string id;
+     *                  request->param("id", id);
+     *              });
+     *          router.add("/static/*", static_handler);  // request->param("*", path)
      */
     http_router& add(const char* uri, http_request_handler_t handler, http_authentication_provider* auth_provider = nullptr, bool upref = false);
     http_router& add(const char* uri, http_request_function_t handler, http_authentication_provider* auth_provider = nullptr, bool upref = false);
@@ -48,6 +60,26 @@ class http_router {
      */
     http_router& add(int status_code, http_request_handler_t handler);
     http_router& add(int status_code, http_request_function_t handler);
+    /**
+     * @brief   register a body sink
+     * @remarks
+     *          HTTP/2 DATA frames are delivered to the sink as they arrive instead of being buffered in http_request
+     *          the handler registered with the same uri is called after the sink receives end_stream
+     * @sample
+     *          router.add_sink("/upload", [&](network_session* session, http_request* request, const byte_t* data, size_t size, bool end_stream) -> return_t {
+     *                  file.write(data, size);
+     *                  return errorcode_t::success;
+     *              });
+     */
+    http_router& add_sink(const char* uri, http_body_sink_t sink);
+    http_router& add_sink(const std::string& uri, http_body_sink_t sink);
+    /**
+     * @brief   body sink
+     * @param   http_request* request [in]
+     * @param   http_body_sink_t& sink [out]
+     * @return  true if registered
+     */
+    bool get_sink(http_request* request, http_body_sink_t& sink);
 
     /**
      * @brief   route
@@ -96,12 +128,48 @@ class http_router {
     } http_router_t;
     typedef std::map<std::string, http_router_t> handler_map_t;
     typedef std::map<int, http_router_t> status_handler_map_t;
+    typedef std::map<std::string, http_body_sink_t> sink_map_t;
     typedef std::map<std::string, http_authentication_provider*> authenticate_map_t;
     typedef std::pair<authenticate_map_t::iterator, bool> authenticate_map_pib_t;
 
+    /**
+     * @brief   an immutable snapshot of the routes
+     * @remarks
+     *          rebuilt by the first lookup after add, add_sink
+     *          the previous snapshots are kept until the router is destroyed (a lookup may still be using one)
+     */
+    struct routes_t {
+        struct entry_t {
+            http_router_t router;
+            http_body_sink_t sink;
+            http_authentication_provider* provider;
+
+            entry_t() : provider(nullptr) {}
+        };
+
+        http_route_tree tree;
+        std::vector<entry_t> entries;
+        status_handler_map_t status_handlers;
+    };
+
+    /**
+     * @brief   current snapshot, lock-free unless add, add_sink have been called since the last lookup
+     */
+    const routes_t* get_routes();
+    /**
+     * @brief   find an entry and capture the parameters
+     * @param   http_request* request [in]
+     * @return  nullptr if not found
+     */
+    const routes_t::entry_t* lookup(const routes_t* routes, http_request* request);
+    void invalidate();
+
     critical_section _lock;
+    std::atomic<const routes_t*> _routes;
+    std::list<const routes_t*> _snapshots;
     handler_map_t _handler_map;
     status_handler_map_t _status_handler_map;
+    sink_map_t _sink_map;
     authenticate_map_t _authenticate_map;
     http_authentication_resolver _resolver;
     oauth2_provider _oauth2;
@@ -10,7 +10,9 @@
 
 #include <sdk/net/basic/tls/dtls_server_socket.hpp>
 #include <sdk/net/basic/tls/tls_server_socket.hpp>
+#include <sdk/net/http/http_parser.hpp>
 #include <sdk/net/http/http_request.hpp>
+#include <sdk/net/http/http_response.hpp>
 #include <sdk/net/http/http_server.hpp>
 #include <sdk/net/server/network_session.hpp>
 
@@ -63,6 +65,7 @@ return_t http_server::startup_tls(const std::string& server_cert, const std::str
     __try2 {
         __try_new_catch(_tlscert, new tlscert(tlscert_flag_tls, server_cert.c_str(), server_key.c_str()), ret, __leave2);
         __try_new_catch(_tls, new transport_layer_security(_tlscert->get_ctx()), ret, __leave2);
+        _tls->enable_early_data(get_server_conf().get(netserver_config_t::serverconf_tls_early_data));
         __try_new_catch(_tls_server_socket, new tls_server_socket(_tls), ret, __leave2);
     }
     __finally2 {
@@ -228,8 +231,20 @@ return_t http_server::consume(uint32 type, uint32 data_count, void* data_array[]
     }
 #endif
 
-    if (errorcode_t::success == get_http_protocol().is_kind_of(buf, bufsize)) {  // HTTP/1.1
-        request.open(buf, bufsize);
+    const protocol_cursor_t* cursor = (data_count > netserver_cb_type_t::netserver_cb_cursor) ? (protocol_cursor_t*)data_array[6] : nullptr;
+    if (cursor && (http_parser_flag_t::http_parser_error & cursor->flags)) {
+        // RFC 9112 6.3 (ex. the final transfer coding is not chunked, Transfer-Encoding and Content-Length)
+        //   the server MUST respond with a 400 (Bad Request) status code and then close the connection
+        network_session* session = (network_session*)data_array[3];
+        if (session) {
+            http_response response;
+            response.get_http_header().add("Connection", "close");
+            response.compose(400);
+            response.respond(session);
+            session->shutdown();
+        }
+    } else if (errorcode_t::success == get_http_protocol().is_kind_of(buf, bufsize)) {  // HTTP/1.1
+        request.open(buf, bufsize, 0, cursor);
         dispatch_data[4] = &request;
     } else if (get_server_conf().get(netserver_config_t::serverconf_enable_h2)) {
         network_session* session = (network_session*)data_array[3];
@@ -243,7 +258,16 @@ return_t http_server::consume(uint32 type, uint32 data_count, void* data_array[]
      * HTTP/1.1 dispatch_data[4] not nullptr
      * HTTP/2   dispatch_data[4] can be nullptr - if END_HEADERS, END_STREAM is not set
      */
-    if (dispatch_data[4]) {
+    network_session* session = (network_session*)data_array[3];
+    http_request* req = (http_request*)dispatch_data[4];
+    if (req && session && session->is_early_data() && (false == is_safe_early_data(req))) {
+        // RFC 8470 5.2.  Using Early Data in HTTP Servers
+        //   A server that receives a request in early data can ... respond with a 425 (Too Early) status code
+        // the client retries after the handshake
+        http_response response(req);
+        response.compose(425);
+        response.respond(session);
+    } else if (req) {
         ret = _consumer(type, RTL_NUMBER_OF(dispatch_data), dispatch_data, callback_control, user_context);
     }
 
@@ -254,6 +278,12 @@ return_t http_server::consume(uint32 type, uint32 data_count, void* data_array[]
     return ret;
 }
 
+bool http_server::is_safe_early_data(http_request* request) {
+    // RFC 8470 4.  Server Behavior, the replay of a safe method (RFC 9110 9.2.1) does not change the state
+    std::string method = request->get_method();
+    return ("GET" == method) || ("HEAD" == method) || ("OPTIONS" == method);
+}
+
 network_server& http_server::get_network_server() { return _server; }
 
 server_conf& http_server::get_server_conf() { return _conf; }
@@ -103,6 +103,12 @@ class http_server {
      * @param   void* user_context [in]
      */
     return_t consume(uint32 type, uint32 data_count, void* data_array[], CALLBACK_CONTROL* callback_control, void* user_context);
+    /**
+     * @brief   TLS 1.3 0-RTT, a request replayed does no harm (GET, HEAD, OPTIONS)
+     * @param   http_request* request [in]
+     * @remarks see serverconf_tls_early_data, RFC 8470
+     */
+    bool is_safe_early_data(http_request* request);
 
    private:
     network_server _server;
@@ -68,6 +68,11 @@ http_server_builder &http_server_builder::set_tls_verify_peer(uint16 value) {
     return *this;
 }
 
+http_server_builder &http_server_builder::set_tls_early_data(uint16 max_early_data_size) {
+    get_server_conf().set(netserver_config_t::serverconf_tls_early_data, max_early_data_size);
+    return *this;
+}
+
 http_server_builder &http_server_builder::enable_ipv4(bool enable) {
     get_server_conf().set(netserver_config_t::serverconf_enable_ipv4, enable ? 1 : 0);
     return *this;
@@ -48,6 +48,13 @@ class http_server_builder {
     http_server_builder& set_tls_certificate(const std::string& server_cert, const std::string& server_key);
     http_server_builder& set_tls_cipher_list(const std::string& cipher_list);
     http_server_builder& set_tls_verify_peer(uint16 value);
+    /**
+     * @brief   TLS 1.3 0-RTT
+     * @param   uint16 max_early_data_size [in] 0 disabled
+     * @remarks
+     *          a request in the early data can be replayed, other than GET, HEAD, OPTIONS is answered 425 (Too Early), see RFC 8470
+     */
+    http_server_builder& set_tls_early_data(uint16 max_early_data_size);
 
     http_server_builder& enable_ipv4(bool enable);
     http_server_builder& enable_ipv6(bool enable);
@@ -12,6 +12,7 @@
 #ifndef __HOTPLACE_SDK_NET_HTTP_TYPES__
 #define __HOTPLACE_SDK_NET_HTTP_TYPES__
 
+#include <functional>
 #include <sdk/net/basic/tls/types.hpp>
 #include <sdk/net/basic/types.hpp>
 #include <sdk/net/server/types.hpp>
@@ -30,11 +31,13 @@ enum http_method_t {
 };
 
 // net/http
+class html_document;
 class html_documents;
 class http_authentication_provider;
 class http_authentication_resolver;
 class http_client;
 class http_header;
+class http_parser;
 class http_protocol;
 class http_request;
 class http_resource;
@@ -68,6 +71,36 @@ class http2_protocol;
 class http2_serverpush;
 class http2_session;
 
+/**
+ * @brief   body sink
+ * @param   network_session* session [in]
+ * @param   http_request* request [in] headers (the content is not buffered)
+ * @param   const byte_t* data [in] DATA payload
+ * @param   size_t size [in]
+ * @param   bool end_stream [in]
+ * @return  success - consumed, the flow-control window is released
+ *          pending - held until http2_session::acknowledge
+ *          otherwise the stream is reset (RST_STREAM CANCEL)
+ * @sa      http_router::add_sink
+ */
+typedef std::function<return_t(network_session*, http_request*, const byte_t*, size_t, bool)> http_body_sink_t;
+/**
+ * @brief   body producer (generated content)
+ * @param   binary_t& chunk [out] empty, the producer appends the next chunk
+ * @return  success - more chunks follow
+ *          no_more - the last chunk (may be empty)
+ *          otherwise the body ends
+ * @sa      http_response::compose
+ */
+typedef std::function<return_t(binary_t&)> http_body_producer_t;
+/**
+ * @brief   response callback (non-blocking client)
+ * @param   return_t result [in] success, otherwise the response is nullptr
+ * @param   http_response* response [in] released after the callback returns
+ * @sa      http_client::post
+ */
+typedef std::function<void(return_t, http_response*)> http_response_callback_t;
+
 // net/http/http3
 class qpack_encoder;
 class qpack_dynamic_table;
@@ -35,6 +35,27 @@ enum protocol_constraints_t {
     protocol_constraints_the_end,
 };
 
+/**
+ * @brief   resumable parse state of a message
+ * @remarks
+ *          kept per stream by network_stream, cleared after a message is complete
+ *          the meaning of each field is protocol specific (see http_parser)
+ */
+struct protocol_cursor_t {
+    uint32 phase;
+    uint32 flags;
+    size_t pos;    // parsed so far, offset from the start of the message
+    size_t value;  // protocol specific
+
+    protocol_cursor_t() : phase(0), flags(0), pos(0), value(0) {}
+    void clear() {
+        phase = 0;
+        flags = 0;
+        pos = 0;
+        value = 0;
+    }
+};
+
 /**
  * @brief   protocol interpreter
  */
@@ -56,12 +77,20 @@ class network_protocol {
     virtual return_t is_kind_of(void* stream, size_t stream_size) { return errorcode_t::success; }
     /**
      * @brief read stream
-     * @param   IBufferStream*      stream          [IN]
-     * @param   size_t*             request_size    [IN]
+     * @param   byte_t*             stream          [IN] parsed in place, followed by a null pad byte
+     * @param   size_t              stream_size     [IN]
+     * @param   size_t*             request_size    [OUT] size of the message
      * @param   protocol_state_t*   state           [OUT]
      * @param   int*                priority        [OUTOPT]
+     * @param   protocol_cursor_t*  cursor          [INOPT] resume where it stopped
+     * @remarks
+     *          protocol_state_complete - request_size is the size of the first message
+     *          protocol_state_header, protocol_state_data - if the size of the message is known, set request_size
+     *                                                       network_stream does not call read_stream until request_size bytes are received
      */
-    virtual return_t read_stream(basic_stream* stream, size_t* request_size, protocol_state_t* state, int* priority = nullptr) {
+    virtual return_t read_stream(byte_t* stream, size_t stream_size, size_t* request_size, protocol_state_t* state, int* priority = nullptr,
+                                 protocol_cursor_t* cursor = nullptr) {
+        *request_size = stream_size;
         *state = protocol_state_t::protocol_state_complete;
         return errorcode_t::success;
     }
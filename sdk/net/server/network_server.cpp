@@ -18,7 +18,9 @@
  * Date         Name                Description
  */
 
+#include <map>
 #include <queue>
+#include <vector>
 #include <sdk/base/system/signalwait_threads.hpp>
 #include <sdk/net/basic/socket/tcp_server_socket.hpp>
 #include <sdk/net/basic/socket/udp_server_socket.hpp>
@@ -32,6 +34,7 @@ namespace hotplace {
 namespace net {
 
 #define NETWORK_MULTIPLEXER_CONTEXT_SIGNATURE 0x20151127
+#define NETWORK_CONSUMER_BATCH 32
 
 struct accept_context_t {
     struct _network_multiplexer_context_t* mplexer_context;
@@ -44,6 +47,20 @@ struct accept_context_t {
 
 typedef std::queue<accept_context_t> accept_queue_t;
 
+struct handshake_context_t {
+    socket_t cli_socket;
+    sockaddr_storage_t client_addr;
+    tls_context_t* tls_handle;
+    bool busy;       /* a stale event of a reused descriptor must not run SSL_accept concurrently */
+    bool early_data; /* a session owns tls_handle, see tls_handshake_early_data */
+
+    handshake_context_t() : cli_socket(INVALID_SOCKET), tls_handle(nullptr), busy(false), early_data(false) {
+        memset(&client_addr, 0, sizeof(client_addr));
+    }
+};
+
+typedef std::map<socket_t, handshake_context_t> handshake_map_t;
+
 struct _network_multiplexer_context_t {
     uint32 signature;
 
@@ -65,15 +82,22 @@ struct _network_multiplexer_context_t {
     signalwait_threads consumer_threads;
 
     network_session_manager session_manager;
-    t_mlfq<network_session> event_queue;
+    t_sharded_mlfq<network_session> event_queue;
 
     network_protocol_group protocol_group;
 
     accept_queue_t accept_queue;
     critical_section accept_queue_lock;
 
+    handshake_map_t handshake_map; /* [epoll] tls handshake in progress */
+    critical_section handshake_lock;
+
     ACCEPT_CONTROL_CALLBACK_ROUTINE accept_control_handler;
 
+    std::vector<struct _network_multiplexer_context_t*> shards; /* serverconf_reuseport_shards, see open_shards */
+    int cpu;                                                    /* cpu affinity of the shard, -1 if not pinned */
+    server_conf* shard_conf;                                    /* shared by the shards, released in close */
+
     _network_multiplexer_context_t()
         : signature(0),
           mplexer_handle(nullptr),
@@ -82,9 +106,22 @@ struct _network_multiplexer_context_t {
           callback_param(nullptr),
           listen_sock(INVALID_SOCKET),
           svr_socket(nullptr),
-          accept_control_handler(nullptr) {}
+          accept_control_handler(nullptr),
+          cpu(-1),
+          shard_conf(nullptr) {}
 };
 
+#if defined __linux__
+static void pin_to_cpu(int cpu) {
+    if (cpu >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+    }
+}
+#endif
+
 network_server::network_server() {}
 
 network_server::~network_server() {}
@@ -103,6 +140,14 @@ return_t network_server::open(network_multiplexer_context_t** handle, unsigned i
             __leave2;
         }
 
+#if defined __linux__
+        uint16 shards = conf ? conf->get(netserver_config_t::serverconf_reuseport_shards) : 0;
+        if (shards > 1) {
+            ret = open_shards(handle, family, port, svr_socket, conf, callback_routine, callback_param, shards);
+            __leave2;
+        }
+#endif
+
         // TCP/TLS socket.stream-bind-listen
         // DTLS    socket.dgram-bind
         ret = svr_socket->open(&sock, family, port);
@@ -133,12 +178,27 @@ return_t network_server::open(network_multiplexer_context_t** handle, unsigned i
         typeof_socket(sock, socktype);
         if (SOCK_STREAM == socktype) {
 #if defined __linux__
+            uint16 edge_triggered = conf ? conf->get(netserver_config_t::serverconf_edge_triggered) : 0;
+            if (edge_triggered) {
+                // EPOLLEXCLUSIVE listen socket, a spurious wakeup must not block in accept
+                mplexer.setoption(mplexer_handle, multiplexer_option_t::mux_option_edge_triggered, 0);
+                set_sock_nbio(sock, 1);
+            }
             // (epoll) bind tcp.socket
             mplexer.bind(mplexer_handle, sock, nullptr);
 #endif
 #if defined _WIN32 || defined _WIN64
             // use dummy signal handler ... just call CloseListener first, and signal_and_wait_all
             context->accept_threads.set(1, accept_thread, signalwait_threads::dummy_signal, context);
+#endif
+        } else if (SOCK_DGRAM == socktype) {
+#if defined __linux__ && defined UDP_GRO
+            uint16 udp_gro = conf ? conf->get(netserver_config_t::serverconf_udp_gro) : 0;
+            if (udp_gro && (false == svr_socket->support_tls())) {
+                // DTLS reads a record per datagram, UDP only
+                int enable = 1;
+                setsockopt(sock, SOL_UDP, UDP_GRO, &enable, sizeof(enable));
+            }
 #endif
         }
 
@@ -156,7 +216,7 @@ return_t network_server::open(network_multiplexer_context_t** handle, unsigned i
 
         context->accept_control_handler = nullptr;
 
-        context->session_manager.set_server_conf(conf);  // serverconf_tcp_bufsize, server_udp_bufsize
+        context->session_manager.set_server_conf(conf);  // serverconf_tcp_bufsize, server_udp_bufsize, serverconf_udp_batch
 
         context->signature = NETWORK_MULTIPLEXER_CONTEXT_SIGNATURE;
 
@@ -164,11 +224,12 @@ return_t network_server::open(network_multiplexer_context_t** handle, unsigned i
 #if defined _WIN32 || defined _WIN64
             context->accept_threads.create();
             // (iocp) and then bind client socket after accept
-#endif
             if (svr_socket->support_tls()) {
                 // (tls) tls_accept
                 context->tls_accept_threads.create();
             }
+#endif
+            // (epoll) non-blocking handshake in network_routine, see tls_handshake_routine
         }
 
         svr_socket->addref();
@@ -194,6 +255,60 @@ return_t network_server::open(network_multiplexer_context_t** handle, unsigned i
     return ret;
 }
 
+#if defined __linux__
+return_t network_server::open_shards(network_multiplexer_context_t** handle, unsigned int family, uint16 port, server_socket* svr_socket,
+                                     server_conf* conf, TYPE_CALLBACK_HANDLEREXV callback_routine, void* callback_param, uint16 shards) {
+    // see open
+    return_t ret = errorcode_t::success;
+    network_multiplexer_context_t* context = nullptr;
+
+    __try2 {
+        __try_new_catch(context, new network_multiplexer_context_t, ret, __leave2);
+
+        // network_session_manager keeps the pointer, the shards read it until close
+        __try_new_catch(context->shard_conf, new server_conf(*conf), ret, __leave2);
+        context->shard_conf->set(netserver_config_t::serverconf_reuseport_shards, 0);
+
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        if (cpus < 1) {
+            cpus = 1;
+        }
+
+        // create_listener sets SO_REUSEPORT
+        for (uint16 i = 0; i < shards; i++) {
+            network_multiplexer_context_t* shard = nullptr;
+            ret = open(&shard, family, port, svr_socket, context->shard_conf, callback_routine, callback_param);
+            if (errorcode_t::success != ret) {
+                break;
+            }
+            shard->cpu = i % cpus;
+            context->shards.push_back(shard);
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        context->callback_routine = callback_routine;
+        context->callback_param = callback_param;
+        context->svr_socket = svr_socket;
+        context->signature = NETWORK_MULTIPLEXER_CONTEXT_SIGNATURE;
+
+        *handle = context;
+    }
+    __finally2 {
+        if ((errorcode_t::success != ret) && context) {
+            for (auto shard : context->shards) {
+                close(shard);
+            }
+            delete context->shard_conf;
+            delete context;
+        }
+    }
+
+    return ret;
+}
+#endif
+
 return_t network_server::set_accept_control_handler(network_multiplexer_context_t* handle, ACCEPT_CONTROL_CALLBACK_ROUTINE accept_control_handler) {
     return_t ret = errorcode_t::success;
 
@@ -206,6 +321,12 @@ return_t network_server::set_accept_control_handler(network_multiplexer_context_
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                set_accept_control_handler(shard, accept_control_handler);
+            }
+            __leave2;
+        }
 
         handle->accept_control_handler = accept_control_handler;
     }
@@ -228,6 +349,12 @@ return_t network_server::add_protocol(network_multiplexer_context_t* handle, net
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                ret = add_protocol(shard, protocol_ptr);
+            }
+            __leave2;
+        }
 
         ret = handle->protocol_group.add(protocol_ptr);
     }
@@ -250,6 +377,12 @@ return_t network_server::remove_protocol(network_multiplexer_context_t* handle,
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                ret = remove_protocol(shard, protocol_ptr);
+            }
+            __leave2;
+        }
 
         ret = handle->protocol_group.remove(protocol_ptr);
     }
@@ -272,6 +405,12 @@ return_t network_server::clear_protocols(network_multiplexer_context_t* handle)
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                clear_protocols(shard);
+            }
+            __leave2;
+        }
 
         ret = handle->protocol_group.clear();
     }
@@ -294,13 +433,21 @@ return_t network_server::tls_accept_loop_run(network_multiplexer_context_t* hand
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                tls_accept_loop_run(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
+#if defined _WIN32 || defined _WIN64
         server_socket* svr_socket = handle->svr_socket;
         if (svr_socket->support_tls()) {
             for (uint32 i = 0; i < concurrent_loop; i++) {
                 handle->tls_accept_threads.create();
             }
         }
+#endif
     }
     __finally2 {
         // do nothing
@@ -321,6 +468,12 @@ return_t network_server::tls_accept_loop_break(network_multiplexer_context_t* ha
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                tls_accept_loop_break(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
         for (uint32 i = 0; i < concurrent_loop; i++) {
             handle->tls_accept_threads.join();
@@ -345,6 +498,12 @@ return_t network_server::event_loop_run(network_multiplexer_context_t* handle, u
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                event_loop_run(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
         /* if a thread count of network_threads reachs max-concurrent, no more thread is created. */
         for (uint32 i = 0; i < concurrent_loop; i++) {
@@ -384,6 +543,12 @@ return_t network_server::event_loop_break(network_multiplexer_context_t* handle,
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                event_loop_break(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
         /* stop threads */
         uint32 i = 0;
@@ -410,6 +575,12 @@ return_t network_server::consumer_loop_run(network_multiplexer_context_t* handle
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                consumer_loop_run(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
         /* if a thread count of consumer_threads reachs max-concurrent, no more thread is created. */
         for (uint32 i = 0; i < concurrent_loop; i++) {
@@ -435,6 +606,12 @@ return_t network_server::consumer_loop_break(network_multiplexer_context_t* hand
             ret = errorcode_t::invalid_context;
             __leave2;
         }
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                consumer_loop_break(shard, concurrent_loop);
+            }
+            __leave2;
+        }
 
         /* stop threads */
         for (uint32 i = 0; i < concurrent_loop; i++) {
@@ -461,6 +638,16 @@ return_t network_server::close(network_multiplexer_context_t* handle) {
             __leave2;
         }
 
+        if (false == handle->shards.empty()) {
+            for (auto shard : handle->shards) {
+                close(shard);
+            }
+            delete handle->shard_conf;
+            handle->signature = 0;
+            delete handle;
+            __leave2;
+        }
+
         server_socket* svr_socket = handle->svr_socket;
         svr_socket->close(handle->listen_sock, nullptr);
 
@@ -468,9 +655,9 @@ return_t network_server::close(network_multiplexer_context_t* handle) {
 #if defined _WIN32 || defined _WIN64
         handle->accept_threads.signal_and_wait_all();
 #endif
-        cleanup_tls_accept(handle);
         handle->tls_accept_threads.signal_and_wait_all();
         handle->network_threads.signal_and_wait_all();
+        cleanup_tls_accept(handle); /* no more tls_accept_routine, tls_handshake_routine */
         handle->consumer_threads.signal_and_wait_all();
 
         handle->protocol_group.clear();
@@ -562,11 +749,16 @@ return_t network_server::accept_routine(network_multiplexer_context_t* handle) {
          */
 
         if (svr_socket->support_tls()) {
+#if defined __linux__
+            /* non-blocking handshake, resumed by network_routine */
+            svr.tls_handshake_start(handle, accpt_ctx.cli_socket, &accpt_ctx.client_addr);
+#else
             /* prepare for ssl_accept delay */
             {
                 critical_section_guard guard(handle->accept_queue_lock);
                 handle->accept_queue.push(accpt_ctx);
             }
+#endif
 
             svr.try_connected(handle, accpt_ctx.cli_socket, &accpt_ctx.client_addr);
         } else {
@@ -752,12 +944,23 @@ return_t network_server::cleanup_tls_accept(network_multiplexer_context_t* handl
             __leave2;
         }
 
-        accept_context_t accpt_ctx;
-        critical_section_guard guard(handle->accept_queue_lock);
-        if (false == handle->accept_queue.empty()) {
-            accpt_ctx = handle->accept_queue.front();
-            handle->accept_queue.pop();
-            close_socket(accpt_ctx.cli_socket, true, 0);
+        {
+            accept_context_t accpt_ctx;
+            critical_section_guard guard(handle->accept_queue_lock);
+            while (false == handle->accept_queue.empty()) {
+                accpt_ctx = handle->accept_queue.front();
+                handle->accept_queue.pop();
+                close_socket(accpt_ctx.cli_socket, true, 0);
+            }
+        }
+        {
+            critical_section_guard guard(handle->handshake_lock);
+            for (auto& pair : handle->handshake_map) {
+                if (false == pair.second.early_data) {
+                    handle->svr_socket->close(INVALID_SOCKET, pair.second.tls_handle); /* closesocket_ondestroy */
+                }
+            }
+            handle->handshake_map.clear();
         }
     }
     __finally2 {
@@ -766,6 +969,195 @@ return_t network_server::cleanup_tls_accept(network_multiplexer_context_t* handl
     return ret;
 }
 
+#if defined __linux__
+return_t network_server::tls_handshake_start(network_multiplexer_context_t* handle, socket_t cli_socket, sockaddr_storage_t* client_addr) {
+    // see accept_routine
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == handle || nullptr == client_addr) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        handshake_context_t hs_ctx;
+        hs_ctx.cli_socket = cli_socket;
+        memcpy(&hs_ctx.client_addr, client_addr, sizeof(hs_ctx.client_addr));
+
+        ret = handle->svr_socket->tls_accept_begin(hs_ctx.cli_socket, &hs_ctx.tls_handle);
+        if (errorcode_t::success != ret) {
+            close_socket(hs_ctx.cli_socket, true, 0);
+            __leave2;
+        }
+
+        {
+            critical_section_guard guard(handle->handshake_lock);
+            handle->handshake_map.insert(std::make_pair(hs_ctx.cli_socket, hs_ctx));
+        }
+
+        /* ClientHello */
+        ret = mplexer.bind_oneshot(handle->mplexer_handle, (handle_t)hs_ctx.cli_socket, SOCK_WAIT_READABLE);
+        if (errorcode_t::success != ret) {
+            {
+                critical_section_guard guard(handle->handshake_lock);
+                handle->handshake_map.erase(hs_ctx.cli_socket);
+            }
+            handle->svr_socket->close(INVALID_SOCKET, hs_ctx.tls_handle); /* closesocket_ondestroy */
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t network_server::tls_handshake_routine(network_multiplexer_context_t* handle, socket_t cli_socket) {
+    // see network_routine
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == handle) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        bool busy = false;
+        handshake_context_t hs_ctx;
+        {
+            critical_section_guard guard(handle->handshake_lock);
+            handshake_map_t::iterator iter = handle->handshake_map.find(cli_socket);
+            if (handle->handshake_map.end() == iter) {
+                ret = errorcode_t::not_found;
+            } else {
+                busy = iter->second.busy;
+                iter->second.busy = true;
+                hs_ctx = iter->second;
+            }
+        }
+
+        if ((errorcode_t::success != ret) || busy) {
+            __leave2; /* the other thread re-arms */
+        }
+
+        /* EPOLLONESHOT, no other network thread handles this socket until re-armed */
+        uint32 wait = 0;
+        return_t test = handle->svr_socket->tls_accept_continue(hs_ctx.tls_handle, &wait);
+        if (((errorcode_t::success == test) || (errorcode_t::pending == test)) &&
+            (errorcode_t::success == tls_handshake_early_data(handle, cli_socket))) {
+            hs_ctx.early_data = true;
+        }
+        if (errorcode_t::pending == test) {
+            {
+                critical_section_guard guard(handle->handshake_lock);
+                handshake_map_t::iterator iter = handle->handshake_map.find(cli_socket);
+                if (handle->handshake_map.end() != iter) {
+                    iter->second.busy = false;
+                }
+            }
+            test = mplexer.bind_oneshot(handle->mplexer_handle, (handle_t)cli_socket, wait);
+            if (errorcode_t::success == test) {
+                __leave2;
+            }
+
+            critical_section_guard guard(handle->handshake_lock);
+            handshake_map_t::iterator iter = handle->handshake_map.find(cli_socket);
+            if ((handle->handshake_map.end() == iter) || iter->second.busy) {
+                __leave2;
+            }
+            iter->second.busy = true;
+        }
+
+        {
+            critical_section_guard guard(handle->handshake_lock);
+            handle->handshake_map.erase(cli_socket);
+        }
+
+        mplexer.unbind(handle->mplexer_handle, (handle_t)cli_socket, nullptr);
+        if (errorcode_t::success == test) {
+            session_accepted(handle, hs_ctx.tls_handle, (handle_t)cli_socket, &hs_ctx.client_addr);
+            /* tls_handle is release in session_closed member. */
+        } else if (hs_ctx.early_data) {
+            session_closed(handle, (handle_t)cli_socket); /* the session releases tls_handle */
+        } else {
+            handle->svr_socket->close(INVALID_SOCKET, hs_ctx.tls_handle); /* closesocket_ondestroy */
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t network_server::tls_handshake_early_data(network_multiplexer_context_t* handle, socket_t cli_socket) {
+    // see tls_handshake_routine
+    return_t ret = errorcode_t::success;
+    network_session* session_object = nullptr;
+
+    __try2 {
+        handshake_context_t hs_ctx;
+        {
+            critical_section_guard guard(handle->handshake_lock);
+            handshake_map_t::iterator iter = handle->handshake_map.find(cli_socket);
+            if (handle->handshake_map.end() == iter) {
+                ret = errorcode_t::not_found;
+            } else {
+                hs_ctx = iter->second;
+            }
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        binary_t early_data;
+        ret = handle->svr_socket->tls_accept_early_data(hs_ctx.tls_handle, early_data);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        if (hs_ctx.early_data) {
+            ret = handle->session_manager.find((handle_t)cli_socket, &session_object); /* reference increased, call release later */
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+        } else {
+            /* not bound to the multiplexer until the handshake completes, see session_accepted */
+            ret = handle->session_manager.connected((handle_t)cli_socket, &hs_ctx.client_addr, handle->svr_socket, hs_ctx.tls_handle, &session_object);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+            session_object->addref();
+            session_object->_handshake = true; /* the sends are queued, see network_session::handshake_finished */
+
+            {
+                critical_section_guard guard(handle->handshake_lock);
+                handshake_map_t::iterator iter = handle->handshake_map.find(cli_socket);
+                if (handle->handshake_map.end() != iter) {
+                    iter->second.early_data = true;
+                }
+            }
+
+            void* dispatch_data[4] = {
+                nullptr,
+            };
+            dispatch_data[0] = (void*)session_object->socket_info();
+            handle->callback_routine(multiplexer_event_type_t::mux_connect, 4, dispatch_data, nullptr, handle->callback_param);
+        }
+
+        /* consumer_routine dispatches the early data (mux_read), see network_session::is_early_data */
+        ret = session_object->produce_early_data(&handle->event_queue, early_data);
+    }
+    __finally2 {
+        if (session_object) {
+            session_object->release(); /* find, refcount-- */
+        }
+    }
+
+    return ret;
+}
+#endif
+
 return_t network_server::network_thread(void* user_context) {
     return_t ret = errorcode_t::success;
     network_multiplexer_context_t* handle = reinterpret_cast<network_multiplexer_context_t*>(user_context);
@@ -780,8 +1172,15 @@ return_t network_server::network_thread(void* user_context) {
             __leave2;
         }
 
+#if defined __linux__
+        pin_to_cpu(handle->cpu);
+#endif
+
         network_server svr;
         ret = svr.mplexer.event_loop_run(handle->mplexer_handle, (handle_t)handle->listen_sock, network_routine, handle);
+#if defined __linux__
+        handle->svr_socket->tls_stop_accept(); /* SSL_accept runs on network threads, see tls_handshake_routine */
+#endif
     }
     __finally2 {
         // do nothing
@@ -807,7 +1206,16 @@ return_t network_server::network_routine(uint32 type, uint32 data_count, void* d
 
         network_session* session_object = nullptr;
         ret = context->session_manager.find(sockcli, &session_object); /* reference increased, call release later */
-        if (errorcode_t::success == ret) {
+        if ((errorcode_t::success == ret) && session_object->is_handshaking()) {
+            /* 0-RTT, the session is made before the handshake completes, see tls_handshake_early_data */
+            session_object->release();
+            ret = errorcode_t::pending;
+        }
+        if ((errorcode_t::success != ret) && (errorcode_t::success == svr.tls_handshake_routine(context, sockcli))) {
+            if (callback_control) {
+                *callback_control = STOP_CONTROL; /* EPOLLONESHOT, see bind_oneshot */
+            }
+        } else if (errorcode_t::success == ret) {
             /* consumer_routine (decrease), close_if_not_referenced (delete) */
             ret = session_object->produce(&context->event_queue, nullptr, 0);
 
@@ -817,7 +1225,41 @@ return_t network_server::network_routine(uint32 type, uint32 data_count, void* d
                 // do nothing
             } else {
                 svr.session_closed(context, sockcli); /* call session_object->release() inside of closed */
+                if (callback_control) {
+                    *callback_control = STOP_CONTROL; /* EPOLLONESHOT, do not re-arm */
+                }
             }
+        } else if (callback_control) {
+            *callback_control = STOP_CONTROL;
+        }
+    } else if (multiplexer_event_type_t::mux_write == type) {
+        int sockcli = (int)(long)data_array[1];
+
+        network_session* session_object = nullptr;
+        ret = context->session_manager.find(sockcli, &session_object); /* reference increased, call release later */
+        if ((errorcode_t::success == ret) && session_object->is_handshaking()) {
+            session_object->release();
+            ret = errorcode_t::pending;
+        }
+        if (errorcode_t::success == ret) {
+            /* the send buffer is drained, see network_session::send */
+            ret = session_object->writable();
+            session_object->release(); /* find, refcount-- */
+            if (errorcode_t::success != ret) {
+                svr.session_closed(context, sockcli);
+            }
+        } else {
+            /* SSL_ERROR_WANT_WRITE */
+            svr.tls_handshake_routine(context, sockcli);
+        }
+        if (callback_control) {
+            *callback_control = STOP_CONTROL;
+        }
+    } else if (multiplexer_event_type_t::mux_disconnect == type) {
+        /* EPOLLHUP, EPOLLERR without EPOLLIN */
+        int sockcli = (int)(long)data_array[1];
+        if (errorcode_t::success != svr.tls_handshake_routine(context, sockcli)) {
+            svr.session_closed(context, sockcli);
         }
     } else if (multiplexer_event_type_t::mux_dgram == type) {
         network_session* dgram_session = nullptr;
@@ -841,7 +1283,6 @@ return_t network_server::network_routine(uint32 type, uint32 data_count, void* d
             dgram_session->release(); /* find, refcount-- */
         }
     }
-    // else if (multiplexer_event_type_t::mux_disconnect == type) /* no event catchable */
 
 #elif defined _WIN32 || defined _WIN64
 
@@ -909,17 +1350,20 @@ return_t network_server::consumer_thread(void* user_context) {
             __leave2;
         }
 
+#if defined __linux__
+        pin_to_cpu(handle->cpu);
+#endif
+
         network_server svr;
         uint32 ret_wait = 0;
 
         while (true) {
-            unsigned cooltime = handle->event_queue.size() ? 1 : 100;
-            ret_wait = handle->consumer_mutex.wait(cooltime);
+            svr.consumer_routine(handle); /* blocked until network_routine posts or consumer_signal */
+
+            ret_wait = handle->consumer_mutex.wait(0);
             if (0 == ret_wait) {
                 break;
             }
-
-            svr.consumer_routine(handle);
         }
     }
     __finally2 {
@@ -932,42 +1376,47 @@ return_t network_server::consumer_thread(void* user_context) {
 return_t network_server::consumer_routine(network_multiplexer_context_t* handle) {
     // see consumer_thread
     return_t ret = errorcode_t::success;
+    int priority = 0;
+    network_session* session_object = nullptr;
 
-    if (handle->event_queue.size()) {
-        int priority = 0;
-        network_session* session_object = nullptr;
-        ret = handle->event_queue.pop(&priority, &session_object, 1);  // session priority
-        if (errorcode_t::success == ret) {
-            // re-order by stream priority
-            network_stream_data* buffer_object = nullptr;
-            session_object->consume(&handle->protocol_group, &buffer_object);  // set stream priority while processing network_protocol::read_stream
-            sockaddr_storage_t addr;
-
-            while (buffer_object) {
-                buffer_object->get_sockaddr(&addr);
-
-                void* dispatch_data[6] = {
-                    nullptr,
-                };
-                dispatch_data[0] = session_object->socket_info(); /* netserver_cb_type_t::netserver_cb_socket */
-                dispatch_data[1] = buffer_object->content();      /* netserver_cb_type_t::netserver_cb_dataptr */
-                dispatch_data[2] = (void*)buffer_object->size();  /* netserver_cb_type_t::netserver_cb_datasize */
-                dispatch_data[3] = session_object;                /* netserver_cb_type_t::netserver_cb_session */
-                dispatch_data[5] = &addr;                         /* netserver_cb_type_t::netserver_cb_sockaddr */
-
-                int socktype = session_object->get_server_socket()->socket_type();
-                auto muxtype = (SOCK_STREAM == socktype) ? multiplexer_event_type_t::mux_read : multiplexer_event_type_t::mux_dgram;
-                handle->callback_routine(muxtype, RTL_NUMBER_OF(dispatch_data), dispatch_data, nullptr, handle->callback_param);
-
-                network_stream_data* temp = buffer_object;
-                buffer_object = buffer_object->next();
-                temp->release();
-            }
+    /* a post signals the semaphore once, so exactly one consumer wakes up per session */
+    ret = handle->event_queue.pop(&priority, &session_object, (uint32)-1);  // session priority
 
-            session_object->release();
+    /* drain in batches without sleeping */
+    for (uint32 batch = 0; errorcode_t::success == ret;) {
+        // re-order by stream priority
+        network_stream_data* buffer_object = nullptr;
+        session_object->consume(&handle->protocol_group, &buffer_object);  // set stream priority while processing network_protocol::read_stream
+        sockaddr_storage_t addr;
+
+        while (buffer_object) {
+            buffer_object->get_sockaddr(&addr);
+
+            void* dispatch_data[7] = {
+                nullptr,
+            };
+            dispatch_data[0] = session_object->socket_info();      /* netserver_cb_type_t::netserver_cb_socket */
+            dispatch_data[1] = buffer_object->content();           /* netserver_cb_type_t::netserver_cb_dataptr */
+            dispatch_data[2] = (void*)buffer_object->size();       /* netserver_cb_type_t::netserver_cb_datasize */
+            dispatch_data[3] = session_object;                     /* netserver_cb_type_t::netserver_cb_session */
+            dispatch_data[5] = &addr;                              /* netserver_cb_type_t::netserver_cb_sockaddr */
+            dispatch_data[6] = (void*)buffer_object->get_cursor(); /* netserver_cb_type_t::netserver_cb_cursor */
+
+            int socktype = session_object->get_server_socket()->socket_type();
+            auto muxtype = (SOCK_STREAM == socktype) ? multiplexer_event_type_t::mux_read : multiplexer_event_type_t::mux_dgram;
+            handle->callback_routine(muxtype, RTL_NUMBER_OF(dispatch_data), dispatch_data, nullptr, handle->callback_param);
+
+            network_stream_data* temp = buffer_object;
+            buffer_object = buffer_object->next();
+            temp->release();
+        }
+
+        session_object->release();
+
+        if (++batch >= NETWORK_CONSUMER_BATCH) {
+            break;
         }
-    } else {
-        msleep(10);
+        ret = handle->event_queue.pop(&priority, &session_object, 0);
     }
 
     return ret;
@@ -983,6 +1432,7 @@ return_t network_server::consumer_signal(void* user_context) {
             __leave2;
         }
         handle->consumer_mutex.signal();
+        handle->event_queue.wakeup(); /* a consumer blocked in consumer_routine */
     }
     __finally2 {
         // do nothing
@@ -1006,24 +1456,46 @@ return_t network_server::session_accepted(network_multiplexer_context_t* handle,
             __leave2;
         }
 
-        network_session* session_object;
+        network_session* session_object = nullptr;
+        bool early_data = false;
         ret = handle->session_manager.connected(event_socket, client_addr, handle->svr_socket, tls_handle, &session_object);
+#if defined __linux__
+        if ((errorcode_t::already_assigned == ret) && tls_handle) {
+            /* TLS 1.3 0-RTT, the session is made before the handshake completes, see tls_handshake_early_data */
+            ret = handle->session_manager.find(event_socket, &session_object); /* reference increased, call release later */
+            early_data = true;
+        }
+#endif
         if (errorcode_t::success != ret) {
             __leave2;
         }
 
+#if defined __linux__
+        /* a full send buffer returns EAGAIN (sendfile), the rest is sent on mux_write, see network_session::writable */
+        set_sock_nbio((socket_t)event_socket, 1);
+#endif
         /* associate with multiplex object (iocp, epoll) */
+        session_object->_session.mplexer_handle = handle->mplexer_handle; /* see network_session::writable */
+#if defined __linux__
+        if (early_data) {
+            session_object->handshake_finished(); /* the responses to the early data, is_handshaking is false before bind */
+        }
+#endif
         mplexer.bind(handle->mplexer_handle, event_socket, session_object);
 #if defined _WIN32 || defined _WIN64
         /* asynchronous */
         session_object->ready_to_read();
 #endif
 
-        void* dispatch_data[4] = {
-            nullptr,
-        };
-        dispatch_data[0] = (void*)session_object->socket_info();
-        handle->callback_routine(multiplexer_event_type_t::mux_connect, 4, dispatch_data, nullptr, handle->callback_param);
+        if (early_data) {
+            session_object->release(); /* find, refcount-- */
+        } else {
+            void* dispatch_data[4] = {
+                nullptr,
+            };
+            dispatch_data[0] = (void*)session_object->socket_info();
+            handle->callback_routine(multiplexer_event_type_t::mux_connect, 4, dispatch_data, nullptr, handle->callback_param);
+        }
     }
     __finally2 {
         // do nothing
@@ -1052,6 +1524,9 @@ return_t network_server::session_closed(network_multiplexer_context_t* handle, h
         if (errorcode_t::success == ret) {
             /* no more associated, control_delete */
             mplexer.unbind(handle->mplexer_handle, session_object->socket_info()->event_socket, nullptr);
+#if defined __linux__
+            session_object->close_writable();
+#endif
 
             void* dispatch_data[4] = {
                 nullptr,
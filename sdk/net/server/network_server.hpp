@@ -23,7 +23,7 @@ namespace net {
 enum netserver_config_t {
     /* network_server */
     serverconf_concurrent_event = 1,       // epoll
-    serverconf_concurrent_tls_accept = 2,  // max number of tls_accept thread
+    serverconf_concurrent_tls_accept = 2,  // max number of tls_accept thread (iocp), epoll handshakes on network threads
     serverconf_concurrent_network = 3,     // max number of network thread (producer)
     serverconf_concurrent_consume = 4,     // max number of consume thread (consumer)
 
@@ -41,6 +41,15 @@ enum netserver_config_t {
 
     serverconf_tcp_bufsize = 15,
     serverconf_udp_bufsize = 16,
+
+    /* network_server */
+    serverconf_edge_triggered = 17,    // [epoll] EPOLLET|EPOLLONESHOT, see multiplexer_option_t
+    serverconf_udp_batch = 18,         // [linux] datagrams per recvmmsg (0 default 32, 1 recvfrom), see network_session::produce_dgram
+    serverconf_udp_gro = 19,           // [linux] UDP_GRO (UDP only, not DTLS), coalesced segments are split in network_session::produce_dgram
+    serverconf_reuseport_shards = 20,  // [linux] SO_REUSEPORT listeners, each with its own epoll, session manager and threads, see open_shards
+
+    /* http_server */
+    serverconf_tls_early_data = 21,  // [epoll] TLS 1.3 0-RTT max_early_data_size (0 disabled), see transport_layer_security::enable_early_data
 };
 
 class server_conf : public t_key_value<netserver_config_t, uint16> {
@@ -56,6 +65,7 @@ enum netserver_cb_type_t {
     netserver_cb_session = 3,       // network_session*
     netserver_cb_http_request = 4,  // http_request*
     netserver_cb_sockaddr = 5,      // sockaddr_storage_t*, udp client address
+    netserver_cb_cursor = 6,        // protocol_cursor_t*, the parse state of the message (network_protocol::read_stream)
 };
 
 typedef return_t (*ACCEPT_CONTROL_CALLBACK_ROUTINE)(socket_t socket, sockaddr_storage_t* client_addr, CALLBACK_CONTROL* control, void* parameter);
@@ -137,6 +147,8 @@ class network_server {
      *          serverconf_concurrent_tls_accept    default 1
      *          serverconf_concurrent_network       default 1
      *          serverconf_concurrent_consume       default 2
+     *          serverconf_edge_triggered           default 0
+     *          serverconf_reuseport_shards         default 0 (a single listener)
      * @param   TYPE_CALLBACK_HANDLEREXV    callback_routine    [IN] callback
      *            return_t (*TYPE_CALLBACK_HANDLEREXV)
      *                         (uint32 type, uint32 count, void* data[], CALLBACK_CONTROL* control, void* parameter);
@@ -158,6 +170,8 @@ class network_server {
      *                equivalant data_array[netserver_cb_type_t::netserver_cb_session]
      *              data_array[5] sockaddr_storage_t*
      *                equivalant data_array[netserver_cb_type_t::netserver_cb_sockaddr]
+     *              data_array[6] protocol_cursor_t* (mux_read)
+     *                equivalant data_array[netserver_cb_type_t::netserver_cb_cursor]
      *
      *            parameter 4
      *              CALLBACK_CONTROL* is always null
@@ -177,6 +191,9 @@ class network_server {
      * @remarks
      *          It'll be automatically created 1 tls_accept_thread, if server_socketis an instance of tls_server_socket class.
      *          see tls_accept_loop_run/tls_accept_loop_break
+     *          [epoll] no tls_accept_thread, the network threads run non-blocking handshakes (see tls_handshake_routine)
+     *          [linux] serverconf_reuseport_shards > 1, see open_shards
+     *                  the thread counts of *_loop_run/*_loop_break and serverconf_concurrent_* apply to each shard
      */
     return_t open(network_multiplexer_context_t** handle, unsigned int family, uint16 port, server_socket* svr_socket, server_conf* conf,
                   TYPE_CALLBACK_HANDLEREXV callback_routine, void* callback_param);
@@ -282,6 +299,21 @@ class network_server {
     return_t close(network_multiplexer_context_t* handle);
 
    protected:
+#if defined __linux__
+    /**
+     * @brief   [linux] SO_REUSEPORT multi-listener
+     * @param   network_multiplexer_context_t** handle [out]
+     * @param   uint16 shards [in] serverconf_reuseport_shards
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          bind N listeners on the same port, the kernel distributes connections (datagrams) by the hash of 4-tuple
+     *          each shard has its own listen socket, multiplexer, session manager, event queue and threads
+     *          the network and consumer threads of a shard are pinned to a cpu (shard index % number of cpus)
+     *          the handle fans out to the shards, a session never moves across the shards (shared-nothing)
+     */
+    return_t open_shards(network_multiplexer_context_t** handle, unsigned int family, uint16 port, server_socket* svr_socket, server_conf* conf,
+                         TYPE_CALLBACK_HANDLEREXV callback_routine, void* callback_param, uint16 shards);
+#endif
     /**
      * @brief   tcp accept
      * @return  error code (see error.hpp)
@@ -310,8 +342,43 @@ class network_server {
     /**
      * @brief   stop tls_accept
      * @return  error code (see error.hpp)
+     * @remarks
+     *          close sockets waiting for tls_accept_routine and tls_handshake_routine
      */
     return_t cleanup_tls_accept(network_multiplexer_context_t* handle);
+#if defined __linux__
+    /**
+     * @brief   [epoll] begin a non-blocking tls handshake
+     * @param   network_multiplexer_context_t* handle [in]
+     * @param   socket_t cli_socket [in]
+     * @param   sockaddr_storage_t* client_addr [in]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          wait for ClientHello (see multiplexer_epoll::bind_oneshot)
+     */
+    return_t tls_handshake_start(network_multiplexer_context_t* handle, socket_t cli_socket, sockaddr_storage_t* client_addr);
+    /**
+     * @brief   [epoll] resume a tls handshake on readiness
+     * @param   network_multiplexer_context_t* handle [in]
+     * @param   socket_t cli_socket [in]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_found  not in handshake
+     * @remarks
+     *          re-arm while SSL_accept wants to read or write, session_accepted when finished
+     */
+    return_t tls_handshake_routine(network_multiplexer_context_t* handle, socket_t cli_socket);
+    /**
+     * @brief   [epoll] TLS 1.3 0-RTT, consume the early data before the handshake completes
+     * @param   network_multiplexer_context_t* handle [in]
+     * @param   socket_t cli_socket [in]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_found  no early data
+     * @remarks
+     *          the session is made (mux_connect) and the early data is dispatched (mux_read, network_session::is_early_data)
+     *          the session is bound to the multiplexer and sends the queued data after the handshake, see session_accepted
+     */
+    return_t tls_handshake_early_data(network_multiplexer_context_t* handle, socket_t cli_socket);
+#endif
 
     /**
      * @brief   read packet and compose a request
@@ -341,7 +408,12 @@ class network_server {
      * @return  error code (see error.hpp)
      */
     static return_t consumer_thread(void* user_context);
-
+    /**
+     * @brief   wait for a session posted by network_routine and dispatch
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          blocks on the event queue semaphore (no polling), then drains up to NETWORK_CONSUMER_BATCH sessions
+     */
     return_t consumer_routine(network_multiplexer_context_t* handle);
 
     // signal ... see signal_wait_threads, signalwait_thread_routine
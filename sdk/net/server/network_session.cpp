@@ -22,13 +22,51 @@ network_session::network_session(server_socket* serversocket) {
     _shared.make_share(this);
     serversocket->addref();
     _session.svr_socket = serversocket;
+    _early_data = false;
+    _early_data_ready = false;
+#if defined __linux__
+    _send_event = -1;
+    _send_shutdown = false;
+    _send_closed = false;
+    _handshake = false;
+#endif
 }
 
 network_session::~network_session() {
+#if defined __linux__
+    for (auto& item : _send_queue) {
+        if (-1 != item.file) {
+            ::close(item.file);
+        }
+    }
+    if (-1 != _send_event) {
+        ::close(_send_event);
+    }
+#endif
     get_server_socket()->close((socket_t)_session.netsock.event_socket, _session.tls_handle);
     get_server_socket()->release();
 }
 
+typedef t_object_pool<sizeof(network_session)> network_session_pool_t;
+
+void* network_session::operator new(size_t size) {
+    void* ptr = (sizeof(network_session) == size) ? network_session_pool_t::get_instance().alloc() : malloc(size);
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void network_session::operator delete(void* ptr, size_t size) {
+    if (sizeof(network_session) == size) {
+        network_session_pool_t::get_instance().free(ptr);
+    } else {
+        free(ptr);
+    }
+}
+
+void network_session::get_pool_stat(object_pool_stat_t* stat) { network_session_pool_t::get_instance().get_stat(stat); }
+
 return_t network_session::connected(handle_t event_socket, sockaddr_storage_t* sockaddr, tls_context_t* tls_handle) {
     return_t ret = errorcode_t::success;
 
@@ -129,8 +167,20 @@ return_t network_session::send(const char* data_ptr, size_t size_data) {
             ret = errorcode_t::invalid_parameter;
             __leave2;
         }
+#if defined __linux__
+        critical_section_guard guard(_send_lock);
+        if ((false == _send_queue.empty()) || _handshake) {
+            ret = queue_send(data_ptr, size_data); /* in order */
+            __leave2;
+        }
+#endif
         size_t cbsent = 0;
         ret = get_server_socket()->send((socket_t)_session.netsock.event_socket, _session.tls_handle, data_ptr, size_data, &cbsent);
+#if defined __linux__
+        if (errorcode_t::pending == ret) {
+            ret = queue_send(data_ptr + cbsent, size_data - cbsent);
+        }
+#endif
     }
     __finally2 {
         // do nothing
@@ -140,6 +190,258 @@ return_t network_session::send(const char* data_ptr, size_t size_data) {
 
 return_t network_session::send(const byte_t* data_ptr, size_t size_data) { return send((char*)data_ptr, size_data); }
 
+return_t network_session::sendv(const sendbuf_t* bufs, size_t count) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if ((nullptr == bufs) && count) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+#if defined __linux__
+        critical_section_guard guard(_send_lock);
+        size_t cbsent = 0;
+        if (_send_queue.empty() && (false == _handshake)) {
+            ret = get_server_socket()->sendv((socket_t)_session.netsock.event_socket, _session.tls_handle, bufs, count, &cbsent);
+            if (errorcode_t::pending != ret) {
+                __leave2;
+            }
+            ret = errorcode_t::success;
+        }
+
+        // the rest in a piece
+        std::vector<char> rest;
+        for (size_t i = 0; i < count; i++) {
+            size_t skip = (cbsent < bufs[i].size) ? cbsent : bufs[i].size;
+            cbsent -= skip;
+            rest.insert(rest.end(), bufs[i].ptr + skip, bufs[i].ptr + bufs[i].size);
+        }
+        if (false == rest.empty()) {
+            ret = queue_send(&rest[0], rest.size());
+        }
+#else
+        size_t cbsent = 0;
+        ret = get_server_socket()->sendv((socket_t)_session.netsock.event_socket, _session.tls_handle, bufs, count, &cbsent);
+#endif
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t network_session::sendfile(handle_t fd, uint64 offset, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+#if defined __linux__
+        critical_section_guard guard(_send_lock);
+        if ((false == _send_queue.empty()) || _handshake) {
+            ret = queue_sendfile(fd, offset, size);
+            __leave2;
+        }
+#endif
+        size_t cbsent = 0;
+        ret = get_server_socket()->sendfile((socket_t)_session.netsock.event_socket, _session.tls_handle, fd, offset, size, &cbsent);
+#if defined __linux__
+        if (errorcode_t::pending == ret) {
+            ret = queue_sendfile(fd, offset + cbsent, size - cbsent);
+        }
+#endif
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t network_session::shutdown() {
+    return_t ret = errorcode_t::success;
+#if defined __linux__
+    {
+        critical_section_guard guard(_send_lock);
+        if ((false == _send_queue.empty()) || _handshake) {
+            _send_shutdown = true; /* see writable */
+            return ret;
+        }
+    }
+    int rc = ::shutdown((socket_t)_session.netsock.event_socket, SHUT_RDWR);
+#elif defined _WIN32 || defined _WIN64
+    int rc = ::shutdown((socket_t)_session.netsock.event_socket, SD_BOTH);
+#endif
+    if (rc < 0) {
+        ret = get_lasterror(rc);
+    }
+    return ret;
+}
+
+#if defined __linux__
+return_t network_session::queue_send(const char* data_ptr, size_t size_data) {
+    // _send_lock
+    return_t ret = errorcode_t::success;
+    if (size_data) {
+        bool armed = (false == _send_queue.empty());
+        _send_queue.push_back(pending_send_t());
+        _send_queue.back().data.assign(data_ptr, data_ptr + size_data);
+        if ((false == armed) && (false == _handshake)) {
+            ret = wait_writable();
+        }
+    }
+    return ret;
+}
+
+return_t network_session::queue_sendfile(handle_t fd, uint64 offset, size_t size) {
+    // _send_lock
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (0 == size) {
+            __leave2;
+        }
+        // the caller may close (or the cache may evict) the file after return
+        int file = ::dup(fd);
+        if (-1 == file) {
+            ret = get_lasterror(file);
+            __leave2;
+        }
+        bool armed = (false == _send_queue.empty());
+        _send_queue.push_back(pending_send_t());
+        pending_send_t& item = _send_queue.back();
+        item.file = file;
+        item.offset = offset;
+        item.size = size;
+        if ((false == armed) && (false == _handshake)) {
+            ret = wait_writable();
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t network_session::wait_writable() {
+    // _send_lock
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (_send_closed) {
+            ret = errorcode_t::closed;
+            __leave2;
+        }
+        socket_t sock = (socket_t)_session.netsock.event_socket;
+        if (-1 == _send_event) {
+            _send_event = ::dup(sock);
+            if (-1 == _send_event) {
+                ret = get_lasterror(_send_event);
+                __leave2;
+            }
+        }
+        multiplexer_epoll mplexer;
+        ret = mplexer.bind_writable((multiplexer_context_t*)_session.mplexer_handle, (handle_t)_send_event, (handle_t)sock);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t network_session::writable() {
+    return_t ret = errorcode_t::success;
+    critical_section_guard guard(_send_lock);
+
+    socket_t sock = (socket_t)_session.netsock.event_socket;
+    while (false == _send_queue.empty()) {
+        pending_send_t& item = _send_queue.front();
+        size_t cbsent = 0;
+        if (-1 == item.file) {
+            ret = get_server_socket()->send(sock, _session.tls_handle, &item.data[item.pos], item.data.size() - item.pos, &cbsent);
+            item.pos += cbsent;
+        } else {
+            ret = get_server_socket()->sendfile(sock, _session.tls_handle, (handle_t)item.file, item.offset, item.size, &cbsent);
+            item.offset += cbsent;
+            item.size -= cbsent;
+        }
+        if (errorcode_t::pending == ret) {
+            ret = wait_writable();
+            break;
+        } else if (errorcode_t::success != ret) {
+            break;
+        }
+        if (-1 != item.file) {
+            ::close(item.file);
+        }
+        _send_queue.pop_front();
+    }
+
+    if (_send_queue.empty() && _send_shutdown) {
+        _send_shutdown = false;
+        ::shutdown(sock, SHUT_RDWR);
+    }
+    return ret;
+}
+
+return_t network_session::produce_early_data(t_sharded_mlfq<network_session>* q, const binary_t& data) {
+    return_t ret = errorcode_t::success;
+    critical_section_guard guard(_lock);
+
+    __try2 {
+        if (nullptr == q) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+        if (data.empty()) {
+            __leave2;
+        }
+
+        getstream()->produce((byte_t*)&data[0], data.size());
+        _early_data_ready = true;
+
+        if (istraceable()) {
+            basic_stream bs;
+            bs << "[ns] early data " << (socket_t)_session.netsock.event_socket << "\n";
+            dump_memory(data, &bs, 16, 2, 0, dump_notrunc);
+            trace_debug_event(category_net, net_event_netsession_produce, &bs);
+        }
+
+        q->push(get_priority(), this);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+bool network_session::is_handshaking() {
+    if (nullptr == _session.tls_handle) {
+        return false;
+    }
+    critical_section_guard guard(_send_lock);
+    return _handshake;
+}
+
+return_t network_session::handshake_finished() {
+    return_t ret = errorcode_t::success;
+    critical_section_guard guard(_send_lock);
+    if (_handshake) {
+        _handshake = false;
+        if ((false == _send_queue.empty()) || _send_shutdown) {
+            ret = wait_writable(); /* see writable */
+        }
+    }
+    return ret;
+}
+
+void network_session::close_writable() {
+    critical_section_guard guard(_send_lock);
+    _send_closed = true;
+    if (-1 != _send_event) {
+        multiplexer_epoll mplexer;
+        mplexer.unbind((multiplexer_context_t*)_session.mplexer_handle, (handle_t)_send_event, nullptr);
+        ::close(_send_event);
+        _send_event = -1;
+    }
+}
+#endif
+
 return_t network_session::sendto(const char* data_ptr, size_t size_data, sockaddr_storage_t* addr) {
     return_t ret = errorcode_t::success;
 
@@ -160,6 +462,35 @@ return_t network_session::sendto(const char* data_ptr, size_t size_data, sockadd
 
 return_t network_session::sendto(const byte_t* data_ptr, size_t size_data, sockaddr_storage_t* addr) { return sendto((char*)data_ptr, size_data, addr); }
 
+return_t network_session::sendmmsg(dgram_t* dgrams, size_t count, size_t* cbcount) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == dgrams) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+        size_t cbsent = 0;
+        ret = get_server_socket()->sendmmsg((socket_t)_session.netsock.event_socket, _session.tls_handle, dgrams, count, &cbsent);
+        if (errorcode_t::not_supported == ret) {
+            for (cbsent = 0; cbsent < count; cbsent++) {
+                dgram_t& dgram = dgrams[cbsent];
+                ret = sendto(dgram.ptr, dgram.size, &dgram.addr);
+                if (errorcode_t::success != ret) {
+                    break;
+                }
+            }
+        }
+        if (cbcount) {
+            *cbcount = cbsent;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 network_session_socket_t* network_session::socket_info() { return _session.socket_info(); }
 
 network_session_buffer_t* network_session::get_buffer() { return &_session.buf; }
@@ -176,11 +507,13 @@ int network_session::get_priority() { return _session.priority; }
 
 void network_session::set_priority(int priority) { _session.priority = priority; }
 
+void network_session::set_edge_triggered(bool enable) { _session.edge_triggered = enable; }
+
 int network_session::addref() { return _shared.addref(); }
 
 int network_session::release() { return _shared.delref(); }
 
-return_t network_session::produce(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
+return_t network_session::produce(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
     // const sockaddr_storage_t* addr
     // (epoll) nullptr
     // (iocp)  valid
@@ -215,7 +548,7 @@ return_t network_session::produce(t_mlfq<network_session>* q, byte_t* buf_read,
     return ret;
 }
 
-return_t network_session::produce_stream(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
+return_t network_session::produce_stream(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
     // const sockaddr_storage_t* addr
     // (epoll) nullptr
     // (iocp)  valid
@@ -244,32 +577,50 @@ return_t network_session::produce_stream(t_mlfq<network_session>* q, byte_t* buf
             int mode = 0;
 #if defined __linux__
             mode = tls_io_flag_t::read_epoll;
+            if (_session.edge_triggered) {
+                mode |= tls_io_flag_t::dontwait_msg;
+            }
 #elif defined _WIN32 || defined _WIN64
             mode = tls_io_flag_t::read_iocp;
 #endif
-            ret = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, mode, (char*)buf_read, size_buf_read, nullptr);
-            if (errorcode_t::success != ret) {
-                __leave2;
-            }
-
             while (true) {
-                result = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, tls_io_flag_t::read_ssl_read, (char*)buf_read,
-                                                   size_buf_read, &cbread); /*SSL_read */
-                if (errorcode_t::success == result || errorcode_t::more_data == result) {
-                    getstream()->produce(buf_read, cbread);
+                ret = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, mode, (char*)buf_read, size_buf_read, nullptr);
+                if (errorcode_t::success != ret) {
+                    break;
+                }
 
-                    data_ready = true;
+                while (true) {
+                    result = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, tls_io_flag_t::read_ssl_read,
+                                                       (char*)buf_read, size_buf_read, &cbread); /*SSL_read */
+                    if (errorcode_t::success == result || errorcode_t::more_data == result) {
+                        getstream()->produce(buf_read, cbread);
 
-                    if (istraceable()) {
-                        basic_stream bs;
-                        bs << "[ns] read " << (socket_t)_session.netsock.event_socket << "\n";
-                        dump_memory(buf_read, cbread, &bs, 16, 2, 0, dump_notrunc);
-                        trace_debug_event(category_net, net_event_netsession_produce, &bs);
+                        data_ready = true;
+
+                        if (istraceable()) {
+                            basic_stream bs;
+                            bs << "[ns] read " << (socket_t)_session.netsock.event_socket << "\n";
+                            dump_memory(buf_read, cbread, &bs, 16, 2, 0, dump_notrunc);
+                            trace_debug_event(category_net, net_event_netsession_produce, &bs);
+                        }
+
+                    } else {
+                        break;
                     }
+                }
 
-                } else {
+                if (errorcode_t::disconnect == result) {
+                    ret = result; /* close_notify */
                     break;
                 }
+                if (false == _session.edge_triggered) {
+                    break;
+                }
+            }
+
+            if (errorcode_t::eagain == ret) {
+                // drained (EPOLLET), or a spurious wakeup (EPOLLONESHOT, one network thread reads a socket at a time)
+                ret = errorcode_t::success;
             }
 
             if (data_ready) {
@@ -278,10 +629,41 @@ return_t network_session::produce_stream(t_mlfq<network_session>* q, byte_t* buf
         } else { /* wo TLS */
             size_t cbread = 0;
 #if defined __linux__
-            ret = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, 0, (char*)buf_read, size_buf_read, &cbread);
-            if (errorcode_t::success == ret) {
-                getstream()->produce(buf_read, cbread);
-                q->push(get_priority(), this);
+            if (_session.edge_triggered) {
+                // EPOLLET, read until EAGAIN and signal once
+                bool data_ready = false;
+                while (true) {
+                    ret = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, tls_io_flag_t::dontwait_msg,
+                                                    (char*)buf_read, size_buf_read, &cbread);
+                    if (errorcode_t::success != ret) {
+                        break;
+                    }
+                    getstream()->produce(buf_read, cbread);
+                    data_ready = true;
+
+                    if (istraceable()) {
+                        basic_stream bs;
+                        bs << "[ns] read " << (socket_t)_session.netsock.event_socket << "\n";
+                        dump_memory(buf_read, cbread, &bs, 16, 2, 0, dump_notrunc);
+                        trace_debug_event(category_net, net_event_netsession_produce, &bs);
+                    }
+                }
+                if (data_ready) {
+                    q->push(get_priority(), this);
+                }
+                if (errorcode_t::eagain == ret) {
+                    ret = errorcode_t::success;  // drained
+                }
+                __leave2;
+            } else {
+                ret = get_server_socket()->read((socket_t)_session.netsock.event_socket, _session.tls_handle, 0, (char*)buf_read, size_buf_read, &cbread);
+                if (errorcode_t::success == ret) {
+                    getstream()->produce(buf_read, cbread);
+                    q->push(get_priority(), this);
+                } else if (errorcode_t::eagain == ret) {
+                    ret = errorcode_t::success;  // spurious wakeup, not a disconnect
+                    __leave2;
+                }
             }
 #elif defined _WIN32 || defined _WIN64
             // udp client address
@@ -304,7 +686,7 @@ return_t network_session::produce_stream(t_mlfq<network_session>* q, byte_t* buf
     return ret;
 }
 
-return_t network_session::produce_dgram(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
+return_t network_session::produce_dgram(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
     // const sockaddr_storage_t* addr
     // (epoll) nullptr
     // (iocp)  valid
@@ -368,6 +750,35 @@ return_t network_session::produce_dgram(t_mlfq<network_session>* q, byte_t* buf_
         } else { /* wo TLS */
             size_t cbread = 0;
 #if defined __linux__
+            network_session_buffer_t& buf = _session.buf;
+            if (buf.batch > 1) {
+                // recvmmsg, a single syscall for up to buf.batch datagrams
+                size_t count = 0;
+                ret = get_server_socket()->recvmmsg((socket_t)_session.netsock.event_socket, _session.tls_handle, &buf.dgrams[0], buf.batch, &count);
+                if (errorcode_t::success == ret) {
+                    for (size_t i = 0; i < count; i++) {
+                        dgram_t& dgram = buf.dgrams[i];
+                        // UDP_GRO, split coalesced segments
+                        size_t segment = dgram.segment ? dgram.segment : dgram.size;
+                        for (size_t pos = 0; pos < dgram.size; pos += segment) {
+                            size_t size = (dgram.size - pos < segment) ? (dgram.size - pos) : segment;
+                            getstream()->produce((byte_t*)dgram.ptr + pos, size, &dgram.addr);
+                        }
+
+                        if (istraceable()) {
+                            basic_stream bs;
+                            bs << "[ns] read " << (socket_t)_session.netsock.event_socket << "\n";
+                            dump_memory((byte_t*)dgram.ptr, dgram.size, &bs, 16, 2, 0, dump_notrunc);
+                            trace_debug_event(category_net, net_event_netsession_produce, &bs);
+                        }
+                    }
+                    if (count) {
+                        q->push(get_priority(), this);
+                    }
+                }
+                __leave2;
+            }
+
             sockaddr_storage_t sa;
             socklen_t sa_size = sizeof(sa);
             ret = get_server_socket()->recvfrom((socket_t)_session.netsock.event_socket, _session.tls_handle, 0, (char*)buf_read, size_buf_read, &cbread,
@@ -400,11 +811,19 @@ return_t network_session::produce_dgram(t_mlfq<network_session>* q, byte_t* buf_
 return_t network_session::consume(network_protocol_group* protocol_group, network_stream_data** ptr_network_stream_buffer) {
     return_t ret = errorcode_t::success;
 
+    {
+        critical_section_guard guard(_lock);
+        _early_data = _early_data_ready; /* the data produced after the handshake may be read along, treated as early data */
+        _early_data_ready = false;
+    }
+
     _request.read(protocol_group, &_stream);
     ret = _request.consume(ptr_network_stream_buffer);
     return ret;
 }
 
+bool network_session::is_early_data() { return _early_data; }
+
 server_socket* network_session::get_server_socket() { return _session.svr_socket; }
 
 network_session_data* network_session::get_session_data() { return &_session_data; }
@@ -12,18 +12,28 @@
 #ifndef __HOTPLACE_SDK_NET_SERVER_NETWORKSESSION__
 #define __HOTPLACE_SDK_NET_SERVER_NETWORKSESSION__
 
-#include <sdk/io/basic/mlfq.hpp>
+#include <sdk/io/basic/sharded_mlfq.hpp>
+#include <sdk/net/basic/types.hpp>                 // dgram_t
 #include <sdk/net/http/http2/http2_session.hpp>  // http2_session
 #include <sdk/net/server/network_stream.hpp>     // network_stream
 #include <sdk/net/types.hpp>
+#include <list>
+#include <unordered_map>
 
 namespace hotplace {
 namespace net {
 
+#define NETWORK_SESSION_SHARDS 64
+
 struct network_session_buffer_t {
 #if defined __linux__
     char* buffer;
     size_t buflen;
+
+    /* recvmmsg, see set_batch */
+    std::vector<char> mbin;
+    std::vector<dgram_t> dgrams;
+    size_t batch;
 #elif defined _WIN32 || defined _WIN64
     /* windows overlapped */
     // assign per socket
@@ -34,7 +44,12 @@ struct network_session_buffer_t {
     std::vector<char> bin;
     size_t bufsize;
 
-    network_session_buffer_t() : bufsize(1500) { init(); }
+    network_session_buffer_t() : bufsize(1500) {
+#if defined __linux__
+        batch = 1;
+#endif
+        init();
+    }
     void init() {
         bin.resize(bufsize);  // do nothing if capacity == size()
 #if defined __linux__
@@ -51,6 +66,25 @@ struct network_session_buffer_t {
             bufsize = size;
         }
     }
+#if defined __linux__
+    /**
+     * @brief   recvmmsg buffers
+     * @param   size_t count [in] datagrams per recvmmsg, 1 recvfrom
+     * @param   size_t size [inopt] size of each buffer, bufsize if 0 (UDP_GRO needs 65535)
+     */
+    void set_batch(size_t count, size_t size = 0) {
+        batch = count ? count : 1;
+        if (batch > 1) {
+            size_t slot = size ? size : bufsize;
+            mbin.resize(batch * slot);
+            dgrams.resize(batch);
+            for (size_t i = 0; i < batch; i++) {
+                dgrams[i].ptr = &mbin[i * slot];
+                dgrams[i].bufsize = slot;
+            }
+        }
+    }
+#endif
 };
 
 /**
@@ -73,8 +107,9 @@ struct network_session_t {
     server_socket* svr_socket;
     tls_context_t* tls_handle;
     int priority;
+    bool edge_triggered;  // read until EAGAIN, see serverconf_edge_triggered
 
-    network_session_t() : mplexer_handle(nullptr), svr_socket(nullptr), tls_handle(nullptr), priority(0) {}
+    network_session_t() : mplexer_handle(nullptr), svr_socket(nullptr), tls_handle(nullptr), priority(0), edge_triggered(false) {}
     network_session_socket_t* socket_info() { return &netsock; }
     network_session_buffer_t& get_buffer() { return buf; }
 };
@@ -98,6 +133,14 @@ class network_session {
     network_session(server_socket* svr_socket);
     virtual ~network_session();
 
+    /**
+     * @remarks
+     *          recycled by t_object_pool, a derived class (size differs) is allocated by malloc
+     */
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
+    static void get_pool_stat(object_pool_stat_t* stat);
+
     /**
      * @brief   connect handler
      * @param   handle_t            event_socket  [IN]
@@ -126,11 +169,54 @@ class network_session {
      * @param const char*         data_ptr        [IN]
      * @param size_t              size_data       [IN]
      * @return  error code (see error.hpp)
+     * @remarks
+     *          [epoll] the caller is not blocked by a full send buffer
+     *          the rest is queued and sent in order when the socket is writable (see writable)
      */
     return_t send(const char* data_ptr, size_t size_data);
     return_t send(const byte_t* data_ptr, size_t size_data);
     return_t sendto(const char* data_ptr, size_t size_data, sockaddr_storage_t* addr);
     return_t sendto(const byte_t* data_ptr, size_t size_data, sockaddr_storage_t* addr);
+    /**
+     * @brief   send datagrams in a batch
+     * @param   dgram_t*    dgrams  [IN] ptr, size, segment (UDP_SEGMENT), addr, addrlen
+     * @param   size_t      count   [IN]
+     * @param   size_t*     cbcount [OUTOPT] number of datagrams sent
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] sendmmsg, a single syscall per 64 datagrams
+     */
+    return_t sendmmsg(dgram_t* dgrams, size_t count, size_t* cbcount = nullptr);
+    /**
+     * @brief   send the pieces in order (scatter-gather)
+     * @param   const sendbuf_t* bufs   [IN] ptr, size
+     * @param   size_t          count   [IN]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          [linux] writev, TLS gathers small pieces into a record
+     *          [epoll] the rest is queued (copied), see send
+     */
+    return_t sendv(const sendbuf_t* bufs, size_t count);
+    /**
+     * @brief   send a file
+     * @param   handle_t    fd      [IN]
+     * @param   uint64      offset  [IN]
+     * @param   size_t      size    [IN]
+     * @return  error code (see error.hpp)
+     *          errorcode_t::not_supported  TLS, send the content instead
+     * @remarks
+     *          [linux] sendfile
+     *          [epoll] the rest is queued with a duplicate of fd, the caller may close fd, see send
+     */
+    return_t sendfile(handle_t fd, uint64 offset, size_t size);
+    /**
+     * @brief   close the connection after the data sent so far
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          shutdown both directions, the network thread reads the end of stream and closes the session (mux_disconnect)
+     *          [epoll] delayed until the queued data is sent, see send
+     */
+    return_t shutdown();
 
     /**
      * @brief return socket information
@@ -153,6 +239,11 @@ class network_session {
      */
     network_stream* getrequest();
 
+    /**
+     * @brief   [epoll] EPOLLET|EPOLLONESHOT, drain a socket in produce
+     */
+    void set_edge_triggered(bool enable);
+
     /**
      * @brief return priority
      */
@@ -170,19 +261,27 @@ class network_session {
     virtual int release();
     /**
      * @brief produce, push into stream
-     * @param   t_mlfq<network_session>*    q               [IN]
-     * @param   byte_t*                     buf_read        [IN]
-     * @param   size_t                      size_buf_read   [IN]
-     * @param   const sockaddr_storage_t*   addr            [inopt]
+     * @param   t_sharded_mlfq<network_session>*    q               [IN]
+     * @param   byte_t*                             buf_read        [IN]
+     * @param   size_t                              size_buf_read   [IN]
+     * @param   const sockaddr_storage_t*           addr            [inopt]
      * @remarks
      */
-    return_t produce(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+    return_t produce(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
     /**
      * @brief consume from stream and put into request, then read stream buffer list from request
      * @param   network_protocol_group* protocol_group              [IN]
      * @param   network_stream_data**   ptr_network_stream_buffer   [OUT] see network_stream::consume
      */
     return_t consume(network_protocol_group* protocol_group, network_stream_data** ptr_network_stream_buffer);
+    /**
+     * @brief   TLS 1.3 0-RTT
+     * @return  true if the data being consumed arrived as early data
+     * @remarks
+     *          the early data is consumed before the handshake completes and can be replayed (RFC 8446 8, RFC 8470 425 Too Early)
+     *          see transport_layer_security::enable_early_data
+     */
+    bool is_early_data();
 
     server_socket* get_server_socket();
     network_session_data* get_session_data();
@@ -191,10 +290,63 @@ class network_session {
     return_t dgram_get_sockaddr(sockaddr_storage_t* addr);
 
    protected:
-    return_t produce_stream(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
-    return_t produce_dgram(t_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+#if defined __linux__
+    /**
+     * @brief   [epoll] continue the queued sends
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          called by network_server::network_routine (mux_write, see multiplexer_epoll::bind_writable)
+     */
+    return_t writable();
+    /**
+     * @brief   [epoll] no more writable notification, the queued data is dropped
+     * @remarks
+     *          called by network_server::session_closed before the multiplexer forgets the socket
+     */
+    void close_writable();
+    /**
+     * @brief   [epoll] TLS 1.3 0-RTT, consume the early data before the handshake completes
+     * @param   t_sharded_mlfq<network_session>*    q       [IN]
+     * @param   const binary_t&                     data    [IN]
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          called by network_server::tls_handshake_early_data, the sends are queued until handshake_finished
+     */
+    return_t produce_early_data(t_sharded_mlfq<network_session>* q, const binary_t& data);
+    /**
+     * @brief   [epoll] the handshake is in progress (early data)
+     */
+    bool is_handshaking();
+    /**
+     * @brief   [epoll] send the data queued during the handshake
+     * @return  error code (see error.hpp)
+     * @remarks
+     *          called by network_server::session_accepted
+     */
+    return_t handshake_finished();
+#endif
+    return_t produce_stream(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
+    return_t produce_dgram(t_sharded_mlfq<network_session>* q, byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
 
    private:
+#if defined __linux__
+    /**
+     * @brief   [epoll] the rest of a send, see send, sendv, sendfile
+     */
+    struct pending_send_t {
+        std::vector<char> data;
+        size_t pos;
+        int file;  // sendfile, a duplicate of the descriptor
+        uint64 offset;
+        size_t size;
+
+        pending_send_t() : pos(0), file(-1), offset(0), size(0) {}
+    };
+    return_t queue_send(const char* data_ptr, size_t size_data);
+    return_t queue_sendfile(handle_t fd, uint64 offset, size_t size);
+    return_t wait_writable();
+#endif
+
     network_session_t _session;
     network_stream _stream;
     network_stream _request;
@@ -204,6 +356,17 @@ class network_session {
 
     t_shared_reference<network_session> _shared;
     critical_section _lock;
+    bool _early_data;        // consuming the early data, see is_early_data
+    bool _early_data_ready;  // produced, not consumed yet
+
+#if defined __linux__
+    critical_section _send_lock;
+    std::list<pending_send_t> _send_queue;
+    int _send_event;      // a duplicate of the socket, see multiplexer_epoll::bind_writable
+    bool _send_shutdown;  // shutdown after the queue is sent
+    bool _send_closed;    // see close_writable
+    bool _handshake;      // 0-RTT, the session is made before the handshake completes, see network_server::tls_handshake_early_data
+#endif
 };
 
 /**
@@ -288,14 +451,42 @@ class network_session_manager {
     void shutdown();
 
    private:
-    typedef std::map<handle_t, network_session*> network_session_map_t;
+    /**
+     * @brief   [UDP/DTLS] peer address (family, port, address), see dgram_key
+     */
+    struct dgram_key_t {
+        uint16 family;
+        uint16 port;
+        uint32 scope;
+        byte_t addr[16];
+
+        bool operator==(const dgram_key_t& rhs) const;
+    };
+    struct dgram_key_hash {
+        size_t operator()(const dgram_key_t& key) const;
+    };
+
+    typedef std::unordered_map<handle_t, network_session*> network_session_map_t;
     typedef std::pair<network_session_map_t::iterator, bool> network_session_map_pib_t;
-    typedef std::map<binary_t, network_session*> dgram_session_map_t;
+    typedef std::unordered_map<dgram_key_t, network_session*, dgram_key_hash> dgram_session_map_t;
     typedef std::pair<dgram_session_map_t::iterator, bool> dgram_session_map_pib_t;
 
-    critical_section _session_lock;
-    network_session_map_t _session_map;
-    dgram_session_map_t _dgram_map;
+    /**
+     * @remarks
+     *          a read event locks only the shard of the socket (or the peer address), not the whole table
+     *          descriptors are dense small integers, so (socket % NETWORK_SESSION_SHARDS) spreads evenly
+     */
+    struct session_shard_t {
+        critical_section lock;
+        network_session_map_t session_map;
+        dgram_session_map_t dgram_map;
+    };
+
+    session_shard_t& get_shard(handle_t event_socket);
+    session_shard_t& get_shard(const dgram_key_t& key);
+    static void dgram_key(dgram_key_t& key, const sockaddr_storage_t* addr);
+
+    session_shard_t _shards[NETWORK_SESSION_SHARDS];
     server_conf* _server_conf;
 };
 
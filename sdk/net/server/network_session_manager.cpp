@@ -38,15 +38,17 @@ return_t network_session_manager::connected(handle_t event_socket, sockaddr_stor
             __leave2;
         }
 
-        critical_section_guard guard(_session_lock);
+        session_shard_t& shard = get_shard(event_socket);
+        critical_section_guard guard(shard.lock);
 
-        pairib = _session_map.insert(std::make_pair(event_socket, (network_session*)nullptr));
+        pairib = shard.session_map.insert(std::make_pair(event_socket, (network_session*)nullptr));
         if (true == pairib.second) {
             session_object = new network_session(svr_socket);
             server_conf* conf = get_server_conf();
             if (conf) {
                 uint16 tcp_bufsize = conf->get(netserver_config_t::serverconf_tcp_bufsize);
                 session_object->get_buffer()->set_bufsize(tcp_bufsize);  // 0 for default buffer size
+                session_object->set_edge_triggered(conf->get(netserver_config_t::serverconf_edge_triggered) ? true : false);
             }
             pairib.first->second = session_object;
             session_object->connected(event_socket, addr, tls_handle);
@@ -71,9 +73,10 @@ return_t network_session_manager::find(handle_t event_socket, network_session**
             __leave2;
         }
 
-        critical_section_guard guard(_session_lock);
-        network_session_map_t::iterator iter = _session_map.find(event_socket);
-        if (_session_map.end() == iter) {
+        session_shard_t& shard = get_shard(event_socket);
+        critical_section_guard guard(shard.lock);
+        network_session_map_t::iterator iter = shard.session_map.find(event_socket);
+        if (shard.session_map.end() == iter) {
             ret = errorcode_t::not_found;
         } else {
             network_session* session_object = iter->second;
@@ -104,15 +107,16 @@ return_t network_session_manager::ready_to_close(handle_t event_socket, network_
             __leave2;
         }
 
-        critical_section_guard guard(_session_lock);
-        network_session_map_t::iterator iter = _session_map.find(event_socket);
-        if (_session_map.end() == iter) {
+        session_shard_t& shard = get_shard(event_socket);
+        critical_section_guard guard(shard.lock);
+        network_session_map_t::iterator iter = shard.session_map.find(event_socket);
+        if (shard.session_map.end() == iter) {
             ret = errorcode_t::not_found;
         } else {
             network_session* session_object = iter->second;
             *ptr_session_object = session_object;
 
-            _session_map.erase(iter);
+            shard.session_map.erase(iter);
         }
     }
     __finally2 {
@@ -123,15 +127,17 @@ return_t network_session_manager::ready_to_close(handle_t event_socket, network_
 }
 
 void network_session_manager::shutdown() {
-    critical_section_guard guard(_session_lock);
-    for (auto item : _session_map) {
-        item.second->release();
-    }
-    _session_map.clear();
-    for (auto item : _dgram_map) {
-        item.second->release();
+    for (auto& shard : _shards) {
+        critical_section_guard guard(shard.lock);
+        for (auto item : shard.session_map) {
+            item.second->release();
+        }
+        shard.session_map.clear();
+        for (auto item : shard.dgram_map) {
+            item.second->release();
+        }
+        shard.dgram_map.clear();
     }
-    _dgram_map.clear();
 }
 
 return_t network_session_manager::get_dgram_session(handle_t listen_sock, server_socket* svr_socket, tls_context_t* tls_handle,
@@ -146,15 +152,23 @@ return_t network_session_manager::get_dgram_session(handle_t listen_sock, server
             __leave2;
         }
 
-        critical_section_guard guard(_session_lock);
+        session_shard_t& shard = get_shard(listen_sock);
+        critical_section_guard guard(shard.lock);
 
-        pairib = _session_map.insert(std::make_pair(listen_sock, (network_session*)nullptr));
+        pairib = shard.session_map.insert(std::make_pair(listen_sock, (network_session*)nullptr));
         if (true == pairib.second) {
             session_object = new network_session(svr_socket);
             server_conf* conf = get_server_conf();
             if (conf) {
                 uint16 udp_bufsize = conf->get(netserver_config_t::serverconf_udp_bufsize);
                 session_object->get_buffer()->set_bufsize(udp_bufsize);  // 0 for default buffer size
+#if defined __linux__
+                if (false == svr_socket->support_tls()) {
+                    uint16 udp_batch = conf->get(netserver_config_t::serverconf_udp_batch);
+                    uint16 udp_gro = conf->get(netserver_config_t::serverconf_udp_gro);
+                    session_object->get_buffer()->set_batch(udp_batch ? udp_batch : 32, udp_gro ? 65535 : 0);
+                }
+#endif
             }
             pairib.first->second = session_object;
             session_object->dtls_session_open(listen_sock);
@@ -187,12 +201,13 @@ return_t network_session_manager::get_dgram_cookie_session(handle_t listen_sock,
             __leave2;
         }
 
-        critical_section_guard guard(_session_lock);
+        dgram_key_t key;
+        dgram_key(key, addr);
 
-        binary_t cookie;
-        generate_cookie_sockaddr(cookie, (sockaddr*)addr, sizeof(sockaddr_storage_t));
+        session_shard_t& shard = get_shard(key);
+        critical_section_guard guard(shard.lock);
 
-        pairib = _dgram_map.insert(std::make_pair(cookie, (network_session*)nullptr));
+        pairib = shard.dgram_map.insert(std::make_pair(key, (network_session*)nullptr));
         if (true == pairib.second) {
             session_object = new network_session(svr_socket);
             server_conf* conf = get_server_conf();
@@ -228,11 +243,14 @@ return_t network_session_manager::dgram_find(const sockaddr_storage_t* addr, net
             __leave2;
         }
 
-        binary_t cookie;
-        generate_cookie_sockaddr(cookie, (sockaddr*)addr, sizeof(sockaddr_storage_t));
+        dgram_key_t key;
+        dgram_key(key, addr);
+
+        session_shard_t& shard = get_shard(key);
+        critical_section_guard guard(shard.lock);
 
-        auto iter = _dgram_map.find(cookie);
-        if (_dgram_map.end() == iter) {
+        auto iter = shard.dgram_map.find(key);
+        if (shard.dgram_map.end() == iter) {
             ret = errorcode_t::not_found;
             __leave2;
         } else {
@@ -247,5 +265,47 @@ return_t network_session_manager::dgram_find(const sockaddr_storage_t* addr, net
     return ret;
 }
 
+network_session_manager::session_shard_t& network_session_manager::get_shard(handle_t event_socket) {
+#if defined _WIN32 || defined _WIN64
+    size_t index = ((arch_t)event_socket >> 2) % NETWORK_SESSION_SHARDS; /* SOCKET is a multiple of 4 */
+#else
+    size_t index = (arch_t)event_socket % NETWORK_SESSION_SHARDS;
+#endif
+    return _shards[index];
+}
+
+network_session_manager::session_shard_t& network_session_manager::get_shard(const dgram_key_t& key) {
+    return _shards[dgram_key_hash()(key) % NETWORK_SESSION_SHARDS];
+}
+
+void network_session_manager::dgram_key(dgram_key_t& key, const sockaddr_storage_t* addr) {
+    // do not hash the whole sockaddr_storage_t (the padding is not always zeroed)
+    memset(&key, 0, sizeof(key));
+    key.family = addr->ss_family;
+    if (AF_INET == addr->ss_family) {
+        const sockaddr_in* sin = (const sockaddr_in*)addr;
+        key.port = sin->sin_port;
+        memcpy(key.addr, &sin->sin_addr, sizeof(sin->sin_addr));
+    } else if (AF_INET6 == addr->ss_family) {
+        const sockaddr_in6* sin6 = (const sockaddr_in6*)addr;
+        key.port = sin6->sin6_port;
+        key.scope = sin6->sin6_scope_id;
+        memcpy(key.addr, &sin6->sin6_addr, sizeof(sin6->sin6_addr));
+    }
+}
+
+bool network_session_manager::dgram_key_t::operator==(const dgram_key_t& rhs) const { return 0 == memcmp(this, &rhs, sizeof(dgram_key_t)); }
+
+size_t network_session_manager::dgram_key_hash::operator()(const dgram_key_t& key) const {
+    // FNV-1a
+    uint64 hash = 0xcbf29ce484222325ULL;
+    const byte_t* p = (const byte_t*)&key;
+    for (size_t i = 0; i < sizeof(dgram_key_t); i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return (size_t)hash;
+}
+
 }  // namespace net
 }  // namespace hotplace
@@ -9,19 +9,21 @@
  */
 
 #include <sdk/base/nostd/list.hpp>
-#include <sdk/base/stream/basic_stream.hpp>
 #include <sdk/net/server/network_protocol.hpp>
 #include <sdk/net/server/network_stream.hpp>
 
 namespace hotplace {
 namespace net {
 
-network_stream::network_stream() {
-    // do nothing
-}
+network_stream::network_stream() : _buffer(nullptr), _capacity(0), _begin(0), _end(0), _need(0) { memset(&_addr, 0, sizeof(_addr)); }
 
 network_stream::~network_stream() {
-    // do nothing
+    for (network_stream_data* buffer_object : _queue) {
+        buffer_object->release();
+    }
+    if (_buffer) {
+        free(_buffer);
+    }
 }
 
 return_t network_stream::produce(byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr) {
@@ -30,12 +32,17 @@ return_t network_stream::produce(byte_t* buf_read, size_t size_buf_read, const s
 
     __try2 {
         if (size_buf_read > 0) {
+            if (nullptr == addr) {
+                // stream, append into the receive buffer
+                critical_section_guard guard(_lock);
+                ret = append(buf_read, size_buf_read);
+                __leave2;
+            }
+
             __try_new_catch(buffer_object, new network_stream_data, ret, __leave2);
 
             buffer_object->assign(buf_read, size_buf_read);
-            if (addr) {
-                buffer_object->set_sockaddr(addr);
-            }
+            buffer_object->set_sockaddr(addr);
 
             critical_section_guard guard(_lock);
             _queue.push_back(buffer_object);
@@ -49,12 +56,12 @@ return_t network_stream::produce(byte_t* buf_read, size_t size_buf_read, const s
 }
 
 bool network_stream::ready() {
-    size_t count = 0;
+    bool ret_value = false;
 
     critical_section_guard guard(_lock);
-    count = _queue.size();
+    ret_value = (false == _queue.empty()) || (_end > _begin);
 
-    return count > 0;
+    return ret_value;
 }
 
 return_t network_stream::consume(network_stream_data** ptr_buffer_object) {
@@ -71,13 +78,16 @@ return_t network_stream::consume(network_stream_data** ptr_buffer_object) {
 
         critical_section_guard guard(_lock);
 
-        if (true == _queue.empty()) {
+        if (true == _queue.empty() && (_end == _begin)) {
             ret = errorcode_t::empty;
         } else {
             while (false == _queue.empty()) {
                 single_link.add(_queue.front());
                 _queue.pop_front();
             }
+            if (errorcode_t::success == detach(&buffer_object)) {
+                single_link.add(buffer_object);
+            }
         }
 
         *ptr_buffer_object = single_link.get_head();
@@ -115,24 +125,17 @@ return_t network_stream::write(network_protocol_group* protocol_group, network_s
 
         critical_section_guard guard(_lock);
 
-        if (true == _queue.empty()) {
+        if (true == _queue.empty() && (_end == _begin)) {
             ret = errorcode_t::empty;
         } else {
             if (true == protocol_group->empty()) {
                 do_write(target);
             } else {
                 /*
-                 * after processing one request, check remains
-                 * before do_write
-                 *      request packet 1 || request packet 2 || ...
-                 * after do_write
-                 *      request packet 1 in target
-                 *      request packet 2 || ... remains
-                 * to resolve
-                 *      check more_data
+                 * request packet 1 || request packet 2 || ...
+                 * do_writep interprets all complete requests from the read cursor
                  */
-                while (errorcode_t::more_data == do_writep(protocol_group, target))
-                    ;
+                do_writep(protocol_group, target);
             }
         }
     }
@@ -150,14 +153,17 @@ return_t network_stream::do_write(network_stream* target) {
         critical_section_guard guard(_lock);
 
         network_stream_data* buffer_object = nullptr;
-        while (false == _queue.empty()) {
-            buffer_object = _queue.front();
-
-            target->produce(buffer_object->content(), buffer_object->size(), buffer_object->get_sockaddr());
+        detach(&buffer_object);
 
-            buffer_object->release();
+        // move, not copy
+        critical_section_guard guard_target(target->_lock);
+        while (false == _queue.empty()) {
+            target->_queue.push_back(_queue.front());
             _queue.pop_front();
         }
+        if (buffer_object) {
+            target->_queue.push_back(buffer_object);
+        }
     }
     __finally2 {
         // do nothing
@@ -169,23 +175,27 @@ return_t network_stream::do_writep(network_protocol_group* protocol_group, netwo
     return_t ret = errorcode_t::success;
     return_t test = errorcode_t::success;
 
-    basic_stream bufstream;
-
-    protocol_state_t state = protocol_state_t::protocol_state_invalid;
-    size_t message_size = 0;
-    size_t roll_count = 0;
-    bool _run = true;
-    int priority = 0;
-
     critical_section_guard guard(_lock);
 
-    for (network_stream_data* buffer_object : _queue) {
-        roll_count++;
+    // datagrams
+    while (false == _queue.empty()) {
+        network_stream_data* buffer_object = _queue.front();
+        append(buffer_object->content(), buffer_object->size());
+        buffer_object->get_sockaddr(&_addr);
+        buffer_object->release();
+        _queue.pop_front();
+    }
 
+    while (_end > _begin) {
+        size_t avail = _end - _begin;
+        if (avail < _need) {
+            break;  // the message announced by read_stream is not received yet
+        }
+
+        byte_t* ptr = _buffer + _begin;
         network_protocol* protocol = nullptr;
-        bufstream.write(buffer_object->content(), buffer_object->size()); /* append */
 
-        test = protocol_group->is_kind_of(bufstream.data(), bufstream.size(), &protocol);  // reference counter ++
+        test = protocol_group->is_kind_of(ptr, avail, &protocol);  // reference counter ++
 
         auto lambda = [](network_protocol* object) -> void {
             if (object) {
@@ -195,105 +205,194 @@ return_t network_stream::do_writep(network_protocol_group* protocol_group, netwo
         t_promise_on_destroy<network_protocol*>(protocol, lambda);
 
         if (errorcode_t::more_data == test) {
-            // do nothing
-        } else if (errorcode_t::success == test) {
-            protocol->read_stream(&bufstream, &message_size, &state, &priority);
-            switch (state) {
-                case protocol_state_t::protocol_state_complete:
-                    target->produce(bufstream.data(), message_size, buffer_object->get_sockaddr());
-                    _run = false;
-                    break;
-                case protocol_state_t::protocol_state_forged:
-                case protocol_state_t::protocol_state_crash:
-                case protocol_state_t::protocol_state_large:
-                    _run = false;
-                    break;
-                default:
-                    break;
+            break;
+        } else if (errorcode_t::success != test) {
+            // not in (errorcode_t::success, errorcode_t::more_data)
+            discard();
+            break;
+        }
+
+        protocol_state_t state = protocol_state_t::protocol_state_invalid;
+        size_t message_size = 0;
+        int priority = 0;
+
+        protocol->read_stream(ptr, avail, &message_size, &state, &priority, &_cursor);
+
+        if (protocol_state_t::protocol_state_complete == state) {
+            if ((0 == message_size) || (message_size > avail)) {
+                message_size = avail;
             }
+            protocol_cursor_t cursor = _cursor;  // cleared below
 
-            if (false == _run) {
-                break;
+            network_stream_data* buffer_object = nullptr;
+            if (message_size == avail) {
+                ret = detach(&buffer_object);  // no copy
+            } else {
+                __try_new_catch_only(buffer_object, new network_stream_data);
+                if (nullptr == buffer_object) {
+                    ret = errorcode_t::out_of_memory;
+                } else {
+                    ret = buffer_object->assign(ptr, message_size);
+                    _begin += message_size;
+                    _need = 0;
+                    _cursor.clear();
+                }
             }
-        } else {
-            // not in (errorcode_t::success, errorcode_t::more_data)
-            while (roll_count--) {
-                buffer_object = _queue.front();
-                buffer_object->release();
-                _queue.pop_front();
+            if (errorcode_t::success != ret) {
+                if (buffer_object) {
+                    buffer_object->release();
+                }
+                discard();
+                break;
             }
 
+            buffer_object->set_priority(priority);  // set stream priority
+            buffer_object->set_sockaddr(&_addr);
+            buffer_object->set_cursor(cursor);
+
+            critical_section_guard guard_target(target->_lock);
+            target->_queue.push_back(buffer_object);
+        } else if ((protocol_state_t::protocol_state_forged == state) || (protocol_state_t::protocol_state_crash == state) ||
+                   (protocol_state_t::protocol_state_large == state)) {
+            discard();
+            break;
+        } else {
+            _need = message_size;  // 0 if unknown
             break;
         }
-    }  // for-loop
-
-    switch (state) {
-        case protocol_state_t::protocol_state_complete: {
-            size_t content_pos = 0;
-            size_t content_size = 0;
-            network_stream_list_t::iterator iter;
-            for (iter = _queue.begin(); iter != _queue.end();) {
-                auto buffer_object = *iter;
-                content_pos = content_size;
-                content_size += buffer_object->size();
-                if (message_size >= content_size) {
-                    buffer_object->release();
-                    _queue.erase(iter++);
-                    if (message_size == content_size) {
-                        if (iter != _queue.end()) {
-                            ret = errorcode_t::more_data;
-                        }
-                        break;
-                    }
-                } else if ((content_pos <= message_size) && (message_size < content_size)) {
-                    size_t remain = content_size - message_size;
-                    byte_t* ptr = bufstream.data() + message_size;
-                    buffer_object->assign(ptr, remain);
-                    buffer_object->set_priority(priority);  // set stream priority
-                    ret = errorcode_t::more_data;           // while (more_data == do_write(...));
-                    break;
-                }
+    }
+
+    return ret;
+}
+
+return_t network_stream::append(byte_t* ptr, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        size_t required = _end + size + 1;  // null pad
+        if (required > _capacity) {
+            if (_begin) {
+                // compact, move remains to front
+                memmove(_buffer, _buffer + _begin, _end - _begin);
+                _end -= _begin;
+                _begin = 0;
+                required = _end + size + 1;
             }
-        } break;
-        case protocol_state_t::protocol_state_forged:
-        case protocol_state_t::protocol_state_crash:
-        case protocol_state_t::protocol_state_large:
-            for (network_stream_data* buffer_object : _queue) {
-                buffer_object->release();
+            if (required > _capacity) {
+                size_t capacity = (_capacity << 1);
+                if (capacity < required) {
+                    capacity = required;
+                }
+                byte_t* p = (byte_t*)realloc(_buffer, capacity);
+                if (nullptr == p) {
+                    ret = errorcode_t::out_of_memory;
+                    __leave2;
+                }
+                _buffer = p;
+                _capacity = capacity;
             }
-            _queue.clear();
-            break;
-        default:
-            break;
+        }
+
+        memcpy(_buffer + _end, ptr, size);
+        _end += size;
+        _buffer[_end] = 0;
+    }
+    __finally2 {
+        // do nothing
     }
 
     return ret;
 }
 
-network_stream_data::network_stream_data() : _ptr(nullptr), _size(0), _next(nullptr), _priority(0), _addr(nullptr) { _instance.make_share(this); }
+return_t network_stream::detach(network_stream_data** ptr_buffer_object) {
+    return_t ret = errorcode_t::success;
+    network_stream_data* buffer_object = nullptr;
+
+    __try2 {
+        *ptr_buffer_object = nullptr;
+
+        if (_end == _begin) {
+            ret = errorcode_t::empty;
+            __leave2;
+        }
+
+        __try_new_catch(buffer_object, new network_stream_data, ret, __leave2);
+
+        buffer_object->attach(_buffer, _buffer + _begin, _end - _begin);
+        *ptr_buffer_object = buffer_object;
 
-network_stream_data::~network_stream_data() {
-    if (_ptr) {
-        free(_ptr);
+        _buffer = nullptr;
+        _capacity = 0;
+        _begin = 0;
+        _end = 0;
+        _need = 0;
+        _cursor.clear();
     }
-    if (_addr) {
-        free(_addr);
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+void network_stream::discard() {
+    _begin = 0;
+    _end = 0;
+    _need = 0;
+    _cursor.clear();
+}
+
+typedef t_object_pool<sizeof(network_stream_data)> network_stream_data_pool_t;
+typedef t_object_pool<NETWORK_STREAM_SLAB> network_stream_slab_t;
+
+network_stream_data::network_stream_data()
+    : _base(nullptr), _slab(false), _ptr(nullptr), _size(0), _next(nullptr), _priority(0), _addr(nullptr) {
+    _instance.make_share(this);
+}
+
+network_stream_data::~network_stream_data() { free_base(); }
+
+void* network_stream_data::operator new(size_t size) {
+    void* ptr = network_stream_data_pool_t::get_instance().alloc();
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void network_stream_data::operator delete(void* ptr) { network_stream_data_pool_t::get_instance().free(ptr); }
+
+void network_stream_data::get_pool_stat(object_pool_stat_t* object, object_pool_stat_t* slab) {
+    network_stream_data_pool_t::get_instance().get_stat(object);
+    network_stream_slab_t::get_instance().get_stat(slab);
+}
+
+void network_stream_data::free_base() {
+    if (_base) {
+        if (_slab) {
+            network_stream_slab_t::get_instance().free(_base);
+        } else {
+            free(_base);
+        }
+        _base = nullptr;
+        _slab = false;
     }
 }
 
 return_t network_stream_data::assign(byte_t* ptr, size_t size) {
     return_t ret = errorcode_t::success;
 
-    void* p = malloc(size);
+    bool slab = (size <= NETWORK_STREAM_SLAB);
+    void* p = slab ? network_stream_slab_t::get_instance().alloc() : malloc(size);
 
     if (nullptr == p) {
         ret = errorcode_t::out_of_memory;
     } else {
         memcpy(p, ptr, size);
 
-        if (nullptr != _ptr) {
-            free(_ptr);
-        }
+        free_base();
+        _base = (byte_t*)p;
+        _slab = slab;
         _ptr = (byte_t*)p;
         _size = size;
     }
@@ -301,6 +400,21 @@ return_t network_stream_data::assign(byte_t* ptr, size_t size) {
     return ret;
 }
 
+return_t network_stream_data::attach(byte_t* base, byte_t* ptr, size_t size) {
+    return_t ret = errorcode_t::success;
+
+    if (nullptr == base || ptr < base) {
+        ret = errorcode_t::invalid_parameter;
+    } else {
+        free_base();
+        _base = base;
+        _ptr = ptr;
+        _size = size;
+    }
+
+    return ret;
+}
+
 size_t network_stream_data::size() { return _size; }
 
 byte_t* network_stream_data::content() { return _ptr; }
@@ -311,6 +425,10 @@ void network_stream_data::set_next(network_stream_data* next) { _next = next; }
 
 int network_stream_data::get_priority() { return _priority; }
 
+void network_stream_data::set_cursor(const protocol_cursor_t& cursor) { _cursor = cursor; }
+
+const protocol_cursor_t* network_stream_data::get_cursor() { return &_cursor; }
+
 void network_stream_data::set_priority(int priority) { _priority = priority; }
 
 int network_stream_data::addref() { return _instance.addref(); }
@@ -321,12 +439,8 @@ void network_stream_data::set_sockaddr(const sockaddr_storage_t* cliaddr) {
     // store recvfrom sockaddr
     if (cliaddr) {
         if (cliaddr->ss_family) {
-            if (nullptr == _addr) {
-                _addr = (sockaddr_storage_t*)malloc(sizeof(sockaddr_storage_t));
-            }
-            if (_addr) {
-                memcpy(_addr, cliaddr, sizeof(sockaddr_storage_t));
-            }
+            _addr = &_sockaddr;
+            memcpy(_addr, cliaddr, sizeof(sockaddr_storage_t));
         }
     }
 }
@@ -11,13 +11,19 @@
 #ifndef __HOTPLACE_SDK_NET_SERVER_NETWORKSTREAM__
 #define __HOTPLACE_SDK_NET_SERVER_NETWORKSTREAM__
 
+#include <sdk/io/basic/object_pool.hpp>
+#include <sdk/net/server/network_protocol.hpp>
 #include <sdk/net/types.hpp>
 
 namespace hotplace {
 namespace net {
 
+#define NETWORK_STREAM_SLAB 2048
+
 /**
  * @brief stream data that produced and consumed by network_stream
+ * @remarks
+ *          an instance is recycled by t_object_pool, and so is the content up to NETWORK_STREAM_SLAB bytes (see assign)
  */
 class network_stream_data {
     friend class network_stream;
@@ -26,12 +32,30 @@ class network_stream_data {
     network_stream_data();
     ~network_stream_data();
 
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+    /**
+     * @brief   pool counters
+     * @param   object_pool_stat_t* object [out] network_stream_data
+     * @param   object_pool_stat_t* slab [out] content (NETWORK_STREAM_SLAB)
+     */
+    static void get_pool_stat(object_pool_stat_t* object, object_pool_stat_t* slab);
+
     /**
      * @brief assign
      * @param   byte_t* ptr     [IN]
      * @param   size_t  size    [IN]
+     * @remarks
+     *          copy into a slab if size <= NETWORK_STREAM_SLAB
      */
     return_t assign(byte_t* ptr, size_t size);
+    /**
+     * @brief   take ownership of the allocated buffer (no copy)
+     * @param   byte_t* base    [IN] allocated by malloc, free on destruct
+     * @param   byte_t* ptr     [IN] content, base <= ptr
+     * @param   size_t  size    [IN]
+     */
+    return_t attach(byte_t* base, byte_t* ptr, size_t size);
     /**
      * @brief content size
      */
@@ -63,19 +87,35 @@ class network_stream_data {
     void get_sockaddr(sockaddr_storage_t* cliaddr);
     const sockaddr_storage_t* get_sockaddr();
 
+    /*
+     * the parse state of the complete message (network_protocol::read_stream), reused by the consumer
+     */
+    void set_cursor(const protocol_cursor_t& cursor);
+    const protocol_cursor_t* get_cursor();
+
    protected:
+    void free_base();
+
    private:
     t_shared_reference<network_stream_data> _instance;
+    byte_t* _base;
+    bool _slab;  // _base from the slab
     byte_t* _ptr;
     size_t _size;
     network_stream_data* _next;
     int _priority;
-    sockaddr_storage_t* _addr;  // udp
+    sockaddr_storage_t* _addr;  // udp, nullptr or &_sockaddr
+    sockaddr_storage_t _sockaddr;
+    protocol_cursor_t _cursor;
 };
 
 /**
  * @brief network_stream_data container
  *        member of network_session
+ * @remarks
+ *          stream data (produce without address) is appended into a contiguous receive buffer
+ *          protocols parse the receive buffer in place, from the read cursor
+ *          datagrams (produce with address) are queued as network_stream_data
  */
 class network_stream {
    public:
@@ -87,6 +127,8 @@ class network_stream {
      * @param   byte_t* buf_read         [IN]
      * @param   size_t  size_buf_read    [IN]
      * @param   const sockaddr_storage_t* addr [inopt]
+     * @remarks
+     *          copied once into the receive buffer (stream) or into network_stream_data (datagram)
      */
     return_t produce(byte_t* buf_read, size_t size_buf_read, const sockaddr_storage_t* addr = nullptr);
     /**
@@ -139,11 +181,35 @@ class network_stream {
      */
     return_t do_writep(network_protocol_group* protocol, network_stream* target);
 
+    /**
+     * @brief append into the receive buffer
+     * @param   byte_t* ptr     [IN]
+     * @param   size_t  size    [IN]
+     */
+    return_t append(byte_t* ptr, size_t size);
+    /**
+     * @brief detach the receive buffer
+     * @param   network_stream_data** ptr_buffer_object [OUT]
+     */
+    return_t detach(network_stream_data** ptr_buffer_object);
+    /**
+     * @brief discard the receive buffer
+     */
+    void discard();
+
     typedef std::list<network_stream_data*> network_stream_list_t;
 
    private:
     critical_section _lock;
     network_stream_list_t _queue;
+
+    byte_t* _buffer;            // contiguous receive buffer (stream)
+    size_t _capacity;           // allocated size, including a null pad byte
+    size_t _begin;              // read cursor
+    size_t _end;                // write cursor
+    size_t _need;               // size of the message announced by protocol (see network_protocol::read_stream)
+    protocol_cursor_t _cursor;  // resumable parse state of the message
+    sockaddr_storage_t _addr;   // datagram appended lastly
 };
 
 }  // namespace net
@@ -27,6 +27,7 @@ class network_stream_data;
 class network_protocol;
 class network_protocol_group;
 class server_conf;
+struct protocol_cursor_t;
 
 }  // namespace net
 }  // namespace hotplace
@@ -23,18 +23,63 @@ namespace hotplace {
 namespace net {
 
 tls_protection::tls_protection()
-    : _flow(tls_1_rtt), _ciphersuite(0), _lagacy_version(tls_12), _version(tls_10), _transcript_hash(nullptr), _use_pre_master_secret(false) {}
+    : _flow(tls_1_rtt),
+      _ciphersuite(0),
+      _lagacy_version(tls_12),
+      _version(tls_10),
+      _transcript_hash(nullptr),
+      _use_pre_master_secret(false),
+      _resumption(false),
+      _early_data(tls_early_data_none),
+      _max_early_data_size(0),
+      _early_data_size(0) {}
 
 tls_protection::~tls_protection() {
     if (_transcript_hash) {
         _transcript_hash->release();
     }
+    clear_aead_contexts();
 }
 
 tls_message_flow_t tls_protection::get_flow() { return _flow; }
 
 void tls_protection::set_flow(tls_message_flow_t flow) { _flow = flow; }
 
+bool tls_protection::is_resumption() { return _resumption; }
+
+void tls_protection::set_resumption(bool resumption) { _resumption = resumption; }
+
+tls_early_data_t tls_protection::get_early_data() { return _early_data; }
+
+void tls_protection::set_early_data(tls_early_data_t state) { _early_data = state; }
+
+bool tls_protection::is_early_data(tls_session *session, tls_direction_t dir) {
+    bool ret_value = false;
+    if (session && (from_client == dir) && (tls_0_rtt == get_flow())) {
+        if ((tls_early_data_offered == _early_data) || (tls_early_data_accepted == _early_data)) {
+            auto hsstatus = session->get_session_info(dir).get_status();
+            // RFC 8446 4.5.  End of Early Data
+            ret_value = (tls_hs_end_of_early_data != hsstatus) && (tls_hs_finished != hsstatus);
+        }
+    }
+    return ret_value;
+}
+
+uint32 tls_protection::get_max_early_data_size() { return _max_early_data_size; }
+
+void tls_protection::set_max_early_data_size(uint32 size) { _max_early_data_size = size; }
+
+return_t tls_protection::consume_early_data(size_t size) {
+    return_t ret = errorcode_t::success;
+    // RFC 8446 4.2.10.  If the server receives more than max_early_data_size bytes of 0-RTT data, it SHOULD terminate the connection
+    if (_early_data_size + size > _max_early_data_size) {
+        ret = errorcode_t::exceed;
+    } else {
+        _early_data_size += size;
+    }
+    return ret;
+}
+
 uint16 tls_protection::get_cipher_suite() { return _ciphersuite; }
 
 void tls_protection::set_cipher_suite(uint16 ciphersuite) {
@@ -76,13 +121,17 @@ void tls_protection::get_item(tls_secret_t type, binary_t &item, uint8 flag) {
 
 const binary_t &tls_protection::get_item(tls_secret_t type) { return _kv[type]; }
 
-void tls_protection::set_item(tls_secret_t type, const binary_t &item) { _kv[type] = item; }
+void tls_protection::set_item(tls_secret_t type, const binary_t &item) {
+    _kv[type] = item;
+    reset_aead_context(type);
+}
 
 void tls_protection::set_item(tls_secret_t type, const byte_t *stream, size_t size) {
     if (stream) {
         binary_t bin;
         bin.insert(bin.end(), stream, stream + size);
         _kv[type] = std::move(bin);
+        reset_aead_context(type);
     }
 }
 
@@ -91,6 +140,7 @@ void tls_protection::clear_item(tls_secret_t type) {
     if (_kv.end() != iter) {
         _kv.erase(iter);
     }
+    reset_aead_context(type);
 }
 
 size_t tls_protection::get_header_size() {
@@ -125,6 +175,24 @@ return_t tls_protection::handshake_hello(tls_session *client_session, tls_sessio
         server_handshake_context.select_from(client_handshake_context);
         ciphersuite = server_handshake_context.get0_cipher_suite();
         tlsversion = server_handshake_context.get0_supported_version();
+
+        // RFC 8446 4.2.11.  the server MUST ensure that it selects a compatible PSK (if any) and cipher suite
+        auto &server_protection = server_session->get_tls_protection();
+        if (server_protection.is_resumption()) {
+            auto resumed = server_protection.get_cipher_suite();
+            bool found = false;
+            client_handshake_context.for_each_cipher_suites([&](uint16 cs, bool *control) -> void {
+                if (cs == resumed) {
+                    found = true;
+                    *control = true;
+                }
+            });
+            if (found) {
+                ciphersuite = resumed;
+            } else {
+                server_protection.set_resumption(false);  // a full handshake
+            }
+        }
     }
     __finally2 {}
     return ret;
@@ -115,6 +115,7 @@ return_t tls_protection::calc(tls_session *session, tls_hs_type_t type, tls_dire
                 kdf.hkdf_expand_tls13_label(okm, hashalg, dlen, secret, str2bin(label), context);
             }
             _kv[sec] = okm;
+            reset_aead_context(sec);  // key update
         };
         auto lambda_extract = [&](tls_secret_t sec, binary_t &prk, const char *hashalg, const binary_t &salt, const binary_t &ikm) -> void {
             kdf.hmac_kdf_extract(prk, hashalg, salt, ikm);
@@ -314,7 +315,14 @@ return_t tls_protection::calc(tls_session *session, tls_hs_type_t type, tls_dire
                     switch (get_flow()) {
                         case tls_1_rtt:
                         case tls_hello_retry_request: {
-                            lambda_expand_label(tls_secret_handshake_derived, secret_handshake_derived, hashalg, dlen, early_secret, "derived", empty_hash);
+                            if (is_resumption()) {
+                                // RFC 8446 2.2.  Resumption and Pre-Shared Key (PSK), psk_dhe_ke
+                                const binary_t &secret_resumption_early = get_item(tls_secret_resumption_early);
+                                lambda_expand_label(tls_secret_handshake_derived, secret_handshake_derived, hashalg, dlen, secret_resumption_early, "derived",
+                                                    empty_hash);
+                            } else {
+                                lambda_expand_label(tls_secret_handshake_derived, secret_handshake_derived, hashalg, dlen, early_secret, "derived", empty_hash);
+                            }
                         } break;
                         case tls_0_rtt: {
                             const binary_t &secret_resumption_early = get_item(tls_secret_resumption_early);
@@ -582,6 +590,25 @@ return_t tls_protection::calc(tls_session *session, tls_hs_type_t type, tls_dire
                 auto keysize = sizeof_key(hint_cipher);
                 auto ivsize = sizeof_iv(hint_cipher);
                 auto dlen = sizeof_digest(hint_digest);
+                switch (hint_tls_alg->mode) {
+                    case gcm:
+                    case ccm:
+                    case ccm8: {
+                        // RFC 5288 3.  AES-GCM Cipher Suites
+                        // RFC 6655 3.  RSA-Based AES-CCM Cipher Suites
+                        //   mac_key_length 0, fixed_iv_length 4 (salt)
+                        dlen = 0;
+                        ivsize = 4;
+                    } break;
+                    case mode_poly1305: {
+                        // RFC 7905 2.  ChaCha20 Cipher Suites
+                        //   mac_key_length 0, fixed_iv_length 12
+                        dlen = 0;
+                        ivsize = 12;
+                    } break;
+                    default: {
+                    } break;
+                }
                 size_t size_keycalc = (dlen << 1) + (keysize << 1) + (ivsize << 1);
                 size_t offset = 0;
 
@@ -650,30 +677,140 @@ return_t tls_protection::calc_psk(tls_session *session, const binary_t &binder_h
         set_item(tls_context_resumption_binder_hash, binder_hash);  // debug
 
         // RFC 8448 4.  Resumed 0-RTT Handshake
+        binary_t context_resumption_finished;
+        ret = calc_psk_binder(session, binder_hash, context_resumption_finished);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        if (psk_binder != context_resumption_finished) {
+            ret = errorcode_t::mismatch;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t tls_protection::calc_psk_binder(tls_session *session, const binary_t &binder_hash, binary_t &psk_binder) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        psk_binder.clear();
+
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        const hint_digest_t *hint_mac = hintof_psk_digest();
+        if (nullptr == hint_mac) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+        auto hashalg = hint_mac->fetchname;
+        auto dlen = hint_mac->digest_size;
 
         openssl_kdf kdf;
+        binary_t empty;
+        binary_t empty_hash;
+        openssl_digest dgst;
+        dgst.digest(hashalg, empty, empty_hash);
+
+        auto lambda_expand_label = [&](binary_t &okm, const binary_t &secret, const char *label, const binary_t &context) -> void {
+            okm.clear();
+            if (is_kindof_dtls()) {
+                kdf.hkdf_expand_dtls13_label(okm, hashalg, dlen, secret, str2bin(label), context);
+            } else {
+                kdf.hkdf_expand_tls13_label(okm, hashalg, dlen, secret, str2bin(label), context);
+            }
+        };
+
         // PRK
         binary_t context_resumption_binder_key;
         const binary_t &secret_resumption_early = get_item(tls_secret_resumption_early);
-        const binary_t &context_empty_hash = get_item(tls_context_empty_hash);
-        kdf.hkdf_expand_tls13_label(context_resumption_binder_key, sha2_256, 32, secret_resumption_early, "res binder", context_empty_hash);
+        lambda_expand_label(context_resumption_binder_key, secret_resumption_early, "res binder", empty_hash);
         set_item(tls_context_resumption_binder_key, context_resumption_binder_key);
 
         // expanded
         binary_t context_resumption_finished_key;
-        binary_t empty_ikm;
-        kdf.hkdf_expand_tls13_label(context_resumption_finished_key, sha2_256, 32, context_resumption_binder_key, "finished", empty_ikm);
+        lambda_expand_label(context_resumption_finished_key, context_resumption_binder_key, "finished", empty);
         set_item(tls_context_resumption_finished_key, context_resumption_finished_key);
 
         // finished
-        binary_t context_resumption_finished;
         openssl_mac mac;
-        mac.hmac(sha2_256, context_resumption_finished_key, binder_hash, context_resumption_finished);
-        set_item(tls_context_resumption_finished, context_resumption_finished);
+        mac.hmac(hashalg, context_resumption_finished_key, binder_hash, psk_binder);
+        set_item(tls_context_resumption_finished, psk_binder);
+    }
+    __finally2 {
+        // do nothing
+    }
 
-        if (psk_binder != context_resumption_finished) {
-            ret = errorcode_t::mismatch;
+    return ret;
+}
+
+return_t tls_protection::calc_resumption_psk(tls_session *session, const binary_t &ticket_nonce, binary_t &psk) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        psk.clear();
+
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        const hint_digest_t *hint_mac = hintof_psk_digest();
+        if (nullptr == hint_mac) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+        const binary_t &secret_resumption_master = get_item(tls_secret_res_master);
+        if (secret_resumption_master.empty()) {
+            ret = errorcode_t::not_ready;
+            __leave2;
+        }
+
+        openssl_kdf kdf;
+        if (is_kindof_dtls()) {
+            kdf.hkdf_expand_dtls13_label(psk, hint_mac->fetchname, hint_mac->digest_size, secret_resumption_master, str2bin("resumption"), ticket_nonce);
+        } else {
+            kdf.hkdf_expand_tls13_label(psk, hint_mac->fetchname, hint_mac->digest_size, secret_resumption_master, str2bin("resumption"), ticket_nonce);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t tls_protection::calc_resumption_early(tls_session *session, const binary_t &psk) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        const hint_digest_t *hint_mac = hintof_psk_digest();
+        if (nullptr == hint_mac) {
+            ret = errorcode_t::not_supported;
+            __leave2;
         }
+
+        binary_t salt;
+        salt.resize(hint_mac->digest_size);
+        binary_t resumption_early_secret;
+        openssl_kdf kdf;
+        kdf.hmac_kdf_extract(resumption_early_secret, hint_mac->fetchname, salt, psk);
+
+        set_item(tls_secret_resumption, psk);
+        set_item(tls_secret_resumption_early, resumption_early_secret);
     }
     __finally2 {
         // do nothing
@@ -682,6 +819,14 @@ return_t tls_protection::calc_psk(tls_session *session, const binary_t &binder_h
     return ret;
 }
 
+const hint_digest_t *tls_protection::hintof_psk_digest() {
+    auto cs = get_cipher_suite();
+    if (0 == cs) {
+        cs = 0x1301;  // TLS_AES_128_GCM_SHA256
+    }
+    return tls_advisor::get_instance()->hintof_digest(cs);
+}
+
 return_t tls_protection::calc_finished(tls_direction_t dir, hash_algorithm_t alg, uint16 dlen, tls_secret_t &typeof_secret, binary_t &maced) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -54,21 +54,45 @@ return_t tls_protection::get_cipher_info(tls_session *session, crypt_algorithm_t
 }
 
 return_t tls_protection::build_iv(tls_session *session, tls_secret_t type, binary_t &iv, uint64 recordno) {
+    iv.resize(12);
+    return_t ret = build_iv(session, type, &iv[0], iv.size(), recordno);
+    if (errorcode_t::success != ret) {
+        iv.clear();
+    }
+    return ret;
+}
+
+return_t tls_protection::build_iv(tls_session *session, tls_secret_t type, byte_t *iv, size_t size, uint64 recordno) {
     return_t ret = errorcode_t::success;
     __try2 {
-        if (nullptr == session) {
+        if ((nullptr == session) || (nullptr == iv) || (size < 12)) {
             ret = errorcode_t::invalid_parameter;
             __leave2;
         }
 
-        iv = get_item(type);
-        if (iv.empty()) {
+        memset(iv, 0, size);
+
+        const binary_t &item = get_item(type);
+        if (4 == item.size()) {
+            // RFC 5288 3.  AES-GCM Cipher Suites
+            //   struct {
+            //      opaque salt[4];
+            //      opaque nonce_explicit[8];
+            //   } GCMNonce;
+            // RFC 6655 3.  RSA-Based AES-CCM Cipher Suites (the same as GCMNonce)
+            memcpy(iv, &item[0], item.size());
+            for (uint64 i = 0; i < 8; i++) {
+                iv[12 - 1 - i] = ((recordno >> (i * 8)) & 0xff);
+            }
+        } else if (12 == item.size()) {
+            // RFC 8446 5.3.  Per-Record Nonce
+            // RFC 7905 2.  ChaCha20 Cipher Suites
+            memcpy(iv, &item[0], item.size());
+            for (uint64 i = 0; i < 8; i++) {
+                iv[12 - 1 - i] ^= ((recordno >> (i * 8)) & 0xff);
+            }
+        } else {
             ret = errorcode_t::bad_data;
-            __leave2;
-        }
-
-        for (uint64 i = 0; i < 8; i++) {
-            iv[12 - 1 - i] ^= ((recordno >> (i * 8)) & 0xff);
         }
     }
     __finally2 {
@@ -110,6 +134,52 @@ uint8 tls_protection::get_tag_size() {
     return ret_value;
 }
 
+uint8 tls_protection::get_record_iv_size() {
+    uint8 ret_value = 0;
+    tls_advisor *tlsadvisor = tls_advisor::get_instance();
+    if (tlsadvisor->is_kindof(tls_12, get_tls_version())) {
+        const tls_cipher_suite_t *hint = tlsadvisor->hintof_cipher_suite(get_cipher_suite());
+        if (hint) {
+            switch (hint->mode) {
+                case gcm:
+                case ccm:
+                case ccm8:
+                    ret_value = 8;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return ret_value;
+}
+
+return_t tls_protection::build_aad(tls_session *session, tls_direction_t dir, const byte_t *header, size_t hdrsize, uint16 length, binary_t &aad) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        aad.clear();
+
+        if ((nullptr == session) || (nullptr == header) || (hdrsize != get_header_size())) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        // TLS  content type(1) || version(2) || length(2)
+        // DTLS content type(1) || version(2) || epoch(2) || sequence_number(6) || length(2)
+        if (is_kindof_dtls()) {
+            binary_append(aad, header + 3, 8);
+        } else {
+            binary_append(aad, session->get_recordno(dir), hton64);
+        }
+        binary_append(aad, header, 3);
+        binary_append(aad, length, hton16);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t tls_protection::get_aead_key(tls_session *session, tls_direction_t dir, tls_secret_t &secret_key, tls_secret_t &secret_iv, protection_level_t level) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -123,7 +193,17 @@ return_t tls_protection::get_aead_key(tls_session *session, tls_direction_t dir,
 
         switch (session_type) {
             case session_tls: {
-                if (from_client == dir) {
+                if (tls_advisor::get_instance()->is_kindof(tls_12, get_tls_version())) {
+                    // RFC 5246 6.3.  Key Calculation
+                    //   client_write_key, server_write_key, client_write_IV, server_write_IV
+                    if (from_client == dir) {
+                        secret_key = tls_secret_client_key;
+                        secret_iv = tls_secret_client_iv;
+                    } else {
+                        secret_key = tls_secret_server_key;
+                        secret_iv = tls_secret_server_iv;
+                    }
+                } else if (from_client == dir) {
                     // TLS, DTLS
                     auto flow = get_flow();
                     if (tls_1_rtt == flow || tls_hello_retry_request == flow) {
@@ -281,6 +361,72 @@ return_t tls_protection::encrypt(tls_session *session, tls_direction_t dir, cons
     return ret;
 }
 
+return_t tls_protection::encrypt(tls_session *session, tls_direction_t dir, const byte_t *aad, size_t aadlen, byte_t *stream, size_t size, byte_t *tag,
+                                 protection_level_t level) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if ((nullptr == session) || (nullptr == stream) || (nullptr == tag) || ((nullptr == aad) && aadlen)) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        auto cipher = crypt_alg_unknown;
+        auto mode = mode_unknown;
+
+        ret = get_cipher_info(session, cipher, mode);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        switch (mode) {
+            case gcm:
+            case ccm:
+            case ccm8:
+            case mode_poly1305:
+                break;
+            default:
+                ret = errorcode_t::not_supported;
+                break;
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        tls_secret_t secret_key;
+        tls_secret_t secret_iv;
+        get_aead_key(session, dir, secret_key, secret_iv, level);
+
+        uint64 record_no = 0;
+        record_no = session->get_recordno(dir, true, level);
+
+        byte_t nonce[12];
+        ret = build_iv(session, secret_iv, nonce, sizeof(nonce), record_no);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        size_t tagsize = get_tag_size();
+        ret = aead_encrypt(secret_key, cipher, mode, nonce, sizeof(nonce), aad, aadlen, stream, size, stream, tag, tagsize);
+
+        if (istraceable()) {
+            basic_stream dbs;
+            dbs.printf("> encrypt (in place)\n");
+            dbs.printf(" > key[%08x] iv[%08x]\n", secret_key, secret_iv);
+            dbs.printf(" > record no %i\n", record_no);
+            dbs.printf(" > nonce %s\n", base16_encode(nonce, sizeof(nonce)).c_str());
+            dbs.printf(" > aad %s\n", base16_encode(aad, aadlen).c_str());
+            dbs.printf(" > tag %s\n", base16_encode(tag, tagsize).c_str());
+            dbs.printf(" > ciphertext\n");
+            dump_memory(stream, size, &dbs, 16, 3, 0x0, dump_notrunc);
+
+            trace_debug_event(category_net, net_event_tls_write, &dbs);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t tls_protection::encrypt_aead(tls_session *session, tls_direction_t dir, const binary_t &plaintext, binary_t &ciphertext, const binary_t &aad,
                                       binary_t &tag, protection_level_t level) {
     return_t ret = errorcode_t::success;
@@ -302,9 +448,6 @@ return_t tls_protection::encrypt_aead(tls_session *session, tls_direction_t dir,
             __leave2;
         }
 
-        crypt_context_t *handle = nullptr;
-        openssl_crypt crypt;
-
         tls_secret_t secret_key;
         tls_secret_t secret_iv;
         get_aead_key(session, dir, secret_key, secret_iv, level);
@@ -314,9 +457,23 @@ return_t tls_protection::encrypt_aead(tls_session *session, tls_direction_t dir,
 
         auto const &key = get_item(secret_key);
         auto const &iv = get_item(secret_iv);
-        binary_t nonce = iv;
-        build_iv(session, secret_iv, nonce, record_no);
-        ret = crypt.encrypt(cipher, mode, key, nonce, plaintext, ciphertext, aad, tag);
+        binary_t nonce;
+        ret = build_iv(session, secret_iv, nonce, record_no);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        size_t tagsize = 16;
+        ciphertext.resize(plaintext.size());
+        tag.resize(tagsize);
+        ret = aead_encrypt(secret_key, cipher, mode, &nonce[0], nonce.size(), aad.data(), aad.size(), plaintext.data(), plaintext.size(), ciphertext.data(),
+                           &tag[0], tagsize);
+        if (errorcode_t::success == ret) {
+            tag.resize(tagsize);
+        } else {
+            ciphertext.clear();
+            tag.clear();
+        }
 
         if (istraceable()) {
             basic_stream dbs;
@@ -550,6 +707,73 @@ return_t tls_protection::decrypt(tls_session *session, tls_direction_t dir, cons
     return ret;
 }
 
+return_t tls_protection::decrypt(tls_session *session, tls_direction_t dir, const byte_t *aad, size_t aadlen, byte_t *stream, size_t size, const byte_t *tag,
+                                 protection_level_t level) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if ((nullptr == session) || (nullptr == stream) || (nullptr == tag) || ((nullptr == aad) && aadlen)) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        auto cipher = crypt_alg_unknown;
+        auto mode = mode_unknown;
+
+        ret = get_cipher_info(session, cipher, mode);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        switch (mode) {
+            case gcm:
+            case ccm:
+            case ccm8:
+            case mode_poly1305:
+                break;
+            default:
+                ret = errorcode_t::not_supported;
+                break;
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        tls_secret_t secret_key;
+        tls_secret_t secret_iv;
+        get_aead_key(session, dir, secret_key, secret_iv, level);
+
+        uint64 record_no = 0;
+        record_no = session->get_recordno(dir, true, level);
+
+        byte_t nonce[12];
+        ret = build_iv(session, secret_iv, nonce, sizeof(nonce), record_no);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        ret = aead_decrypt(secret_key, cipher, mode, nonce, sizeof(nonce), aad, aadlen, stream, size, stream, tag, get_tag_size());
+
+        if (istraceable()) {
+            basic_stream dbs;
+            dbs.printf("> decrypt (in place)\n");
+            dbs.printf(" > key[%08x] iv[%08x]\n", secret_key, secret_iv);
+            dbs.printf(" > record no %i\n", record_no);
+            dbs.printf(" > nonce %s\n", base16_encode(nonce, sizeof(nonce)).c_str());
+            dbs.printf(" > aad %s\n", base16_encode(aad, aadlen).c_str());
+            dbs.printf(" > tag %s\n", base16_encode(tag, get_tag_size()).c_str());
+            if (errorcode_t::success == ret) {
+                dbs.printf(" > plaintext\n");
+                dump_memory(stream, size, &dbs, 16, 3, 0x0, dump_notrunc);
+            }
+
+            trace_debug_event(category_net, net_event_tls_read, &dbs);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
 return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir, const byte_t *stream, size_t size, size_t pos, binary_t &plaintext,
                                       protection_level_t level) {
     return_t ret = errorcode_t::success;
@@ -562,16 +786,53 @@ return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir,
         size_t aadlen = get_header_size();
 
         binary_t aad;
-        binary_append(aad, stream + pos, aadlen);
-
         binary_t tag;
         uint8 tagsize = get_tag_size();
+        const byte_t *nonce_explicit = nullptr;
+
+        if ((session_tls == session->get_type()) && tls_advisor::get_instance()->is_kindof(tls_12, get_tls_version())) {
+            /**
+             * RFC 5246 6.2.3.3.  AEAD Ciphers
+             *   struct {
+             *      opaque nonce_explicit[SecurityParameters.record_iv_length];
+             *      aead-ciphered struct {
+             *          opaque content[TLSCompressed.length];
+             *      };
+             *   } GenericAEADCipher;
+             *
+             * ... header(aadlen) nonce_explicit(record_iv_size) encdata tag(tagsize)
+             *     \_ pos
+             */
+            size_t record_iv_size = get_record_iv_size();
+            if (size < record_iv_size + tagsize) {
+                ret = errorcode_t::bad_data;
+                __leave2;
+            }
+            if (record_iv_size) {
+                nonce_explicit = stream + pos + aadlen;
+            }
+            size_t ptlen = size - record_iv_size - tagsize;
+            ret = build_aad(session, dir, stream + pos, aadlen, ptlen, aad);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+            binary_append(tag, stream + (pos + aadlen) + size - tagsize, tagsize);
+
+            ret = decrypt_aead(session, dir, stream, ptlen, pos + aadlen + record_iv_size, plaintext, aad, tag, level, nonce_explicit);
+        } else {
+            if (size < tagsize) {
+                ret = errorcode_t::bad_data;
+                __leave2;
+            }
+
+            binary_append(aad, stream + pos, aadlen);
 
-        // ... aad(aadlen) encdata tag(tagsize)
-        //     \_ pos
-        binary_append(tag, stream + (pos + aadlen) + size - tagsize, tagsize);
+            // ... aad(aadlen) encdata tag(tagsize)
+            //     \_ pos
+            binary_append(tag, stream + (pos + aadlen) + size - tagsize, tagsize);
 
-        ret = decrypt_aead(session, dir, stream, size - tagsize, pos + aadlen, plaintext, aad, tag, level);
+            ret = decrypt_aead(session, dir, stream, size - tagsize, pos + aadlen, plaintext, aad, tag, level);
+        }
     }
     __finally2 {
         // do nothing
@@ -580,7 +841,7 @@ return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir,
 }
 
 return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir, const byte_t *stream, size_t size, size_t pos, binary_t &plaintext,
-                                      const binary_t &aad, const binary_t &tag, protection_level_t level) {
+                                      const binary_t &aad, const binary_t &tag, protection_level_t level, const byte_t *nonce_explicit) {
     return_t ret = errorcode_t::success;
     __try2 {
         if (nullptr == session || nullptr == stream) {
@@ -594,9 +855,6 @@ return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir,
 
         auto record_version = get_lagacy_version();
 
-        crypt_context_t *handle = nullptr;
-        openssl_crypt crypt;
-
         ret = get_cipher_info(session, cipher, mode);
         if (errorcode_t::success != ret) {
             __leave2;
@@ -611,9 +869,22 @@ return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir,
 
         auto const &key = get_item(secret_key);
         auto const &iv = get_item(secret_iv);
-        binary_t nonce = iv;
-        build_iv(session, secret_iv, nonce, record_no);
-        ret = crypt.decrypt(cipher, mode, key, nonce, stream + pos, size, plaintext, aad, tag);
+        binary_t nonce;
+        ret = build_iv(session, secret_iv, nonce, record_no);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        if (nonce_explicit) {
+            // salt(4) || nonce_explicit(8), as sent by the peer
+            memcpy(&nonce[4], nonce_explicit, 8);
+        }
+
+        plaintext.resize(size);
+        ret = aead_decrypt(secret_key, cipher, mode, &nonce[0], nonce.size(), aad.data(), aad.size(), stream + pos, size, plaintext.data(), tag.data(),
+                           tag.size());
+        if (errorcode_t::success != ret) {
+            plaintext.clear();
+        }
 
         if (istraceable()) {
             basic_stream dbs;
@@ -638,6 +909,126 @@ return_t tls_protection::decrypt_aead(tls_session *session, tls_direction_t dir,
     return ret;
 }
 
+return_t tls_protection::aead_encrypt(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode, const byte_t *nonce, size_t noncesize,
+                                      const byte_t *aad, size_t aadlen, const byte_t *plaintext, size_t size, byte_t *ciphertext, byte_t *tag,
+                                      size_t &tagsize) {
+    return_t ret = errorcode_t::success;
+    aead_context_t *context = nullptr;
+    __try2 {
+        context = get_aead_context(secret_key, alg, mode);
+        if (nullptr == context) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+        openssl_crypt crypt;
+        ret = crypt.set(context->handle, crypt_item_t::item_iv, nonce, noncesize);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        ret = crypt.encrypt(context->handle, plaintext, size, ciphertext, aad, aadlen, tag, tagsize);
+    }
+    __finally2 {
+        if (context) {
+            context->lock.leave();
+        }
+    }
+    return ret;
+}
+
+return_t tls_protection::aead_decrypt(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode, const byte_t *nonce, size_t noncesize,
+                                      const byte_t *aad, size_t aadlen, const byte_t *ciphertext, size_t size, byte_t *plaintext, const byte_t *tag,
+                                      size_t tagsize) {
+    return_t ret = errorcode_t::success;
+    aead_context_t *context = nullptr;
+    __try2 {
+        context = get_aead_context(secret_key, alg, mode);
+        if (nullptr == context) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+        openssl_crypt crypt;
+        ret = crypt.set(context->handle, crypt_item_t::item_iv, nonce, noncesize);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        ret = crypt.decrypt(context->handle, ciphertext, size, plaintext, aad, aadlen, tag, tagsize);
+    }
+    __finally2 {
+        if (context) {
+            context->lock.leave();
+        }
+    }
+    return ret;
+}
+
+tls_protection::aead_context_t *tls_protection::get_aead_context(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode) {
+    aead_context_t *context = nullptr;
+    critical_section_guard guard(_lock);
+
+    const binary_t &key = _kv[secret_key];
+    auto iter = _aead.find(secret_key);
+    if (_aead.end() != iter) {
+        context = iter->second;
+        context->lock.enter();
+        // a key installed without set_item
+        if (key != context->key) {
+            context->lock.leave();
+            reset_aead_context(secret_key);
+            context = nullptr;
+        }
+    }
+
+    if (nullptr == context) {
+        openssl_crypt crypt;
+        crypt_context_t *handle = nullptr;
+        binary_t iv(12, 0);  // see aead_encrypt, aead_decrypt
+        return_t ret = crypt.open(&handle, alg, mode, key.data(), key.size(), iv.data(), iv.size());
+        if (errorcode_t::success == ret) {
+            if (ccm8 == mode) {
+                crypt.set(handle, crypt_ctrl_tsize, 8);  // see get_tag_size
+            }
+            context = new aead_context_t;
+            context->handle = handle;
+            context->key = key;
+            context->lock.enter();
+            _aead.insert({secret_key, context});
+        }
+    }
+
+    return context;
+}
+
+void tls_protection::reset_aead_context(tls_secret_t secret_key) {
+    critical_section_guard guard(_lock);
+    auto iter = _aead.find(secret_key);
+    if (_aead.end() != iter) {
+        auto context = iter->second;
+        // wait for a record in progress
+        context->lock.enter();
+        context->lock.leave();
+
+        openssl_crypt crypt;
+        crypt.close(context->handle);
+        std::fill(context->key.begin(), context->key.end(), 0);
+        delete context;
+        _aead.erase(iter);
+    }
+}
+
+void tls_protection::clear_aead_contexts() {
+    critical_section_guard guard(_lock);
+    openssl_crypt crypt;
+    for (auto &item : _aead) {
+        auto context = item.second;
+        crypt.close(context->handle);
+        std::fill(context->key.begin(), context->key.end(), 0);
+        delete context;
+    }
+    _aead.clear();
+}
+
 return_t tls_protection::decrypt_cbc_hmac(tls_session *session, tls_direction_t dir, const byte_t *stream, size_t size, size_t pos, binary_t &plaintext) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -0,0 +1,522 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#include <time.h>
+
+#include <sdk/base/basic/binary.hpp>
+#include <sdk/crypto/basic/openssl_crypt.hpp>
+#include <sdk/crypto/basic/openssl_prng.hpp>
+#include <sdk/net/tls/tls_advisor.hpp>
+#include <sdk/net/tls/tls_protection.hpp>
+#include <sdk/net/tls/tls_resumption.hpp>
+#include <sdk/net/tls/tls_session.hpp>
+
+namespace hotplace {
+namespace net {
+
+#define TLS_TICKET_KEY_NAME_SIZE 16
+#define TLS_TICKET_KEY_SIZE 32
+#define TLS_TICKET_IV_SIZE 12
+#define TLS_TICKET_TAG_SIZE 16
+#define TLS_TICKET_STATE_SIZE 25  // version(2) cipher_suite(2) issued(8) age_add(4) lifetime(4) max_early_data_size(4) psk_len(1), psk alpn_len(1) alpn follow
+#define TLS_TICKET_LIFETIME_MAX 604800
+
+static const char* constexpr_ticket_alg = "aes-256-gcm";
+
+tls_resumption tls_resumption::_instance;
+
+tls_resumption* tls_resumption::get_instance() { return &_instance; }
+
+tls_resumption::tls_resumption() : _lifetime(7200), _rotation(3600), _cache_size(0), _max_early_data_size(0), _replay_window(10) {}
+
+tls_resumption::~tls_resumption() {}
+
+tls_resumption& tls_resumption::set_lifetime(uint32 lifetime) {
+    // RFC 8446 4.6.1.  Servers MUST NOT use any value greater than 604800 seconds (7 days).
+    critical_section_guard guard(_lock);
+    _lifetime = (lifetime > TLS_TICKET_LIFETIME_MAX) ? TLS_TICKET_LIFETIME_MAX : lifetime;
+    return *this;
+}
+
+uint32 tls_resumption::get_lifetime() { return _lifetime; }
+
+tls_resumption& tls_resumption::set_rotation(uint32 interval) {
+    critical_section_guard guard(_lock);
+    _rotation = interval;
+    return *this;
+}
+
+tls_resumption& tls_resumption::set_cache_size(size_t size) {
+    critical_section_guard guard(_lock);
+    _cache_size = size;
+    evict();
+    return *this;
+}
+
+tls_resumption& tls_resumption::set_max_early_data_size(uint32 size) {
+    critical_section_guard guard(_lock);
+    _max_early_data_size = size;
+    return *this;
+}
+
+uint32 tls_resumption::get_max_early_data_size() { return _max_early_data_size; }
+
+tls_resumption& tls_resumption::set_replay_window(uint32 window) {
+    critical_section_guard guard(_lock);
+    _replay_window = window;
+    return *this;
+}
+
+void tls_resumption::rotate() {
+    critical_section_guard guard(_lock);
+    time_t now = time(nullptr);
+    new_key(now);
+    expire_keys(now);
+}
+
+return_t tls_resumption::issue(tls_session* session, const binary_t& nonce, uint32& lifetime, uint32& age_add, binary_t& ticket) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        lifetime = 0;
+        age_add = 0;
+        ticket.clear();
+
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        auto& protection = session->get_tls_protection();
+        if (false == protection.is_kindof_tls13()) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+        ticket_state_t state;
+        ret = protection.calc_resumption_psk(session, nonce, state.psk);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        openssl_prng prng;
+        time_t now = time(nullptr);
+        state.version = protection.get_tls_version();
+        state.cipher_suite = protection.get_cipher_suite();
+        state.alpn = protection.get_item(tls_context_alpn);
+        state.issued = now;
+        state.age_add = prng.rand32();
+
+        critical_section_guard guard(_lock);
+
+        state.lifetime = _lifetime;
+        state.max_early_data_size = _max_early_data_size;
+
+        if (_keys.empty() || (_keys.front().created + _rotation <= now)) {
+            new_key(now);
+        }
+        expire_keys(now);
+
+        ret = seal(state, ticket);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        if (_cache_size) {
+            insert_cache(ticket, state);
+        }
+
+        lifetime = state.lifetime;
+        age_add = state.age_add;
+        _stat.issued++;
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t tls_resumption::resume(tls_session* session, const binary_t& ticket, uint32 obfuscated_ticket_age, const byte_t* partial_client_hello, size_t size,
+                                const binary_t& binder) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if ((nullptr == session) || (nullptr == partial_client_hello) || ticket.empty()) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        ticket_state_t state;
+        {
+            critical_section_guard guard(_lock);
+            _stat.offered++;
+            ret = search_cache(ticket, state);
+            if (errorcode_t::success != ret) {
+                ret = open(ticket, state);
+            }
+        }
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        // RFC 8446 4.6.1.  Clients MUST NOT attempt to use tickets which have ages greater than the "ticket_lifetime" value
+        // RFC 8446 4.2.11.  The "obfuscated_ticket_age" field of each PskIdentity contains an obfuscated version of the ticket age
+        time_t now = time(nullptr);
+        uint32 ticket_age = obfuscated_ticket_age - state.age_add;  // in milliseconds, modulo 2^32
+        if ((state.issued + state.lifetime < (uint64)now) || (ticket_age / 1000 > state.lifetime)) {
+            ret = errorcode_t::expired;
+            __leave2;
+        }
+
+        auto& protection = session->get_tls_protection();
+        const hint_digest_t* hint_mac = tls_advisor::get_instance()->hintof_digest(state.cipher_suite);
+        if (nullptr == hint_mac) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+        protection.set_tls_version(state.version);
+        protection.set_cipher_suite(state.cipher_suite);
+
+        ret = protection.calc_resumption_early(session, state.psk);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        // RFC 8446 4.2.11.2.  PSK Binder
+        binary_t binder_hash;
+        ret = protection.calc_context_hash(session, hint_mac->algorithm, partial_client_hello, size, binder_hash);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+        ret = protection.calc_psk(session, binder_hash, binder);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        protection.set_resumption(true);
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   the first identity is selected, the early data is accepted if the ticket allows, the ClientHello is fresh and not replayed
+        if (tls_early_data_offered == protection.get_early_data()) {
+            critical_section_guard guard(_lock);
+            protection.set_max_early_data_size(state.max_early_data_size);
+            if (match_early_data(session, state) && accept_early_data(state, ticket_age, binder, now)) {
+                // the server selects the ALPN protocol of the ticket (see tls_extension_alpn)
+                protection.set_item(tls_context_alpn, state.alpn);
+                protection.set_early_data(tls_early_data_accepted);
+                protection.set_flow(tls_0_rtt);
+                _stat.early_data_accepted++;
+            } else {
+                // RFC 8446 4.2.10.  the server skips past the early data (up to max_early_data_size)
+                protection.set_early_data(tls_early_data_rejected);
+                _stat.early_data_rejected++;
+            }
+        }
+    }
+    __finally2 {
+        if (session) {
+            critical_section_guard guard(_lock);
+            if (errorcode_t::success == ret) {
+                _stat.resumed++;
+            } else {
+                _stat.rejected++;
+
+                auto& protection = session->get_tls_protection();
+                if (tls_early_data_offered == protection.get_early_data()) {
+                    protection.set_max_early_data_size(_max_early_data_size);
+                    protection.set_early_data(tls_early_data_rejected);
+                    _stat.early_data_rejected++;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+void tls_resumption::get_stat(tls_resumption_stat_t* stat) {
+    if (stat) {
+        critical_section_guard guard(_lock);
+        *stat = _stat;
+        stat->entries = _cache_map.size();
+    }
+}
+
+void tls_resumption::clear() {
+    critical_section_guard guard(_lock);
+    _keys.clear();
+    _cache_map.clear();
+    _lru.clear();
+    _strikes.clear();
+    _strike_order.clear();
+}
+
+void tls_resumption::new_key(time_t now) {
+    openssl_prng prng;
+    ticket_key_t item;
+    prng.random(item.name, TLS_TICKET_KEY_NAME_SIZE);
+    prng.random(item.key, TLS_TICKET_KEY_SIZE);
+    item.created = now;
+    _keys.push_front(item);
+}
+
+void tls_resumption::expire_keys(time_t now) {
+    // a previous key decrypts until the tickets issued under it expire
+    while (_keys.size() > 1) {
+        const ticket_key_t& item = _keys.back();
+        if (item.created + _rotation + _lifetime < now) {
+            _keys.pop_back();
+        } else {
+            break;
+        }
+    }
+}
+
+return_t tls_resumption::seal(const ticket_state_t& state, binary_t& ticket) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (_keys.empty() || (state.psk.size() > 0xff) || (state.alpn.size() > 0xff)) {
+            ret = errorcode_t::invalid_request;
+            __leave2;
+        }
+
+        const ticket_key_t& item = _keys.front();
+
+        binary_t plaintext;
+        binary_append(plaintext, state.version, hton16);
+        binary_append(plaintext, state.cipher_suite, hton16);
+        binary_append(plaintext, state.issued, hton64);
+        binary_append(plaintext, state.age_add, hton32);
+        binary_append(plaintext, state.lifetime, hton32);
+        binary_append(plaintext, state.max_early_data_size, hton32);
+        binary_append(plaintext, uint8(state.psk.size()));
+        binary_append(plaintext, state.psk);
+        binary_append(plaintext, uint8(state.alpn.size()));
+        binary_append(plaintext, state.alpn);
+
+        openssl_prng prng;
+        openssl_crypt crypt;
+        binary_t iv;
+        binary_t ciphertext;
+        binary_t tag;
+        prng.random(iv, TLS_TICKET_IV_SIZE);
+        ret = crypt.encrypt(constexpr_ticket_alg, item.key, iv, plaintext, ciphertext, item.name, tag);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        ticket = item.name;
+        binary_append(ticket, iv);
+        binary_append(ticket, ciphertext);
+        binary_append(ticket, tag);
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t tls_resumption::open(const binary_t& ticket, ticket_state_t& state) {
+    return_t ret = errorcode_t::success;
+
+    __try2 {
+        if (ticket.size() < TLS_TICKET_KEY_NAME_SIZE + TLS_TICKET_IV_SIZE + TLS_TICKET_STATE_SIZE + TLS_TICKET_TAG_SIZE) {
+            ret = errorcode_t::bad_data;
+            __leave2;
+        }
+
+        binary_t name(ticket.begin(), ticket.begin() + TLS_TICKET_KEY_NAME_SIZE);
+        const ticket_key_t* item = nullptr;
+        for (const auto& key : _keys) {
+            if (key.name == name) {
+                item = &key;
+                break;
+            }
+        }
+        if (nullptr == item) {
+            ret = errorcode_t::not_found;  // rotated out
+            __leave2;
+        }
+
+        auto iter_iv = ticket.begin() + TLS_TICKET_KEY_NAME_SIZE;
+        auto iter_tag = ticket.end() - TLS_TICKET_TAG_SIZE;
+        binary_t iv(iter_iv, iter_iv + TLS_TICKET_IV_SIZE);
+        binary_t ciphertext(iter_iv + TLS_TICKET_IV_SIZE, iter_tag);
+        binary_t tag(iter_tag, ticket.end());
+        binary_t plaintext;
+
+        openssl_crypt crypt;
+        ret = crypt.decrypt(constexpr_ticket_alg, item->key, iv, ciphertext, plaintext, name, tag);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        const byte_t* p = &plaintext[0];
+        size_t psklen = p[24];
+        if (plaintext.size() < TLS_TICKET_STATE_SIZE + psklen + 1) {
+            ret = errorcode_t::bad_data;
+            __leave2;
+        }
+        size_t alpnlen = p[TLS_TICKET_STATE_SIZE + psklen];
+        if (plaintext.size() != TLS_TICKET_STATE_SIZE + psklen + 1 + alpnlen) {
+            ret = errorcode_t::bad_data;
+            __leave2;
+        }
+
+        state.version = t_binary_to_integer<uint16>(p, 2);
+        state.cipher_suite = t_binary_to_integer<uint16>(p + 2, 2);
+        state.issued = t_binary_to_integer<uint64>(p + 4, 8);
+        state.age_add = t_binary_to_integer<uint32>(p + 12, 4);
+        state.lifetime = t_binary_to_integer<uint32>(p + 16, 4);
+        state.max_early_data_size = t_binary_to_integer<uint32>(p + 20, 4);
+        state.psk.assign(p + TLS_TICKET_STATE_SIZE, p + TLS_TICKET_STATE_SIZE + psklen);
+        state.alpn.assign(p + TLS_TICKET_STATE_SIZE + psklen + 1, p + TLS_TICKET_STATE_SIZE + psklen + 1 + alpnlen);
+    }
+    __finally2 {
+        // do nothing
+    }
+
+    return ret;
+}
+
+return_t tls_resumption::search_cache(const binary_t& ticket, ticket_state_t& state) {
+    return_t ret = errorcode_t::success;
+    auto iter = _cache_map.find(ticket);
+    if (_cache_map.end() == iter) {
+        ret = errorcode_t::not_found;
+    } else {
+        cache_entry_t& entry = iter->second;
+        _lru.splice(_lru.begin(), _lru, entry.lru);
+        state = entry.state;
+        _stat.cache_hit++;
+    }
+    return ret;
+}
+
+void tls_resumption::insert_cache(const binary_t& ticket, const ticket_state_t& state) {
+    auto iter = _cache_map.find(ticket);
+    if (_cache_map.end() == iter) {
+        cache_entry_t entry;
+        entry.state = state;
+        entry.lru = _lru.insert(_lru.begin(), ticket);
+        _cache_map.insert(std::make_pair(ticket, entry));
+        evict();
+    }
+}
+
+void tls_resumption::evict() {
+    // the least recently used
+    while ((_cache_map.size() > _cache_size) && (false == _lru.empty())) {
+        _cache_map.erase(_lru.back());
+        _lru.pop_back();
+        _stat.evict++;
+    }
+}
+
+bool tls_resumption::match_early_data(tls_session* session, const ticket_state_t& state) {
+    bool ret_value = false;
+    __try2 {
+        auto& protection = session->get_tls_protection();
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   the TLS version number, the selected cipher suite and the selected ALPN protocol, if any,
+        //   are the same as those associated with the selected PSK
+
+        // the cipher suite of the ticket is selected if offered (see tls_protection::negotiate)
+        bool offered = false;
+        protection.get_protection_context().for_each_cipher_suites([&](uint16 cs, bool* control) -> void {
+            if (cs == state.cipher_suite) {
+                offered = true;
+                *control = true;
+            }
+        });
+        if (false == offered) {
+            __leave2;
+        }
+
+        // ProtocolNameList, a ticket without ALPN matches a ClientHello without ALPN
+        const binary_t& protocols = protection.get_item(tls_context_client_hello_alpn);
+        if (state.alpn.empty()) {
+            ret_value = protocols.empty();
+            __leave2;
+        }
+        // the selected one (a single ProtocolName) is among those offered
+        size_t pos = 0;
+        while (pos < protocols.size()) {
+            size_t len = 1 + protocols[pos];
+            if (pos + len > protocols.size()) {
+                break;
+            }
+            if ((len == state.alpn.size()) && (0 == memcmp(&protocols[pos], &state.alpn[0], len))) {
+                ret_value = true;
+                break;
+            }
+            pos += len;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret_value;
+}
+
+bool tls_resumption::accept_early_data(const ticket_state_t& state, uint32 ticket_age, const binary_t& binder, time_t now) {
+    bool ret_value = false;
+    __try2 {
+        if (0 == state.max_early_data_size) {
+            __leave2;
+        }
+
+        // RFC 8446 8.3.  Freshness Checks
+        //   expected_arrival_time = adjusted_creation_time + clients_ticket_age
+        //   a ClientHello outside the window is not fresh, the replay window bounds the binders to keep
+        int64 window = int64(_replay_window) * 1000;
+        int64 skew = (int64(now) - int64(state.issued)) * 1000 - int64(ticket_age);
+        if ((skew > window) || (skew < -window)) {
+            __leave2;
+        }
+
+        // RFC 8446 8.2.  ClientHello Recording
+        //   the binder is unique to a ClientHello (it covers the random)
+        expire_strikes(now);
+        if (_strikes.end() != _strikes.find(binder)) {
+            _stat.replayed++;
+            __leave2;
+        }
+        _strikes.insert(std::make_pair(binder, now));
+        _strike_order.push_back(binder);
+
+        ret_value = true;
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret_value;
+}
+
+void tls_resumption::expire_strikes(time_t now) {
+    while (false == _strike_order.empty()) {
+        auto iter = _strikes.find(_strike_order.front());
+        if ((_strikes.end() != iter) && (iter->second + _replay_window >= now)) {
+            break;
+        }
+        if (_strikes.end() != iter) {
+            _strikes.erase(iter);
+        }
+        _strike_order.pop_front();
+    }
+}
+
+}  // namespace net
+}  // namespace hotplace
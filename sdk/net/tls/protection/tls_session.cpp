@@ -105,5 +105,26 @@ return_t tls_session::pop_alert(uint8& level, uint8& desc) {
     return ret;
 }
 
+void tls_session::push_early_data(const byte_t* data, size_t size) {
+    if (data && size) {
+        critical_section_guard guard(_lock);
+        _early_data.push(binary_t(data, data + size));
+    }
+}
+
+size_t tls_session::numberof_early_data() { return _early_data.size(); }
+
+return_t tls_session::pop_early_data(binary_t& data) {
+    return_t ret = errorcode_t::success;
+    critical_section_guard guard(_lock);
+    if (_early_data.empty()) {
+        ret = errorcode_t::not_found;
+    } else {
+        data = std::move(_early_data.front());
+        _early_data.pop();
+    }
+    return ret;
+}
+
 }  // namespace net
 }  // namespace hotplace
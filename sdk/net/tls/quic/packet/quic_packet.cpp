@@ -95,22 +95,37 @@ return_t quic_packet::read(tls_direction_t dir, const byte_t* stream, size_t siz
 return_t quic_packet::read(tls_direction_t dir, const binary_t& bin, size_t& pos) { return read(dir, &bin[0], bin.size(), pos); }
 
 return_t quic_packet::write(tls_direction_t dir, binary_t& packet) {
+    size_t hdrsize = 0;
+    packet.clear();
+    return do_write(dir, packet, hdrsize);
+}
+
+return_t quic_packet::write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag) {
     return_t ret = errorcode_t::success;
     __try2 {
-        binary_t header;
-        binary_t ciphertext;
-        binary_t tag;
+        binary_t packet;
+        size_t hdrsize = 0;
 
-        packet.clear();
+        header.clear();
+        ciphertext.clear();
+        tag.clear();
 
-        ret = write(dir, header, ciphertext, tag);
+        ret = do_write(dir, packet, hdrsize);
         if (errorcode_t::success != ret) {
             __leave2;
         }
 
-        binary_append(packet, header);
-        binary_append(packet, ciphertext);
-        binary_append(packet, tag);
+        if (hdrsize == packet.size()) {
+            header = std::move(packet);
+        } else {
+            auto session = get_session();
+            auto tagsize = session->get_tls_protection().get_tag_size();
+            size_t ciphersize = packet.size() - hdrsize - tagsize;
+
+            binary_append(header, &packet[0], hdrsize);
+            binary_append(ciphertext, &packet[hdrsize], ciphersize);
+            binary_append(tag, &packet[hdrsize + ciphersize], tagsize);
+        }
     }
     __finally2 {
         // do nothing
@@ -118,7 +133,10 @@ return_t quic_packet::write(tls_direction_t dir, binary_t& packet) {
     return ret;
 }
 
-return_t quic_packet::write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag) { return errorcode_t::success; }
+return_t quic_packet::do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize) {
+    hdrsize = 0;
+    return errorcode_t::success;
+}
 
 return_t quic_packet::write_header(binary_t& header) { return write(from_any, header); }
 
@@ -320,38 +338,46 @@ void quic_packet::set_session(tls_session* session) {
     }
 }
 
-return_t quic_packet::header_protect(tls_direction_t dir, const binary_t& bin_ciphertext, protection_level_t level, uint8 hdr, uint8 pn_length,
-                                     binary_t& bin_pn, binary_t& bin_protected_header) {
+return_t quic_packet::protect(tls_direction_t dir, protection_level_t level, binary_t& packet, size_t offset, size_t hdrsize, uint8 pn_length) {
     return_t ret = errorcode_t::success;
     __try2 {
         auto session = get_session();
         auto& protection = session->get_tls_protection();
+        auto tagsize = protection.get_tag_size();
 
-        if ((pn_length > 4) || bin_protected_header.empty()) {
+        size_t pos = offset + hdrsize;
+        if ((pn_length > 4) || (0 == hdrsize) || (hdrsize < pn_length) || (packet.size() < pos + 4)) {
             ret = errorcode_t::invalid_parameter;
             __leave2;
         }
 
-        auto adj = 4 - pn_length;
-        binary_append(bin_pn, &bin_ciphertext[0], adj);
+        // unprotected header (AAD) || payload || tag
+        size_t size = packet.size() - pos;
+        packet.resize(pos + size + tagsize);
+
+        // AEAD
+        ret = protection.encrypt(session, dir, &packet[offset], hdrsize, &packet[pos], size, &packet[pos + size], level);
+        if (errorcode_t::success != ret) {
+            packet.resize(offset);
+            __leave2;
+        }
 
-        // calcurate mask
+        // Header Protection
+        // the sample begins 4 bytes after the start of the Packet Number field
+        auto adj = 4 - pn_length;
         binary_t bin_mask;
-        ret = protection.protection_mask(session, dir, &bin_ciphertext[adj], bin_ciphertext.size(), bin_mask, 5, level);
+        ret = protection.protection_mask(session, dir, &packet[pos + adj], size + tagsize - adj, bin_mask, 5, level);
         if (errorcode_t::success != ret) {
+            packet.resize(offset);
             __leave2;
         }
 
-        if (quic_packet_field_hf & hdr) {
-            hdr ^= bin_mask[0] & 0x0f;
+        if (quic_packet_field_hf & packet[offset]) {
+            packet[offset] ^= bin_mask[0] & 0x0f;
         } else {
-            hdr ^= bin_mask[0] & 0x1f;
+            packet[offset] ^= bin_mask[0] & 0x1f;
         }
-        memxor(&bin_pn[0], &bin_mask[1], 4);
-
-        // encode packet length
-        bin_protected_header[0] = hdr;
-        bin_pn.resize(pn_length);
+        memxor(&packet[pos - pn_length], &bin_mask[1], pn_length);
     }
     __finally2 {
         // do nothing
@@ -156,17 +156,24 @@ class quic_packet {
     void dump();
 
     /**
-     * @brief   protect
+     * @brief   write
+     * @param   tls_direction_t dir [in]
+     * @param   binary_t& packet [inout] header || ciphertext || tag is appended
+     * @param   size_t& hdrsize [out] size of the header
+     * @remarks
+     *          the header only if the packet is not protected (from_any, a payload shorter than the sample)
+     */
+    virtual return_t do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize);
+    /**
+     * @brief   packet protection in place
      * @param   tls_direction_t dir [in]
-     * @param   const binary_t& bin_ciphertext [in]
      * @param   protection_level_t level [in]
-     * @param   uint8 hdr [in]
+     * @param   binary_t& packet [inout] unprotected header || payload, encrypted and the tag is appended
+     * @param   size_t offset [in] offset of the header
+     * @param   size_t hdrsize [in] size of the unprotected header (packet number at the end)
      * @param   uint8 pn_length [in]
-     * @param   binary_t& bin_pn [inout]
-     * @param   binary_t& bin_protected_header [inout]
      */
-    return_t header_protect(tls_direction_t dir, const binary_t& bin_ciphertext, protection_level_t level, uint8 hdr, uint8 pn_length, binary_t& bin_pn,
-                            binary_t& bin_protected_header);
+    return_t protect(tls_direction_t dir, protection_level_t level, binary_t& packet, size_t offset, size_t hdrsize, uint8 pn_length);
     /**
      * @brief   unprotect
      * @param   tls_direction_t dir [in]
@@ -223,13 +230,13 @@ class quic_packet_initial : public quic_packet {
     quic_packet_initial(const quic_packet_initial& rhs);
 
     virtual return_t read(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
-    virtual return_t write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag);
 
     quic_packet_initial& set_token(const binary_t& token);
     const binary_t& get_token();
     uint64 get_length();
 
    protected:
+    virtual return_t do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize);
     virtual void dump();
 
    private:
@@ -255,7 +262,6 @@ class quic_packet_0rtt : public quic_packet {
     quic_packet_0rtt(const quic_packet_0rtt& rhs);
 
     virtual return_t read(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
-    virtual return_t write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag);
 
    protected:
    private:
@@ -278,11 +284,11 @@ class quic_packet_handshake : public quic_packet {
     quic_packet_handshake(const quic_packet_handshake& rhs);
 
     virtual return_t read(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
-    virtual return_t write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag);
 
     uint64 get_length();
 
    protected:
+    virtual return_t do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize);
     virtual void dump();
 
    private:
@@ -346,7 +352,9 @@ class quic_packet_1rtt : public quic_packet {
     quic_packet_1rtt(const quic_packet_1rtt& rhs);
 
     virtual return_t read(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
-    virtual return_t write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag);
+
+   protected:
+    virtual return_t do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize);
 };
 
 /**
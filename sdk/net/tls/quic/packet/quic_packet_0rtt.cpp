@@ -29,10 +29,5 @@ return_t quic_packet_0rtt::read(tls_direction_t dir, const byte_t* stream, size_
     return ret;
 }
 
-return_t quic_packet_0rtt::write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag) {
-    return_t ret = errorcode_t::success;
-    return ret;
-}
-
 }  // namespace net
 }  // namespace hotplace
@@ -108,17 +108,14 @@ return_t quic_packet_handshake::read(tls_direction_t dir, const byte_t* stream,
             write_header(bin_unprotected_header);
 
             // AEAD
-            binary_t bin_plaintext;
             {
                 auto& protection = session->get_tls_protection();
                 protection.set_item(tls_context_quic_dcid, get_dcid());
 
-                size_t pos = 0;
-                ret =
-                    protection.decrypt(session, dir, &_payload[0], _payload.size(), pos, bin_plaintext, bin_unprotected_header, bin_tag, protection_handshake);
-                if (errorcode_t::success == ret) {
-                    _payload = std::move(bin_plaintext);
-                } else {
+                // decrypt in place
+                ret = protection.decrypt(session, dir, &bin_unprotected_header[0], bin_unprotected_header.size(), _payload.data(), _payload.size(), &bin_tag[0],
+                                         protection_handshake);
+                if (errorcode_t::success != ret) {
                     _payload.clear();
                 }
             }
@@ -138,9 +135,11 @@ return_t quic_packet_handshake::read(tls_direction_t dir, const byte_t* stream,
     return ret;
 }
 
-return_t quic_packet_handshake::write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag) {
+return_t quic_packet_handshake::do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize) {
     return_t ret = errorcode_t::success;
     __try2 {
+        hdrsize = 0;
+
         auto session = get_session();
         if (nullptr == session) {
             ret = errorcode_t::invalid_context;
@@ -150,8 +149,7 @@ return_t quic_packet_handshake::write(tls_direction_t dir, binary_t& header, bin
         auto& protection = session->get_tls_protection();
         auto tagsize = protection.get_tag_size();
 
-        binary_t bin_unprotected_header;
-        binary_t bin_protected_header;
+        size_t offset = packet.size();
         uint8 pn_length = 0;
         uint64 len = 0;
         binary_t bin_pn;
@@ -159,10 +157,7 @@ return_t quic_packet_handshake::write(tls_direction_t dir, binary_t& header, bin
 
         // unprotected header
         {
-            ret = write_common_header(bin_unprotected_header);
-
-            // protected header
-            bin_protected_header = bin_unprotected_header;
+            ret = write_common_header(packet);
 
             // packet number length + payload size + AEAD tag size
             pn_length = get_pn_length();
@@ -175,9 +170,11 @@ return_t quic_packet_handshake::write(tls_direction_t dir, binary_t& header, bin
             payload pl;
             pl << new payload_member(new quic_encoded(len, prefix_len))  //
                << new payload_member(bin_pn);
-            pl.write(bin_unprotected_header);
+            pl.write(packet);
         }
 
+        hdrsize = packet.size() - offset;
+
         /**
          * RFC 9001 5.4.2.  Header Protection Sample
          *
@@ -187,47 +184,21 @@ return_t quic_packet_handshake::write(tls_direction_t dir, binary_t& header, bin
          *  assumed to be 4 bytes long (its maximum possible encoded length).
          */
         if ((from_any != dir) && (get_payload().size() >= 0x10)) {
-            binary_t bin_ciphertext;
-            binary_t bin_tag;
-            binary_t bin_mask;
-
-            // AEAD
-            ret = protection.encrypt(session, dir, get_payload(), bin_ciphertext, bin_unprotected_header, bin_tag, protection_handshake);
+            // unprotected header || payload, AEAD and Header Protection in place
+            binary_append(packet, get_payload());
+            ret = protect(dir, protection_handshake, packet, offset, hdrsize, pn_length);
             if (errorcode_t::success != ret) {
+                hdrsize = 0;
                 __leave2;
             }
 
-            // Header Protection
-            {
-                uint8 ht = _ht;
-                ret = header_protect(dir, bin_ciphertext, protection_handshake, ht, pn_length, bin_pn, bin_protected_header);
-                if (errorcode_t::success != ret) {
-                    __leave2;
-                }
-
-                // encode packet number
-                payload pl;
-                pl << new payload_member(new quic_encoded(len, prefix_len))  //
-                   << new payload_member(bin_pn);                            //
-
-                // protected header
-                pl.write(bin_protected_header);
-            }
-
-            header = std::move(bin_protected_header);
-            ciphertext = std::move(bin_ciphertext);
-            tag = std::move(bin_tag);
-
             if (istraceable()) {
                 dump();
 
-                auto session = get_session();
                 size_t pos = 0;
                 quic_frames frames;
                 frames.read(session, dir, &_payload[0], _payload.size(), pos);
             }
-        } else {
-            header = std::move(bin_unprotected_header);
         }
     }
     __finally2 {
@@ -108,17 +108,15 @@ return_t quic_packet_initial::read(tls_direction_t dir, const byte_t* stream, si
             write_header(bin_unprotected_header);
 
             // decrypt
-            binary_t bin_plaintext;
             {
                 auto& protection = session->get_tls_protection();
                 protection.set_item(tls_context_quic_dcid, get_dcid());
                 protection.calc(session, tls_hs_client_hello, dir);  // calc initial keys
 
-                size_t pos = 0;
-                ret = protection.decrypt(session, dir, &_payload[0], _payload.size(), pos, bin_plaintext, bin_unprotected_header, bin_tag, protection_initial);
-                if (errorcode_t::success == ret) {
-                    _payload = std::move(bin_plaintext);
-                } else {
+                // decrypt in place
+                ret = protection.decrypt(session, dir, &bin_unprotected_header[0], bin_unprotected_header.size(), _payload.data(), _payload.size(), &bin_tag[0],
+                                         protection_initial);
+                if (errorcode_t::success != ret) {
                     _payload.clear();
                 }
             }
@@ -145,9 +143,11 @@ return_t quic_packet_initial::read(tls_direction_t dir, const byte_t* stream, si
     return ret;
 }
 
-return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binary_t& ciphertext, binary_t& tag) {
+return_t quic_packet_initial::do_write(tls_direction_t dir, binary_t& packet, size_t& hdrsize) {
     return_t ret = errorcode_t::success;
     __try2 {
+        hdrsize = 0;
+
         auto session = get_session();
         if (nullptr == session) {
             ret = errorcode_t::invalid_context;
@@ -157,8 +157,7 @@ return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binar
         auto& protection = session->get_tls_protection();
         auto tagsize = protection.get_tag_size();
 
-        binary_t bin_unprotected_header;
-        binary_t bin_protected_header;
+        size_t offset = packet.size();
         uint8 pn_length = 0;
         uint64 len = 0;
         binary_t bin_pn;
@@ -166,10 +165,7 @@ return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binar
 
         // unprotected header
         {
-            ret = write_common_header(bin_unprotected_header);
-
-            // protected header
-            bin_protected_header = bin_unprotected_header;
+            ret = write_common_header(packet);
 
             // packet number length + payload size + AEAD tag size
             pn_length = get_pn_length();
@@ -183,9 +179,11 @@ return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binar
             pl << new payload_member(new quic_encoded(get_token()))      // Token Length (i), Token (..)
                << new payload_member(new quic_encoded(len, prefix_len))  // Length (i)
                << new payload_member(bin_pn);                            // Packet Number (8..32)
-            pl.write(bin_unprotected_header);
+            pl.write(packet);
         }
 
+        hdrsize = packet.size() - offset;
+
         /**
          * RFC 9001 5.4.2.  Header Protection Sample
          *
@@ -195,38 +193,14 @@ return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binar
          *  assumed to be 4 bytes long (its maximum possible encoded length).
          */
         if ((from_any != dir) && (get_payload().size() >= 0x10)) {
-            binary_t bin_ciphertext;
-            binary_t bin_tag;
-            binary_t bin_mask;
-
-            // AEAD
-            ret = protection.encrypt(session, dir, get_payload(), bin_ciphertext, bin_unprotected_header, bin_tag, protection_initial);
+            // unprotected header || payload, AEAD and Header Protection in place
+            binary_append(packet, get_payload());
+            ret = protect(dir, protection_initial, packet, offset, hdrsize, pn_length);
             if (errorcode_t::success != ret) {
+                hdrsize = 0;
                 __leave2;
             }
 
-            // Header Protection
-            {
-                uint8 ht = _ht;
-                ret = header_protect(dir, bin_ciphertext, protection_initial, ht, pn_length, bin_pn, bin_protected_header);
-                if (errorcode_t::success != ret) {
-                    __leave2;
-                }
-
-                // encode packet number
-                payload pl;
-                pl << new payload_member(new quic_encoded(get_token()))      //
-                   << new payload_member(new quic_encoded(len, prefix_len))  //
-                   << new payload_member(bin_pn);
-
-                // protected header
-                pl.write(bin_protected_header);
-            }
-
-            header = std::move(bin_protected_header);
-            ciphertext = std::move(bin_ciphertext);
-            tag = std::move(bin_tag);
-
             if (istraceable()) {
                 dump();
 
@@ -241,8 +215,6 @@ return_t quic_packet_initial::write(tls_direction_t dir, binary_t& header, binar
                 };
                 frames.for_each(lambda_foreach);
             }
-        } else {
-            header = std::move(bin_unprotected_header);
         }
     }
     __finally2 {
@@ -22,11 +22,18 @@ namespace net {
 constexpr char constexpr_alpn_len[] = "alpn len";
 constexpr char constexpr_protocol[] = "alpn protocol";
 
-tls_extension_alpn::tls_extension_alpn(tls_session* session) : tls_extension(tls1_ext_application_layer_protocol_negotiation, session) {}
+tls_extension_alpn::tls_extension_alpn(tls_hs_type_t hstype, tls_session* session)
+    : tls_extension(tls1_ext_application_layer_protocol_negotiation, session), _hstype(hstype) {}
 
 return_t tls_extension_alpn::do_read_body(const byte_t* stream, size_t size, size_t& pos) {
     return_t ret = errorcode_t::success;
     __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
         uint16 alpn_len = 0;
         binary_t protocols;
         {
@@ -50,7 +57,14 @@ return_t tls_extension_alpn::do_read_body(const byte_t* stream, size_t size, siz
         }
 
         {
-            //
+            // RFC 8446 4.2.10.  the selected ALPN protocol is associated with the PSK (see tls_resumption)
+            auto& protection = session->get_tls_protection();
+            if (tls_hs_client_hello == _hstype) {
+                protection.set_item(tls_context_client_hello_alpn, protocols);
+            } else if (tls_hs_encrypted_extensions == _hstype) {
+                protection.set_item(tls_context_alpn, protocols);
+            }
+
             _protocols = std::move(protocols);
         }
     }
@@ -62,11 +76,30 @@ return_t tls_extension_alpn::do_read_body(const byte_t* stream, size_t size, siz
 
 return_t tls_extension_alpn::do_write_body(binary_t& bin) {
     return_t ret = errorcode_t::success;
-    {
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        auto& protection = session->get_tls_protection();
+        if (tls_hs_encrypted_extensions == _hstype) {
+            // server, RFC 8446 4.2.10.  the early data is accepted under the ALPN protocol of the ticket (see tls_resumption)
+            if ((tls_early_data_accepted == protection.get_early_data()) && (_protocols != protection.get_item(tls_context_alpn))) {
+                ret = errorcode_t::mismatch;
+                __leave2;
+            }
+            protection.set_item(tls_context_alpn, _protocols);
+        }
+
         payload pl;
         pl << new payload_member(uint16(_protocols.size()), true, constexpr_alpn_len) << new payload_member(_protocols, constexpr_protocol);
         pl.write(bin);
     }
+    __finally2 {
+        // do nothing
+    }
     return ret;
 }
 
@@ -19,10 +19,14 @@ namespace net {
 
 /**
  * @brief   application_layer_protocol_negotiation (ALPN, 0x0010)
+ * @remarks
+ *          RFC 7301 3.1.  The Application-Layer Protocol Negotiation Extension
+ *          ClientHello - the protocols offered (tls_context_client_hello_alpn, server)
+ *          EncryptedExtensions - the protocol selected (tls_context_alpn, kept in the session ticket)
  */
 class tls_extension_alpn : public tls_extension {
    public:
-    tls_extension_alpn(tls_session* session);
+    tls_extension_alpn(tls_hs_type_t hstype, tls_session* session);
 
     const binary_t& get_protocols();
     void set_protocols(const binary_t& protocols);
@@ -32,6 +36,7 @@ class tls_extension_alpn : public tls_extension {
     virtual return_t do_write_body(binary_t& bin);
 
    private:
+    tls_hs_type_t _hstype;
     binary_t _protocols;
 };
 
@@ -17,6 +17,7 @@
 #include <sdk/net/tls/tls/extension/tls_extension_alps.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_builder.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_compress_certificate.hpp>
+#include <sdk/net/tls/tls/extension/tls_extension_early_data.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_ec_point_formats.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_encrypted_client_hello.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_key_share.hpp>
@@ -74,7 +75,7 @@ tls_extension* tls_extension_builder::build() {
             __try_new_catch_only(extension, new tls_extension_signature_algorithms(get_session()));
         } break;
         case tls1_ext_application_layer_protocol_negotiation: /* 0x0010 */ {
-            __try_new_catch_only(extension, new tls_extension_alpn(get_session()));
+            __try_new_catch_only(extension, new tls_extension_alpn(get_handshake(), get_session()));
         } break;
         case tls1_ext_compress_certificate: /* 0x001b */ {
             __try_new_catch_only(extension, new tls_extension_compress_certificate(get_session()));
@@ -90,6 +91,9 @@ tls_extension* tls_extension_builder::build() {
                 }
             }
         } break;
+        case tls1_ext_early_data: /* 0x002a */ {
+            __try_new_catch_only(extension, new tls_extension_early_data(get_handshake(), get_session()));
+        } break;
         case tls1_ext_supported_versions: /* 0x002b */ {
             auto session = get_session();
             if (session) {
@@ -138,7 +142,6 @@ tls_extension* tls_extension_builder::build() {
         case tls1_ext_record_size_limit:            /* 0x001c */
         case tls1_ext_session_ticket:               /* 0x0023 */
         case tls1_ext_tlmsp:                        /* 0x0024 */
-        case tls1_ext_early_data:                   /* 0x002a */
         case tls1_ext_cookie:                       /* 0x002c */
         case tls1_ext_certificate_authorities:      /* 0x002f */
         case tls1_ext_oid_filters:                  /* 0x0030 */
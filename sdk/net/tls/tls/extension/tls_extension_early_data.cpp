@@ -0,0 +1,152 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include <sdk/base/basic/binary.hpp>
+#include <sdk/base/stream/basic_stream.hpp>
+#include <sdk/base/unittest/trace.hpp>
+#include <sdk/io/basic/payload.hpp>
+#include <sdk/net/tls/tls/extension/tls_extension_early_data.hpp>
+#include <sdk/net/tls/tls/tls.hpp>
+#include <sdk/net/tls/tls_protection.hpp>
+#include <sdk/net/tls/tls_resumption.hpp>
+#include <sdk/net/tls/tls_session.hpp>
+
+namespace hotplace {
+namespace net {
+
+constexpr char constexpr_max_early_data_size[] = "max early data size";
+
+tls_extension_early_data::tls_extension_early_data(tls_hs_type_t hstype, tls_session* session)
+    : tls_extension(tls1_ext_early_data, session), _hstype(hstype), _max_early_data_size(0) {}
+
+uint32 tls_extension_early_data::get_max_early_data_size() { return _max_early_data_size; }
+
+return_t tls_extension_early_data::do_read_body(const byte_t* stream, size_t size, size_t& pos) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        // struct {} Empty;
+        // struct {
+        //     select (Handshake.msg_type) {
+        //         case new_session_ticket:   uint32 max_early_data_size;
+        //         case client_hello:         Empty;
+        //         case encrypted_extensions: Empty;
+        //     };
+        // } EarlyDataIndication;
+
+        auto& protection = session->get_tls_protection();
+        switch (_hstype) {
+            case tls_hs_client_hello: {
+                // server, accepted or rejected while resuming (see tls_resumption)
+                protection.set_early_data(tls_early_data_offered);
+            } break;
+            case tls_hs_encrypted_extensions: {
+                // client
+                if (tls_early_data_offered == protection.get_early_data()) {
+                    protection.set_early_data(tls_early_data_accepted);
+                }
+            } break;
+            case tls_hs_new_session_ticket: {
+                uint32 max_early_data_size = 0;
+                {
+                    payload pl;
+                    pl << new payload_member(uint32(0), true, constexpr_max_early_data_size);
+                    pl.read(stream, endpos_extension(), pos);
+
+                    max_early_data_size = pl.t_value_of<uint32>(constexpr_max_early_data_size);
+                }
+
+                // client, the ticket allows 0-RTT (see tls_handshake_new_session_ticket)
+                binary_t bin;
+                binary_append(bin, max_early_data_size, hton32);
+                protection.set_item(tls_context_session_ticket_max_early_data, bin);
+
+                _max_early_data_size = max_early_data_size;
+
+                if (istraceable()) {
+                    basic_stream dbs;
+                    dbs.printf("   > %s 0x%08x(%u)\n", constexpr_max_early_data_size, max_early_data_size, max_early_data_size);
+
+                    trace_debug_event(category_net, net_event_tls_read, &dbs);
+                }
+            } break;
+            default: {
+            } break;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+return_t tls_extension_early_data::do_write_body(binary_t& bin) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        auto& protection = session->get_tls_protection();
+        switch (_hstype) {
+            case tls_hs_client_hello: {
+                // client, a ticket allowing 0-RTT (see tls_extension_client_psk)
+                //   the version and the cipher suite of the ticket are known (client_early_traffic_secret)
+                uint32 max_early_data_size = 0;
+                if (protection.is_kindof_tls13() && (false == protection.get_item(tls_context_session_ticket).empty())) {
+                    max_early_data_size = t_binary_to_integer<uint32>(protection.get_item(tls_context_session_ticket_max_early_data));
+                }
+                if (max_early_data_size) {
+                    protection.set_max_early_data_size(max_early_data_size);
+                    protection.set_early_data(tls_early_data_offered);
+                } else {
+                    ret = errorcode_t::not_ready;
+                }
+            } break;
+            case tls_hs_encrypted_extensions: {
+                // server
+                if (tls_early_data_accepted != protection.get_early_data()) {
+                    ret = errorcode_t::not_ready;
+                }
+            } break;
+            case tls_hs_new_session_ticket: {
+                // server
+                uint32 max_early_data_size = tls_resumption::get_instance()->get_max_early_data_size();
+                if (max_early_data_size) {
+                    payload pl;
+                    pl << new payload_member(uint32(max_early_data_size), true, constexpr_max_early_data_size);
+                    pl.write(bin);
+
+                    _max_early_data_size = max_early_data_size;
+                } else {
+                    ret = errorcode_t::not_ready;
+                }
+            } break;
+            default: {
+                ret = errorcode_t::not_supported;
+            } break;
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
+
+}  // namespace net
+}  // namespace hotplace
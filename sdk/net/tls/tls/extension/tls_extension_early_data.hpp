@@ -0,0 +1,45 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS_TLSEXTENSION_EARLY_DATA__
+#define __HOTPLACE_SDK_NET_TLS_TLSEXTENSION_EARLY_DATA__
+
+#include <sdk/net/tls/tls/extension/tls_extension.hpp>
+
+namespace hotplace {
+namespace net {
+
+/**
+ * @brief   early_data (0x002a)
+ * @remarks
+ *          RFC 8446 4.2.10.  Early Data Indication
+ *          ClientHello, EncryptedExtensions - empty
+ *          NewSessionTicket - max_early_data_size
+ */
+class tls_extension_early_data : public tls_extension {
+   public:
+    tls_extension_early_data(tls_hs_type_t hstype, tls_session* session);
+
+    uint32 get_max_early_data_size();
+
+   protected:
+    virtual return_t do_read_body(const byte_t* stream, size_t size, size_t& pos);
+    virtual return_t do_write_body(binary_t& bin);
+
+   private:
+    tls_hs_type_t _hstype;
+    uint32 _max_early_data_size;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -8,12 +8,15 @@
  * Date         Name                Description
  */
 
+#include <time.h>
+
 #include <sdk/base/basic/dump_memory.hpp>
 #include <sdk/base/unittest/trace.hpp>
 #include <sdk/io/basic/payload.hpp>
 #include <sdk/net/tls/tls/extension/tls_extension_pre_shared_key.hpp>
 #include <sdk/net/tls/tls_advisor.hpp>
 #include <sdk/net/tls/tls_protection.hpp>
+#include <sdk/net/tls/tls_resumption.hpp>
 #include <sdk/net/tls/tls_session.hpp>
 
 namespace hotplace {
@@ -96,33 +99,48 @@ return_t tls_extension_client_psk::do_read_body(const byte_t* stream, size_t siz
             psk_identity_len = pl.t_value_of<uint16>(constexpr_psk_identity_len);
             pl.get_binary(constexpr_psk_identity, psk_identity);
             obfuscated_ticket_age = pl.t_value_of<uint32>(constexpr_obfuscated_ticket_age);
-            offset_psk_binders_len = offsetof_header() + pl.offset_of(constexpr_psk_binders_len);  // 0-RTT "res binder"
+            offset_psk_binders_len = offsetof_body() + pl.offset_of(constexpr_psk_binders_len);  // "res binder"
             psk_binders_len = pl.t_value_of<uint16>(constexpr_psk_binders_len);
             psk_binder_len = pl.t_value_of<uint8>(constexpr_psk_binder_len);
             pl.get_binary(constexpr_psk_binder, psk_binder);
         }
 
+        return_t test = errorcode_t::success;
         {
-            // RFC 8448 4.  Resumed 0-RTT Handshake
-
-            // binder hash
             auto& protection = session->get_tls_protection();
-            binary_t context_resumption_binder_hash;
-            {
-                size_t content_header_size = 0;
-                // size_t sizeof_dtls_recons = 0;
-                if (protection.is_kindof_tls()) {
-                    content_header_size = RTL_FIELD_SIZE(tls_content_t, tls);
-                } else {
-                    content_header_size = RTL_FIELD_SIZE(tls_content_t, dtls);
-                    // sizeof_dtls_recons = 8;
-                }
-                ret = protection.calc_context_hash(session, sha2_256, stream + content_header_size, offset_psk_binders_len - 1, context_resumption_binder_hash);
-                // if (errorcode_t::success != ret) do something
+
+            // Truncate(ClientHello1), the handshake header ~ identities
+            size_t content_header_size = 0;
+            if (protection.is_kindof_tls()) {
+                content_header_size = RTL_FIELD_SIZE(tls_content_t, tls);
+            } else {
+                content_header_size = RTL_FIELD_SIZE(tls_content_t, dtls);
             }
+            const byte_t* partial_client_hello = stream + content_header_size;
+            size_t partial_size = offset_psk_binders_len - content_header_size;
+
+            if (tls_0_rtt == protection.get_flow()) {
+                // RFC 8448 4.  Resumed 0-RTT Handshake
+
+                // binder hash
+                binary_t context_resumption_binder_hash;
+                ret = protection.calc_context_hash(session, sha2_256, partial_client_hello, partial_size, context_resumption_binder_hash);
+                // if (errorcode_t::success != ret) do something
 
-            // verify psk binder
-            ret = protection.calc_psk(session, context_resumption_binder_hash, psk_binder);
+                // verify psk binder
+                ret = protection.calc_psk(session, context_resumption_binder_hash, psk_binder);
+                test = ret;
+
+                // the ticket received in the previous handshake of this session
+                if ((errorcode_t::success == ret) && (tls_early_data_offered == protection.get_early_data())) {
+                    protection.set_max_early_data_size(t_binary_to_integer<uint32>(protection.get_item(tls_context_session_ticket_max_early_data)));
+                    protection.set_early_data(tls_early_data_accepted);
+                }
+            } else {
+                // RFC 8446 2.2.  Resumption and Pre-Shared Key (PSK)
+                // a ticket issued by tls_resumption, otherwise a full handshake
+                test = tls_resumption::get_instance()->resume(session, psk_identity, obfuscated_ticket_age, partial_client_hello, partial_size, psk_binder);
+            }
         }
 
         if (istraceable()) {
@@ -133,7 +151,7 @@ return_t tls_extension_client_psk::do_read_body(const byte_t* stream, size_t siz
             dbs.printf("   > %s 0x%04x(%i)\n", constexpr_psk_binders_len, psk_binders_len, psk_binders_len);
             dbs.printf("   > %s 0x%04x(%i)\n", constexpr_psk_binder_len, psk_binder_len, psk_binder_len);
             dbs.printf("   > %s %s \e[1;33m%s\e[0m\n", constexpr_psk_binder, base16_encode(psk_binder).c_str(),
-                       (errorcode_t::success == ret) ? "true" : "false");
+                       (errorcode_t::success == test) ? "true" : "false");
 
             trace_debug_event(category_net, net_event_tls_read, &dbs);
         }
@@ -153,7 +171,67 @@ return_t tls_extension_client_psk::do_read_body(const byte_t* stream, size_t siz
     return ret;
 }
 
-return_t tls_extension_client_psk::do_write_body(binary_t& bin) { return not_supported; }
+return_t tls_extension_client_psk::do_write_body(binary_t& bin) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+
+        // a ticket received in NewSessionTicket (see tls_handshake_new_session_ticket)
+        auto& protection = session->get_tls_protection();
+        const binary_t& ticket = protection.get_item(tls_context_session_ticket);
+        if (ticket.empty()) {
+            ret = errorcode_t::not_ready;
+            __leave2;
+        }
+
+        const hint_digest_t* hint_mac = tls_advisor::get_instance()->hintof_digest(protection.get_cipher_suite());
+        if (nullptr == hint_mac) {
+            ret = errorcode_t::not_supported;
+            __leave2;
+        }
+
+        // RFC 8446 4.2.11.1.  Ticket Age
+        //   adding the value of "ticket_age_add" modulo 2^32
+        uint32 ticket_age_add = t_binary_to_integer<uint32>(protection.get_item(tls_context_session_ticket_age_add));
+        uint64 received = t_binary_to_integer<uint64>(protection.get_item(tls_context_session_ticket_received));
+        uint32 obfuscated_ticket_age = uint32((time(nullptr) - received) * 1000) + ticket_age_add;
+
+        // RFC 8446 4.2.11.2.  PSK Binder
+        //   the binder is computed over the partial ClientHello and patched (see tls_handshake_client_hello)
+        binary_t psk_binder;
+        psk_binder.resize(hint_mac->digest_size);
+
+        uint16 psk_identities_len = sizeof(uint16) + ticket.size() + sizeof(uint32);
+        uint16 psk_binders_len = sizeof(uint8) + psk_binder.size();
+        {
+            payload pl;
+            pl << new payload_member(uint16(psk_identities_len), true, constexpr_psk_identities_len)        //
+               << new payload_member(uint16(ticket.size()), true, constexpr_psk_identity_len)               //
+               << new payload_member(ticket, constexpr_psk_identity)                                        //
+               << new payload_member(uint32(obfuscated_ticket_age), true, constexpr_obfuscated_ticket_age)  //
+               << new payload_member(uint16(psk_binders_len), true, constexpr_psk_binders_len)              //
+               << new payload_member(uint8(psk_binder.size()), constexpr_psk_binder_len)                    //
+               << new payload_member(psk_binder, constexpr_psk_binder);                                     //
+            pl.write(bin);
+        }
+
+        {
+            _psk_identities_len = psk_identities_len;
+            _psk_identity = ticket;
+            _obfuscated_ticket_age = obfuscated_ticket_age;
+            _psk_binders_len = psk_binders_len;
+            _psk_binder = std::move(psk_binder);
+        }
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
 
 tls_extension_server_psk::tls_extension_server_psk(tls_session* session) : tls_extension_psk(session), _selected_identity(0) {}
 
@@ -180,6 +258,12 @@ return_t tls_extension_server_psk::do_read_body(const byte_t* stream, size_t siz
             //
             _selected_identity = selected_identity;
         }
+
+        // client, the PSK offered is accepted (psk_dhe_ke)
+        auto session = get_session();
+        if (session) {
+            session->get_tls_protection().set_resumption(true);
+        }
     }
     __finally2 {
         // do nothing
@@ -187,7 +271,29 @@ return_t tls_extension_server_psk::do_read_body(const byte_t* stream, size_t siz
     return ret;
 }
 
-return_t tls_extension_server_psk::do_write_body(binary_t& bin) { return not_supported; }
+return_t tls_extension_server_psk::do_write_body(binary_t& bin) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+        if (false == session->get_tls_protection().is_resumption()) {
+            ret = errorcode_t::not_ready;
+            __leave2;
+        }
+
+        // a single identity is offered (see tls_extension_client_psk)
+        payload pl;
+        pl << new payload_member(uint16(_selected_identity), true, constexpr_selected_identity);
+        pl.write(bin);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
 
 }  // namespace net
 }  // namespace hotplace
@@ -55,7 +55,8 @@ return_t tls_handshake_client_hello::do_preprocess(tls_direction_t dir) {
 
         {
             auto hsstatus = session->get_session_info(dir).get_status();
-            if (tls_hs_finished == hsstatus) {
+            bool reuse = (tls_hs_finished == hsstatus);
+            if (reuse) {
                 // 0-RTT
                 protection.set_flow(tls_0_rtt);
             }
@@ -63,10 +64,13 @@ return_t tls_handshake_client_hello::do_preprocess(tls_direction_t dir) {
                 case tls_1_rtt: {
                 } break;
                 case tls_0_rtt: {
-                    protection.get_keyexchange().clear();
+                    // a new session offering the early data keeps the key_share (see do_write_body)
+                    if (reuse) {
+                        protection.get_keyexchange().clear();
 
-                    session->reset_recordno(from_client);
-                    session->reset_recordno(from_server);
+                        session->reset_recordno(from_client);
+                        session->reset_recordno(from_server);
+                    }
                 } break;
                 case tls_hello_retry_request: {
                     auto& keyexchange = protection.get_keyexchange();
@@ -119,6 +123,7 @@ return_t tls_handshake_client_hello::do_postprocess(tls_direction_t dir, const b
         // protection_context
         auto& protection_context = protection.get_protection_context();
         {
+            protection_context.clear_cipher_suites();
             for (auto cs : _cipher_suites) {
                 protection_context.add_cipher_suite(cs);
             }
@@ -268,6 +273,15 @@ return_t tls_handshake_client_hello::do_read_body(tls_direction_t dir, const byt
                 trace_debug_event(category_net, net_event_tls_read, &dbs);
             }
 
+            {
+                // RFC 8446 4.2.10.  the cipher suites offered are known to the pre_shared_key extension (see tls_resumption)
+                auto& protection_context = protection.get_protection_context();
+                protection_context.clear_cipher_suites();
+                for (auto cs : _cipher_suites) {
+                    protection_context.add_cipher_suite(cs);
+                }
+            }
+
             ret = get_extensions().read(tls_hs_client_hello, session, dir, stream, size, pos);
         }
     }
@@ -321,6 +335,49 @@ return_t tls_handshake_client_hello::do_write_body(tls_direction_t dir, binary_t
         { protection.set_item(tls_context_client_hello_random, _random); }
 
         binary_append(bin, extensions);
+
+        // RFC 8446 4.2.11.2.  PSK Binder
+        //   the "pre_shared_key" extension MUST be the last extension in the ClientHello
+        //   binder = HMAC(finished_key, Transcript-Hash(Truncate(ClientHello1)))
+        auto count = get_extensions().size();
+        auto last = count ? get_extensions().getat(count - 1) : nullptr;
+        if (last && (tls1_ext_pre_shared_key == last->get_type()) && (false == protection.get_item(tls_context_session_ticket).empty())) {
+            const hint_digest_t* hint_mac = tls_advisor::get_instance()->hintof_digest(protection.get_cipher_suite());
+            if (nullptr == hint_mac) {
+                ret = errorcode_t::not_supported;
+                __leave2;
+            }
+            size_t dlen = hint_mac->digest_size;
+            size_t sizeof_binders = sizeof(uint16) + sizeof(uint8) + dlen;
+            if (bin.size() < sizeof_binders) {
+                ret = errorcode_t::bad_data;
+                __leave2;
+            }
+
+            // msg_type(1) || length(3), the length of the whole ClientHello
+            binary_t partial_client_hello;
+            binary_append(partial_client_hello, uint32(bin.size()), hton32);
+            partial_client_hello[0] = tls_hs_client_hello;
+            if (protection.is_kindof_dtls()) {
+                partial_client_hello.resize(partial_client_hello.size() + 8);  // handshake reconstruction data, not hashed
+            }
+            partial_client_hello.insert(partial_client_hello.end(), bin.begin(), bin.end() - sizeof_binders);
+
+            binary_t binder_hash;
+            binary_t psk_binder;
+            protection.calc_context_hash(session, hint_mac->algorithm, &partial_client_hello[0], partial_client_hello.size(), binder_hash);
+            ret = protection.calc_psk_binder(session, binder_hash, psk_binder);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+            memcpy(&bin[bin.size() - dlen], &psk_binder[0], dlen);
+        }
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   the early data is protected under client_early_traffic_secret (see do_postprocess)
+        if (tls_early_data_offered == protection.get_early_data()) {
+            protection.set_flow(tls_0_rtt);
+        }
     }
     __finally2 {
         // do nothing
@@ -33,6 +33,13 @@ return_t tls_handshake_encrypted_extensions::do_postprocess(tls_direction_t dir,
         auto& protection = session->get_tls_protection();
 
         { protection.update_transcript_hash(session, stream + hspos, get_size()); }
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   the early data offered is rejected without the early_data, the client Finished is protected under the handshake traffic secret
+        if ((tls_0_rtt == protection.get_flow()) && (tls_early_data_offered == protection.get_early_data())) {
+            protection.set_flow(tls_1_rtt);
+            protection.set_early_data(tls_early_data_rejected);
+        }
     }
     __finally2 {
         // do nothing
@@ -20,6 +20,13 @@ namespace net {
 
 tls_handshake_end_of_early_data::tls_handshake_end_of_early_data(tls_session* session) : tls_handshake(tls_hs_end_of_early_data, session) {}
 
+void tls_handshake_end_of_early_data::run_scheduled(tls_direction_t dir) {
+    auto session = get_session();
+    session->reset_recordno(from_client);
+    session->reset_recordno(from_server);
+    session->get_session_info(dir).set_status(get_type());
+}
+
 return_t tls_handshake_end_of_early_data::do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -33,11 +40,10 @@ return_t tls_handshake_end_of_early_data::do_postprocess(tls_direction_t dir, co
 
         {
             protection.calc(session, tls_hs_end_of_early_data, dir);
-            session->reset_recordno(from_client);
-            session->reset_recordno(from_server);
-            session->get_session_info(dir).set_status(get_type());
-
             protection.update_transcript_hash(session, stream + hspos, get_size());
+
+            // the record is protected under client_early_traffic_secret
+            session->schedule(this);  // run_scheduled
         }
     }
     __finally2 {
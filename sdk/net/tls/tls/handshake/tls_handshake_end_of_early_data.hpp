@@ -18,6 +18,8 @@ class tls_handshake_end_of_early_data : public tls_handshake {
    public:
     tls_handshake_end_of_early_data(tls_session* session);
 
+    virtual void run_scheduled(tls_direction_t dir);
+
    protected:
     virtual return_t do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size);
     virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
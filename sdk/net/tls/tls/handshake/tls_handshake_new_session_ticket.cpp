@@ -8,19 +8,32 @@
  * Date         Name                Description
  */
 
+#include <time.h>
+
 #include <sdk/base/basic/dump_memory.hpp>
 #include <sdk/base/stream/basic_stream.hpp>
 #include <sdk/base/unittest/trace.hpp>
+#include <sdk/crypto/basic/openssl_prng.hpp>
 #include <sdk/io/basic/payload.hpp>
 #include <sdk/net/tls/tls/handshake/tls_handshake_new_session_ticket.hpp>
 #include <sdk/net/tls/tls_advisor.hpp>
 #include <sdk/net/tls/tls_protection.hpp>
+#include <sdk/net/tls/tls_resumption.hpp>
 #include <sdk/net/tls/tls_session.hpp>
 
 namespace hotplace {
 namespace net {
 
-tls_handshake_new_session_ticket::tls_handshake_new_session_ticket(tls_session* session) : tls_handshake(tls_hs_new_session_ticket, session) {}
+constexpr char constexpr_ticket_lifetime[] = "ticket timeline";
+constexpr char constexpr_ticket_age_add[] = "ticket age add";
+constexpr char constexpr_ticket_nonce_len[] = "ticket nonce len";
+constexpr char constexpr_ticket_nonce[] = "ticket nonce";
+constexpr char constexpr_session_ticket_len[] = "session ticket len";
+constexpr char constexpr_session_ticket[] = "session ticket";
+constexpr char constexpr_ticket_extension_len[] = "ticket extension len";
+
+tls_handshake_new_session_ticket::tls_handshake_new_session_ticket(tls_session* session)
+    : tls_handshake(tls_hs_new_session_ticket, session), _ticket_lifetime(0), _ticket_age_add(0) {}
 
 return_t tls_handshake_new_session_ticket::do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size) {
     return_t ret = errorcode_t::success;
@@ -68,36 +81,26 @@ return_t tls_handshake_new_session_ticket::do_read_body(tls_direction_t dir, con
              * } NewSessionTicket;
              */
 
-            constexpr char constexpr_ticket_lifetime[] = "ticket timeline";
-            constexpr char constexpr_ticket_age_add[] = "ticket age add";
-            constexpr char constexpr_ticket_nonce_len[] = "ticket nonce len";
-            constexpr char constexpr_ticket_nonce[] = "ticket nonce";
-            constexpr char constexpr_session_ticket_len[] = "session ticket len";
-            constexpr char constexpr_session_ticket[] = "session ticket";
-            constexpr char constexpr_ticket_extension_len[] = "ticket extension len";
-            constexpr char constexpr_ticket_extensions[] = "ticket extensions";
-
             uint32 ticket_lifetime = 0;
             uint32 ticket_age_add = 0;
             binary_t ticket_nonce;
             binary_t session_ticket;
-            binary_t ticket_extensions;
+            uint16 ticket_extension_len = 0;
             {
                 payload pl;
                 pl << new payload_member(uint32(0), true, constexpr_ticket_lifetime) << new payload_member(uint32(0), true, constexpr_ticket_age_add)
                    << new payload_member(uint8(0), constexpr_ticket_nonce_len) << new payload_member(binary_t(), constexpr_ticket_nonce)
                    << new payload_member(uint16(0), true, constexpr_session_ticket_len) << new payload_member(binary_t(), constexpr_session_ticket)
-                   << new payload_member(uint16(0), true, constexpr_ticket_extension_len) << new payload_member(binary_t(), constexpr_ticket_extensions);
+                   << new payload_member(uint16(0), true, constexpr_ticket_extension_len);
                 pl.set_reference_value(constexpr_ticket_nonce, constexpr_ticket_nonce_len);
                 pl.set_reference_value(constexpr_session_ticket, constexpr_session_ticket_len);
-                pl.set_reference_value(constexpr_ticket_extensions, constexpr_ticket_extension_len);
                 pl.read(stream, size, pos);
 
                 ticket_lifetime = pl.t_value_of<uint32>(constexpr_ticket_lifetime);
                 ticket_age_add = pl.t_value_of<uint32>(constexpr_ticket_age_add);
                 pl.get_binary(constexpr_ticket_nonce, ticket_nonce);
                 pl.get_binary(constexpr_session_ticket, session_ticket);
-                pl.get_binary(constexpr_ticket_extensions, ticket_extensions);
+                ticket_extension_len = pl.t_value_of<uint16>(constexpr_ticket_extension_len);
             }
 
             if (istraceable()) {
@@ -108,11 +111,34 @@ return_t tls_handshake_new_session_ticket::do_read_body(tls_direction_t dir, con
                 dbs.printf(" > %s %s\n", constexpr_ticket_nonce, base16_encode(ticket_nonce).c_str());
                 dbs.printf(" > %s\n", constexpr_session_ticket);
                 dump_memory(session_ticket, &dbs, 16, 3, 0x0, dump_notrunc);
-                dbs.printf(" > %s %s\n", constexpr_ticket_extensions, base16_encode(ticket_extensions).c_str());
+                dbs.printf(" > %s 0x%04x(%i)\n", constexpr_ticket_extension_len, ticket_extension_len, ticket_extension_len);
                 dbs.autoindent(0);
 
                 trace_debug_event(category_net, net_event_tls_read, &dbs);
             }
+
+            // RFC 8446 4.6.1.  early_data (max_early_data_size, see tls_extension_early_data)
+            ret = get_extensions().read(tls_hs_new_session_ticket, session, dir, stream, pos + ticket_extension_len, pos);
+            if (errorcode_t::success != ret) {
+                __leave2;
+            }
+
+            // client, the ticket and the PSK associated with it (see tls_extension_client_psk)
+            auto& protection = session->get_tls_protection();
+            if ((from_server == dir) && protection.is_kindof_tls13()) {
+                binary_t bin;
+                protection.set_item(tls_context_session_ticket, session_ticket);
+                binary_append(bin, ticket_age_add, hton32);
+                protection.set_item(tls_context_session_ticket_age_add, bin);
+                bin.clear();
+                binary_append(bin, uint64(time(nullptr)), hton64);
+                protection.set_item(tls_context_session_ticket_received, bin);
+
+                binary_t psk;
+                if (errorcode_t::success == protection.calc_resumption_psk(session, ticket_nonce, psk)) {
+                    protection.calc_resumption_early(session, psk);
+                }
+            }
         }
     }
     __finally2 {
@@ -121,7 +147,50 @@ return_t tls_handshake_new_session_ticket::do_read_body(tls_direction_t dir, con
     return ret;
 }
 
-return_t tls_handshake_new_session_ticket::do_write_body(tls_direction_t dir, binary_t& bin) { return errorcode_t::success; }
+return_t tls_handshake_new_session_ticket::do_write_body(tls_direction_t dir, binary_t& bin) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        auto session = get_session();
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_context;
+            __leave2;
+        }
+        if (from_server != dir) {
+            ret = errorcode_t::invalid_request;
+            __leave2;
+        }
+
+        // RFC 8446 4.6.1.  a per-ticket value that is unique across all tickets issued on this connection
+        openssl_prng prng;
+        prng.random(_ticket_nonce, 8);
+
+        ret = tls_resumption::get_instance()->issue(session, _ticket_nonce, _ticket_lifetime, _ticket_age_add, _ticket);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        binary_t extensions;
+        get_extensions().write(extensions);
+
+        {
+            payload pl;
+            pl << new payload_member(uint32(_ticket_lifetime), true, constexpr_ticket_lifetime)         //
+               << new payload_member(uint32(_ticket_age_add), true, constexpr_ticket_age_add)           //
+               << new payload_member(uint8(_ticket_nonce.size()), constexpr_ticket_nonce_len)           //
+               << new payload_member(_ticket_nonce, constexpr_ticket_nonce)                             //
+               << new payload_member(uint16(_ticket.size()), true, constexpr_session_ticket_len)        //
+               << new payload_member(_ticket, constexpr_session_ticket)                                 //
+               << new payload_member(uint16(extensions.size()), true, constexpr_ticket_extension_len);  //
+            pl.write(bin);
+        }
+
+        binary_append(bin, extensions);
+    }
+    __finally2 {
+        // do nothing
+    }
+    return ret;
+}
 
 }  // namespace net
 }  // namespace hotplace
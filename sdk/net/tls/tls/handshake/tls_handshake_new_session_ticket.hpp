@@ -21,7 +21,16 @@ class tls_handshake_new_session_ticket : public tls_handshake {
    protected:
     virtual return_t do_postprocess(tls_direction_t dir, const byte_t* stream, size_t size);
     virtual return_t do_read_body(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
+    /**
+     * @brief   server, a ticket issued by tls_resumption
+     */
     virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
+
+   private:
+    uint32 _ticket_lifetime;
+    uint32 _ticket_age_add;
+    binary_t _ticket_nonce;
+    binary_t _ticket;
 };
 
 }  // namespace net
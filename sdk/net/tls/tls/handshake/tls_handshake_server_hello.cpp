@@ -88,6 +88,10 @@ return_t tls_handshake_server_hello::do_postprocess(tls_direction_t dir, const b
             if (tls_1_rtt == protection.get_flow()) {
                 const binary_t& client_hello = protection.get_item(tls_context_client_hello);
                 protection.update_transcript_hash(session, &client_hello[0], client_hello.size());  // client_hello
+            } else if ((tls_0_rtt == protection.get_flow()) && (false == protection.is_resumption())) {
+                // RFC 8446 4.2.10.  the PSK is not selected, a full handshake (the transcript includes the client_hello)
+                protection.set_flow(tls_1_rtt);
+                protection.set_early_data(tls_early_data_rejected);
             }
 
             protection.calc_transcript_hash(session, stream + hspos, size_header_body, hello_hash);  // server_hello
@@ -278,9 +278,6 @@ return_t dtls13_ciphertext::do_write_header(tls_direction_t dir, binary_t& bin,
          * |0|0|1|C|S|L|E E|
          * +-+-+-+-+-+-+-+-+
          */
-        binary_t ciphertext;
-        binary_t header;
-        binary_t tag;
         uint8 uhdr = 0x20;
         uint8 c = (_cid.empty()) ? 0x00 : 0x01;
         uint8 s = (1 == cap) ? 0x00 : 0x08;
@@ -290,8 +287,7 @@ return_t dtls13_ciphertext::do_write_header(tls_direction_t dir, binary_t& bin,
         uint8 sequence_len = s ? 2 : 1;
         uint8 tagsize = protection.get_tag_size();
 
-        binary_t cid;
-
+        // unified header || plaintext || tag, encrypted in place
         {
             payload pl;
             pl << new payload_member(uhdr, constexpr_unified_header)                                          //
@@ -303,61 +299,60 @@ return_t dtls13_ciphertext::do_write_header(tls_direction_t dir, binary_t& bin,
             pl.set_group(constexpr_group_s16, 0 != (0x08 & uhdr));
             pl.set_group(constexpr_group_s8, 0 == (0x08 & uhdr));
             pl.set_group(constexpr_group_l, (0x04 & uhdr));
-            pl.write(header);
+            pl.write(bin);
         }
 
+        size_t hdrsize = bin.size() - recpos;
+        size_t blockpos = bin.size();
+        size_t seqpos = blockpos - (l ? 2 : 0) - sequence_len;
+
         {
             _content_type = uhdr;
             _bodysize = body.size();
             _range.begin = recpos;
-            _range.end = header.size();
+            _range.end = hdrsize;
             _sequence = sess_recno;
             _sequence_len = sequence_len;
-            _offset_encdata = header.size();
+            _offset_encdata = hdrsize;
+        }
+
+        binary_t header;
+        if (check_trace_level(2) && istraceable()) {
+            binary_append(header, &bin[recpos], hdrsize);
+        }
+
+        bin.resize(blockpos + body.size() + tagsize);
+        if (false == body.empty()) {
+            memcpy(&bin[blockpos], &body[0], body.size());
         }
 
         {
-            ret = protection.encrypt(session, dir, body, ciphertext, header, tag);
+            ret = protection.encrypt(session, dir, &bin[recpos], hdrsize, &bin[blockpos], body.size(), &bin[blockpos + body.size()]);
             if (errorcode_t::success != ret) {
+                bin.resize(recpos);
                 __leave2;
             }
         }
 
-        binary_t block;
-        {
-            binary_append(block, ciphertext);
-            binary_append(block, tag);
-        }
-
         uint16 recno = 0;
         uint16 rec_enc = 0;
         binary_t protmask;
-        ret = protection.protection_mask(session, dir, &block[0], block.size(), protmask, 2);
+        ret = protection.protection_mask(session, dir, &bin[blockpos], body.size() + tagsize, protmask, 2);
         if (errorcode_t::success != ret) {
+            bin.resize(recpos);
             __leave2;
         }
 
+        // record number encryption
         if (2 == sequence_len) {
             rec_enc = t_binary_to_integer<uint16>(protmask);
+            recno = sess_recno ^ rec_enc;
+            bin[seqpos] = (recno >> 8) & 0xff;
+            bin[seqpos + 1] = recno & 0xff;
         } else {
             rec_enc = t_binary_to_integer<uint8>(protmask);
-        }
-        recno = sess_recno ^ rec_enc;
-
-        {
-            payload pl;
-            pl << new payload_member(uhdr, constexpr_unified_header)                                  //
-               << new payload_member(_cid, constexpr_connection_id, constexpr_group_c)                // cid    C:1
-               << new payload_member(uint16(recno), true, constexpr_sequence16, constexpr_group_s16)  // seq 16 S:1
-               << new payload_member(uint8(recno), constexpr_sequence8, constexpr_group_s8)           // seq 8  S:0
-               << new payload_member(uint16(block.size()), true, constexpr_len, constexpr_group_l);   // len    L:1
-            pl.set_group(constexpr_group_c, (0x10 & uhdr));
-            pl.set_group(constexpr_group_s16, 0 != (0x08 & uhdr));
-            pl.set_group(constexpr_group_s8, 0 == (0x08 & uhdr));
-            pl.set_group(constexpr_group_l, (0x04 & uhdr));
-            pl.write(bin);
-
-            binary_append(bin, block);
+            recno = sess_recno ^ rec_enc;
+            bin[seqpos] = recno & 0xff;
         }
 
         if (check_trace_level(2) && istraceable()) {
@@ -366,7 +361,7 @@ return_t dtls13_ciphertext::do_write_header(tls_direction_t dir, binary_t& bin,
             dbs.printf("> header\n");
             dump_memory(header, &dbs, 16, 3, 0x0, dump_notrunc);
             dbs.printf("> header masked (sequence)\n");
-            dump_memory(&bin[0], header.size(), &dbs, 16, 3, 0x0, dump_notrunc);
+            dump_memory(&bin[recpos], hdrsize, &dbs, 16, 3, 0x0, dump_notrunc);
 
             trace_debug_event(category_net, net_event_tls_read, &dbs);
         }
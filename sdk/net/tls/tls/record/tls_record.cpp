@@ -243,13 +243,27 @@ return_t tls_record::do_read_header(tls_direction_t dir, const byte_t* stream, s
 return_t tls_record::do_read_body(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos) { return not_supported; }
 
 return_t tls_record::do_write_header(tls_direction_t dir, binary_t& bin, const binary_t& body) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        ret = write_header(bin, body.size());
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        binary_append(bin, body);
+    }
+    __finally2 {}
+    return ret;
+}
+
+return_t tls_record::write_header(binary_t& bin, uint16 len) {
     return_t ret = errorcode_t::success;
     __try2 {
         uint16 legacy_version = get_legacy_version();
 
         {
             _range.begin = bin.size();
-            _bodysize = body.size();
+            _bodysize = len;
         }
 
         {
@@ -264,15 +278,13 @@ return_t tls_record::do_write_header(tls_direction_t dir, binary_t& bin, const b
                << new payload_member(uint16(get_legacy_version()), true, constexpr_legacy_version)                      // tls, dtls
                << new payload_member(uint16(get_key_epoch()), true, constexpr_key_epoch, constexpr_group_dtls)          // dtls
                << new payload_member(binary_t(get_dtls_record_seq()), constexpr_dtls_record_seq, constexpr_group_dtls)  // dtls
-               << new payload_member(uint16(body.size()), true, constexpr_len);                                         // tls, dtls
+               << new payload_member(uint16(len), true, constexpr_len);                                                 // tls, dtls
 
             pl.set_group(constexpr_group_dtls, is_kindof_dtls(legacy_version));
             pl.write(bin);
         }
 
         _range.end = bin.size();
-
-        binary_append(bin, body);
     }
     __finally2 {}
     return ret;
@@ -49,6 +49,12 @@ class tls_record {
     virtual return_t do_read_body(tls_direction_t dir, const byte_t* stream, size_t size, size_t& pos);
     virtual return_t do_write_header(tls_direction_t dir, binary_t& bin, const binary_t& body);
     virtual return_t do_write_body(tls_direction_t dir, binary_t& bin);
+    /**
+     * @brief   record header
+     * @param   binary_t& bin [inout] the header is appended
+     * @param   uint16 len [in] size of the body that follows
+     */
+    return_t write_header(binary_t& bin, uint16 len);
 
     const range_t& get_header_range();
     uint16 get_body_size();
@@ -68,7 +68,19 @@ return_t tls_record_application_data::do_read_body(tls_direction_t dir, const by
         auto cs = protection.get_cipher_suite();
         const tls_cipher_suite_t* hint = tlsadvisor->hintof_cipher_suite(cs);
         auto declen = (cbc == hint->mode) ? pos + len : len;
+
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   the early data rejected, the server skips the records which fail deprotection (up to max_early_data_size)
+        bool skip_early_data = (from_client == dir) && (tls_early_data_rejected == protection.get_early_data()) &&
+                               (tls_hs_finished != session->get_session_info(dir).get_status());
+        auto recordno = session->get_recordno(dir);
+
         ret = protection.decrypt(session, dir, stream, declen, recpos, plaintext);
+        if ((errorcode_t::success != ret) && skip_early_data) {
+            session->set_recordno(dir, recordno);
+            ret = protection.consume_early_data(len);
+            __leave2;
+        }
         if (errorcode_t::success == ret) {
             auto plainsize = plaintext.size();
             if (plainsize) {
@@ -80,6 +92,14 @@ return_t tls_record_application_data::do_read_body(tls_direction_t dir, const by
                 } else if (tls_content_type_handshake == last_byte) {
                     ret = get_handshakes().read(session, dir, &plaintext[0], plainsize - 1, tpos);
                 } else if (tls_content_type_application_data == last_byte) {
+                    if (protection.is_early_data(session, dir)) {
+                        // 0-RTT, delivered before the handshake completes
+                        ret = protection.consume_early_data(plainsize - 1);
+                        if (errorcode_t::success != ret) {
+                            __leave2;
+                        }
+                        session->push_early_data(&plaintext[0], plainsize - 1);
+                    }
                     if (cbc == hint->mode) {
                         ret = get_application_data(plaintext, true);
                     } else {
@@ -155,18 +175,45 @@ return_t tls_record_application_data::do_write_header(tls_direction_t dir, binar
 
             binary_append(ciphertext, iv);
             binary_append(ciphertext, encbody);
+
+            // content header + ciphertext
+            tls_record::do_write_header(dir, bin, ciphertext);
         } else {
-            // additional = content header as AAD
-            ret = protection.encrypt(session, dir, body, ciphertext, additional, tag);
+            // content header || [nonce_explicit] || plaintext || tag, encrypted in place
+            size_t record_iv_size = protection.get_record_iv_size();
+            size_t recpos = bin.size();
+            ret = write_header(bin, len + record_iv_size);
             if (errorcode_t::success != ret) {
                 __leave2;
             }
 
-            binary_append(ciphertext, tag);
-        }
+            // additional = content header as AAD (TLS 1.3, DTLS 1.3)
+            if (tlsadvisor->is_kindof(tls_12, tlsversion)) {
+                // RFC 5246 6.2.3.3.  AEAD Ciphers
+                //   additional_data = seq_num + TLSCompressed.type + TLSCompressed.version + TLSCompressed.length
+                //   nonce_explicit = seq_num (see build_iv)
+                ret = protection.build_aad(session, dir, &bin[recpos], bin.size() - recpos, body.size(), additional);
+                if (errorcode_t::success != ret) {
+                    bin.resize(recpos);
+                    __leave2;
+                }
+                if (record_iv_size) {
+                    binary_append(bin, session->get_recordno(dir), hton64);
+                }
+            }
+
+            size_t pos = bin.size();
+            bin.resize(pos + body.size() + tagsize);
+            if (false == body.empty()) {
+                memcpy(&bin[pos], &body[0], body.size());
+            }
 
-        // content header + ciphertext
-        tls_record::do_write_header(dir, bin, ciphertext);
+            ret = protection.encrypt(session, dir, &additional[0], additional.size(), &bin[pos], body.size(), &bin[pos + body.size()]);
+            if (errorcode_t::success != ret) {
+                bin.resize(recpos);
+                __leave2;
+            }
+        }
     }
     __finally2 {}
     return ret;
@@ -188,11 +235,20 @@ return_t tls_record_application_data::do_write_body(tls_direction_t dir, binary_
     } else if (get_binary().size()) {
         // RFC 8446 2.  Protocol Overview
         // Application Data MUST NOT be sent prior to sending the Finished message
+        // RFC 8446 4.2.10.  Early Data Indication
+        //   0-RTT data protected under client_early_traffic_secret, at most max_early_data_size
         auto session = get_session();
+        auto& protection = session->get_tls_protection();
         auto hsstatus = session->get_session_info(dir).get_status();
         if (tls_hs_finished == hsstatus) {
             binary_append(bin, _bin);
             _bin.clear();
+        } else if (protection.is_early_data(session, dir)) {
+            ret = protection.consume_early_data(_bin.size());
+            if (errorcode_t::success == ret) {
+                binary_append(bin, _bin);
+                _bin.clear();
+            }
         }
     }
     return ret;
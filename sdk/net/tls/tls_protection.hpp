@@ -96,6 +96,40 @@ class tls_protection {
 
     tls_message_flow_t get_flow();
     void set_flow(tls_message_flow_t flow);
+    /**
+     * @brief   PSK resumption (psk_dhe_ke)
+     * @remarks
+     *          RFC 8446 2.2.  Resumption and Pre-Shared Key (PSK)
+     *          server - the ticket and the binder are verified (see tls_resumption)
+     *          client - the server_hello pre_shared_key selected the identity
+     *          the Early Secret is derived from tls_secret_resumption_early
+     */
+    bool is_resumption();
+    void set_resumption(bool resumption);
+    /**
+     * @brief   0-RTT early data
+     * @remarks
+     *          RFC 8446 4.2.10.  Early Data Indication
+     *          client - offered if the ticket allows early data, accepted by EncryptedExtensions early_data
+     *          server - accepted if the PSK is resumed and the ClientHello is fresh and not replayed (see tls_resumption)
+     */
+    tls_early_data_t get_early_data();
+    void set_early_data(tls_early_data_t state);
+    /**
+     * @brief   application data protected under client_early_traffic_secret
+     * @remarks from_client, 0-RTT flow, offered or accepted, until EndOfEarlyData
+     */
+    bool is_early_data(tls_session* session, tls_direction_t dir);
+    /**
+     * @brief   max_early_data_size
+     */
+    uint32 get_max_early_data_size();
+    void set_max_early_data_size(uint32 size);
+    /**
+     * @brief   count the early data
+     * @return  errorcode_t::exceed if more than max_early_data_size
+     */
+    return_t consume_early_data(size_t size);
 
     /**
      * @brief   cipher suite
@@ -160,8 +194,37 @@ class tls_protection {
     // encryption
     ///////////////////////////////////////////////////////////////////////////
     return_t get_cipher_info(tls_session* session, crypt_algorithm_t& alg, crypt_mode_t& mode);
+    /**
+     * @brief   AEAD nonce (12 bytes)
+     * @remarks
+     *          TLS 1.3, DTLS 1.3, QUIC, TLS 1.2 ChaCha20-Poly1305 (RFC 7905)
+     *            nonce = iv(12) xor recordno
+     *          TLS 1.2 GCM, CCM, CCM_8 (RFC 5288, RFC 6655)
+     *            nonce = salt(4) || nonce_explicit(8), nonce_explicit = recordno
+     */
     return_t build_iv(tls_session* session, tls_secret_t type, binary_t& iv, uint64 recordno);
+    return_t build_iv(tls_session* session, tls_secret_t type, byte_t* iv, size_t size, uint64 recordno);
     uint8 get_tag_size();
+    /**
+     * @brief   RFC 5246 6.2.3.3.  AEAD Ciphers - record_iv_length
+     * @return  8 (nonce_explicit) in TLS 1.2 and DTLS 1.2 GCM, CCM, CCM_8, otherwise 0
+     */
+    uint8 get_record_iv_size();
+    /**
+     * @brief   TLS 1.2 AEAD additional data
+     * @param   tls_session* session [in]
+     * @param   tls_direction_t dir [in]
+     * @param   const byte_t* header [in] record header
+     * @param   size_t hdrsize [in]
+     * @param   uint16 length [in] plaintext length
+     * @param   binary_t& aad [out]
+     * @remarks
+     *          RFC 5246 6.2.3.3.  AEAD Ciphers
+     *            additional_data = seq_num + TLSCompressed.type + TLSCompressed.version + TLSCompressed.length;
+     *          RFC 6347 4.1.2.1.  MAC
+     *            seq_num = epoch || sequence_number (DTLS 1.2)
+     */
+    return_t build_aad(tls_session* session, tls_direction_t dir, const byte_t* header, size_t hdrsize, uint16 length, binary_t& aad);
 
     return_t get_aead_key(tls_session* session, tls_direction_t dir, tls_secret_t& key, tls_secret_t& iv, protection_level_t level = protection_default);
     return_t get_cbc_hmac_key(tls_session* session, tls_direction_t dir, tls_secret_t& key, tls_secret_t& mackey);
@@ -189,6 +252,32 @@ class tls_protection {
     return_t decrypt(tls_session* session, tls_direction_t dir, const byte_t* stream, size_t size, size_t pos, binary_t& plaintext, const binary_t& aad,
                      const binary_t& tag, protection_level_t level = protection_default);
 
+    /**
+     * @brief   AEAD encrypt in place
+     * @param   tls_session* session [in]
+     * @param   tls_direction_t dir [in]
+     * @param   const byte_t* aad [in]
+     * @param   size_t aadlen [in]
+     * @param   byte_t* stream [inout] plaintext, ciphertext
+     * @param   size_t size [in]
+     * @param   byte_t* tag [out] get_tag_size() bytes
+     * @param   protection_level_t level [inopt]
+     * @remarks
+     *          GCM, CCM, CCM_8, Poly1305 (CBC not_supported)
+     *          record = header(aad) || plaintext || room for the tag
+     *              protection.encrypt(session, dir, &record[0], hdrsize, &record[hdrsize], size, &record[hdrsize + size]);
+     */
+    return_t encrypt(tls_session* session, tls_direction_t dir, const byte_t* aad, size_t aadlen, byte_t* stream, size_t size, byte_t* tag,
+                     protection_level_t level = protection_default);
+    /**
+     * @brief   AEAD decrypt in place
+     * @param   byte_t* stream [inout] ciphertext, plaintext
+     * @param   const byte_t* tag [in] get_tag_size() bytes
+     * @remarks see encrypt
+     */
+    return_t decrypt(tls_session* session, tls_direction_t dir, const byte_t* aad, size_t aadlen, byte_t* stream, size_t size, const byte_t* tag,
+                     protection_level_t level = protection_default);
+
     ///////////////////////////////////////////////////////////////////////////
     // calc
     ///////////////////////////////////////////////////////////////////////////
@@ -199,6 +288,32 @@ class tls_protection {
      */
     return_t calc(tls_session* session, tls_hs_type_t type, tls_direction_t dir);
     return_t calc_psk(tls_session* session, const binary_t& binder_hash, const binary_t& psk_binder);
+    /**
+     * @brief   PSK binder
+     * @param   tls_session* session [in]
+     * @param   const binary_t& binder_hash [in] Transcript-Hash(Truncate(ClientHello1))
+     * @param   binary_t& psk_binder [out]
+     * @remarks RFC 8446 4.2.11.2.  PSK Binder (the hash of the cipher suite, SHA-256 if not negotiated)
+     */
+    return_t calc_psk_binder(tls_session* session, const binary_t& binder_hash, binary_t& psk_binder);
+    /**
+     * @brief   PSK associated with the ticket
+     * @param   tls_session* session [in]
+     * @param   const binary_t& ticket_nonce [in]
+     * @param   binary_t& psk [out]
+     * @remarks RFC 8446 4.6.1.  HKDF-Expand-Label(resumption_master_secret, "resumption", ticket_nonce, Hash.length)
+     */
+    return_t calc_resumption_psk(tls_session* session, const binary_t& ticket_nonce, binary_t& psk);
+    /**
+     * @brief   Early Secret
+     * @param   tls_session* session [in]
+     * @param   const binary_t& psk [in]
+     * @remarks
+     *          RFC 8446 7.1.  Key Schedule
+     *          tls_secret_resumption = psk
+     *          tls_secret_resumption_early = HKDF-Extract(0, psk)
+     */
+    return_t calc_resumption_early(tls_session* session, const binary_t& psk);
     return_t calc_finished(tls_direction_t dir, hash_algorithm_t alg, uint16 dlen, tls_secret_t& secret, binary_t& maced);
 
     ///////////////////////////////////////////////////////////////////////////
@@ -229,25 +344,72 @@ class tls_protection {
                           protection_level_t level = protection_default);
     /**
      * @brief   decrypt
+     * @param   const byte_t* nonce_explicit [inopt] TLS 1.2 GCM, CCM, CCM_8 (see get_record_iv_size)
      * @remarks stream do not include a tag
      */
     return_t decrypt_aead(tls_session* session, tls_direction_t dir, const byte_t* stream, size_t size, size_t pos, binary_t& plaintext, const binary_t& aad,
-                          const binary_t& tag, protection_level_t level = protection_default);
+                          const binary_t& tag, protection_level_t level = protection_default, const byte_t* nonce_explicit = nullptr);
     /**
      * @brief   TLS 1 decrypt
      */
     return_t decrypt_cbc_hmac(tls_session* session, tls_direction_t dir, const byte_t* stream, size_t size, size_t pos, binary_t& plaintext);
+    /**
+     * @brief   the hash of the cipher suite (SHA-256 if not negotiated), PSK binder and resumption
+     */
+    const hint_digest_t* hintof_psk_digest();
+
+    /**
+     * @brief   AEAD encrypt/decrypt using a cached context
+     * @param   tls_secret_t secret_key [in] see get_aead_key
+     * @param   crypt_algorithm_t alg [in]
+     * @param   crypt_mode_t mode [in]
+     * @param   const byte_t* nonce [in] see build_iv
+     * @remarks
+     *          ciphertext == plaintext (in place) allowed
+     *          the key schedule is expanded once per traffic key, a record sets the nonce only
+     *          a traffic key is per direction and level (client/server, early/handshake/application, QUIC initial/handshake/application)
+     */
+    return_t aead_encrypt(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode, const byte_t* nonce, size_t noncesize, const byte_t* aad,
+                          size_t aadlen, const byte_t* plaintext, size_t size, byte_t* ciphertext, byte_t* tag, size_t& tagsize);
+    return_t aead_decrypt(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode, const byte_t* nonce, size_t noncesize, const byte_t* aad,
+                          size_t aadlen, const byte_t* ciphertext, size_t size, byte_t* plaintext, const byte_t* tag, size_t tagsize);
 
    private:
-    tls_message_flow_t _flow;              // TLS flow
-    uint16 _ciphersuite;                   // cipher suite negotiated
-    uint16 _lagacy_version;                // legacy version
-    uint16 _version;                       // negotiated version
-    transcript_hash* _transcript_hash;     // transcript hash
-    critical_section _lock;                // lock
-    crypto_key _keyexchange;               // key
-    std::map<tls_secret_t, binary_t> _kv;  // secrets
-    bool _use_pre_master_secret;           // test
+    struct aead_context_t {
+        crypt_context_t* handle;  // openssl_crypt
+        binary_t key;             // the key installed
+        critical_section lock;    // a record at a time
+
+        aead_context_t() : handle(nullptr) {}
+    };
+
+    /**
+     * @brief   cached AEAD context
+     * @return  entered (call lock.leave), nullptr if failed
+     * @remarks (re)created if the key is installed or updated
+     */
+    aead_context_t* get_aead_context(tls_secret_t secret_key, crypt_algorithm_t alg, crypt_mode_t mode);
+    /**
+     * @brief   drop the AEAD context
+     * @remarks key update, clear_item
+     */
+    void reset_aead_context(tls_secret_t secret_key);
+    void clear_aead_contexts();
+
+    tls_message_flow_t _flow;                       // TLS flow
+    uint16 _ciphersuite;                            // cipher suite negotiated
+    uint16 _lagacy_version;                         // legacy version
+    uint16 _version;                                // negotiated version
+    transcript_hash* _transcript_hash;              // transcript hash
+    critical_section _lock;                         // lock
+    crypto_key _keyexchange;                        // key
+    std::map<tls_secret_t, binary_t> _kv;           // secrets
+    std::map<tls_secret_t, aead_context_t*> _aead;  // AEAD contexts per traffic key
+    bool _use_pre_master_secret;                    // test
+    bool _resumption;                               // PSK resumption
+    tls_early_data_t _early_data;                   // 0-RTT
+    uint32 _max_early_data_size;                    // 0-RTT
+    uint32 _early_data_size;                        // 0-RTT received or sent
 
     uint8 _key_exchange_mode;               // psk_ke, psk_dhe_ke
     protection_context _handshake_context;  // context
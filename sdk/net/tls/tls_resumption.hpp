@@ -0,0 +1,192 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *          RFC 8446 4.6.1.  New Session Ticket Message
+ *          RFC 5077 4.  Recommended Ticket Construction
+ *          RFC 8446 8.  0-RTT and Anti-Replay
+ *
+ * Revision History
+ * Date         Name                Description
+ *
+ */
+
+#ifndef __HOTPLACE_SDK_NET_TLS1_RESUMPTION__
+#define __HOTPLACE_SDK_NET_TLS1_RESUMPTION__
+
+#include <list>
+#include <map>
+#include <sdk/base/system/critical_section.hpp>
+#include <sdk/base/system/types.hpp>
+#include <sdk/net/tls/types.hpp>
+
+namespace hotplace {
+namespace net {
+
+class tls_session;
+
+struct tls_resumption_stat_t {
+    uint64 issued;    // NewSessionTicket
+    uint64 offered;   // pre_shared_key offered
+    uint64 resumed;   // PSK accepted
+    uint64 rejected;  // unknown key, expired, binder mismatch (a full handshake)
+    uint64 cache_hit;
+    uint64 evict;
+    uint64 early_data_accepted;  // 0-RTT
+    uint64 early_data_rejected;  // 0-RTT not allowed, stale or replayed
+    uint64 replayed;             // the binder seen in the replay window
+    size_t entries;              // cached tickets
+
+    tls_resumption_stat_t()
+        : issued(0), offered(0), resumed(0), rejected(0), cache_hit(0), evict(0), early_data_accepted(0), early_data_rejected(0), replayed(0), entries(0) {}
+};
+
+/**
+ * @brief   session ticket (server)
+ * @remarks
+ *          stateless, the resumption state is encrypted under a ticket key and carried by the client
+ *            ticket = key_name(16) || iv(12) || aes-256-gcm(state) || tag(16), key_name is the AAD
+ *            state  = version(2) || cipher_suite(2) || issued(8) || age_add(4) || lifetime(4) || max_early_data_size(4) || psk_len(1) || psk
+ *                     || alpn_len(1) || alpn
+ *          the ticket key is rotated every interval, the previous keys decrypt until the tickets issued under them expire
+ *          set_cache_size(n) keeps the n most recently used states (decryption is skipped on hit)
+ *          set_max_early_data_size(n) allows 0-RTT, early data is accepted if
+ *            the ticket allows it, the ClientHello offers the cipher suite and the ALPN protocol of the ticket (RFC 8446 4.2.10),
+ *            the ClientHello is fresh (RFC 8446 8.3) and the binder is not seen in the replay window (RFC 8446 8.2)
+ *
+ *          // server, NewSessionTicket
+ *          tls_resumption::get_instance()->issue(session, nonce, lifetime, age_add, ticket);
+ *          // server, ClientHello pre_shared_key
+ *          ret = tls_resumption::get_instance()->resume(session, ticket, obfuscated_ticket_age, partial_client_hello, size, binder);
+ *          // errorcode_t::success - psk_dhe_ke, otherwise a full handshake
+ */
+class tls_resumption {
+   public:
+    static tls_resumption* get_instance();
+    ~tls_resumption();
+
+    /**
+     * @brief   ticket_lifetime in seconds (default 7200, at most 604800)
+     */
+    tls_resumption& set_lifetime(uint32 lifetime);
+    uint32 get_lifetime();
+    /**
+     * @brief   ticket key rotation interval in seconds (default 3600)
+     */
+    tls_resumption& set_rotation(uint32 interval);
+    /**
+     * @brief   cached tickets (default 0, stateless)
+     */
+    tls_resumption& set_cache_size(size_t size);
+    /**
+     * @brief   max_early_data_size (default 0, 0-RTT disabled)
+     */
+    tls_resumption& set_max_early_data_size(uint32 size);
+    uint32 get_max_early_data_size();
+    /**
+     * @brief   anti-replay window in seconds (default 10)
+     * @remarks the binders of the ClientHellos accepting 0-RTT are kept for the window, the ClientHellos older than the window are not fresh
+     */
+    tls_resumption& set_replay_window(uint32 window);
+    /**
+     * @brief   a new ticket key
+     */
+    void rotate();
+
+    /**
+     * @brief   NewSessionTicket
+     * @param   tls_session* session [in] server session (after client Finished)
+     * @param   const binary_t& nonce [in] ticket_nonce
+     * @param   uint32& lifetime [out] ticket_lifetime
+     * @param   uint32& age_add [out] ticket_age_add
+     * @param   binary_t& ticket [out] ticket
+     */
+    return_t issue(tls_session* session, const binary_t& nonce, uint32& lifetime, uint32& age_add, binary_t& ticket);
+    /**
+     * @brief   resume
+     * @param   tls_session* session [in] server session
+     * @param   const binary_t& ticket [in] PskIdentity.identity
+     * @param   uint32 obfuscated_ticket_age [in] PskIdentity.obfuscated_ticket_age
+     * @param   const byte_t* partial_client_hello [in] handshake header ~ identities (Truncate(ClientHello1))
+     * @param   size_t size [in]
+     * @param   const binary_t& binder [in] PskBinderEntry
+     * @remarks
+     *          on success, tls_secret_resumption_early and the cipher suite are set and tls_protection::is_resumption() is true
+     *          if the early_data is offered, it is accepted (tls_0_rtt) or rejected (tls_1_rtt)
+     */
+    return_t resume(tls_session* session, const binary_t& ticket, uint32 obfuscated_ticket_age, const byte_t* partial_client_hello, size_t size,
+                    const binary_t& binder);
+
+    void get_stat(tls_resumption_stat_t* stat);
+    /**
+     * @brief   drop the ticket keys, the cache and the replay window
+     */
+    void clear();
+
+   protected:
+    tls_resumption();
+
+    struct ticket_key_t {
+        binary_t name;  // key_name
+        binary_t key;   // aes-256-gcm
+        time_t created;
+
+        ticket_key_t() : created(0) {}
+    };
+    struct ticket_state_t {
+        uint16 version;
+        uint16 cipher_suite;
+        uint64 issued;
+        uint32 age_add;
+        uint32 lifetime;
+        uint32 max_early_data_size;
+        binary_t psk;
+        binary_t alpn;  // ProtocolNameList selected (EncryptedExtensions)
+
+        ticket_state_t() : version(0), cipher_suite(0), issued(0), age_add(0), lifetime(0), max_early_data_size(0) {}
+    };
+    struct cache_entry_t {
+        ticket_state_t state;
+        std::list<binary_t>::iterator lru;
+    };
+
+    void new_key(time_t now);
+    void expire_keys(time_t now);
+    return_t seal(const ticket_state_t& state, binary_t& ticket);
+    return_t open(const binary_t& ticket, ticket_state_t& state);
+    return_t search_cache(const binary_t& ticket, ticket_state_t& state);
+    void insert_cache(const binary_t& ticket, const ticket_state_t& state);
+    void evict();
+    /**
+     * @brief   RFC 8446 4.2.10.  the cipher suite and the ALPN protocol of the ticket are offered
+     */
+    bool match_early_data(tls_session* session, const ticket_state_t& state);
+    /**
+     * @brief   RFC 8446 8.  0-RTT and Anti-Replay
+     * @return  true if 0-RTT is accepted
+     */
+    bool accept_early_data(const ticket_state_t& state, uint32 ticket_age, const binary_t& binder, time_t now);
+    void expire_strikes(time_t now);
+
+   private:
+    static tls_resumption _instance;
+
+    critical_section _lock;
+    uint32 _lifetime;
+    uint32 _rotation;
+    size_t _cache_size;
+    uint32 _max_early_data_size;
+    uint32 _replay_window;
+    std::list<ticket_key_t> _keys;                 // the current key first
+    std::map<binary_t, cache_entry_t> _cache_map;  // cache
+    std::list<binary_t> _lru;                      // the most recently used first
+    std::map<binary_t, time_t> _strikes;           // binders seen in the replay window
+    std::list<binary_t> _strike_order;             // the oldest first
+    tls_resumption_stat_t _stat;
+};
+
+}  // namespace net
+}  // namespace hotplace
+
+#endif
@@ -106,6 +106,23 @@ class tls_session {
     size_t numberof_alerts();
     return_t pop_alert(uint8& level, uint8& desc);
 
+    /**
+     * RFC 8446 4.2.10.  Early Data Indication
+     * 0-RTT application data accepted by the server, delivered before the handshake completes
+     *
+     * produce
+     *      // tls_record_application_data, the client_early_traffic_secret is in use
+     *      session->push_early_data(&plaintext[0], plainsize - 1);
+     * consume
+     *      binary_t early_data;
+     *      while (errorcode_t::success == session->pop_early_data(early_data)) {
+     *          // handler
+     *      }
+     */
+    void push_early_data(const byte_t* data, size_t size);
+    size_t numberof_early_data();
+    return_t pop_early_data(binary_t& data);
+
    private:
     critical_section _lock;
     t_shared_reference<tls_session> _shared;
@@ -121,6 +138,7 @@ class tls_session {
         alert(uint8 l, uint8 d) : level(l), desc(d) {}
     };
     std::queue<alert> _alerts;
+    std::queue<binary_t> _early_data;
 };
 
 }  // namespace net
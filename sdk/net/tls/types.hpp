@@ -516,6 +516,12 @@ enum tls_secret_t : uint16 {
     tls_context_resumption_binder_hash = (TLS_SECRET_USERCONTEXT | 0x10),   // CH 0-RTT
 
     tls_context_quic_dcid = (TLS_SECRET_USERCONTEXT | 0x11),
+    tls_context_session_ticket = (TLS_SECRET_USERCONTEXT | 0x12),           // NST ticket (client)
+    tls_context_session_ticket_age_add = (TLS_SECRET_USERCONTEXT | 0x13),   // NST ticket_age_add (client)
+    tls_context_session_ticket_received = (TLS_SECRET_USERCONTEXT | 0x14),  // NST time received in secs (client)
+    tls_context_session_ticket_max_early_data = (TLS_SECRET_USERCONTEXT | 0x15),  // NST early_data max_early_data_size (client)
+    tls_context_client_hello_alpn = (TLS_SECRET_USERCONTEXT | 0x16),              // CH ProtocolNameList offered (server, 0-RTT)
+    tls_context_alpn = (TLS_SECRET_USERCONTEXT | 0x17),                           // EE ProtocolNameList selected (session ticket)
     tls_context_fragment = (TLS_SECRET_USERCONTEXT | 0x1b),  // DTLS, QUIC
 };
 
@@ -531,6 +537,16 @@ enum tls_message_flow_t {
     tls_hello_retry_request = 2,
 };
 
+/**
+ * @brief   RFC 8446 4.2.10.  Early Data Indication
+ */
+enum tls_early_data_t {
+    tls_early_data_none = 0,
+    tls_early_data_offered = 1,   // CH early_data
+    tls_early_data_accepted = 2,  // EE early_data
+    tls_early_data_rejected = 3,  // a full handshake, an unknown or replayed PSK, EE without early_data
+};
+
 /**
  * @brief record number (TLS, DTLS), packet number (QUIC)
  * @remarks
@@ -25,6 +25,7 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 
 #elif defined _WIN32 || defined _WIN64
@@ -46,7 +47,17 @@ using namespace crypto;
 using namespace io;
 namespace net {
 
-// reserve
+/**
+ * @brief   a piece of a message, sent by reference (scatter-gather)
+ * @sa      server_socket::sendv, network_session::sendv
+ */
+struct sendbuf_t {
+    const char* ptr;
+    size_t size;
+
+    sendbuf_t() : ptr(nullptr), size(0) {}
+    sendbuf_t(const void* p, size_t n) : ptr((const char*)p), size(n) {}
+};
 
 }  // namespace net
 }  // namespace hotplace
@@ -66,6 +66,8 @@ int main(int argc, char** argv) {
 
     // huffman codes
     test_huffman_codes();
+    test_huffman_packed();
+    test_huffman_benchmark();
 
     // HPACK
     test_rfc7541_c_1();
@@ -74,7 +76,12 @@ int main(int argc, char** argv) {
     test_rfc7541_c_4();
     test_rfc7541_c_5();
     test_rfc7541_c_6();
+    test_dynamic_table();
+    test_static_table();
     test_h2_header_frame_fragment();
+    test_h2_flow_control();
+    test_h2_flow_control_benchmark();
+    test_h2_receive_window();
 
     openssl_cleanup();
 
@@ -27,13 +27,20 @@ extern t_shared_instance<t_cmdline_t<OPTION> > _cmdline;
 extern t_shared_instance<hpack_encoder> encoder;
 
 void test_huffman_codes();
+void test_huffman_packed();
+void test_huffman_benchmark();
 void test_rfc7541_c_1();
 void test_rfc7541_c_2();
 void test_rfc7541_c_3();
 void test_rfc7541_c_4();
 void test_rfc7541_c_5();
 void test_rfc7541_c_6();
+void test_dynamic_table();
+void test_static_table();
 
 void test_h2_header_frame_fragment();
+void test_h2_flow_control();
+void test_h2_flow_control_benchmark();
+void test_h2_receive_window();
 
 #endif
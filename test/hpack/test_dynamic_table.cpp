@@ -0,0 +1,87 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+void test_dynamic_table() {
+    _test_case.begin("dynamic table");
+
+    hpack_dynamic_table table;
+    size_t index = 0;
+    std::string name;
+    std::string value;
+    match_result_t state = match_result_t::not_matched;
+    return_t ret = errorcode_t::success;
+
+    // entry size = 32 + 4 + 4, 4 entries
+    table.set_capacity(160);
+
+    char buf[8];
+    for (int i = 0; i < 100; i++) {
+        snprintf(buf, sizeof(buf), "%04d", i);
+        table.insert("name", buf);
+        table.commit();
+    }
+    _test_case.assert((4 == table.get_entries()) && (160 == table.get_tablesize()), __FUNCTION__, "evict");
+
+    // latest = 62 (RFC 7541 2.3.3)
+    state = table.match(0, "name", "0099", index);
+    _test_case.assert((match_result_t::all_matched_dynamic == state) && (62 == index), __FUNCTION__, "match latest");
+    state = table.match(0, "name", "0096", index);
+    _test_case.assert((match_result_t::all_matched_dynamic == state) && (65 == index), __FUNCTION__, "match oldest");
+    state = table.match(0, "name", "0095", index);
+    _test_case.assert(match_result_t::not_matched == state, __FUNCTION__, "evicted");
+    state = table.match(qpack_name_reference, "name", "0095", index);
+    _test_case.assert((match_result_t::key_matched_dynamic == state) && (62 == index), __FUNCTION__, "name reference");
+
+    ret = table.select(0, 63, name, value);
+    _test_case.assert((errorcode_t::success == ret) && ("name" == name) && ("0098" == value), __FUNCTION__, "select");
+    ret = table.select(0, 66, name, value);
+    _test_case.assert(errorcode_t::not_found == ret, __FUNCTION__, "select out of range");
+
+    // duplicated entries
+    table.insert("name", "0099");
+    table.commit();
+    state = table.match(0, "name", "0099", index);
+    _test_case.assert((match_result_t::all_matched_dynamic == state) && (62 == index), __FUNCTION__, "duplicated");
+
+    // shrink
+    table.set_capacity(40);
+    _test_case.assert(1 == table.get_entries(), __FUNCTION__, "set_capacity");
+
+    // lookups against a large table
+    const int entries = 1000;
+    const int loop = 100000;
+    hpack_dynamic_table large;
+    large.set_capacity(entries * 64);
+    for (int i = 0; i < entries; i++) {
+        snprintf(buf, sizeof(buf), "%04d", i);
+        large.insert(std::string("x-custom-") + buf, buf);
+    }
+    large.commit();
+
+    struct timespec begin;
+    struct timespec end;
+    struct timespec diff;
+    int matched = 0;
+    time_monotonic(begin);
+    for (int i = 0; i < loop; i++) {
+        snprintf(buf, sizeof(buf), "%04d", i % entries);
+        if (match_result_t::all_matched_dynamic == large.match(0, std::string("x-custom-") + buf, buf, index)) {
+            matched++;
+        }
+    }
+    time_monotonic(end);
+    time_diff(diff, begin, end);
+
+    double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    _logger->writeln("entries %i match %.0f ops/sec", large.get_entries(), loop / elapsed);
+    _test_case.assert(loop == matched, __FUNCTION__, "match %i entries", entries);
+}
@@ -0,0 +1,450 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *      RFC 9113 5.2.  Flow Control
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+struct h2_data_t {
+    uint32 stream_id;
+    uint8 flags;
+    size_t size;
+    size_t offset;  // offset of the frame
+};
+
+static void parse_data_frames(const binary_t& frames, std::vector<h2_data_t>& data) {
+    size_t pos = 0;
+    while (pos + sizeof(http2_frame_header_t) <= frames.size()) {
+        http2_frame_header_t* hdr = (http2_frame_header_t*)&frames[pos];
+        size_t size = (hdr->len[0] << 16) | (hdr->len[1] << 8) | hdr->len[2];
+        if (h2_frame_t::h2_frame_data == hdr->type) {
+            h2_data_t item;
+            item.stream_id = ntoh32(hdr->stream_id);
+            item.flags = hdr->flags;
+            item.size = size;
+            item.offset = pos;
+            data.push_back(item);
+        }
+        pos += sizeof(http2_frame_header_t) + size;
+    }
+}
+
+void test_h2_flow_control() {
+    _test_case.begin("HTTP/2 flow control");
+
+    binary_t headers;  // not used
+    binary_t content;
+    binary_t frames;
+    std::vector<h2_data_t> data;
+
+    // RFC 9113 6.9.2.  the initial value is 65535 octets for both new streams and the overall connection
+    {
+        http2_session session;
+        content.resize(100000);
+        session.write(1, headers, content, false, frames);
+        parse_data_frames(frames, data);
+
+        size_t sent = 0;
+        bool test = true;
+        for (auto item : data) {
+            sent += item.size;
+            test &= (item.size <= 16384) && (0 == (h2_flag_end_stream & item.flags));
+        }
+        _test_case.assert(test && (65535 == sent) && (0 == session.get_window(0)) && (1 == session.get_pending_streams()), __FUNCTION__,
+                          "window %zi frames %zi", sent, data.size());
+
+        // connection window, the stream is still blocked
+        frames.clear();
+        session.update_window(0, 100000, frames);
+        _test_case.assert(frames.empty(), __FUNCTION__, "stream window");
+
+        frames.clear();
+        data.clear();
+        session.update_window(1, 100000, frames);
+        parse_data_frames(frames, data);
+        sent = 0;
+        for (auto item : data) {
+            sent += item.size;
+        }
+        _test_case.assert((100000 - 65535 == sent) && (h2_flag_end_stream & data.back().flags) && (0 == session.get_pending_streams()), __FUNCTION__,
+                          "WINDOW_UPDATE");
+    }
+
+    // SETTINGS_MAX_FRAME_SIZE
+    {
+        http2_session session;
+        frames.clear();
+        data.clear();
+        session.update_settings(h2_settings_max_frame_size, 0x8000, frames);
+        session.update_settings(h2_settings_initial_window_size, 0x100000, frames);
+        session.update_window(0, 0x100000, frames);
+        content.resize(100000);
+        session.write(1, headers, content, false, frames);
+        parse_data_frames(frames, data);
+        _test_case.assert((4 == data.size()) && (0x8000 == data[0].size) && (100000 - 3 * 0x8000 == data[3].size), __FUNCTION__, "SETTINGS_MAX_FRAME_SIZE");
+    }
+
+    // round robin
+    {
+        http2_session session;
+        frames.clear();
+        data.clear();
+        session.update_settings(h2_settings_initial_window_size, 0x100000, frames);
+
+        // the connection window is used by stream 1
+        content.resize(65535);
+        session.write(1, headers, content, false, frames);
+        for (uint32 id = 3; id < 3 + 200; id += 2) {
+            content.resize(65536);
+            session.write(id, headers, content, false, frames);
+        }
+        frames.clear();
+        session.update_window(0, 0x1000000, frames);
+        parse_data_frames(frames, data);
+
+        std::set<uint32> streams;
+        for (size_t i = 0; (i < 100) && (i < data.size()); i++) {
+            streams.insert(data[i].stream_id);
+        }
+        _test_case.assert(100 == streams.size(), __FUNCTION__, "interleaved");
+    }
+
+    // weight
+    {
+        http2_session session;
+        frames.clear();
+        data.clear();
+        session.update_settings(h2_settings_initial_window_size, 0x1000000, frames);
+
+        content.resize(65535);
+        session.write(1, headers, content, false, frames);  // the connection window is used
+        content.resize(0x800000);
+        session.write(3, headers, content, false, frames);
+        content.resize(0x800000);
+        session.write(5, headers, content, false, frames);
+        session.set_weight(3, 255).set_weight(5, 15);  // 256, 16
+
+        frames.clear();
+        session.update_window(0, 0x200000, frames);
+        parse_data_frames(frames, data);
+
+        size_t sent3 = 0;
+        size_t sent5 = 0;
+        for (auto item : data) {
+            if (3 == item.stream_id) {
+                sent3 += item.size;
+            } else if (5 == item.stream_id) {
+                sent5 += item.size;
+            }
+        }
+        _test_case.assert(sent5 && (sent3 / sent5 >= 8), __FUNCTION__, "weight 256 %zi weight 16 %zi", sent3, sent5);
+    }
+
+    // generated content, END_STREAM is set in the last DATA frame of the last chunk
+    {
+        http2_session session;
+        frames.clear();
+        data.clear();
+        content.resize(40000);
+        session.write_chunk(1, headers, content, false, frames);
+        content.resize(40000);
+        session.write_chunk(1, headers, content, false, frames);  // blocked, 14465 bytes queued
+        content.resize(1000);
+        session.write_chunk(1, headers, content, true, frames);
+        content.resize(10);
+        return_t ret = session.write(1, headers, content, false, frames);
+        _test_case.assert(errorcode_t::already_exist == ret, __FUNCTION__, "in progress");
+
+        parse_data_frames(frames, data);
+        size_t sent = 0;
+        bool test = true;
+        for (auto item : data) {
+            sent += item.size;
+            test &= (0 == (h2_flag_end_stream & item.flags));
+        }
+        _test_case.assert(test && (65535 == sent) && (1 == session.get_pending_streams()), __FUNCTION__, "chunks %zi", sent);
+
+        frames.clear();
+        data.clear();
+        session.update_window(0, 100000, frames);
+        session.update_window(1, 100000, frames);
+        parse_data_frames(frames, data);
+        sent = 0;
+        for (auto item : data) {
+            sent += item.size;
+        }
+        _test_case.assert((81000 - 65535 == sent) && (h2_flag_end_stream & data.back().flags) && (0 == session.get_pending_streams()), __FUNCTION__,
+                          "the last chunk");
+
+        // the last chunk is empty
+        http2_session session2;
+        frames.clear();
+        data.clear();
+        content.resize(100);
+        session2.write_chunk(3, headers, content, false, frames);
+        content.clear();
+        session2.write_chunk(3, headers, content, true, frames);
+        parse_data_frames(frames, data);
+        _test_case.assert((2 == data.size()) && (0 == (h2_flag_end_stream & data[0].flags)) && (h2_flag_end_stream & data[1].flags) && (0 == data[1].size),
+                          __FUNCTION__, "empty chunk");
+    }
+
+    // a producer is pulled as the window opens, the queue is bounded (256KB)
+    {
+        const size_t chunk_size = 10000;
+        const size_t total = 1000 * chunk_size;
+        size_t produced = 0;
+        auto producer = [&](binary_t& chunk) -> return_t {
+            chunk.resize(chunk_size, 'x');
+            produced += chunk_size;
+            return (produced < total) ? errorcode_t::success : errorcode_t::no_more;
+        };
+
+        http2_session session;
+        frames.clear();
+        data.clear();
+        session.write(1, headers, producer, frames);
+        parse_data_frames(frames, data);
+        size_t sent = 0;
+        for (auto item : data) {
+            sent += item.size;
+        }
+        bool test = (65535 == sent) && (produced - sent <= 0x40000 + chunk_size);
+        _test_case.assert(test, __FUNCTION__, "producer, sent %zi produced %zi", sent, produced);
+
+        bool bounded = true;
+        bool end_stream = false;
+        while (session.get_pending_streams()) {
+            frames.clear();
+            data.clear();
+            session.update_window(0, 0x10000, frames);
+            session.update_window(1, 0x10000, frames);
+            parse_data_frames(frames, data);
+            for (auto item : data) {
+                sent += item.size;
+                end_stream = (h2_flag_end_stream & item.flags) ? true : false;
+            }
+            bounded &= (produced - sent <= 0x40000 + chunk_size);
+        }
+        _test_case.assert(bounded && end_stream && (total == sent) && (total == produced), __FUNCTION__, "producer, %zi bytes", sent);
+    }
+
+    // RFC 9113 6.9.  WINDOW_UPDATE errors
+    {
+        auto lambda_goaway = [&](const binary_t& bin, uint32 errorcode) -> bool {
+            http2_frame_goaway frame;
+            return_t ret = bin.empty() ? errorcode_t::empty : frame.read((http2_frame_header_t*)&bin[0], bin.size());
+            return (errorcode_t::success == ret) && (h2_frame_t::h2_frame_goaway == frame.get_type()) && (errorcode == frame.get_errorcode());
+        };
+        auto lambda_rst_stream = [&](const binary_t& bin, uint32 stream_id, uint32 errorcode) -> bool {
+            http2_frame_rst_stream frame;
+            return_t ret = bin.empty() ? errorcode_t::empty : frame.read((http2_frame_header_t*)&bin[0], bin.size());
+            return (errorcode_t::success == ret) && (h2_frame_t::h2_frame_rst_stream == frame.get_type()) && (stream_id == frame.get_stream_id()) &&
+                   (errorcode == frame.get_errorcode());
+        };
+
+        http2_session session;
+        frames.clear();
+        return_t ret = session.update_window(0, 0, frames);
+        _test_case.assert((errorcode_t::disconnect == ret) && lambda_goaway(frames, h2_protocol_error), __FUNCTION__, "connection, increment 0");
+
+        frames.clear();
+        ret = session.update_window(0, 0x7fffffff, frames);
+        _test_case.assert((errorcode_t::disconnect == ret) && lambda_goaway(frames, h2_flow_control_error) && (65535 == session.get_window(0)),
+                          __FUNCTION__, "connection, window over 2^31-1");
+
+        frames.clear();
+        content.resize(100000);
+        session.write(1, headers, content, false, frames);  // blocked
+        content.resize(100000);
+        session.write(3, headers, content, false, frames);  // blocked
+        frames.clear();
+        ret = session.update_window(1, 0, frames);
+        _test_case.assert((errorcode_t::bad_data == ret) && lambda_rst_stream(frames, 1, h2_protocol_error) && (1 == session.get_pending_streams()),
+                          __FUNCTION__, "stream, increment 0");
+
+        frames.clear();
+        ret = session.update_window(3, 0x7fffffff, frames);
+        _test_case.assert((errorcode_t::bad_data == ret) && lambda_rst_stream(frames, 3, h2_flow_control_error) && (0 == session.get_pending_streams()),
+                          __FUNCTION__, "stream, window over 2^31-1");
+
+        // RFC 9113 6.5.2.  Defined Settings
+        frames.clear();
+        ret = session.update_settings(h2_settings_initial_window_size, 0x80000000, frames);
+        _test_case.assert((errorcode_t::disconnect == ret) && lambda_goaway(frames, h2_flow_control_error), __FUNCTION__, "SETTINGS_INITIAL_WINDOW_SIZE");
+
+        frames.clear();
+        ret = session.update_settings(h2_settings_max_frame_size, 0x1000000, frames);
+        _test_case.assert((errorcode_t::disconnect == ret) && lambda_goaway(frames, h2_protocol_error), __FUNCTION__, "SETTINGS_MAX_FRAME_SIZE");
+    }
+
+    // http_response::get_response_h2(binary_t&), the body is not truncated
+    {
+        http2_session session;
+        http_response response;
+        binary_t body;
+        body.resize(100000, 'a');
+        response.set_hpack_session(&session.get_hpack_session()).set_version(2).set_stream_id(1);
+        response.compose(200, "application/octet-stream", body);
+
+        frames.clear();
+        data.clear();
+        response.get_response_h2(frames);
+        parse_data_frames(frames, data);
+        size_t sent = 0;
+        bool test = (false == data.empty());
+        for (auto item : data) {
+            sent += item.size;
+            test &= (item.size <= 16384);
+        }
+        test &= (h2_flag_end_stream & data.back().flags) ? true : false;
+        _test_case.assert(test && (100000 == sent), __FUNCTION__, "get_response_h2 %zi frames %zi", sent, data.size());
+    }
+}
+
+void test_h2_flow_control_benchmark() {
+    _test_case.begin("HTTP/2 flow control benchmark");
+
+    const uint32 streams = 100;
+    const size_t size = 60000;  // http2_frame_data (variant) writes up to 64KB
+
+    struct timespec begin;
+    struct timespec end;
+    struct timespec diff;
+
+    auto elapsed = [&]() -> double {
+        time_diff(diff, begin, end);
+        return diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    };
+
+    binary_t headers;
+    binary_t content;
+    std::vector<h2_data_t> data;
+
+    // a DATA frame per response (http2_frame_data), no flow control
+    binary_t frames1;
+    time_monotonic(begin);
+    for (uint32 i = 0; i < streams; i++) {
+        content.resize(size);
+        http2_frame_data frame;
+        frame.set_flags(h2_flag_end_stream).set_stream_id(1 + (i << 1));
+        frame.set_data(content);
+        frame.write(frames1);
+    }
+    time_monotonic(end);
+    double elapsed1 = elapsed();
+    parse_data_frames(frames1, data);
+    size_t first1 = data.back().offset;  // the first byte of the last stream
+
+    // flow control, the responses are queued (the connection window is used by the first one) and the client opens the window by 1MB
+    http2_session session;
+    binary_t frames2;
+    time_monotonic(begin);
+    session.update_settings(h2_settings_initial_window_size, 0x7fffffff, frames2);
+    for (uint32 i = 0; i < streams; i++) {
+        content.resize(size);
+        session.write(1 + (i << 1), headers, content, false, frames2);
+    }
+    while (session.get_pending_streams()) {
+        session.update_window(0, 0x100000, frames2);
+    }
+    time_monotonic(end);
+    double elapsed2 = elapsed();
+
+    data.clear();
+    parse_data_frames(frames2, data);
+    size_t first2 = 0;
+    for (auto item : data) {
+        if (1 + ((streams - 1) << 1) == item.stream_id) {
+            first2 = item.offset;
+            break;
+        }
+    }
+
+    _logger->writeln("streams %u size %zi", streams, size);
+    _logger->writeln("  single DATA frame %8.1f MB/s, the last stream starts at %zi", frames1.size() / elapsed1 / 1000000, first1);
+    _logger->writeln("  flow control      %8.1f MB/s, the last stream starts at %zi", frames2.size() / elapsed2 / 1000000, first2);
+    _test_case.assert(first2 < first1, __FUNCTION__, "streams %u", streams);
+}
+
+void test_h2_receive_window() {
+    _test_case.begin("HTTP/2 receive window");
+
+    // WINDOW_UPDATE is sent when a half of the connection window is consumed
+    {
+        http2_session session;
+        binary_t frames;
+        session.acknowledge(1, 20000, frames);
+        _test_case.assert(frames.empty(), __FUNCTION__, "consumed 20000");
+
+        session.acknowledge(1, 20000, frames);
+        http2_frame_window_update frame;
+        return_t ret = frame.read((http2_frame_header_t*)&frames[0], frames.size());
+        _test_case.assert((errorcode_t::success == ret) && (0 == frame.get_stream_id()) && (40000 == frame.get_increment()), __FUNCTION__,
+                          "WINDOW_UPDATE %u", frame.get_increment());
+
+        frames.clear();
+        session.acknowledge(3, 100, frames);
+        _test_case.assert(frames.empty(), __FUNCTION__, "consumed 100");
+    }
+
+    // RFC 9113 6.9.1.  DATA beyond the connection window, GOAWAY (FLOW_CONTROL_ERROR)
+    {
+        http2_session session;
+        binary_t frames;
+        bool test = (errorcode_t::success == session.receive(1, 40000, frames));
+        session.acknowledge(1, 40000, frames);  // WINDOW_UPDATE 40000
+        test &= (errorcode_t::success == session.receive(1, 65535, frames));
+        _test_case.assert(test, __FUNCTION__, "connection window");
+
+        frames.clear();
+        return_t ret = session.receive(3, 1, frames);
+        http2_frame_goaway frame;
+        frame.read((http2_frame_header_t*)&frames[0], frames.size());
+        _test_case.assert((errorcode_t::disconnect == ret) && (h2_frame_t::h2_frame_goaway == frame.get_type()) &&
+                              (h2_errorcodes_t::h2_flow_control_error == frame.get_errorcode()),
+                          __FUNCTION__, "GOAWAY FLOW_CONTROL_ERROR");
+    }
+
+    // DATA beyond the stream window, RST_STREAM (FLOW_CONTROL_ERROR)
+    {
+        http2_session session;
+        binary_t frames;
+        bool test = true;
+        const uint32 size = 0x8000;
+        for (uint32 i = 0; i < (0xa00000 / size); i++) {
+            test &= (errorcode_t::success == session.receive(1, size, frames));
+            session.acknowledge(0, size, frames);  // the connection window only
+        }
+        _test_case.assert(test, __FUNCTION__, "stream window");
+
+        frames.clear();
+        return_t ret = session.receive(1, 1, frames);
+        http2_frame_rst_stream frame;
+        frame.read((http2_frame_header_t*)&frames[0], frames.size());
+        _test_case.assert((errorcode_t::bad_data == ret) && (h2_frame_t::h2_frame_rst_stream == frame.get_type()) && (1 == frame.get_stream_id()) &&
+                              (h2_errorcodes_t::h2_flow_control_error == frame.get_errorcode()),
+                          __FUNCTION__, "RST_STREAM FLOW_CONTROL_ERROR");
+
+        frames.clear();
+        ret = session.receive(3, 1, frames);
+        _test_case.assert((errorcode_t::success == ret) && frames.empty(), __FUNCTION__, "other streams");
+    }
+
+    {
+        std::string body(1 << 20, 'x');
+        http_request request;
+        request.set_version(2).set_stream_id(1);
+        request.get_http_header().add(":path", "/upload");
+        request.add_content(body.c_str(), body.size());
+
+        http_request moved(std::move(request));
+        _test_case.assert((body == moved.get_content()) && (1 == moved.get_stream_id()), __FUNCTION__, "move");
+    }
+}
@@ -82,3 +82,130 @@ void test_huffman_codes() {
         do_test_huffman_codes_routine(item->sample, item->expect);
     }
 }
+
+void test_huffman_packed() {
+    _test_case.begin("RFC 7541 Appendix B. Huffman Code (bit-packed, state table)");
+
+    return_t ret = errorcode_t::success;
+    huffman_coding packed;
+    huffman_coding bitstring;
+    packed.imports(_h2hcodes);
+    bitstring.imports(_h2hcodes).set_packed(false);
+
+    // all symbols
+    binary_t sample;
+    for (int i = 0; i < 256; i++) {
+        sample.push_back((byte_t)i);
+    }
+    binary_t bin_packed;
+    binary_t bin_bitstring;
+    packed.encode(bin_packed, &sample[0], sample.size());
+    bitstring.encode(bin_bitstring, &sample[0], sample.size());
+    _test_case.assert(bin_packed == bin_bitstring, __FUNCTION__, "encode 0x00..0xff");
+
+    basic_stream bs;
+    ret = packed.decode(&bs, &bin_packed[0], bin_packed.size());
+    _test_case.assert((errorcode_t::success == ret) && (bs.size() == sample.size()) && (0 == memcmp(bs.data(), &sample[0], sample.size())), __FUNCTION__,
+                      "decode 0x00..0xff");
+
+    // 'a' 00011, padding must be the most significant bits of EOS
+    byte_t badpad[] = {0x18};
+    bs.clear();
+    ret = packed.decode(&bs, badpad, sizeof(badpad));
+    _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "padding 00011 000");
+    byte_t goodpad[] = {0x1f};
+    bs.clear();
+    ret = packed.decode(&bs, goodpad, sizeof(goodpad));
+    _test_case.assert((errorcode_t::success == ret) && (bs == basic_stream("a")), __FUNCTION__, "padding 00011 111");
+
+    // EOS (30 bits) MUST be treated as a decoding error
+    byte_t eos[] = {0xff, 0xff, 0xff, 0xff};
+    bs.clear();
+    ret = packed.decode(&bs, eos, sizeof(eos));
+    _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "EOS");
+
+    // RFC 7541 5.2.  padding strictly longer than 7 bits MUST be treated as a decoding error
+    struct testvector_t {
+        binary_t input;
+        const char* text;
+    } testvector[] = {
+        {{0xff}, "padding 8 bits"},
+        {{0xff, 0xff}, "padding 16 bits"},
+        {{0x1f, 0xff}, "'a' padding 11 bits"},
+        {{0x1f, 0xff, 0xff, 0xff, 0xe3}, "'a' EOS 'a'"},
+        {{0x1f, 0xff, 0xff, 0xff, 0xff}, "'a' EOS padding"},
+    };
+    for (const auto& item : testvector) {
+        bs.clear();
+        ret = packed.decode(&bs, &item.input[0], item.input.size());
+        _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "packed %s", item.text);
+        bs.clear();
+        ret = bitstring.decode(&bs, &item.input[0], item.input.size());
+        _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "bitstring %s", item.text);
+    }
+
+    // "00000" 25 bits + 7 bits padding, the longest valid padding
+    byte_t longpad[] = {0x00, 0x00, 0x00, 0x7f};
+    bs.clear();
+    ret = packed.decode(&bs, longpad, sizeof(longpad));
+    _test_case.assert((errorcode_t::success == ret) && (bs == basic_stream("00000")), __FUNCTION__, "packed padding 7 bits");
+    bs.clear();
+    ret = bitstring.decode(&bs, longpad, sizeof(longpad));
+    _test_case.assert((errorcode_t::success == ret) && (bs == basic_stream("00000")), __FUNCTION__, "bitstring padding 7 bits");
+}
+
+double bench_huffman(huffman_coding& huff, const std::string& text, bool encode) {
+    const int loop = 200;
+    struct timespec begin;
+    struct timespec end;
+    struct timespec diff;
+    binary_t bin;
+    basic_stream bs;
+
+    huff.encode(bin, text.c_str(), text.size());
+
+    time_monotonic(begin);
+    for (int i = 0; i < loop; i++) {
+        if (encode) {
+            binary_t temp;
+            huff.encode(temp, text.c_str(), text.size());
+        } else {
+            bs.clear();
+            huff.decode(&bs, &bin[0], bin.size());
+        }
+    }
+    time_monotonic(end);
+    time_diff(diff, begin, end);
+
+    double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    return (text.size() * loop) / elapsed / (1024 * 1024);
+}
+
+void test_huffman_benchmark() {
+    _test_case.begin("Huffman Code benchmark");
+
+    huffman_coding packed;
+    huffman_coding bitstring;
+    packed.imports(_h2hcodes);
+    bitstring.imports(_h2hcodes).set_packed(false);
+
+    std::string text;
+    const char* header = "accept-encoding: gzip, deflate, br\r\nuser-agent: Mozilla/5.0 (X11; Linux x86_64)\r\ncookie: session=0123456789abcdef\r\n";
+    while (text.size() < (16 << 10)) {
+        text += header;
+    }
+
+    double encode_bitstring = bench_huffman(bitstring, text, true);
+    double encode_packed = bench_huffman(packed, text, true);
+    double decode_bitstring = bench_huffman(bitstring, text, false);
+    double decode_packed = bench_huffman(packed, text, false);
+
+    _logger->writeln("encode bitstring %8.2f MB/s packed %8.2f MB/s", encode_bitstring, encode_packed);
+    _logger->writeln("decode trie      %8.2f MB/s table  %8.2f MB/s", decode_bitstring, decode_packed);
+
+    binary_t bin;
+    basic_stream bs;
+    packed.encode(bin, text.c_str(), text.size());
+    return_t ret = packed.decode(&bs, &bin[0], bin.size());
+    _test_case.assert((errorcode_t::success == ret) && (bs == basic_stream(text.c_str())), __FUNCTION__, "benchmark %zi bytes", text.size());
+}
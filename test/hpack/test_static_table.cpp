@@ -0,0 +1,54 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+void do_test_static_table(http_static_table* table, const char* text) {
+    size_t index = 0;
+    std::string name;
+    std::string value;
+    bool test_match = true;
+    bool test_select = true;
+    std::map<std::string, size_t> first;
+
+    auto lambda = [&](uint32 idx, const char* n, const char* v) -> void {
+        first.insert({n, idx});  // the first entry with the name
+
+        match_result_t state = table->match(0, n, v ? v : "", index);
+        if ((match_result_t::all_matched != state) || (idx != index)) {
+            test_match = false;
+        }
+        state = table->match(0, n, "x-unknown-value", index);
+        if ((match_result_t::key_matched != state) || (first[n] != index)) {
+            test_match = false;
+        }
+
+        return_t ret = table->select(hpack_layout_index, idx, name, value);
+        if ((errorcode_t::success != ret) || (name != n) || (value != (v ? v : ""))) {
+            test_select = false;
+        }
+    };
+    table->for_each(lambda);
+
+    _test_case.assert(test_match, __FUNCTION__, "%s match", text);
+    _test_case.assert(test_select, __FUNCTION__, "%s select", text);
+    _test_case.assert(match_result_t::not_matched == table->match(0, "x-unknown-name", "", index), __FUNCTION__, "%s not matched", text);
+    _test_case.assert(errorcode_t::not_found == table->select(hpack_layout_index, table->size() + 1, name, value), __FUNCTION__, "%s out of range", text);
+}
+
+void test_static_table() {
+    _test_case.begin("static table");
+
+    do_test_static_table(hpack_static_table::get_instance(), "HPACK");
+    do_test_static_table(qpack_static_table::get_instance(), "QPACK");
+
+    _test_case.assert(61 == hpack_static_table::get_instance()->size(), __FUNCTION__, "RFC 7541 Appendix A");
+    _test_case.assert(99 == qpack_static_table::get_instance()->size(), __FUNCTION__, "RFC 9204 Appendix A");
+}
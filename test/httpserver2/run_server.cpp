@@ -27,6 +27,16 @@ void api_response_json_handler(network_session*, http_request* request, http_res
     response->compose(200, "application/json", R"({"result":"ok"})");
 }
 
+void api_response_stream_handler(network_session*, http_request* request, http_response* response, http_router* router) {
+    // generated content, a chunk is sent as it is produced
+    int count = 0;
+    http_body_producer_t producer = [count](binary_t& chunk) mutable -> return_t {
+        binary_append(chunk, format("chunk %i\n", count));
+        return (++count < 10) ? errorcode_t::success : errorcode_t::no_more;
+    };
+    response->compose(200, "text/plain", producer);
+}
+
 return_t consume_routine(uint32 type, uint32 data_count, void* data_array[], CALLBACK_CONTROL* callback_control, void* user_context) {
     return_t ret = errorcode_t::success;
     network_session_socket_t* session_socket = (network_session_socket_t*)data_array[0];
@@ -122,8 +132,16 @@ return_t simple_http2_server(void*) {
         _http_server->get_http_router()
             .add("/api/html", api_response_html_handler)
             .add("/api/json", api_response_json_handler)
+            .add("/api/stream", api_response_stream_handler)
             .add("/api/test", default_handler);
 
+        // HTTP/2 request body, DATA frames are not buffered
+        http_body_sink_t upload_sink = [&](network_session* session, http_request* request, const byte_t* data, size_t size, bool end_stream) -> return_t {
+            _logger->writeln("stream %u DATA %zi%s", request->get_stream_id(), size, end_stream ? " END_STREAM" : "");
+            return errorcode_t::success;
+        };
+        _http_server->get_http_router().add_sink("/api/upload", upload_sink).add("/api/upload", default_handler);
+
         _http_server->start();
 
         while (true) {
@@ -68,11 +68,17 @@ int main(int argc, char **argv) {
 
     // request
     test_request();
+    test_header();
 
     // response
     test_response_compose();
+    test_response_writer();
     test_response_parse();
 
+    // stream
+    test_stream();
+    test_chunked();
+
     // authenticate
     test_basic_authentication();
     test_digest_access_authentication();
@@ -87,6 +93,17 @@ int main(int argc, char **argv) {
 
     // documents
     test_documents();
+    test_documents_cache();
+
+    // router
+    test_router();
+
+    // client
+    test_client_pool();
+
+    // server
+    test_sharded_server();
+    test_sendfile_slow_client();
 
     // network test
     if (option.connect) {
@@ -30,8 +30,12 @@ extern t_shared_instance<t_cmdline_t<OPTION> > _cmdline;
 
 void test_uri();
 void test_request();
+void test_header();
 void test_response_compose();
+void test_response_writer();
 void test_response_parse();
+void test_stream();
+void test_chunked();
 void test_uri_form_encoded_body_parameter();
 void test_uri2();
 void test_escape_url();
@@ -39,6 +43,11 @@ void test_basic_authentication();
 void test_digest_access_authentication(const char *alg = nullptr, unsigned long *ossl_minver = nullptr);
 void test_rfc_digest_example();
 void test_documents();
+void test_documents_cache();
+void test_router();
+void test_client_pool();
+void test_sharded_server();
+void test_sendfile_slow_client();
 void test_get_tlsclient();
 void test_get_httpclient();
 void test_bearer_token();
@@ -152,6 +152,53 @@ void test_request() {
     _test_case.assert(header_accept_encoding == "gzip, deflate, br", __FUNCTION__, "header");
 }
 
+void test_header() {
+    _test_case.begin("header");
+
+    http_header header;
+    header.add("Host", "127.0.0.1:9000").add("Content-Length", "2").add("X-Custom", "value").add("host", "ignored");
+
+    // RFC 9110 5.1.  Field Names - case-insensitive
+    const std::string *host = header.find(http_field_host);
+    _test_case.assert(host && ("127.0.0.1:9000" == *host), __FUNCTION__, "well-known field");
+    _test_case.assert(host == header.find("HOST"), __FUNCTION__, "case-insensitive");
+    _test_case.assert("value" == header.get("x-custom"), __FUNCTION__, "other field");
+    _test_case.assert((nullptr == header.find(http_field_range)) && (nullptr == header.find("X-Unknown")), __FUNCTION__, "not found");
+
+    _test_case.assert(http_field_content_length == http_header::get_field("CONTENT-LENGTH", 14), __FUNCTION__, "get_field");
+    _test_case.assert(http_field_unknown == http_header::get_field("content-lengtx", 14), __FUNCTION__, "get_field unknown");
+
+    std::string headers;
+    header.get_headers(headers);
+    _test_case.assert("Host: 127.0.0.1:9000\r\nContent-Length: 2\r\nX-Custom: value\r\n" == headers, __FUNCTION__, "order");
+
+    // HTTP/2 field names are lowercase
+    http_header h2;
+    h2.set_version(2);
+    h2.add(":method", "GET").add("Accept-Encoding", "gzip");
+    headers.clear();
+    h2.get_headers(headers);
+    _test_case.assert((":method: GET\r\naccept-encoding: gzip\r\n" == headers) && ("GET" == *h2.find(http_field_method)), __FUNCTION__, "HTTP/2");
+
+    std::string token;
+    header.add("Authorization", "Bearer 0123-4567-89ab-cdef");
+    header.get_token("Authorization", 1, token);
+    _test_case.assert("0123-4567-89ab-cdef" == token, __FUNCTION__, "token");
+
+    http_header moved;
+    moved = std::move(header);
+    _test_case.assert(moved.find(http_field_authorization) && (nullptr == header.find(http_field_authorization)), __FUNCTION__, "move");
+
+    // RFC 9110 12.5.3.  Accept-Encoding
+    _test_case.assert(1000 == http_header::get_qvalue("gzip, deflate, br", "gzip"), __FUNCTION__, "qvalue gzip");
+    _test_case.assert(0 == http_header::get_qvalue("gzip;q=0, deflate", "gzip"), __FUNCTION__, "qvalue gzip;q=0");
+    _test_case.assert(0 == http_header::get_qvalue("deflate, gzip ; q=0.000", "gzip"), __FUNCTION__, "qvalue gzip ; q=0.000");
+    _test_case.assert(500 == http_header::get_qvalue("GZIP;q=0.5", "gzip"), __FUNCTION__, "qvalue GZIP;q=0.5");
+    _test_case.assert(0 == http_header::get_qvalue("deflate", "gzip"), __FUNCTION__, "qvalue not listed");
+    _test_case.assert(100 == http_header::get_qvalue("deflate, *;q=0.1", "gzip"), __FUNCTION__, "qvalue *;q=0.1");
+    _test_case.assert(0 == http_header::get_qvalue("*, gzip;q=0", "gzip"), __FUNCTION__, "qvalue *, gzip;q=0");
+}
+
 void test_response_compose() {
     _test_case.begin("response");
     const OPTION &option = _cmdline->value();
@@ -173,6 +220,65 @@ void test_response_compose() {
     _test_case.assert(0 == strcmp(response.content_type(), "text/html"), __FUNCTION__, "Content-Type");
 }
 
+void test_response_writer() {
+    _test_case.begin("response");
+
+    // generated content, Transfer-Encoding: chunked
+    {
+        const char *chunks[] = {"hello", " ", "world"};
+        size_t index = 0;
+        auto producer = [&](binary_t &chunk) -> return_t {
+            binary_append(chunk, chunks[index]);
+            return (++index < RTL_NUMBER_OF(chunks)) ? errorcode_t::success : errorcode_t::no_more;
+        };
+
+        http_response response;
+        response.compose(200, "text/plain", producer);
+        basic_stream bs;
+        response.get_response(bs);
+
+        std::string text = bs.c_str();
+        size_t pos = text.find("\r\n\r\n");
+        _test_case.assert(std::string::npos != text.find("Transfer-Encoding: chunked\r\n"), __FUNCTION__, "Transfer-Encoding");
+        _test_case.assert((std::string::npos == text.find("Content-Length")) && (std::string::npos != pos), __FUNCTION__, "Content-Length");
+        _test_case.assert("5\r\nhello\r\n1\r\n \r\n5\r\nworld\r\n0\r\n\r\n" == text.substr(pos + 4), __FUNCTION__, "chunks");
+    }
+
+#if defined __linux__
+    // scatter-gather, the pieces are sent in order and not copied
+    {
+        socket_t sv[2];
+        socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+
+        std::string head = "HTTP/1.1 200 OK\r\nContent-Length: 65536\r\n\r\n";
+        std::string body(1 << 16, 'a');
+        sendbuf_t bufs[] = {sendbuf_t(head.c_str(), head.size()), sendbuf_t(), sendbuf_t(body.c_str(), body.size())};
+
+        tcp_server_socket sock;
+        size_t cbsent = 0;
+        std::string received;
+        auto reader = [&]() -> void {
+            char buf[4096];
+            while (received.size() < head.size() + body.size()) {
+                ssize_t size = ::recv(sv[1], buf, sizeof(buf), 0);
+                if (size < 1) {
+                    break;
+                }
+                received.append(buf, size);
+            }
+        };
+        std::thread t(reader);
+        return_t ret = sock.sendv(sv[0], nullptr, bufs, RTL_NUMBER_OF(bufs), &cbsent);
+        t.join();
+        close_socket(sv[0], true, 0);
+        close_socket(sv[1], true, 0);
+
+        _test_case.assert((errorcode_t::success == ret) && (cbsent == head.size() + body.size()) && (head + body == received), __FUNCTION__, "sendv %zi",
+                          cbsent);
+    }
+#endif
+}
+
 void test_response_parse() {
     _test_case.begin("response");
     const OPTION &option = _cmdline->value();
@@ -213,6 +319,192 @@ void test_response_parse() {
     _test_case.assert("8be41306f5b9bb30019350c33b182858" == kv["opaque"], __FUNCTION__, "opaque from WWW-Authenticate");
 }
 
+void test_stream() {
+    _test_case.begin("stream");
+
+    network_protocol_group group;
+    http_protocol http;
+    network_stream stream_read;
+    network_stream stream_interpreted;
+    group.add(&http);
+
+    // POST (content 1MB) || GET, received in 1500-byte reads
+    const size_t content_size = 1 << 20;
+    basic_stream bs;
+    bs << "POST / HTTP/1.1\r\nContent-Length: " << (unsigned)content_size << "\r\n\r\n";
+    size_t post_size = bs.size() + content_size;
+    std::string content(content_size, 'a');
+    bs.write(content.c_str(), content.size());
+    bs << "GET / HTTP/1.1\r\n\r\n";
+    size_t get_size = bs.size() - post_size;
+
+    size_t count = 0;
+    size_t total = 0;
+    for (size_t pos = 0; pos < bs.size(); pos += 1500) {
+        size_t size = (bs.size() - pos < 1500) ? (bs.size() - pos) : 1500;
+        stream_read.produce(bs.data() + pos, size);
+        stream_read.write(&group, &stream_interpreted);
+
+        network_stream_data *data = nullptr;
+        stream_interpreted.consume(&data);
+        while (data) {
+            network_stream_data *item = data;
+            size_t expect = (0 == count) ? post_size : get_size;
+            _test_case.assert((expect == item->size()) && (0 == memcmp(bs.data() + total, item->content(), item->size())), __FUNCTION__, "message #%zi size %zi",
+                              count, item->size());
+            count++;
+            total += item->size();
+            data = data->next();
+            item->release();
+        }
+    }
+    _test_case.assert(2 == count, __FUNCTION__, "pipelined");
+    _test_case.assert(false == stream_read.ready(), __FUNCTION__, "consumed");
+}
+
+void test_chunked() {
+    _test_case.begin("chunked");
+
+    const char *input =
+        "POST /chunked HTTP/1.1\r\n"
+        "Host: 127.0.0.1:9000\r\n"
+        "transfer-encoding: gzip, chunked\r\n"
+        "\r\n"
+        "5\r\nhello\r\n"
+        "6;ext=1\r\n world\r\n"
+        "0\r\n"
+        "Trailer-Field: value\r\n"
+        "\r\n"
+        "get / http/1.1\r\n"
+        "content-length: 3\r\n"
+        "\r\n"
+        "abc";
+    size_t size_input = strlen(input);
+    size_t size_post = strstr(input, "get /") - input;
+
+    http_request request;
+    request.open(input, size_post);
+    _test_case.assert("POST" == request.get_method(), __FUNCTION__, "method");
+    _test_case.assert("hello world" == request.get_content(), __FUNCTION__, "content");
+    _test_case.assert("value" == request.get_http_header().get("Trailer-Field"), __FUNCTION__, "trailer");
+
+    // resumable, one byte at a time
+    http_parser parser;
+    protocol_cursor_t cursor;
+    return_t ret = errorcode_t::success;
+    size_t size = 0;
+    for (size = 1; size <= size_input; size++) {
+        ret = parser.parse(&cursor, input, size);
+        if (errorcode_t::more_data != ret) {
+            break;
+        }
+    }
+    _test_case.assert((errorcode_t::success == ret) && (size_post == cursor.pos), __FUNCTION__, "resume");
+
+    // pipelined
+    network_protocol_group group;
+    http_protocol http;
+    network_stream stream_read;
+    network_stream stream_interpreted;
+    group.add(&http);
+
+    for (size_t pos = 0; pos < size_input; pos += 7) {
+        stream_read.produce((byte_t *)input + pos, (size_input - pos < 7) ? (size_input - pos) : 7);
+        stream_read.write(&group, &stream_interpreted);
+    }
+    network_stream_data *data = nullptr;
+    stream_interpreted.consume(&data);
+    size_t count = 0;
+    while (data) {
+        network_stream_data *item = data;
+        size_t expect = (0 == count) ? size_post : (size_input - size_post);
+        _test_case.assert(expect == item->size(), __FUNCTION__, "message #%zi size %zi", count, item->size());
+        count++;
+        data = data->next();
+        item->release();
+    }
+    _test_case.assert(2 == count, __FUNCTION__, "pipelined");
+
+    // RFC 9112 5.1 No whitespace is allowed between the field name and colon
+    protocol_cursor_t cursor_bad;
+    const char *bad = "POST / HTTP/1.1\r\nContent-Length : 5\r\n\r\nhello";
+    ret = parser.parse(&cursor_bad, bad, strlen(bad));
+    _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "field name");
+
+    // RFC 9112 6.1, 6.3 request smuggling
+    const char *smuggling[] = {
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked, gzip\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nTransfer-Encoding: gzip\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked, chunked\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\nContent-Length: 5\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nContent-Length: 5\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n",
+    };
+    for (size_t i = 0; i < RTL_NUMBER_OF(smuggling); i++) {
+        protocol_cursor_t cursor_smuggling;
+        ret = parser.parse(&cursor_smuggling, smuggling[i], strlen(smuggling[i]));
+        _test_case.assert(errorcode_t::bad_data == ret, __FUNCTION__, "transfer coding #%zi", i);
+    }
+
+    // a response, the final coding is not chunked, read until the connection is closed
+    {
+        const char *response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: gzip\r\n\r\nabcdef";
+        protocol_cursor_t cursor_response;
+        size_t need = 0;
+        ret = parser.parse(&cursor_response, response, strlen(response), &need);
+        _test_case.assert((errorcode_t::more_data == ret) && (0 == need), __FUNCTION__, "response until close");
+        cursor_response.flags |= http_parser_flag_t::http_parser_eof;
+        ret = parser.parse(&cursor_response, response, strlen(response), &need);
+        _test_case.assert((errorcode_t::success == ret) && (strlen(response) == cursor_response.pos), __FUNCTION__, "response closed");
+    }
+
+    // the framing pass marks the stream, the rest is not split into messages (400 and close, see http_server::consume)
+    {
+        const char *stream =
+            "POST / HTTP/1.1\r\n"
+            "Transfer-Encoding: chunked\r\n"
+            "Content-Length: 4\r\n"
+            "\r\n"
+            "0\r\n\r\n"
+            "GET /admin HTTP/1.1\r\n\r\n";
+        network_stream stream_smuggling;
+        network_stream stream_messages;
+        stream_smuggling.produce((byte_t *)stream, strlen(stream));
+        stream_smuggling.write(&group, &stream_messages);
+        network_stream_data *message = nullptr;
+        stream_messages.consume(&message);
+        bool test = message && (nullptr == message->next()) && (strlen(stream) == message->size()) &&
+                    (http_parser_flag_t::http_parser_error & message->get_cursor()->flags);
+        _test_case.assert(test, __FUNCTION__, "400 and close");
+        while (message) {
+            network_stream_data *item = message;
+            message = message->next();
+            item->release();
+        }
+    }
+
+    // the cursor of the framing pass is reused
+    {
+        network_stream stream_framing;
+        network_stream stream_messages;
+        stream_framing.produce((byte_t *)input, size_post);
+        stream_framing.write(&group, &stream_messages);
+        network_stream_data *message = nullptr;
+        stream_messages.consume(&message);
+        bool test = (nullptr != message);
+        if (message) {
+            const protocol_cursor_t *framing = message->get_cursor();
+            http_request request_framed;
+            ret = request_framed.open((char *)message->content(), message->size(), 0, framing);
+            test = (errorcode_t::success == ret) && (http_parser_phase_t::http_parser_complete == framing->phase) &&
+                   (http_parser_flag_t::http_parser_chunked & framing->flags) && ("hello world" == request_framed.get_content()) &&
+                   ("value" == request_framed.get_http_header().get("Trailer-Field"));
+            message->release();
+        }
+        _test_case.assert(test, __FUNCTION__, "framed");
+    }
+}
+
 void test_uri_form_encoded_body_parameter() {
     _test_case.begin("uri");
     const OPTION &option = _cmdline->value();
@@ -718,6 +1010,564 @@ void test_documents() {
     _test_case.nassert(test, __FUNCTION__, "uri %s local %s", uri.c_str(), local.c_str());
 }
 
+void test_documents_cache() {
+    _test_case.begin("html_documents cache");
+
+    const char *files[] = {"doc_a.html", "doc_b.html", "doc_c.html"};
+    for (auto file : files) {
+        file_stream fs;
+        fs.open(file, filestream_flag_t::open_create_always);
+        fs.fill(1000, file[4]);
+        fs.close();
+    }
+
+    html_documents docs;
+    docs.add_documents_root("/", ".").add_content_type(".html", "text/html").set_cache_capacity(2000);
+
+    std::string content_type;
+    binary_t content;
+    html_documents_stat_t stat;
+
+    // LRU
+    docs.load("/doc_a.html", content_type, content);
+    docs.load("/doc_b.html", content_type, content);
+    docs.load("/doc_a.html", content_type, content);
+    docs.load("/doc_c.html", content_type, content);  // evict doc_b
+    docs.load("/doc_a.html", content_type, content);
+    docs.get_stat(&stat);
+    _test_case.assert((1000 == content.size()) && ('a' == content[0]), __FUNCTION__, "load");
+    _test_case.assert((2 == stat.hit) && (3 == stat.miss) && (1 == stat.evict) && (2 == stat.entries) && (2000 == stat.bytes), __FUNCTION__,
+                      "hit %llu miss %llu evict %llu entries %zi bytes %zi", stat.hit, stat.miss, stat.evict, stat.entries, stat.bytes);
+
+    // RFC 9110 14.2.  Range Requests
+    {
+        http_request request;
+        request.compose(http_method_t::HTTP_GET, "/doc_b.html");
+        request.get_http_header().add("Range", "bytes=10-19");
+        http_response response(&request);
+        docs.compose("/doc_b.html", &response);
+        std::string content_range = response.get_http_header().get("Content-Range");
+        _test_case.assert((206 == response.status_code()) && ("bytes 10-19/1000" == content_range), __FUNCTION__, "206 %s", content_range.c_str());
+
+        basic_stream bs;
+        response.get_response(bs);
+        _test_case.assert(ends_with(bs.c_str(), "\r\n\r\nbbbbbbbbbb"), __FUNCTION__, "Partial Content");
+    }
+    {
+        http_request request;
+        request.compose(http_method_t::HTTP_GET, "/doc_b.html");
+        request.get_http_header().add("Range", "bytes=1000-");
+        http_response response(&request);
+        docs.compose("/doc_b.html", &response);
+        _test_case.assert(416 == response.status_code(), __FUNCTION__, "416");
+    }
+
+    // precompressed, gzip;q=0 refuses
+    {
+        file_stream fs;
+        fs.open("doc_c.html.gz", filestream_flag_t::open_create_always);
+        fs.fill(100, 'z');
+        fs.close();
+
+        http_request request;
+        request.compose(http_method_t::HTTP_GET, "/doc_c.html");
+        request.get_http_header().add("Accept-Encoding", "gzip;q=0, deflate");
+        http_response response(&request);
+        docs.compose("/doc_c.html", &response);
+
+        http_request request2;
+        request2.compose(http_method_t::HTTP_GET, "/doc_c.html");
+        request2.get_http_header().add("Accept-Encoding", "deflate, gzip;q=0.5");
+        http_response response2(&request2);
+        docs.compose("/doc_c.html", &response2);
+
+        _test_case.assert(response.get_http_header().get("Content-Encoding").empty() && ("gzip" == response2.get_http_header().get("Content-Encoding")),
+                          __FUNCTION__, "Accept-Encoding q-value");
+        remove("doc_c.html.gz");
+    }
+
+    // RFC 9110 13.1.2.  If-None-Match
+    {
+        http_request request;
+        request.compose(http_method_t::HTTP_GET, "/doc_c.html");
+        http_response response(&request);
+        docs.compose("/doc_c.html", &response);
+        std::string etag = response.get_http_header().get("ETag");
+
+        http_request request2;
+        request2.compose(http_method_t::HTTP_GET, "/doc_c.html");
+        request2.get_http_header().add("If-None-Match", etag);
+        http_response response2(&request2);
+        docs.compose("/doc_c.html", &response2);
+        _test_case.assert((200 == response.status_code()) && (304 == response2.status_code()), __FUNCTION__, "304 %s", etag.c_str());
+    }
+
+    // each cached document keeps a descriptor open, the number of entries is bounded too
+    {
+        html_documents small;
+        small.add_documents_root("/", ".").add_content_type(".html", "text/html").set_cache_capacity(1 << 20, 2);
+        for (auto file : files) {
+            small.load(std::string("/") + file, content_type, content);
+        }
+        small.get_stat(&stat);
+        _test_case.assert((2 == stat.entries) && (1 == stat.evict) && (2000 == stat.bytes), __FUNCTION__, "entries %zi evict %llu", stat.entries, stat.evict);
+    }
+
+    for (auto file : files) {
+        remove(file);
+    }
+}
+
+void test_router() {
+    _test_case.begin("http_router");
+
+    return_t ret = errorcode_t::success;
+    int index = -1;
+    http_route_tree::params_t params;
+
+    // patterns
+    {
+        http_route_tree tree;
+        tree.add("/users/:id", 0);
+        tree.add("/users/me", 1);
+        tree.add("/users/:id/posts/:post", 2);
+        tree.add("/static/*", 3);
+        tree.add("/api/test", 4);
+        tree.add("/api/tea", 5);
+
+        ret = tree.find("/users/1", index, &params);
+        _test_case.assert((errorcode_t::success == ret) && (0 == index) && (1 == params.size()) && ("1" == params[0].second), __FUNCTION__, "parameter");
+        ret = tree.find("/users/me", index, &params);
+        _test_case.assert((errorcode_t::success == ret) && (1 == index) && params.empty(), __FUNCTION__, "literal first");
+        ret = tree.find("/users/1/posts/2", index, &params);
+        _test_case.assert((errorcode_t::success == ret) && (2 == index) && (2 == params.size()) && ("post" == params[1].first) && ("2" == params[1].second),
+                          __FUNCTION__, "parameters");
+        ret = tree.find("/static/css/style.css", index, &params);
+        _test_case.assert((errorcode_t::success == ret) && (3 == index) && ("*" == params[0].first) && ("css/style.css" == params[0].second), __FUNCTION__,
+                          "wildcard");
+        ret = tree.find("/api/tea", index);
+        _test_case.assert((errorcode_t::success == ret) && (5 == index), __FUNCTION__, "compressed edge");
+        ret = tree.find("/api/te", index);
+        _test_case.assert(errorcode_t::not_found == ret, __FUNCTION__, "prefix");
+        ret = tree.find("/users/", index);
+        _test_case.assert(errorcode_t::not_found == ret, __FUNCTION__, "empty parameter");
+
+        ret = tree.add("/users/:name", 6);
+        _test_case.assert(errorcode_t::already_exist == ret, __FUNCTION__, "conflict");
+        ret = tree.add("/files/*path/more", 7);
+        _test_case.assert(errorcode_t::invalid_parameter == ret, __FUNCTION__, "wildcard not at the end");
+    }
+
+    // route
+    {
+        http_router router;
+        std::string handled;
+        auto handler = [&](network_session *session, http_request *request, http_response *response, http_router *router) -> void {
+            std::string id;
+            request->param("id", id);
+            handled = std::string(request->get_http_uri().get_uripath()) + " " + id;
+        };
+        router.add("/users/:id", handler).add(404, [&](network_session *session, http_request *request, http_response *response, http_router *router) -> void {
+            handled = "404";
+        });
+
+        http_request request;
+        http_response response;
+        request.compose(http_method_t::HTTP_GET, "/users/100");
+        router.route(nullptr, &request, &response);
+        _test_case.assert("/users/100 100" == handled, __FUNCTION__, "route %s", handled.c_str());
+
+        request.compose(http_method_t::HTTP_GET, "/users");
+        router.route(nullptr, &request, &response);
+        _test_case.assert("404" == handled, __FUNCTION__, "route %s", handled.c_str());
+
+        // added after the lookup
+        router.add("/users", handler);
+        router.route(nullptr, &request, &response);
+        _test_case.assert("/users " == handled, __FUNCTION__, "route %s", handled.c_str());
+    }
+
+    // lookups against hundreds of routes
+    {
+        const int routes = 500;
+        const int loop = 100000;
+        http_route_tree tree;
+        char buf[64];
+        for (int i = 0; i < routes; i++) {
+            snprintf(buf, sizeof(buf), "/api/v1/resource%03d/:id", i);
+            tree.add(buf, i);
+        }
+
+        struct timespec begin;
+        struct timespec end;
+        struct timespec diff;
+        int matched = 0;
+        time_monotonic(begin);
+        for (int i = 0; i < loop; i++) {
+            snprintf(buf, sizeof(buf), "/api/v1/resource%03d/%d", i % routes, i);
+            if ((errorcode_t::success == tree.find(buf, index, &params)) && (i % routes == index)) {
+                matched++;
+            }
+        }
+        time_monotonic(end);
+        time_diff(diff, begin, end);
+
+        double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+        _logger->writeln("routes %i find %.0f ops/sec", routes, loop / elapsed);
+        _test_case.assert(loop == matched, __FUNCTION__, "find %i routes", routes);
+    }
+}
+
+#if defined __linux__
+/*
+ * @brief   loopback server
+ *          /close      Connection: close
+ *          /chunked    Transfer-Encoding: chunked
+ *          otherwise   the path is the content
+ */
+class loopback_server {
+   public:
+    loopback_server() : _sock(INVALID_SOCKET), _port(0), _stop(false), _accepted(0) {
+        sockaddr_in addr;
+        socklen_t addrlen = sizeof(addr);
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        _sock = socket(AF_INET, SOCK_STREAM, 0);
+        bind(_sock, (sockaddr *)&addr, sizeof(addr));
+        listen(_sock, 16);
+        getsockname(_sock, (sockaddr *)&addr, &addrlen);
+        _port = ntohs(addr.sin_port);
+        _thread = std::thread([&]() -> void { run(); });
+    }
+    ~loopback_server() {
+        _stop = true;
+        _thread.join();
+        for (auto &t : _workers) {
+            t.join();
+        }
+        close_socket(_sock, true, 0);
+    }
+
+    uint16 port() { return _port; }
+    int accepted() { return _accepted; }
+
+   protected:
+    void run() {
+        while (false == _stop) {
+            if (errorcode_t::success == wait_socket(_sock, 100, SOCK_WAIT_READABLE)) {
+                socket_t cli = accept(_sock, nullptr, nullptr);
+                _accepted++;
+                _workers.push_back(std::thread([=]() -> void { serve(cli); }));
+            }
+        }
+    }
+    void serve(socket_t cli) {
+        std::string buffer;
+        char buf[1024];
+        bool persist = true;
+        while (persist && (false == _stop)) {
+            size_t pos = buffer.find("\r\n\r\n");
+            if (std::string::npos == pos) {
+                if (errorcode_t::success != wait_socket(cli, 100, SOCK_WAIT_READABLE)) {
+                    continue;
+                }
+                ssize_t size = ::recv(cli, buf, sizeof(buf), 0);
+                if (size < 1) {
+                    break;
+                }
+                buffer.append(buf, size);
+                continue;
+            }
+
+            // GET /path HTTP/1.1
+            size_t begin = buffer.find(' ') + 1;
+            std::string path = buffer.substr(begin, buffer.find(' ', begin) - begin);
+            bool head = (0 == buffer.compare(0, 5, "HEAD "));
+            buffer.erase(0, pos + 4);
+
+            basic_stream bs;
+            if ("/close" == path) {
+                bs << "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 6\r\n\r\n/close";
+                persist = false;
+            } else if ("/chunked" == path) {
+                bs << "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhello\r\n6\r\n world\r\n0\r\n\r\n";
+            } else {
+                bs.printf("HTTP/1.1 200 OK\r\nContent-Length: %zi\r\n\r\n%s", path.size(), head ? "" : path.c_str());
+            }
+            ::send(cli, bs.c_str(), bs.size(), 0);
+        }
+        close_socket(cli, true, 0);
+    }
+
+   private:
+    socket_t _sock;
+    uint16 _port;
+    std::atomic<bool> _stop;
+    std::atomic<int> _accepted;
+    std::thread _thread;
+    std::vector<std::thread> _workers;
+};
+#endif
+
+void test_client_pool() {
+    _test_case.begin("http_client");
+#if defined __linux__
+    loopback_server server;
+    basic_stream url;
+    url.printf("http://127.0.0.1:%i", server.port());
+
+    // keep-alive
+    {
+        http_client client;
+        http_response *response = nullptr;
+        std::string content;
+        for (auto path : {"/a", "/b", "/close", "/c"}) {
+            client.request(url.c_str() + std::string(path), &response);
+            if (response) {
+                content += response->content();
+                response->release();
+            }
+        }
+        http_client_stat_t stat;
+        client.get_stat(&stat);
+        _test_case.assert(("/a/b/close/c" == content) && (2 == stat.connect) && (2 == stat.reuse) && (1 == stat.idle), __FUNCTION__,
+                          "keep-alive connect %zi reuse %zi", (size_t)stat.connect, (size_t)stat.reuse);
+
+        // chunked
+        client.request(url.c_str() + std::string("/chunked"), &response);
+        _test_case.assert(response && (std::string("hello world") == response->content()), __FUNCTION__, "chunked");
+        if (response) {
+            response->release();
+        }
+
+        // idle timeout
+        client.set_keepalive(1);
+        msleep(10);
+        client.request(url.c_str() + std::string("/d"), &response);
+        if (response) {
+            response->release();
+        }
+        client.get_stat(&stat);
+        _test_case.assert((1 == stat.expire) && (3 == stat.connect), __FUNCTION__, "idle timeout");
+    }
+
+    // pipelining, the responses are read in order
+    {
+        http_client client;
+        client.set_url(url.c_str());
+
+        http_request requests[4];
+        std::vector<http_request *> pipelined;
+        const char *paths[] = {"/1", "/22", "/333", "/4444"};
+        for (size_t i = 0; i < 4; i++) {
+            requests[i].compose((2 == i) ? http_method_t::HTTP_HEAD : http_method_t::HTTP_GET, paths[i]);
+            pipelined.push_back(&requests[i]);
+        }
+        std::vector<http_response *> responses;
+        client.pipeline(pipelined, responses);
+
+        bool test = (4 == responses.size());
+        for (size_t i = 0; test && (i < 4); i++) {
+            test = (nullptr != responses[i]) && (std::string((2 == i) ? "" : paths[i]) == responses[i]->content());
+        }
+        for (auto response : responses) {
+            if (response) {
+                response->release();
+            }
+        }
+        http_client_stat_t stat;
+        client.get_stat(&stat);
+        _test_case.assert(test && (1 == stat.connect), __FUNCTION__, "pipeline");
+    }
+
+    // non-blocking, the requests are queued (2 connections) and pipelined
+    {
+        http_client client;
+        client.set_max_connections(2).set_pipelining(4);
+
+        const int count = 20;
+        std::atomic<int> succeeded(0);
+        std::atomic<int> matched(0);
+        for (int i = 0; i < count; i++) {
+            std::string path = format("/%i", i);
+            auto callback = [&, path](return_t result, http_response *response) -> void {
+                if (errorcode_t::success == result) {
+                    succeeded++;
+                    if (path == response->content()) {
+                        matched++;
+                    }
+                }
+            };
+            client.post(url.c_str() + path, callback);
+        }
+        return_t ret = client.wait(5000);
+        http_client_stat_t stat;
+        client.get_stat(&stat);
+        _test_case.assert((errorcode_t::success == ret) && (count == succeeded) && (count == matched) && (stat.connect <= 2), __FUNCTION__,
+                          "post %i connect %zi", (int)succeeded, (size_t)stat.connect);
+    }
+#endif
+}
+
+#if defined __linux__
+static uint16 get_free_port() {
+    uint16 port = 0;
+    sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socket_t sock = socket(AF_INET, SOCK_STREAM, 0);
+    bind(sock, (sockaddr *)&addr, sizeof(addr));
+    getsockname(sock, (sockaddr *)&addr, &addrlen);
+    port = ntohs(addr.sin_port);
+    close_socket(sock, true, 0);
+    return port;
+}
+
+static return_t echo_routine(uint32 type, uint32 data_count, void *data_array[], CALLBACK_CONTROL *callback_control, void *user_context) {
+    network_session_socket_t *session_socket = (network_session_socket_t *)data_array[0];
+    if (multiplexer_event_type_t::mux_read == type) {
+        ::send((socket_t)session_socket->event_socket, (char *)data_array[1], (size_t)data_array[2], 0);
+    }
+    return errorcode_t::success;
+}
+
+static return_t open_sharded_server(network_server &server, network_multiplexer_context_t **handle, tcp_server_socket *svr_sock, uint16 port) {
+    // the server_conf is gone when open returns, the shards must not refer to it
+    server_conf conf;
+    conf.set(netserver_config_t::serverconf_concurrent_event, 1024)
+        .set(netserver_config_t::serverconf_concurrent_network, 1)
+        .set(netserver_config_t::serverconf_concurrent_consume, 1)
+        .set(netserver_config_t::serverconf_reuseport_shards, 2);
+    return server.open(handle, AF_INET, port, svr_sock, &conf, echo_routine, nullptr);
+}
+#endif
+
+void test_sharded_server() {
+    _test_case.begin("network_server");
+#if defined __linux__
+    uint16 port = get_free_port();
+
+    network_server server;
+    network_multiplexer_context_t *handle = nullptr;
+    tcp_server_socket svr_sock;
+    return_t ret = open_sharded_server(server, &handle, &svr_sock, port);
+    _test_case.test(ret, __FUNCTION__, "open 2 shards, port %i", port);
+    if (errorcode_t::success != ret) {
+        return;
+    }
+    server.consumer_loop_run(handle, 1);
+    server.event_loop_run(handle, 1);
+
+    // the kernel spreads the connections over the listeners
+    const int count = 16;
+    int echoed = 0;
+    std::vector<socket_t> socks;
+    for (int i = 0; i < count; i++) {
+        socket_t sock = INVALID_SOCKET;
+        if (errorcode_t::success == connect_socket(&sock, "127.0.0.1", port, 1)) {
+            socks.push_back(sock);
+        }
+    }
+    for (size_t i = 0; i < socks.size(); i++) {
+        std::string message = format("ping %zi", i);
+        ::send(socks[i], message.c_str(), message.size(), 0);
+
+        std::string received;
+        char buf[64];
+        while ((received.size() < message.size()) && (errorcode_t::success == wait_socket(socks[i], 1000, SOCK_WAIT_READABLE))) {
+            ssize_t size = ::recv(socks[i], buf, sizeof(buf), 0);
+            if (size < 1) {
+                break;
+            }
+            received.append(buf, size);
+        }
+        if (message == received) {
+            echoed++;
+        }
+    }
+    for (auto sock : socks) {
+        close_socket(sock, true, 0);
+    }
+    _test_case.assert((count == (int)socks.size()) && (count == echoed), __FUNCTION__, "accept and echo %i/%i", echoed, count);
+
+    server.event_loop_break(handle, 1);
+    server.consumer_loop_break(handle, 1);
+    server.close(handle);
+#endif
+}
+
+#if defined __linux__
+static return_t sendfile_routine(uint32 type, uint32 data_count, void *data_array[], CALLBACK_CONTROL *callback_control, void *user_context) {
+    if (multiplexer_event_type_t::mux_read == type) {
+        network_session *session = (network_session *)data_array[3];
+        file_stream *fs = (file_stream *)user_context;
+        session->sendfile((handle_t)*fs, 0, fs->size());
+    }
+    return errorcode_t::success;
+}
+#endif
+
+void test_sendfile_slow_client() {
+    _test_case.begin("network_session sendfile");
+#if defined __linux__
+    // larger than the socket buffers on both sides
+    const size_t size = 32 << 20;
+    const char *file = "sendfile.bin";
+    file_stream fs;
+    fs.open(file, filestream_flag_t::open_create_always);
+    fs.fill(size, 'x');
+    fs.close();
+    fs.open(file);
+
+    uint16 port = get_free_port();
+    network_server server;
+    network_multiplexer_context_t *handle = nullptr;
+    tcp_server_socket svr_sock;
+    server_conf conf;
+    conf.set(netserver_config_t::serverconf_concurrent_event, 1024)
+        .set(netserver_config_t::serverconf_concurrent_network, 2)
+        .set(netserver_config_t::serverconf_concurrent_consume, 1);
+    return_t ret = server.open(&handle, AF_INET, port, &svr_sock, &conf, sendfile_routine, &fs);
+    _test_case.test(ret, __FUNCTION__, "open port %i", port);
+    if (errorcode_t::success == ret) {
+        server.consumer_loop_run(handle, 1);
+        server.event_loop_run(handle, 2);
+
+        size_t received = 0;
+        size_t mismatch = 0;
+        socket_t sock = INVALID_SOCKET;
+        if (errorcode_t::success == connect_socket(&sock, "127.0.0.1", port, 1)) {
+            ::send(sock, "get", 3, 0);
+
+            // the send buffer of the server is full for longer than a second
+            msleep(1500);
+
+            std::vector<char> buf(1 << 16);
+            while ((received < size) && (errorcode_t::success == wait_socket(sock, 3000, SOCK_WAIT_READABLE))) {
+                ssize_t rc = ::recv(sock, &buf[0], buf.size(), 0);
+                if (rc < 1) {
+                    break;
+                }
+                mismatch += std::count_if(buf.begin(), buf.begin() + rc, [](char c) -> bool { return 'x' != c; });
+                received += rc;
+            }
+            close_socket(sock, true, 0);
+        }
+        _test_case.assert((size == received) && (0 == mismatch), __FUNCTION__, "slow client, received %zi of %zi", received, size);
+
+        server.event_loop_break(handle, 2);
+        server.consumer_loop_break(handle, 1);
+        server.close(handle);
+    }
+
+    fs.close();
+    remove(file);
+#endif
+}
+
 /*
  * @brief   basic implementation
  * @sa      test_get_httpclient
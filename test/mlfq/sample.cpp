@@ -54,6 +54,10 @@ int main(int argc, char** argv) {
 
     confirm();
 
+    test_wakeup();
+    test_sharded();
+    test_benchmark();
+
     _logger->flush();
 
     _test_case.report(5);
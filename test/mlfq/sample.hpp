@@ -55,5 +55,8 @@ class test_scenario {
 
 return_t scenario(void*);
 void confirm();
+void test_wakeup();
+void test_sharded();
+void test_benchmark();
 
 #endif
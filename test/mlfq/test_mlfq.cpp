@@ -109,6 +109,26 @@ return_t scenario(void*) {
     return ret;
 }
 
+return_t wakeup_scenario(void* param) {
+    t_mlfq<int, mlfq_nonshared_binder<int>>* mfq = (t_mlfq<int, mlfq_nonshared_binder<int>>*)param;
+    int pri = 0;
+    int* data = nullptr;
+    return mfq->get(&pri, &data, -1);  // blocked until wakeup
+}
+
+void test_wakeup() {
+    _test_case.begin("wakeup");
+
+    t_mlfq<int, mlfq_nonshared_binder<int>> mfq;
+    thread thread1(wakeup_scenario, &mfq);
+    thread1.start();
+
+    msleep(10);
+    mfq.wakeup();
+    return_t ret = thread1.wait(1000);
+    _test_case.test(ret, __FUNCTION__, "get returns without post");
+}
+
 void confirm() {
     int i = 0;
 
@@ -0,0 +1,157 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+void test_sharded() {
+    _test_case.begin("sharded");
+
+    return_t ret = errorcode_t::success;
+    int values[4] = {0, 1, 2, 3};
+    int pri = 0;
+    int* data = nullptr;
+
+    t_sharded_mlfq<int, mlfq_nonshared_binder<int>> mfq(4, 4, 4);
+
+    // greater number mean more priority
+    mfq.post(1, &values[1]);
+    mfq.post(3, &values[3]);
+    mfq.post(0, &values[0]);
+    mfq.post(2, &values[2]);
+    _test_case.assert(4 == mfq.size(), __FUNCTION__, "size");
+
+    bool test = true;
+    for (int i = 3; i >= 0; i--) {
+        ret = mfq.get(&pri, &data, 0);
+        if ((errorcode_t::success != ret) || (i != pri) || (&values[i] != data)) {
+            test = false;
+        }
+    }
+    _test_case.assert(test, __FUNCTION__, "priority");
+
+    ret = mfq.get(&pri, &data, 0);
+    _test_case.assert(errorcode_t::not_ready == ret, __FUNCTION__, "empty");
+
+    // cancel
+    mfq.post(0, &values[0]);
+    mfq.post(0, &values[1]);
+    mfq.cancel(&values[0], nullptr);
+    ret = mfq.get(&pri, &data, 0);
+    _test_case.assert(errorcode_t::canceled == ret, __FUNCTION__, "canceled");
+    ret = mfq.get(&pri, &data, 0);
+    _test_case.assert((errorcode_t::success == ret) && (&values[1] == data), __FUNCTION__, "not canceled");
+
+    // 4 shards x 4 slots, the rest spills over
+    int count = 0;
+    for (int i = 0; i < 20; i++) {
+        if (errorcode_t::success == mfq.post(0, &values[i % 4])) {
+            count++;
+        }
+    }
+    _test_case.assert((20 == count) && (20 == mfq.size()), __FUNCTION__, "full, spill over");
+    int values_got[4] = {0};
+    for (int i = 0; i < 20; i++) {
+        ret = mfq.get(&pri, &data, 0);
+        if (errorcode_t::success == ret) {
+            values_got[*data]++;
+        }
+    }
+    test = (0 == mfq.size());
+    for (int i = 0; i < 4; i++) {
+        test = test && (5 == values_got[i]);
+    }
+    _test_case.assert(test, __FUNCTION__, "full, nothing lost");
+
+    // cancel and clear cover the spilled entries
+    for (int i = 0; i < 20; i++) {
+        mfq.post(0, &values[i % 4]);
+    }
+    mfq.cancel(&values[0], nullptr);
+    count = 0;
+    while (errorcode_t::not_ready != mfq.get(&pri, &data, 0)) {
+        if (data) {
+            count++;
+            if (&values[0] == data) {
+                count = -100;
+            }
+        }
+    }
+    _test_case.assert(15 == count, __FUNCTION__, "full, cancel");
+    for (int i = 0; i < 20; i++) {
+        mfq.post(0, &values[i % 4]);
+    }
+    mfq.clear(nullptr);
+    _test_case.assert(0 == mfq.size(), __FUNCTION__, "clear");
+    // drain the signals left by clear
+    while (errorcode_t::not_ready != mfq.get(&pri, &data, 0)) {
+    }
+
+    // wakeup
+    mfq.wakeup();
+    ret = mfq.get(&pri, &data, 0);
+    _test_case.assert(errorcode_t::not_found == ret, __FUNCTION__, "wakeup");
+}
+
+const int _bench_loop = 10000;
+
+template <typename QUEUE_T>
+return_t bench_routine(void* param) {
+    QUEUE_T* mfq = (QUEUE_T*)param;
+    int value = 0;
+    int pri = 0;
+    int* data = nullptr;
+    for (int i = 0; i < _bench_loop; i++) {
+        mfq->post(0, &value);
+        mfq->get(&pri, &data, 0);
+    }
+    return errorcode_t::success;
+}
+
+template <typename QUEUE_T>
+double bench(QUEUE_T* mfq, int threads) {
+    std::vector<thread*> workers;
+    struct timespec begin;
+    struct timespec end;
+    struct timespec diff;
+
+    time_monotonic(begin);
+    for (int i = 0; i < threads; i++) {
+        thread* worker = new thread(bench_routine<QUEUE_T>, mfq);
+        worker->start();
+        workers.push_back(worker);
+    }
+    for (auto worker : workers) {
+        worker->join();
+        delete worker;
+    }
+    time_monotonic(end);
+    time_diff(diff, begin, end);
+
+    double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    return (2.0 * _bench_loop * threads) / elapsed;  // post + get
+}
+
+void test_benchmark() {
+    _test_case.begin("benchmark");
+
+    typedef t_mlfq<int, mlfq_nonshared_binder<int>> mlfq_t;
+    typedef t_sharded_mlfq<int, mlfq_nonshared_binder<int>> sharded_mlfq_t;
+
+    int threads[] = {1, 4, 16, 64};
+    for (auto n : threads) {
+        mlfq_t mfq;
+        sharded_mlfq_t sharded;
+        double ops_mlfq = bench(&mfq, n);
+        double ops_sharded = bench(&sharded, n);
+
+        _logger->writeln("threads %2d t_mlfq %12.0f ops/sec t_sharded_mlfq %12.0f ops/sec", n, ops_mlfq, ops_sharded);
+        _test_case.assert((0 == mfq.size()) && (0 == sharded.size()), __FUNCTION__, "threads %i", n);
+    }
+}
@@ -70,7 +70,9 @@ return_t echo_server(void* param) {
         conf.set(netserver_config_t::serverconf_concurrent_event, 1024)  // concurrent (linux epoll concerns, windows ignore)
             .set(netserver_config_t::serverconf_concurrent_tls_accept, 1)
             .set(netserver_config_t::serverconf_concurrent_network, 2)
-            .set(netserver_config_t::serverconf_concurrent_consume, 2);
+            .set(netserver_config_t::serverconf_concurrent_consume, 2)
+            .set(netserver_config_t::serverconf_edge_triggered, option.edge_triggered)
+            .set(netserver_config_t::serverconf_reuseport_shards, option.shards);
 
         network_server.open(&handle_ipv4, AF_INET, port, &svr_sock, &conf, consume_routine, nullptr);
         network_server.open(&handle_ipv6, AF_INET6, port, &svr_sock, &conf, consume_routine, nullptr);
@@ -25,6 +25,8 @@ int main(int argc, char** argv) {
                 << t_cmdarg_t<OPTION>("-d", "debug/trace", [](OPTION& o, char* param) -> void { o.debug = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-l", "log", [](OPTION& o, char* param) -> void { o.log = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-t", "log time", [](OPTION& o, char* param) -> void { o.time = 1; }).optional()
+                << t_cmdarg_t<OPTION>("-e", "edge triggered", [](OPTION& o, char* param) -> void { o.edge_triggered = 1; }).optional()
+                << t_cmdarg_t<OPTION>("-s", "reuseport shards", [](OPTION& o, char* param) -> void { o.shards = atoi(param); }).optional().preced()
                 << t_cmdarg_t<OPTION>("-p", "port (9000)", [](OPTION& o, char* param) -> void { o.port = atoi(param); }).optional().preced();
     _cmdline->parse(argc, argv);
 
@@ -16,9 +16,11 @@ typedef struct _OPTION {
     int debug;
     int log;
     int time;
+    int edge_triggered;
+    int shards;
     uint16 port;
 
-    _OPTION() : verbose(0), debug(0), log(0), time(0), port(9000) {
+    _OPTION() : verbose(0), debug(0), log(0), time(0), edge_triggered(0), shards(0), port(9000) {
         // do nothing
     }
 } OPTION;
@@ -82,6 +82,65 @@ void test_signalwait_threads() {
     _test_case.assert(0 == threads.running(), __FUNCTION__, "all thread terminated");
 }
 
+struct pool_block_t {
+    char data[200];
+};
+typedef t_object_pool<sizeof(pool_block_t)> block_pool_t;
+
+std::vector<void*> _blocks;
+critical_section _blocks_lock;
+
+return_t pool_alloc_routine(void* param) {
+    // allocate on this thread
+    for (int i = 0; i < 1000; i++) {
+        void* ptr = block_pool_t::get_instance().alloc();
+        critical_section_guard guard(_blocks_lock);
+        _blocks.push_back(ptr);
+    }
+    return errorcode_t::success;
+}
+
+return_t pool_free_routine(void* param) {
+    // free on the other thread
+    std::vector<void*> blocks;
+    {
+        critical_section_guard guard(_blocks_lock);
+        blocks.swap(_blocks);
+    }
+    for (auto ptr : blocks) {
+        block_pool_t::get_instance().free(ptr);
+    }
+    return errorcode_t::success;
+}
+
+void test_object_pool() {
+    _test_case.begin("object pool");
+
+    block_pool_t& pool = block_pool_t::get_instance();
+    object_pool_stat_t stat;
+
+    void* ptr1 = pool.alloc();
+    pool.free(ptr1);
+    void* ptr2 = pool.alloc();
+    _test_case.assert(ptr1 == ptr2, __FUNCTION__, "recycle (thread cache)");
+    pool.free(ptr2);
+
+    // allocate on a thread, free on another thread, and allocate again
+    for (int round = 0; round < 2; round++) {
+        thread producer(pool_alloc_routine, nullptr);
+        producer.start();
+        producer.wait(-1);
+        thread consumer(pool_free_routine, nullptr);
+        consumer.start();
+        consumer.wait(-1);
+    }
+
+    pool.get_stat(&stat);
+    _logger->writeln("hit %I64u miss %I64u free %I64u", stat.hit, stat.miss, stat.free);
+    _test_case.assert(stat.hit + stat.miss == 2002, __FUNCTION__, "alloc count");
+    _test_case.assert(stat.hit > 1000, __FUNCTION__, "recycle (depot)");
+}
+
 int main(int argc, char** argv) {
 #ifdef __MINGW32__
     setvbuf(stdout, 0, _IOLBF, 1 << 20);
@@ -114,6 +173,7 @@ int main(int argc, char** argv) {
 
     _test_case.begin("thread");
     test_signalwait_threads();
+    test_object_pool();
 
     _logger->flush();
 
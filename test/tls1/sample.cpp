@@ -182,8 +182,14 @@ int main(int argc, char** argv) {
     test_rfc8448_7();
 
     test_construct_tls();
+    test_construct_tls_resumption();
+    test_construct_tls_early_data();
     test_construct_dtls();
 
+    test_aead_record_benchmark();
+    test_aead_record_in_place();
+    test_aead_record_tls12();
+
     openssl_cleanup();
 
     _logger->flush();
@@ -60,7 +60,13 @@ void test_rfc8448_7();
 void test_use_pre_master_secret();
 
 void test_construct_tls();
+void test_construct_tls_resumption();
+void test_construct_tls_early_data();
 void test_construct_dtls();
 void test_validate();
 
+void test_aead_record_benchmark();
+void test_aead_record_in_place();
+void test_aead_record_tls12();
+
 #endif
@@ -12,7 +12,8 @@
 
 #include "sample.hpp"
 
-static return_t do_test_construct_client_hello(const TLS_OPTION& option, tls_direction_t dir, tls_session* session, binary_t& bin, const char* message) {
+static return_t do_test_construct_client_hello(const TLS_OPTION& option, tls_direction_t dir, tls_session* session, binary_t& bin, const char* message,
+                                               const std::vector<std::string>& alpn = {"h2", "http/1.1"}) {
     return_t ret = errorcode_t::success;
     tls_advisor* tlsadvisor = tls_advisor::get_instance();
 
@@ -84,6 +85,16 @@ static return_t do_test_construct_client_hello(const TLS_OPTION& option, tls_dir
                 .add("ffdhe8192");
             handshake->get_extensions().add(supported_groups);
         }
+        if (false == alpn.empty()) {
+            auto extension = new tls_extension_alpn(tls_hs_client_hello, session);
+            binary_t protocols;
+            for (const auto& item : alpn) {
+                binary_append(protocols, uint8(item.size()));
+                binary_append(protocols, item);
+            }
+            extension->set_protocols(protocols);
+            handshake->get_extensions().add(extension);
+        }
         {
             auto extension = new tls_extension_unknown(tls1_ext_next_protocol_negotiation, session);
             handshake->get_extensions().add(extension);
@@ -145,6 +156,13 @@ static return_t do_test_construct_client_hello(const TLS_OPTION& option, tls_dir
             _logger->write(bs);
             _test_case.assert(pkey, __FUNCTION__, "{client} key share (client generated)");
         }
+        if (false == session->get_tls_protection().get_item(tls_context_session_ticket).empty()) {
+            // if the ticket allows 0-RTT
+            handshake->get_extensions().add(new tls_extension_early_data(tls_hs_client_hello, session));
+            // the last extension
+            auto psk = new tls_extension_client_psk(session);
+            handshake->get_extensions().add(psk);
+        }
     }
     __finally2 {
         if (errorcode_t::success == ret) {
@@ -222,6 +240,10 @@ static return_t do_test_construct_server_hello(const TLS_OPTION& option, tls_dir
             _logger->write(bs);
             _test_case.assert(svr_keyshare, __FUNCTION__, "{server} key share (server generated)");
         }
+        if (protection.is_resumption()) {
+            auto psk = new tls_extension_server_psk(session);
+            handshake->get_extensions().add(psk);
+        }
     }
     __finally2 {
         if (errorcode_t::success == ret) {
@@ -267,15 +289,16 @@ static return_t do_test_construct_encrypted_extensions(tls_direction_t dir, tls_
         tls_record_application_data record(session);
         auto handshake = new tls_handshake_encrypted_extensions(session);
         {
-            auto extension = new tls_extension_alpn(session);
+            // RFC 7301 3.1.  the "ProtocolNameList" MUST contain exactly one "ProtocolName"
+            auto extension = new tls_extension_alpn(tls_hs_encrypted_extensions, session);
             binary_t protocols;
             binary_append(protocols, uint8(2));
             binary_append(protocols, "h2");
-            binary_append(protocols, uint8(8));
-            binary_append(protocols, "http/1.1");
             extension->set_protocols(protocols);
             handshake->get_extensions().add(extension);
         }
+        // if the early data is accepted
+        handshake->get_extensions().add(new tls_extension_early_data(tls_hs_encrypted_extensions, session));
         record.get_handshakes().add(handshake);
         ret = record.write(dir, bin);
     }
@@ -516,6 +539,49 @@ static return_t do_test_construct_close_notify(tls_direction_t dir, tls_session*
     return ret;
 }
 
+static return_t do_test_construct_new_session_ticket(tls_direction_t dir, tls_session* session, binary_t& bin, const char* message) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        tls_record_application_data record(session);
+        auto handshake = new tls_handshake_new_session_ticket(session);
+        // if 0-RTT is allowed
+        handshake->get_extensions().add(new tls_extension_early_data(tls_hs_new_session_ticket, session));
+        record.get_handshakes().add(handshake);
+        ret = record.write(dir, bin);
+    }
+    __finally2 {
+        std::string dirstr;
+        direction_string(dir, 0, dirstr);
+        _test_case.test(ret, __FUNCTION__, "%s %s", dirstr.c_str(), message);
+    }
+    return ret;
+}
+
+static return_t do_test_construct_end_of_early_data(tls_direction_t dir, tls_session* session, binary_t& bin, const char* message) {
+    return_t ret = errorcode_t::success;
+    __try2 {
+        if (nullptr == session) {
+            ret = errorcode_t::invalid_parameter;
+            __leave2;
+        }
+
+        tls_record_application_data record(session);
+        record.get_handshakes().add(new tls_handshake_end_of_early_data(session));
+        ret = record.write(dir, bin);
+    }
+    __finally2 {
+        std::string dirstr;
+        direction_string(dir, 0, dirstr);
+        _test_case.test(ret, __FUNCTION__, "%s %s", dirstr.c_str(), message);
+    }
+    return ret;
+}
+
 static return_t do_test_send_record(tls_direction_t dir, tls_session* session, const binary_t& bin, const char* message) {
     return_t ret = errorcode_t::success;
     __try2 {
@@ -665,9 +731,15 @@ static void test_construct_tls_routine(const TLS_OPTION& option) {
             {
                 do_cross_check_keycalc(&client_session, &server_session, tls_context_transcript_hash, "tls_context_transcript_hash");
                 do_cross_check_keycalc(&client_session, &server_session, tls_secret_server_key, "tls_secret_server_key");
-                do_cross_check_keycalc(&client_session, &server_session, tls_secret_server_mac_key, "tls_secret_server_mac_key");
                 do_cross_check_keycalc(&client_session, &server_session, tls_secret_client_key, "tls_secret_client_key");
-                do_cross_check_keycalc(&client_session, &server_session, tls_secret_client_mac_key, "tls_secret_client_mac_key");
+                if (cbc == mode) {
+                    do_cross_check_keycalc(&client_session, &server_session, tls_secret_server_mac_key, "tls_secret_server_mac_key");
+                    do_cross_check_keycalc(&client_session, &server_session, tls_secret_client_mac_key, "tls_secret_client_mac_key");
+                } else {
+                    // AEAD, no MAC key (RFC 5246 6.2.3.3)
+                    do_cross_check_keycalc(&client_session, &server_session, tls_secret_server_iv, "tls_secret_server_iv");
+                    do_cross_check_keycalc(&client_session, &server_session, tls_secret_client_iv, "tls_secret_client_iv");
+                }
             }
         }
 
@@ -818,3 +890,331 @@ void test_construct_tls() {
         test_construct_tls_routine(item);
     }
 }
+
+static void test_construct_tls_resumption_routine(const TLS_OPTION& option, std::function<void(void)> hook = nullptr) {
+    tls_advisor* tlsadvisor = tls_advisor::get_instance();
+    auto hint = tlsadvisor->hintof_cipher_suite(option.cipher_suite);
+    _test_case.begin("resumption %s", hint->name_iana);
+
+    tls_resumption* resumption = tls_resumption::get_instance();
+    tls_resumption_stat_t stat1;
+    tls_resumption_stat_t stat2;
+    resumption->get_stat(&stat1);
+
+    // the ticket received, transferred to the next connection
+    auto lambda_load_ticket = [&](tls_session* from, tls_session* to) -> void {
+        auto& from_protection = from->get_tls_protection();
+        auto& to_protection = to->get_tls_protection();
+        to_protection.set_cipher_suite(from_protection.get_cipher_suite());
+        to_protection.set_item(tls_context_session_ticket, from_protection.get_item(tls_context_session_ticket));
+        to_protection.set_item(tls_context_session_ticket_age_add, from_protection.get_item(tls_context_session_ticket_age_add));
+        to_protection.set_item(tls_context_session_ticket_received, from_protection.get_item(tls_context_session_ticket_received));
+        to_protection.calc_resumption_early(to, from_protection.get_item(tls_secret_resumption));
+    };
+
+    // full handshake and NewSessionTicket
+    tls_session client_session;
+    tls_session server_session;
+    {
+        binary_t bin;
+        do_test_construct_client_hello(option, from_client, &client_session, bin, "construct client hello");
+        do_test_send_record(from_client, &server_session, bin, "send client hello");
+        bin.clear();
+        do_test_construct_server_hello(option, from_server, &server_session, &client_session, bin, "construct server hello");
+        do_test_send_record(from_server, &client_session, bin, "send server hello");
+        bin.clear();
+        do_test_construct_encrypted_extensions(from_server, &server_session, bin, "construct encrypted extensions");
+        do_test_send_record(from_server, &client_session, bin, "send encrypted extensions");
+        bin.clear();
+        do_test_construct_certificate(from_server, &server_session, tls_content_type_application_data, "ecdsa.crt", "ecdsa.key", bin, "construct certificate");
+        do_test_send_record(from_server, &client_session, bin, "send cerficate");
+        bin.clear();
+        do_test_construct_certificate_verify(from_server, &server_session, bin, "construct certificate verify");
+        do_test_send_record(from_server, &client_session, bin, "send cerficate verify");
+        bin.clear();
+        do_test_construct_server_finished(from_server, &server_session, bin, "construct server finished");
+        do_test_send_record(from_server, &client_session, bin, "send server finished");
+        bin.clear();
+        do_test_construct_client_finished(from_client, &client_session, bin, "construct client finished");
+        do_test_send_record(from_client, &server_session, bin, "send client finished");
+        do_cross_check_keycalc(&client_session, &server_session, tls_secret_res_master, "tls_secret_res_master");
+
+        // S -> C NST
+        bin.clear();
+        do_test_construct_new_session_ticket(from_server, &server_session, bin, "construct new session ticket");
+        do_test_send_record(from_server, &client_session, bin, "send new session ticket");
+
+        const binary_t& ticket = client_session.get_tls_protection().get_item(tls_context_session_ticket);
+        _logger->hdump("> ticket", ticket, 16, 3);
+        _test_case.assert(ticket.size(), __FUNCTION__, "ticket %zi bytes", ticket.size());
+    }
+
+    if (hook) {
+        hook();
+    }
+
+    // resumed handshake (psk_dhe_ke), no Certificate and CertificateVerify
+    {
+        tls_session client_session2;
+        tls_session server_session2;
+        lambda_load_ticket(&client_session, &client_session2);
+
+        binary_t bin;
+        do_test_construct_client_hello(option, from_client, &client_session2, bin, "construct client hello (pre_shared_key)");
+        do_test_send_record(from_client, &server_session2, bin, "send client hello (pre_shared_key)");
+        bin.clear();
+        do_test_construct_server_hello(option, from_server, &server_session2, &client_session2, bin, "construct server hello (pre_shared_key)");
+        do_test_send_record(from_server, &client_session2, bin, "send server hello (pre_shared_key)");
+
+        _test_case.assert(server_session2.get_tls_protection().is_resumption() && client_session2.get_tls_protection().is_resumption(), __FUNCTION__,
+                          "resumption");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_resumption_early, "tls_secret_resumption_early");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_handshake_derived, "tls_secret_handshake_derived");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_handshake, "tls_secret_handshake");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_c_hs_traffic, "tls_secret_c_hs_traffic");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_s_hs_traffic, "tls_secret_s_hs_traffic");
+
+        bin.clear();
+        do_test_construct_encrypted_extensions(from_server, &server_session2, bin, "construct encrypted extensions");
+        do_test_send_record(from_server, &client_session2, bin, "send encrypted extensions");
+        bin.clear();
+        do_test_construct_server_finished(from_server, &server_session2, bin, "construct server finished");
+        do_test_send_record(from_server, &client_session2, bin, "send server finished");
+        bin.clear();
+        do_test_construct_client_finished(from_client, &client_session2, bin, "construct client finished");
+        do_test_send_record(from_client, &server_session2, bin, "send client finished");
+
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_context_transcript_hash, "tls_context_transcript_hash");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_application_client_key, "tls_secret_application_client_key");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_application_server_key, "tls_secret_application_server_key");
+
+        bin.clear();
+        do_test_construct_client_ping(from_client, &client_session2, bin, "construct client ping");
+        do_test_send_record(from_client, &server_session2, bin, "send client ping");
+        bin.clear();
+        do_test_construct_server_pong(from_server, &server_session2, bin, "construct server pong");
+        do_test_send_record(from_server, &client_session2, bin, "send server pong");
+    }
+
+    // a modified ticket, a full handshake
+    {
+        tls_session client_session3;
+        tls_session server_session3;
+        lambda_load_ticket(&client_session, &client_session3);
+        auto& protection = client_session3.get_tls_protection();
+        binary_t ticket = protection.get_item(tls_context_session_ticket);
+        ticket.back() ^= 0x01;
+        protection.set_item(tls_context_session_ticket, ticket);
+
+        binary_t bin;
+        do_test_construct_client_hello(option, from_client, &client_session3, bin, "construct client hello (modified ticket)");
+        do_test_send_record(from_client, &server_session3, bin, "send client hello (modified ticket)");
+        _test_case.assert(false == server_session3.get_tls_protection().is_resumption(), __FUNCTION__, "rejected");
+    }
+
+    resumption->get_stat(&stat2);
+    _logger->writeln("issued %I64u offered %I64u resumed %I64u rejected %I64u", stat2.issued, stat2.offered, stat2.resumed, stat2.rejected);
+    _test_case.assert((stat1.issued + 1 == stat2.issued) && (stat1.resumed + 1 == stat2.resumed) && (stat1.rejected + 1 == stat2.rejected), __FUNCTION__,
+                      "stat");
+}
+
+void test_construct_tls_resumption() {
+    TLS_OPTION testvector[] = {
+        {tls_13, "TLS_AES_128_GCM_SHA256"},
+        {tls_13, "TLS_AES_256_GCM_SHA384"},
+        {tls_13, "TLS_CHACHA20_POLY1305_SHA256"},
+    };
+
+    for (auto item : testvector) {
+        test_construct_tls_resumption_routine(item);
+    }
+
+    tls_resumption* resumption = tls_resumption::get_instance();
+
+    // rotation, the previous key decrypts the tickets issued under it
+    test_construct_tls_resumption_routine(testvector[0], [&]() -> void { resumption->rotate(); });
+
+    // cache
+    {
+        resumption->set_cache_size(1);
+        test_construct_tls_resumption_routine(testvector[0]);
+        test_construct_tls_resumption_routine(testvector[1]);
+
+        tls_resumption_stat_t stat;
+        resumption->get_stat(&stat);
+        _test_case.assert((1 == stat.entries) && (2 == stat.cache_hit) && (1 == stat.evict), __FUNCTION__, "cache hit %I64u evict %I64u", stat.cache_hit,
+                          stat.evict);
+        resumption->set_cache_size(0);
+    }
+}
+
+static void test_construct_tls_early_data_routine(const TLS_OPTION& option) {
+    tls_advisor* tlsadvisor = tls_advisor::get_instance();
+    auto hint = tlsadvisor->hintof_cipher_suite(option.cipher_suite);
+    _test_case.begin("0-RTT %s", hint->name_iana);
+
+    tls_resumption* resumption = tls_resumption::get_instance();
+    tls_resumption_stat_t stat1;
+    tls_resumption_stat_t stat2;
+    resumption->get_stat(&stat1);
+
+    // the ticket received, transferred to the next connection
+    auto lambda_load_ticket = [&](tls_session* from, tls_session* to) -> void {
+        auto& from_protection = from->get_tls_protection();
+        auto& to_protection = to->get_tls_protection();
+        to_protection.set_cipher_suite(from_protection.get_cipher_suite());
+        to_protection.set_item(tls_context_session_ticket, from_protection.get_item(tls_context_session_ticket));
+        to_protection.set_item(tls_context_session_ticket_age_add, from_protection.get_item(tls_context_session_ticket_age_add));
+        to_protection.set_item(tls_context_session_ticket_received, from_protection.get_item(tls_context_session_ticket_received));
+        to_protection.set_tls_version(from_protection.get_tls_version());
+        to_protection.set_item(tls_context_session_ticket_max_early_data, from_protection.get_item(tls_context_session_ticket_max_early_data));
+        to_protection.calc_resumption_early(to, from_protection.get_item(tls_secret_resumption));
+    };
+
+    // full handshake and NewSessionTicket (early_data)
+    tls_session client_session;
+    tls_session server_session;
+    {
+        binary_t bin;
+        do_test_construct_client_hello(option, from_client, &client_session, bin, "construct client hello");
+        do_test_send_record(from_client, &server_session, bin, "send client hello");
+        bin.clear();
+        do_test_construct_server_hello(option, from_server, &server_session, &client_session, bin, "construct server hello");
+        do_test_send_record(from_server, &client_session, bin, "send server hello");
+        bin.clear();
+        do_test_construct_encrypted_extensions(from_server, &server_session, bin, "construct encrypted extensions");
+        do_test_send_record(from_server, &client_session, bin, "send encrypted extensions");
+        bin.clear();
+        do_test_construct_certificate(from_server, &server_session, tls_content_type_application_data, "ecdsa.crt", "ecdsa.key", bin, "construct certificate");
+        do_test_send_record(from_server, &client_session, bin, "send cerficate");
+        bin.clear();
+        do_test_construct_certificate_verify(from_server, &server_session, bin, "construct certificate verify");
+        do_test_send_record(from_server, &client_session, bin, "send cerficate verify");
+        bin.clear();
+        do_test_construct_server_finished(from_server, &server_session, bin, "construct server finished");
+        do_test_send_record(from_server, &client_session, bin, "send server finished");
+        bin.clear();
+        do_test_construct_client_finished(from_client, &client_session, bin, "construct client finished");
+        do_test_send_record(from_client, &server_session, bin, "send client finished");
+
+        bin.clear();
+        do_test_construct_new_session_ticket(from_server, &server_session, bin, "construct new session ticket");
+        do_test_send_record(from_server, &client_session, bin, "send new session ticket");
+
+        auto max_early_data_size = t_binary_to_integer<uint32>(client_session.get_tls_protection().get_item(tls_context_session_ticket_max_early_data));
+        _test_case.assert(resumption->get_max_early_data_size() == max_early_data_size, __FUNCTION__, "max_early_data_size %u", max_early_data_size);
+    }
+
+    // resumed handshake, the early data is accepted
+    binary_t bin_client_hello;
+    binary_t bin_early_data;
+    {
+        tls_session client_session2;
+        tls_session server_session2;
+        lambda_load_ticket(&client_session, &client_session2);
+
+        auto& client_protection = client_session2.get_tls_protection();
+        auto& server_protection = server_session2.get_tls_protection();
+
+        do_test_construct_client_hello(option, from_client, &client_session2, bin_client_hello, "construct client hello (early_data)");
+        do_test_send_record(from_client, &server_session2, bin_client_hello, "send client hello (early_data)");
+        _test_case.assert(tls_early_data_accepted == server_protection.get_early_data(), __FUNCTION__, "{server} early data accepted");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_c_e_traffic_key, "tls_secret_c_e_traffic_key");
+
+        // C -> S 0-RTT, before the ServerHello
+        do_test_construct_client_ping(from_client, &client_session2, bin_early_data, "construct early data");
+        do_test_send_record(from_client, &server_session2, bin_early_data, "send early data");
+        binary_t ping;
+        binary_append(ping, "ping");
+        binary_t early_data;
+        server_session2.pop_early_data(early_data);
+        _test_case.assert((ping == early_data) && (0 == server_session2.numberof_early_data()), __FUNCTION__, "{server} early data delivered");
+
+        binary_t bin;
+        do_test_construct_server_hello(option, from_server, &server_session2, &client_session2, bin, "construct server hello (pre_shared_key)");
+        do_test_send_record(from_server, &client_session2, bin, "send server hello (pre_shared_key)");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_c_hs_traffic, "tls_secret_c_hs_traffic");
+        bin.clear();
+        do_test_construct_encrypted_extensions(from_server, &server_session2, bin, "construct encrypted extensions (early_data)");
+        do_test_send_record(from_server, &client_session2, bin, "send encrypted extensions (early_data)");
+        _test_case.assert(tls_early_data_accepted == client_protection.get_early_data(), __FUNCTION__, "{client} early data accepted");
+        bin.clear();
+        do_test_construct_server_finished(from_server, &server_session2, bin, "construct server finished");
+        do_test_send_record(from_server, &client_session2, bin, "send server finished");
+        bin.clear();
+        do_test_construct_end_of_early_data(from_client, &client_session2, bin, "construct end of early data");
+        do_test_send_record(from_client, &server_session2, bin, "send end of early data");
+        bin.clear();
+        do_test_construct_client_finished(from_client, &client_session2, bin, "construct client finished");
+        do_test_send_record(from_client, &server_session2, bin, "send client finished");
+
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_context_transcript_hash, "tls_context_transcript_hash");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_application_client_key, "tls_secret_application_client_key");
+        do_cross_check_keycalc(&client_session2, &server_session2, tls_secret_application_server_key, "tls_secret_application_server_key");
+
+        bin.clear();
+        do_test_construct_client_ping(from_client, &client_session2, bin, "construct client ping");
+        do_test_send_record(from_client, &server_session2, bin, "send client ping");
+        bin.clear();
+        do_test_construct_server_pong(from_server, &server_session2, bin, "construct server pong");
+        do_test_send_record(from_server, &client_session2, bin, "send server pong");
+    }
+
+    // the ClientHello replayed, resumed without the early data
+    {
+        tls_session server_session3;
+        auto& server_protection = server_session3.get_tls_protection();
+
+        do_test_send_record(from_client, &server_session3, bin_client_hello, "send client hello (replayed)");
+        _test_case.assert(server_protection.is_resumption() && (tls_early_data_rejected == server_protection.get_early_data()), __FUNCTION__,
+                          "{server} early data rejected");
+        do_test_send_record(from_client, &server_session3, bin_early_data, "send early data (replayed, skipped)");
+        _test_case.assert(0 == server_session3.numberof_early_data(), __FUNCTION__, "{server} early data skipped");
+    }
+
+    // RFC 8446 4.2.10.  the cipher suite and the ALPN protocol are the same as those associated with the ticket
+    {
+        TLS_OPTION other_suite = option;
+        other_suite.cipher_suite = (0x1301 == hint->code) ? "TLS_CHACHA20_POLY1305_SHA256" : "TLS_AES_128_GCM_SHA256";
+
+        tls_session client_session4;
+        tls_session server_session4;
+        lambda_load_ticket(&client_session, &client_session4);
+        binary_t bin;
+        do_test_construct_client_hello(other_suite, from_client, &client_session4, bin, "construct client hello (another cipher suite)");
+        do_test_send_record(from_client, &server_session4, bin, "send client hello (another cipher suite)");
+        _test_case.assert(tls_early_data_rejected == server_session4.get_tls_protection().get_early_data(), __FUNCTION__,
+                          "{server} early data rejected (cipher suite)");
+
+        tls_session client_session5;
+        tls_session server_session5;
+        lambda_load_ticket(&client_session, &client_session5);
+        bin.clear();
+        do_test_construct_client_hello(option, from_client, &client_session5, bin, "construct client hello (another ALPN)", {"http/1.1"});
+        do_test_send_record(from_client, &server_session5, bin, "send client hello (another ALPN)");
+        _test_case.assert(tls_early_data_rejected == server_session5.get_tls_protection().get_early_data(), __FUNCTION__, "{server} early data rejected (ALPN)");
+    }
+
+    resumption->get_stat(&stat2);
+    _logger->writeln("early data accepted %I64u rejected %I64u replayed %I64u", stat2.early_data_accepted, stat2.early_data_rejected, stat2.replayed);
+    _test_case.assert((stat1.early_data_accepted + 1 == stat2.early_data_accepted) && (stat1.early_data_rejected + 3 == stat2.early_data_rejected) &&
+                          (stat1.replayed + 1 == stat2.replayed),
+                      __FUNCTION__, "stat");
+}
+
+void test_construct_tls_early_data() {
+    TLS_OPTION testvector[] = {
+        {tls_13, "TLS_AES_128_GCM_SHA256"},
+        {tls_13, "TLS_AES_256_GCM_SHA384"},
+        {tls_13, "TLS_CHACHA20_POLY1305_SHA256"},
+    };
+
+    tls_resumption* resumption = tls_resumption::get_instance();
+    resumption->set_max_early_data_size(16384);
+
+    for (auto item : testvector) {
+        test_construct_tls_early_data_routine(item);
+    }
+
+    resumption->set_max_early_data_size(0);
+}
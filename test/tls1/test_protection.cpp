@@ -0,0 +1,285 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *      record protection (AEAD)
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+static void set_traffic_key(tls_session* session, uint16 cs, const binary_t& key, const binary_t& iv) {
+    auto& protection = session->get_tls_protection();
+    protection.set_cipher_suite(cs);
+    protection.set_tls_version(tls_13);
+    protection.set_item(tls_secret_handshake_server_key, key);
+    protection.set_item(tls_secret_handshake_server_iv, iv);
+}
+
+void test_aead_record_benchmark() {
+    _test_case.begin("record protection");
+
+    struct testvector_t {
+        uint16 cs;
+        const char* name;
+        size_t keysize;
+    } testvector[] = {
+        {0x1301, "TLS_AES_128_GCM_SHA256", 16},
+        {0x1303, "TLS_CHACHA20_POLY1305_SHA256", 32},
+    };
+    const size_t sizes[] = {256, 16384};
+    const uint32 records = 2000;
+
+    struct timespec begin;
+    struct timespec end;
+    struct timespec diff;
+
+    auto elapsed = [&]() -> double {
+        time_diff(diff, begin, end);
+        return diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    };
+
+    openssl_prng prng;
+    for (auto item : testvector) {
+        binary_t key;
+        binary_t iv;
+        prng.random(key, item.keysize);
+        prng.random(iv, 12);
+
+        for (auto size : sizes) {
+            tls_session server_session(session_tls);
+            tls_session client_session(session_tls);
+            set_traffic_key(&server_session, item.cs, key, iv);
+            set_traffic_key(&client_session, item.cs, key, iv);
+
+            auto& server_protection = server_session.get_tls_protection();
+            auto& client_protection = client_session.get_tls_protection();
+
+            crypt_algorithm_t alg = crypt_alg_unknown;
+            crypt_mode_t mode = mode_unknown;
+            server_protection.get_cipher_info(&server_session, alg, mode);
+
+            binary_t plaintext;
+            prng.random(plaintext, size);
+            binary_t aad = {0x17, 0x03, 0x03, 0x00, 0x00};
+            binary_t ciphertext;
+            binary_t tag;
+            binary_t decrypted;
+
+            // a context per record
+            time_monotonic(begin);
+            for (uint32 i = 0; i < records; i++) {
+                openssl_crypt crypt;
+                binary_t nonce;
+                server_protection.build_iv(&server_session, tls_secret_handshake_server_iv, nonce, i);
+                crypt.encrypt(alg, mode, key, nonce, plaintext, ciphertext, aad, tag);
+            }
+            time_monotonic(end);
+            double elapsed1 = elapsed();
+
+            // a context per traffic key
+            time_monotonic(begin);
+            for (uint32 i = 0; i < records; i++) {
+                server_protection.encrypt(&server_session, from_server, plaintext, ciphertext, aad, tag);
+            }
+            time_monotonic(end);
+            double elapsed2 = elapsed();
+
+            // the record number of the client session follows
+            for (uint32 i = 0; i < records; i++) {
+                client_session.get_recordno(from_server, true);
+            }
+            server_protection.encrypt(&server_session, from_server, plaintext, ciphertext, aad, tag);
+            return_t ret = client_protection.decrypt(&client_session, from_server, &ciphertext[0], ciphertext.size(), 0, decrypted, aad, tag);
+            bool test = (errorcode_t::success == ret) && (plaintext == decrypted);
+
+            _logger->writeln("%s record %zi x %u", item.name, size, records);
+            _logger->writeln("  context per record      %8.1f MB/s %10.0f records/s", records * size / elapsed1 / 1000000, records / elapsed1);
+            _logger->writeln("  context per traffic key %8.1f MB/s %10.0f records/s", records * size / elapsed2 / 1000000, records / elapsed2);
+            _test_case.assert(test, __FUNCTION__, "%s record %zi", item.name, size);
+
+            // key update, the context is dropped
+            binary_t newkey;
+            prng.random(newkey, item.keysize);
+            server_protection.set_item(tls_secret_handshake_server_key, newkey);
+            server_protection.encrypt(&server_session, from_server, plaintext, ciphertext, aad, tag);
+            ret = client_protection.decrypt(&client_session, from_server, &ciphertext[0], ciphertext.size(), 0, decrypted, aad, tag);
+            _test_case.assert(errorcode_t::success != ret, __FUNCTION__, "%s old key", item.name);
+
+            client_protection.set_item(tls_secret_handshake_server_key, newkey);
+            server_protection.encrypt(&server_session, from_server, plaintext, ciphertext, aad, tag);
+            ret = client_protection.decrypt(&client_session, from_server, &ciphertext[0], ciphertext.size(), 0, decrypted, aad, tag);
+            _test_case.assert((errorcode_t::success == ret) && (plaintext == decrypted), __FUNCTION__, "%s key update", item.name);
+        }
+    }
+}
+
+void test_aead_record_in_place() {
+    _test_case.begin("record protection (in place)");
+
+    openssl_prng prng;
+    const uint16 cs[] = {0x1301, 0x1303};
+    for (auto item : cs) {
+        binary_t key;
+        binary_t iv;
+        prng.random(key, (0x1303 == item) ? 32 : 16);
+        prng.random(iv, 12);
+
+        tls_session server_session(session_tls);
+        tls_session client_session(session_tls);
+        tls_session binary_session(session_tls);
+        set_traffic_key(&server_session, item, key, iv);
+        set_traffic_key(&client_session, item, key, iv);
+        set_traffic_key(&binary_session, item, key, iv);
+
+        auto& server_protection = server_session.get_tls_protection();
+        auto& client_protection = client_session.get_tls_protection();
+        auto& binary_protection = binary_session.get_tls_protection();
+        auto tagsize = server_protection.get_tag_size();
+
+        binary_t plaintext;
+        prng.random(plaintext, 1000);
+
+        // header || plaintext || tag
+        binary_t record = {0x17, 0x03, 0x03, 0x00, 0x00};
+        size_t aadlen = record.size();
+        binary_append(record, plaintext);
+        record.resize(aadlen + plaintext.size() + tagsize);
+        return_t ret = server_protection.encrypt(&server_session, from_server, &record[0], aadlen, &record[aadlen], plaintext.size(),
+                                                 &record[aadlen + plaintext.size()]);
+
+        // the same as the copying interface
+        binary_t aad(record.begin(), record.begin() + aadlen);
+        binary_t ciphertext;
+        binary_t tag;
+        binary_protection.encrypt(&binary_session, from_server, plaintext, ciphertext, aad, tag);
+        binary_t expect = aad;
+        binary_append(expect, ciphertext);
+        binary_append(expect, tag);
+        _test_case.assert((errorcode_t::success == ret) && (expect == record), __FUNCTION__, "encrypt 0x%04x", item);
+
+        ret = client_protection.decrypt(&client_session, from_server, &record[0], aadlen, &record[aadlen], plaintext.size(), &record[aadlen + plaintext.size()]);
+        _test_case.assert((errorcode_t::success == ret) && (0 == memcmp(&record[aadlen], &plaintext[0], plaintext.size())), __FUNCTION__, "decrypt 0x%04x",
+                          item);
+
+        // the next record, a modified tag
+        server_protection.encrypt(&server_session, from_server, &record[0], aadlen, &record[aadlen], plaintext.size(), &record[aadlen + plaintext.size()]);
+        record.back() ^= 0x01;
+        ret = client_protection.decrypt(&client_session, from_server, &record[0], aadlen, &record[aadlen], plaintext.size(), &record[aadlen + plaintext.size()]);
+        _test_case.assert(errorcode_t::success != ret, __FUNCTION__, "tag 0x%04x", item);
+    }
+}
+
+void test_aead_record_tls12() {
+    _test_case.begin("record protection (TLS 1.2 AEAD)");
+
+    // RFC 5288 3.  AES-GCM Cipher Suites
+    // RFC 7905 2.  ChaCha20 Cipher Suites
+    struct testvector_t {
+        uint16 cs;
+        const char* name;
+        size_t keysize;
+        size_t ivsize;  // fixed_iv_length
+        size_t record_iv_size;
+    } testvector[] = {
+        {0xc02b, "TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256", 16, 4, 8},
+        {0xc02c, "TLS_ECDHE_ECDSA_WITH_AES_256_GCM_SHA384", 32, 4, 8},
+        {0xcca9, "TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256", 32, 12, 0},
+    };
+
+    openssl_prng prng;
+    for (auto item : testvector) {
+        binary_t key;
+        binary_t iv;
+        prng.random(key, item.keysize);
+        prng.random(iv, item.ivsize);
+
+        tls_session server_session(session_tls);
+        tls_session client_session(session_tls);
+        auto lambda_set_key = [&](tls_session* session) -> void {
+            auto& protection = session->get_tls_protection();
+            protection.set_cipher_suite(item.cs);
+            protection.set_tls_version(tls_12);
+            protection.set_legacy_version(tls_12);
+            protection.set_item(tls_secret_server_key, key);
+            protection.set_item(tls_secret_server_iv, iv);
+            session->get_session_info(from_server).set_status(tls_hs_finished);
+        };
+        lambda_set_key(&server_session);
+        lambda_set_key(&client_session);
+
+        auto& server_protection = server_session.get_tls_protection();
+        auto& client_protection = client_session.get_tls_protection();
+        auto tagsize = server_protection.get_tag_size();
+        const size_t hdrsize = 5;
+
+        crypt_algorithm_t alg = crypt_alg_unknown;
+        crypt_mode_t mode = mode_unknown;
+        server_protection.get_cipher_info(&server_session, alg, mode);
+
+        _test_case.assert(item.record_iv_size == server_protection.get_record_iv_size(), __FUNCTION__, "%s record_iv_length %zi", item.name,
+                          item.record_iv_size);
+
+        for (uint64 seq = 0; seq < 3; seq++) {
+            binary_t plaintext;
+            prng.random(plaintext, 100 + seq);
+
+            // header || nonce_explicit || ciphertext || tag
+            binary_t record;
+            tls_record_application_data appdata(&server_session, plaintext);
+            return_t ret = appdata.write(from_server, record);
+            bool test = (errorcode_t::success == ret) && (record.size() == hdrsize + item.record_iv_size + plaintext.size() + tagsize);
+            _test_case.assert(test, __FUNCTION__, "%s write record #%I64u", item.name, seq);
+            if (false == test) {
+                break;
+            }
+
+            // the nonce and additional data built independently
+            binary_t seqnum;
+            binary_append(seqnum, seq, hton64);
+            binary_t nonce;
+            if (item.record_iv_size) {
+                nonce = iv;
+                binary_append(nonce, seqnum);
+            } else {
+                nonce = iv;
+                for (size_t i = 0; i < 8; i++) {
+                    nonce[4 + i] ^= seqnum[i];
+                }
+            }
+            binary_t aad = seqnum;
+            binary_append(aad, &record[0], 3);
+            binary_append(aad, uint16(plaintext.size()), hton16);
+
+            openssl_crypt crypt;
+            binary_t ciphertext;
+            binary_t tag;
+            crypt.encrypt(alg, mode, key, nonce, plaintext, ciphertext, aad, tag);
+            binary_t expect(record.begin(), record.begin() + hdrsize);
+            if (item.record_iv_size) {
+                binary_append(expect, seqnum);
+            }
+            binary_append(expect, ciphertext);
+            binary_append(expect, tag);
+            _test_case.assert(expect == record, __FUNCTION__, "%s nonce and additional data #%I64u", item.name, seq);
+
+            // as read by the record layer
+            binary_t decrypted;
+            ret = client_protection.decrypt(&client_session, from_server, &record[0], record.size() - hdrsize, 0, decrypted);
+            _test_case.assert((errorcode_t::success == ret) && (plaintext == decrypted), __FUNCTION__, "%s decrypt #%I64u", item.name, seq);
+        }
+
+        // a modified record, the record number of the client session moves on
+        binary_t record;
+        binary_t plaintext = str2bin("modified");
+        tls_record_application_data appdata(&server_session, plaintext);
+        appdata.write(from_server, record);
+        record[hdrsize] ^= 0x01;
+        binary_t decrypted;
+        return_t ret = client_protection.decrypt(&client_session, from_server, &record[0], record.size() - hdrsize, 0, decrypted);
+        _test_case.assert(errorcode_t::success != ret, __FUNCTION__, "%s modified %s", item.name, item.record_iv_size ? "nonce_explicit" : "ciphertext");
+    }
+}
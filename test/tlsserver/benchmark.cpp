@@ -0,0 +1,178 @@
+/* vim: set tabstop=4 shiftwidth=4 softtabstop=4 expandtab smarttab : */
+/**
+ * @file {file}
+ * @author Soo Han, Kim (princeb612.kr@gmail.com)
+ * @desc
+ *      throughput SSL_write (user space) vs kTLS (kernel)
+ *          test-tlsserver -b
+ *      kTLS requires the tls ULP
+ *          modprobe tls
+ *          cat /proc/sys/net/ipv4/tcp_available_ulp
+ *
+ * Revision History
+ * Date         Name                Description
+ */
+
+#include "sample.hpp"
+
+struct benchmark_context_t {
+    uint16 port;
+    size_t total;
+    size_t received;
+    return_t result;
+
+    benchmark_context_t() : port(0), total(0), received(0), result(errorcode_t::success) {}
+};
+
+static return_t benchmark_client(void* param) {
+    benchmark_context_t* context = (benchmark_context_t*)param;
+    return_t ret = errorcode_t::success;
+    SSL_CTX* sslctx = nullptr;
+    transport_layer_security* tls = nullptr;
+    socket_t sock = INVALID_SOCKET;
+    tls_context_t* handle = nullptr;
+
+    __try2 {
+        ret = tlscert_open_simple(tlscert_flag_tls, &sslctx);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        __try_new_catch(tls, new transport_layer_security(sslctx), ret, __leave2);
+
+        tls_client_socket cli(tls);
+        ret = cli.connect(&sock, &handle, "127.0.0.1", context->port, 5);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        std::vector<char> buffer(1 << 16);
+        size_t cbread = 0;
+        while (context->received < context->total) {
+            ret = cli.read(sock, handle, &buffer[0], buffer.size(), &cbread);
+            while ((errorcode_t::success == ret) || (errorcode_t::more_data == ret)) {
+                context->received += cbread;
+                if (errorcode_t::more_data != ret) {
+                    break;
+                }
+                ret = cli.more(sock, handle, &buffer[0], buffer.size(), &cbread);
+            }
+            if ((errorcode_t::success != ret) && (errorcode_t::pending != ret)) {
+                break;
+            }
+            ret = errorcode_t::success;
+        }
+
+        cli.close(sock, handle);
+    }
+    __finally2 {
+        if (tls) {
+            tls->release();
+        }
+        SSL_CTX_free(sslctx);
+        context->result = ret;
+    }
+    return ret;
+}
+
+static void benchmark(bool ktls) {
+    const OPTION& option = _cmdline->value();
+    return_t ret = errorcode_t::success;
+    SSL_CTX* sslctx = nullptr;
+    transport_layer_security* tls = nullptr;
+    tls_server_socket* tls_socket = nullptr;
+    socket_t listen_sock = INVALID_SOCKET;
+    socket_t cli_sock = INVALID_SOCKET;
+    tls_context_t* handle = nullptr;
+    const char* text = ktls ? "kTLS" : "user space";
+
+    benchmark_context_t context;
+    context.port = option.port;
+    context.total = 256 << 20;
+    thread client(benchmark_client, &context);
+
+    __try2 {
+        ret = tlscert_open(tlscert_flag_tls, &sslctx, "server.crt", "server.key");
+        if (nullptr == sslctx) {
+            __leave2;
+        }
+        ret = errorcode_t::success;  // errorcode_t::expired
+        SSL_CTX_set_ciphersuites(sslctx, "TLS_AES_128_GCM_SHA256");
+
+        __try_new_catch(tls, new transport_layer_security(sslctx), ret, __leave2);
+        tls->enable_ktls(ktls);
+        __try_new_catch(tls_socket, new tls_server_socket(tls), ret, __leave2);
+
+        unsigned int family = AF_INET;
+        ret = create_listener(1, &family, &listen_sock, IPPROTO_TCP, option.port);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        client.start();
+
+        sockaddr_storage_t addr;
+        socklen_t addrlen = sizeof(addr);
+        cli_sock = ::accept(listen_sock, (sockaddr*)&addr, &addrlen);
+        ret = tls_socket->tls_accept(cli_sock, &handle);
+        if (errorcode_t::success != ret) {
+            __leave2;
+        }
+
+        uint32 offload = tls->get_ktls(handle);
+
+        struct timespec begin;
+        struct timespec end;
+        struct timespec diff;
+        std::vector<char> record(16384, 'x');
+        sendbuf_t buf(&record[0], record.size());
+
+        time_monotonic(begin);
+        size_t sent = 0;
+        while (sent < context.total) {
+            size_t cbsent = 0;
+            ret = tls_socket->sendv(cli_sock, handle, &buf, 1, &cbsent);
+            if (errorcode_t::success != ret) {
+                break;
+            }
+            sent += cbsent;
+        }
+        client.wait(-1);
+        time_monotonic(end);
+        time_diff(diff, begin, end);
+
+        double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+        _logger->writeln("%-10s %8.1f MB/s (send %s, recv %s)", text, context.received / elapsed / 1000000,
+                         (tls_flag_t::tls_ktls_send & offload) ? "kernel" : "user space", (tls_flag_t::tls_ktls_recv & offload) ? "kernel" : "user space");
+        if (ktls && (0 == offload)) {
+            _logger->writeln("kTLS is not available, fell back to SSL_write (modprobe tls)");
+        }
+    }
+    __finally2 {
+        client.wait(-1);
+        if (tls_socket) {
+            if (handle) {
+                tls_socket->close(cli_sock, handle);
+            } else if (INVALID_SOCKET != cli_sock) {
+                close_socket(cli_sock, true, 0);
+            }
+            tls_socket->release();
+        }
+        if (INVALID_SOCKET != listen_sock) {
+            close_socket(listen_sock, true, 0);
+        }
+        if (tls) {
+            tls->release();
+        }
+        SSL_CTX_free(sslctx);
+
+        _test_case.assert((errorcode_t::success == ret) && (context.total == context.received), __FUNCTION__, "%s %zi bytes", text, context.received);
+    }
+}
+
+void run_benchmark() {
+    _test_case.begin("kTLS");
+
+    benchmark(false);
+    benchmark(true);
+}
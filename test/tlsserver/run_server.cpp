@@ -73,6 +73,7 @@ return_t echo_server(void*) {
         SSL_CTX_set_verify(sslctx, 0, nullptr);
 
         __try_new_catch(tls, new transport_layer_security(sslctx), ret, __leave2);
+        tls->enable_ktls(option.ktls);
         __try_new_catch(tls_socket, new tls_server_socket(tls), ret, __leave2);
 
         server_conf conf;
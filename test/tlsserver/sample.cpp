@@ -8,6 +8,8 @@
  *          ctrl + c
  *      test.2
  *          test/etc/test-tlsclient
+ *      test.3
+ *          test-tlsserver -b
  *
  * @sa  See in the following order : tcpserver1, tcpserver2, tlsserver, httpserver1, httpauth, httpserver2
  *
@@ -31,7 +33,9 @@ int main(int argc, char** argv) {
                 << t_cmdarg_t<OPTION>("-d", "debug/trace", [](OPTION& o, char* param) -> void { o.debug = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-l", "log", [](OPTION& o, char* param) -> void { o.log = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-t", "log time", [](OPTION& o, char* param) -> void { o.time = 1; }).optional()
-                << t_cmdarg_t<OPTION>("-p", "port (9000)", [](OPTION& o, char* param) -> void { o.port = atoi(param); }).optional().preced();
+                << t_cmdarg_t<OPTION>("-p", "port (9000)", [](OPTION& o, char* param) -> void { o.port = atoi(param); }).optional().preced()
+                << t_cmdarg_t<OPTION>("-k", "kTLS", [](OPTION& o, char* param) -> void { o.ktls = 1; }).optional()
+                << t_cmdarg_t<OPTION>("-b", "benchmark SSL_write vs kTLS", [](OPTION& o, char* param) -> void { o.benchmark = 1; }).optional();
     _cmdline->parse(argc, argv);
 
     const OPTION& option = _cmdline->value();
@@ -57,7 +61,11 @@ int main(int argc, char** argv) {
 #endif
     openssl_startup();
 
-    run_server();
+    if (option.benchmark) {
+        run_benchmark();
+    } else {
+        run_server();
+    }
 
     openssl_cleanup();
 
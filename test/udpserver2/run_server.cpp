@@ -102,3 +102,128 @@ void run_server() {
     __try2 { thread1.start(); }
     __finally2 { thread1.wait(-1); }
 }
+
+std::atomic<size_t> _bench_count(0);
+
+return_t bench_routine(uint32 type, uint32 data_count, void* data_array[], CALLBACK_CONTROL* callback_control, void* user_context) {
+    if (mux_dgram == type) {
+        _bench_count++;
+    }
+    return errorcode_t::success;
+}
+
+/**
+ * @brief   datagrams per second received by network_server
+ * @param   uint16 batch [in] serverconf_udp_batch (1 recvfrom, otherwise recvmmsg)
+ * @param   size_t* received [out]
+ * @param   size_t sent [in]
+ */
+double bench_pps(uint16 batch, size_t sent, size_t* received) {
+    const OPTION& option = _cmdline->value();
+
+    network_server network_server;
+    network_multiplexer_context_t* handle = nullptr;
+    udp_server_socket svr_sock;
+    uint16 port = option.port + batch;  // avoid rebinding the port just closed
+    double pps = 0;
+
+    server_conf conf;
+    conf.set(netserver_config_t::serverconf_concurrent_network, 1)
+        .set(netserver_config_t::serverconf_concurrent_consume, 1)
+        .set(netserver_config_t::serverconf_udp_batch, batch);
+
+    _bench_count = 0;
+    network_server.open(&handle, AF_INET, port, &svr_sock, &conf, bench_routine, nullptr);
+    network_server.consumer_loop_run(handle, 1);
+    network_server.event_loop_run(handle, 1);
+
+    socket_t sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    char payload[64] = {
+        0,
+    };
+    struct timespec begin;
+    struct timespec last;
+    struct timespec diff;
+
+    time_monotonic(begin);
+#if defined __linux__
+    struct mmsghdr msgs[32];
+    struct iovec iov[32];
+    memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < 32; i++) {
+        iov[i].iov_base = payload;
+        iov[i].iov_len = sizeof(payload);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &addr;
+        msgs[i].msg_hdr.msg_namelen = sizeof(addr);
+    }
+    for (size_t i = 0; i < sent; i += 32) {
+        sendmmsg(sock, msgs, (sent - i < 32) ? (sent - i) : 32, 0);
+        if (0 == (i % 1024)) {
+            msleep(1);  // do not overflow SO_RCVBUF
+        }
+    }
+#else
+    for (size_t i = 0; i < sent; i++) {
+        sendto(sock, payload, sizeof(payload), 0, (sockaddr*)&addr, sizeof(addr));
+        if (0 == (i % 256)) {
+            msleep(1);  // do not overflow SO_RCVBUF
+        }
+    }
+#endif
+
+    // until all received or no progress
+    size_t count = 0;
+    last = begin;
+    for (int idle = 0; (count < sent) && (idle < 50); idle++) {
+        msleep(10);
+        size_t now = _bench_count;
+        if (now != count) {
+            count = now;
+            idle = 0;
+            time_monotonic(last);
+        }
+    }
+    time_diff(diff, begin, last);
+    double elapsed = diff.tv_sec + (diff.tv_nsec / 1000000000.0);
+    if (elapsed > 0) {
+        pps = count / elapsed;
+    }
+    *received = count;
+
+#if defined __linux__
+    close(sock);
+#elif defined _WIN32 || defined _WIN64
+    closesocket(sock);
+#endif
+
+    network_server.event_loop_break(handle, 1);
+    network_server.consumer_loop_break(handle, 1);
+    network_server.close(handle);
+    return pps;
+}
+
+void run_benchmark() {
+    _test_case.begin("benchmark (recvfrom, recvmmsg)");
+
+    const size_t sent = 100000;
+    uint16 batches[] = {1, 32};
+    for (auto batch : batches) {
+        size_t received = 0;
+        double pps = bench_pps(batch, sent, &received);
+        _logger->writeln("batch %2i %s received %zi/%zi %12.0f pps", batch, (1 == batch) ? "recvfrom" : "recvmmsg", received, sent, pps);
+        _test_case.assert(received > 0, __FUNCTION__, "batch %i", batch);
+    }
+
+    object_pool_stat_t object;
+    object_pool_stat_t slab;
+    network_stream_data::get_pool_stat(&object, &slab);
+    _logger->writeln("network_stream_data pool hit %I64u miss %I64u, slab hit %I64u miss %I64u", object.hit, object.miss, slab.hit, slab.miss);
+}
@@ -25,6 +25,7 @@ int main(int argc, char** argv) {
                 << t_cmdarg_t<OPTION>("-d", "debug/trace", [](OPTION& o, char* param) -> void { o.debug = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-l", "log", [](OPTION& o, char* param) -> void { o.log = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-t", "log time", [](OPTION& o, char* param) -> void { o.time = 1; }).optional()
+                << t_cmdarg_t<OPTION>("-b", "benchmark (pps)", [](OPTION& o, char* param) -> void { o.benchmark = 1; }).optional()
                 << t_cmdarg_t<OPTION>("-p", "port (9000)", [](OPTION& o, char* param) -> void { o.port = atoi(param); }).optional().preced();
     _cmdline->parse(argc, argv);
 
@@ -51,7 +52,11 @@ int main(int argc, char** argv) {
 #endif
     openssl_startup();
 
-    run_server();
+    if (option.benchmark) {
+        run_benchmark();
+    } else {
+        run_server();
+    }
 
     openssl_cleanup();
 
@@ -16,9 +16,10 @@ typedef struct _OPTION {
     int debug;
     int log;
     int time;
+    int benchmark;
     uint16 port;
 
-    _OPTION() : verbose(0), debug(0), log(0), time(0), port(9000) {
+    _OPTION() : verbose(0), debug(0), log(0), time(0), benchmark(0), port(9000) {
         // do nothing
     }
 } OPTION;
@@ -28,5 +29,6 @@ extern t_shared_instance<logger> _logger;
 extern t_shared_instance<t_cmdline_t<OPTION> > _cmdline;
 
 void run_server();
+void run_benchmark();
 
 #endif